@@ -0,0 +1,211 @@
+#include "Utils.h"
+
+#include <GameCore/SpaceFillingCurves.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+//
+// Compares the spring forces loop over a ship-like lattice, whose points and springs
+// are laid out in the different orders available to the ship builder
+//
+
+static constexpr int LatticeWidth = 1000;
+static constexpr int LatticeHeight = 300;
+
+struct LatticePoint
+{
+    int X;
+    int Y;
+};
+
+enum class LatticeOrder
+{
+    Stripes,
+    Morton,
+    Hilbert
+};
+
+// Makes the points of a hull-shaped lattice, together with their springs
+static void MakeLattice(
+    std::vector<LatticePoint> & points,
+    std::vector<SpringEndpoints> & springs)
+{
+    std::vector<std::vector<ElementIndex>> matrix(LatticeWidth, std::vector<ElementIndex>(LatticeHeight, NoneElementIndex));
+
+    // Columns from left to right, each from bottom to top, like the ship builder does
+    for (int x = 0; x < LatticeWidth; ++x)
+    {
+        int const bottom = std::abs(x - LatticeWidth / 2) * LatticeHeight / LatticeWidth;
+        for (int y = bottom; y < LatticeHeight; ++y)
+        {
+            matrix[x][y] = static_cast<ElementIndex>(points.size());
+            points.push_back({ x, y });
+        }
+    }
+
+    for (int y = LatticeHeight - 1; y >= 0; --y)
+    {
+        for (int x = 0; x < LatticeWidth; ++x)
+        {
+            if (matrix[x][y] == NoneElementIndex)
+                continue;
+
+            auto const connect = [&](int x2, int y2)
+            {
+                if (x2 >= 0 && x2 < LatticeWidth && y2 >= 0 && y2 < LatticeHeight && matrix[x2][y2] != NoneElementIndex)
+                    springs.push_back({ matrix[x][y], matrix[x2][y2] });
+            };
+
+            connect(x + 1, y);
+            connect(x + 1, y - 1);
+            connect(x, y - 1);
+            connect(x - 1, y - 1);
+        }
+    }
+}
+
+static std::vector<ElementIndex> MakeStripesRemap(std::vector<LatticePoint> const & points)
+{
+    // Vertical stripes two columns wide and four rows high, from left to right,
+    // stripes from top to bottom, overlapping by one row
+    std::vector<std::tuple<int, int, int, ElementIndex>> keys;
+    for (ElementIndex p = 0; p < points.size(); ++p)
+    {
+        int const stripe = (LatticeHeight - 1 - points[p].Y) / 3;
+        keys.emplace_back(stripe, points[p].X / 2, LatticeHeight - points[p].Y, p);
+    }
+
+    std::sort(keys.begin(), keys.end());
+
+    std::vector<ElementIndex> remap(points.size());
+    for (ElementIndex i = 0; i < keys.size(); ++i)
+    {
+        remap[std::get<3>(keys[i])] = i;
+    }
+
+    return remap;
+}
+
+static std::vector<ElementIndex> MakeCurveRemap(
+    std::vector<LatticePoint> const & points,
+    LatticeOrder order)
+{
+    int const hilbertOrder = SpaceFillingCurves::HilbertOrder(std::max(LatticeWidth, LatticeHeight));
+
+    std::vector<std::tuple<std::uint32_t, ElementIndex>> keys;
+    for (ElementIndex p = 0; p < points.size(); ++p)
+    {
+        std::uint32_t const key = (order == LatticeOrder::Morton)
+            ? SpaceFillingCurves::MortonKey(static_cast<std::uint16_t>(points[p].X), static_cast<std::uint16_t>(points[p].Y))
+            : SpaceFillingCurves::HilbertKey(points[p].X, points[p].Y, hilbertOrder);
+
+        keys.emplace_back(key, p);
+    }
+
+    std::sort(keys.begin(), keys.end());
+
+    std::vector<ElementIndex> remap(points.size());
+    for (ElementIndex i = 0; i < keys.size(); ++i)
+    {
+        remap[std::get<1>(keys[i])] = i;
+    }
+
+    return remap;
+}
+
+static void UpdateSpringForces_Reordered(
+    benchmark::State & state,
+    LatticeOrder order)
+{
+    std::vector<LatticePoint> latticePoints;
+    std::vector<SpringEndpoints> latticeSprings;
+    MakeLattice(latticePoints, latticeSprings);
+
+    auto const remap = (order == LatticeOrder::Stripes)
+        ? MakeStripesRemap(latticePoints)
+        : MakeCurveRemap(latticePoints, order);
+
+    std::vector<vec2f> pointsPosition(latticePoints.size());
+    std::vector<vec2f> pointsVelocity(latticePoints.size(), vec2f(0.1f, 0.2f));
+    std::vector<vec2f> pointsForce(latticePoints.size(), vec2f::zero());
+    for (ElementIndex p = 0; p < latticePoints.size(); ++p)
+    {
+        pointsPosition[remap[p]] = vec2f(static_cast<float>(latticePoints[p].X), static_cast<float>(latticePoints[p].Y));
+    }
+
+    // Springs sorted by their lowest endpoint
+    std::vector<SpringEndpoints> springsEndpoints;
+    for (auto const & s : latticeSprings)
+    {
+        springsEndpoints.push_back({
+            std::min(remap[s.PointAIndex], remap[s.PointBIndex]),
+            std::max(remap[s.PointAIndex], remap[s.PointBIndex]) });
+    }
+
+    if (order != LatticeOrder::Stripes)
+    {
+        std::sort(
+            springsEndpoints.begin(),
+            springsEndpoints.end(),
+            [](SpringEndpoints const & s1, SpringEndpoints const & s2)
+            {
+                return std::tie(s1.PointAIndex, s1.PointBIndex) < std::tie(s2.PointAIndex, s2.PointBIndex);
+            });
+    }
+
+    std::vector<float> springsStiffnessCoefficient(springsEndpoints.size(), 0.5f);
+    std::vector<float> springsDamperCoefficient(springsEndpoints.size(), 0.1f);
+    std::vector<float> springsRestLength(springsEndpoints.size(), 1.0f);
+
+    for (auto _ : state)
+    {
+        for (size_t springIndex = 0; springIndex < springsEndpoints.size(); ++springIndex)
+        {
+            auto const pointAIndex = springsEndpoints[springIndex].PointAIndex;
+            auto const pointBIndex = springsEndpoints[springIndex].PointBIndex;
+
+            vec2f const displacement = pointsPosition[pointBIndex] - pointsPosition[pointAIndex];
+            float const displacementLength = displacement.length();
+            vec2f const springDir = displacement.normalise(displacementLength);
+
+            vec2f const fSpringA =
+                springDir
+                * (displacementLength - springsRestLength[springIndex])
+                * springsStiffnessCoefficient[springIndex];
+
+            vec2f const relVelocity = pointsVelocity[pointBIndex] - pointsVelocity[pointAIndex];
+            vec2f const fDampA =
+                springDir
+                * relVelocity.dot(springDir)
+                * springsDamperCoefficient[springIndex];
+
+            pointsForce[pointAIndex] += fSpringA + fDampA;
+            pointsForce[pointBIndex] -= fSpringA + fDampA;
+        }
+    }
+
+    benchmark::DoNotOptimize(pointsForce);
+}
+
+static void PointReordering_Stripes(benchmark::State & state)
+{
+    UpdateSpringForces_Reordered(state, LatticeOrder::Stripes);
+}
+BENCHMARK(PointReordering_Stripes);
+
+static void PointReordering_Morton(benchmark::State & state)
+{
+    UpdateSpringForces_Reordered(state, LatticeOrder::Morton);
+}
+BENCHMARK(PointReordering_Morton);
+
+static void PointReordering_Hilbert(benchmark::State & state)
+{
+    UpdateSpringForces_Reordered(state, LatticeOrder::Hilbert);
+}
+BENCHMARK(PointReordering_Hilbert);
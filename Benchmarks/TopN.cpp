@@ -2,6 +2,7 @@
 
 #include <GameCore/BoundedVector.h>
 #include <GameCore/TemporallyCoherentPriorityQueue.h>
+#include <GameCore/TopNSelector.h>
 #include <GameCore/TruncatedPriorityQueue.h>
 
 #include <benchmark/benchmark.h>
@@ -235,4 +236,28 @@ static void TopN_10TruncatedPriorityQueue_Emplace(benchmark::State& state)
         benchmark::DoNotOptimize(const_cast<TruncatedPriorityQueue<float> const &>(results));
     }
 }
-BENCHMARK(TopN_10TruncatedPriorityQueue_Emplace)->Arg(20)->Arg(100)->Arg(1000)->Arg(5000);
\ No newline at end of file
+BENCHMARK(TopN_10TruncatedPriorityQueue_Emplace)->Arg(20)->Arg(100)->Arg(1000)->Arg(5000);
+
+
+static void TopN_10TopNSelector_EmplaceAndFinalize(benchmark::State& state)
+{
+    auto vals = MakeFloats(Size);
+    size_t v = 0;
+
+    TopNSelector<float> results(10);
+
+    for (auto _ : state)
+    {
+        results.clear();
+
+        for (int64_t i = 0; i < state.range(0); ++i, ++v)
+        {
+            results.emplace(static_cast<ElementIndex>(i), vals[v % Size]);
+        }
+
+        results.finalize();
+
+        benchmark::DoNotOptimize(const_cast<TopNSelector<float> const &>(results));
+    }
+}
+BENCHMARK(TopN_10TopNSelector_EmplaceAndFinalize)->Arg(20)->Arg(100)->Arg(1000)->Arg(5000);
\ No newline at end of file
@@ -7,7 +7,7 @@
 
 // Inputs
 in vec4 inShipPointAttributeGroup1; // Position, TextureCoordinates
-in vec4 inShipPointAttributeGroup2; // Light, Water, PlaneId, Decay
+in float inShipPointPlaneId;
 
 // Outputs        
 out vec2 vertexTextureCoords;
@@ -18,7 +18,7 @@ uniform mat4 paramOrthoMatrix;
 void main()
 {
     vertexTextureCoords = inShipPointAttributeGroup1.xy; 
-    gl_Position = paramOrthoMatrix * vec4(inShipPointAttributeGroup1.xy, inShipPointAttributeGroup2.z, 1.0);
+    gl_Position = paramOrthoMatrix * vec4(inShipPointAttributeGroup1.xy, inShipPointPlaneId, 1.0);
 }
 
 ###FRAGMENT
@@ -2478,6 +2478,46 @@ void SettingsDialog::PopulateWindAndWavesPanel(wxPanel * panel)
                     CellBorder);
             }
 
+            // Displace ocean surface with ships
+            {
+                mDisplaceOceanSurfaceWithShipsCheckBox = new wxCheckBox(abnormalWavesBox, wxID_ANY, _("Ship Wakes"));
+                mDisplaceOceanSurfaceWithShipsCheckBox->SetToolTip(_("Enables or disables generation of wakes and bow waves by ships moving through the water."));
+                mDisplaceOceanSurfaceWithShipsCheckBox->Bind(
+                    wxEVT_COMMAND_CHECKBOX_CLICKED,
+                    [this](wxCommandEvent & event)
+                    {
+                        mLiveSettings.SetValue(GameSettings::DoDisplaceOceanSurfaceWithShips, event.IsChecked());
+                        OnLiveSettingsChanged();
+                    });
+
+                abnormalWavesSizer->Add(
+                    mDisplaceOceanSurfaceWithShipsCheckBox,
+                    wxGBPosition(1, 0),
+                    wxGBSpan(1, 1),
+                    wxALL | wxALIGN_CENTER_VERTICAL,
+                    CellBorder);
+            }
+
+            // Refine ocean surface around camera
+            {
+                mRefineOceanSurfaceAroundCameraCheckBox = new wxCheckBox(abnormalWavesBox, wxID_ANY, _("Detailed Waves"));
+                mRefineOceanSurfaceAroundCameraCheckBox->SetToolTip(_("Enables or disables simulation of waves at a higher resolution around the center of the view."));
+                mRefineOceanSurfaceAroundCameraCheckBox->Bind(
+                    wxEVT_COMMAND_CHECKBOX_CLICKED,
+                    [this](wxCommandEvent & event)
+                    {
+                        mLiveSettings.SetValue(GameSettings::DoRefineOceanSurfaceAroundCamera, event.IsChecked());
+                        OnLiveSettingsChanged();
+                    });
+
+                abnormalWavesSizer->Add(
+                    mRefineOceanSurfaceAroundCameraCheckBox,
+                    wxGBPosition(1, 1),
+                    wxGBSpan(1, 1),
+                    wxALL | wxALIGN_CENTER_VERTICAL,
+                    CellBorder);
+            }
+
             abnormalWavesBoxSizer->Add(abnormalWavesSizer, 0, wxALL, StaticBoxInsetMargin);
         }
 
@@ -4224,6 +4264,8 @@ void SettingsDialog::SyncControlsWithSettings(Settings<GameSettings> const & set
     mTsunamiRateSlider->SetValue(settings.GetValue<std::chrono::minutes>(GameSettings::TsunamiRate).count());
 
     mRogueWaveRateSlider->SetValue(settings.GetValue<std::chrono::minutes>(GameSettings::RogueWaveRate).count());
+    mDisplaceOceanSurfaceWithShipsCheckBox->SetValue(settings.GetValue<bool>(GameSettings::DoDisplaceOceanSurfaceWithShips));
+    mRefineOceanSurfaceAroundCameraCheckBox->SetValue(settings.GetValue<bool>(GameSettings::DoRefineOceanSurfaceAroundCamera));
 
     // Interactions
 
@@ -136,6 +136,8 @@ private:
     SliderControl<float> * mBasalWaveSpeedAdjustmentSlider;
     SliderControl<std::chrono::minutes::rep> * mTsunamiRateSlider;
     SliderControl<std::chrono::minutes::rep> * mRogueWaveRateSlider;
+    wxCheckBox * mDisplaceOceanSurfaceWithShipsCheckBox;
+    wxCheckBox * mRefineOceanSurfaceAroundCameraCheckBox;
 
     // Interactions
     SliderControl<float> * mDestroyRadiusSlider;
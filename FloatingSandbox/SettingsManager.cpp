@@ -113,6 +113,8 @@ BaseSettingsManager<GameSettings>::BaseSettingsManagerFactory SettingsManager::M
     ADD_GC_SETTING(bool, DoGenerateAirBubbles);
     ADD_GC_SETTING(float, AirBubblesDensity);
     ADD_GC_SETTING(bool, DoDisplaceOceanSurfaceAtAirBubblesSurfacing);
+    ADD_GC_SETTING(bool, DoDisplaceOceanSurfaceWithShips);
+    ADD_GC_SETTING(bool, DoRefineOceanSurfaceAroundCamera);
     ADD_GC_SETTING(bool, DoGenerateEngineWakeParticles);
     ADD_GC_SETTING(unsigned int, NumberOfStars);
     ADD_GC_SETTING(unsigned int, NumberOfClouds);
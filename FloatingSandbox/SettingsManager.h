@@ -86,6 +86,8 @@ enum class GameSettings : size_t
     DoGenerateAirBubbles,
     AirBubblesDensity,
     DoDisplaceOceanSurfaceAtAirBubblesSurfacing,
+    DoDisplaceOceanSurfaceWithShips,
+    DoRefineOceanSurfaceAroundCamera,
     DoGenerateEngineWakeParticles,
     NumberOfStars,
     NumberOfClouds,
@@ -11,6 +11,8 @@
 
 #include <GameCore/Utils.h>
 
+#include <algorithm>
+
 UIPreferencesManager::UIPreferencesManager(
     std::shared_ptr<IGameController> gameController,
     LocalizationManager & localizationManager,
@@ -232,6 +234,32 @@ void UIPreferencesManager::LoadPreferences()
             mGameController->SetDoShowTsunamiNotifications(showTsunamiNotificationsIt->second.get<bool>());
         }
 
+        //
+        // Telemetry export target
+        //
+
+        if (auto telemetryExportTargetIt = preferencesRootObject->find("telemetry_export_target");
+            telemetryExportTargetIt != preferencesRootObject->end() && telemetryExportTargetIt->second.is<std::string>())
+        {
+            mGameController->SetTelemetryExportTarget(telemetryExportTargetIt->second.get<std::string>());
+        }
+
+        //
+        // Task threads
+        //
+
+        if (auto taskThreadCountIt = preferencesRootObject->find("task_thread_count");
+            taskThreadCountIt != preferencesRootObject->end() && taskThreadCountIt->second.is<std::int64_t>())
+        {
+            mGameController->SetTaskThreadCount(static_cast<size_t>(std::max(std::int64_t(0), taskThreadCountIt->second.get<std::int64_t>())));
+        }
+
+        if (auto doPinTaskThreadsIt = preferencesRootObject->find("do_pin_task_threads");
+            doPinTaskThreadsIt != preferencesRootObject->end() && doPinTaskThreadsIt->second.is<bool>())
+        {
+            mGameController->SetDoPinTaskThreads(doPinTaskThreadsIt->second.get<bool>());
+        }
+
         //
         // Ship auto-texturization default settings
         //
@@ -432,6 +460,13 @@ void UIPreferencesManager::SavePreferences() const
     // Add show tsunami notification
     preferencesRootObject["show_tsunami_notifications"] = picojson::value(mGameController->GetDoShowTsunamiNotifications());
 
+    // Add telemetry export target
+    preferencesRootObject["telemetry_export_target"] = picojson::value(mGameController->GetTelemetryExportTarget());
+
+    // Add task threads
+    preferencesRootObject["task_thread_count"] = picojson::value(static_cast<std::int64_t>(mGameController->GetTaskThreadCount()));
+    preferencesRootObject["do_pin_task_threads"] = picojson::value(mGameController->GetDoPinTaskThreads());
+
     // Add ship auto-texturization default settings
     preferencesRootObject["ship_auto_texturization_default_settings"] = picojson::value(mGameController->GetShipAutoTexturizationDefaultSettings().ToJSON());
 
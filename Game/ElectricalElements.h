@@ -380,36 +380,41 @@ public:
         ShipId shipId,
         World & parentWorld,
         std::shared_ptr<GameEventDispatcher> gameEventDispatcher,
-        GameParameters const & gameParameters)
+        GameParameters const & gameParameters,
+        BufferArena & bufferArena)
         : ElementContainer(allElementCount)
         //////////////////////////////////
         // Buffers
         //////////////////////////////////
-        , mIsDeletedBuffer(mBufferElementCount, mElementCount, true)
-        , mPointIndexBuffer(mBufferElementCount, mElementCount, NoneElementIndex)
-        , mMaterialBuffer(mBufferElementCount, mElementCount, nullptr)
-        , mMaterialTypeBuffer(mBufferElementCount, mElementCount, ElectricalMaterial::ElectricalElementType::Cable)
-        , mConductivityBuffer(mBufferElementCount, mElementCount, Conductivity(false))
-        , mMaterialHeatGeneratedBuffer(mBufferElementCount, mElementCount, 0.0f)
-        , mMaterialOperatingTemperaturesBuffer(mBufferElementCount, mElementCount, OperatingTemperatures(0.0f, 0.0f))
-        , mMaterialLuminiscenceBuffer(mBufferElementCount, mElementCount, 0.0f)
-        , mMaterialLightColorBuffer(mBufferElementCount, mElementCount, vec4f::zero())
-        , mMaterialLightSpreadBuffer(mBufferElementCount, mElementCount, 0.0f)
-        , mConnectedElectricalElementsBuffer(mBufferElementCount, mElementCount, FixedSizeVector<ElementIndex, GameParameters::MaxSpringsPerPoint>())
-        , mConductingConnectedElectricalElementsBuffer(mBufferElementCount, mElementCount, FixedSizeVector<ElementIndex, GameParameters::MaxSpringsPerPoint>())
-        , mElementStateBuffer(mBufferElementCount, mElementCount, ElementState::CableState())
-        , mAvailableLightBuffer(mBufferElementCount, mElementCount, 0.0f)
-        , mCurrentConnectivityVisitSequenceNumberBuffer(mBufferElementCount, mElementCount, SequenceNumber())
+        , mIsDeletedBuffer(mBufferElementCount, mElementCount, true, bufferArena, "ElectricalElements.IsDeleted")
+        , mPointIndexBuffer(mBufferElementCount, mElementCount, NoneElementIndex, bufferArena, "ElectricalElements.PointIndex")
+        , mMaterialBuffer(mBufferElementCount, mElementCount, nullptr, bufferArena, "ElectricalElements.Material")
+        , mMaterialTypeBuffer(mBufferElementCount, mElementCount, ElectricalMaterial::ElectricalElementType::Cable, bufferArena, "ElectricalElements.MaterialType")
+        , mConductivityBuffer(mBufferElementCount, mElementCount, Conductivity(false), bufferArena, "ElectricalElements.Conductivity")
+        , mMaterialHeatGeneratedBuffer(mBufferElementCount, mElementCount, 0.0f, bufferArena, "ElectricalElements.MaterialHeatGenerated")
+        , mMaterialOperatingTemperaturesBuffer(mBufferElementCount, mElementCount, OperatingTemperatures(0.0f, 0.0f), bufferArena, "ElectricalElements.MaterialOperatingTemperatures")
+        , mMaterialLuminiscenceBuffer(mBufferElementCount, mElementCount, 0.0f, bufferArena, "ElectricalElements.MaterialLuminiscence")
+        , mMaterialLightColorBuffer(mBufferElementCount, mElementCount, vec4f::zero(), bufferArena, "ElectricalElements.MaterialLightColor")
+        , mMaterialLightSpreadBuffer(mBufferElementCount, mElementCount, 0.0f, bufferArena, "ElectricalElements.MaterialLightSpread")
+        , mConnectedElectricalElementsBuffer(mBufferElementCount, mElementCount, FixedSizeVector<ElementIndex, GameParameters::MaxSpringsPerPoint>(), bufferArena, "ElectricalElements.ConnectedElectricalElements")
+        , mConductingConnectedElectricalElementsBuffer(mBufferElementCount, mElementCount, FixedSizeVector<ElementIndex, GameParameters::MaxSpringsPerPoint>(), bufferArena, "ElectricalElements.ConductingConnectedElectricalElements")
+        , mElementStateBuffer(mBufferElementCount, mElementCount, ElementState::CableState(), bufferArena, "ElectricalElements.ElementState")
+        , mAvailableLightBuffer(mBufferElementCount, mElementCount, 0.0f, bufferArena, "ElectricalElements.AvailableLight")
+        , mCurrentConnectivityVisitSequenceNumberBuffer(mBufferElementCount, mElementCount, SequenceNumber(), bufferArena, "ElectricalElements.CurrentConnectivityVisitSequenceNumber")
         , mInstanceInfos()
         //////////////////////////////////
         // Lamps
         //////////////////////////////////
         , mBufferLampCount(make_aligned_float_element_count(lampElementCount))
-        , mLampRawDistanceCoefficientBuffer(mBufferLampCount, lampElementCount, 0.0f)
-        , mLampLightSpreadMaxDistanceBuffer(mBufferLampCount, lampElementCount, 0.0f)
-        , mLampPositionWorkBuffer(mBufferLampCount, lampElementCount, vec2f::zero())
-        , mLampPlaneIdWorkBuffer(mBufferLampCount, lampElementCount, 0)
-        , mLampDistanceCoefficientWorkBuffer(mBufferLampCount, lampElementCount, 0.0f)
+        , mLampRawDistanceCoefficientBuffer(mBufferLampCount, lampElementCount, 0.0f, bufferArena, "ElectricalElements.LampRawDistanceCoefficient")
+        , mLampLightSpreadMaxDistanceBuffer(mBufferLampCount, lampElementCount, 0.0f, bufferArena, "ElectricalElements.LampLightSpreadMaxDistance")
+        , mLampPositionWorkBuffer(mBufferLampCount, lampElementCount, vec2f::zero(), bufferArena, "ElectricalElements.LampPositionWork")
+        , mLampPlaneIdWorkBuffer(mBufferLampCount, lampElementCount, 0, bufferArena, "ElectricalElements.LampPlaneIdWork")
+        , mLampDistanceCoefficientWorkBuffer(mBufferLampCount, lampElementCount, 0.0f, bufferArena, "ElectricalElements.LampDistanceCoefficientWork")
+        , mTileLampPositionWorkBuffer(mBufferLampCount, lampElementCount, vec2f::zero(), bufferArena, "ElectricalElements.TileLampPositionWork")
+        , mTileLampPlaneIdWorkBuffer(mBufferLampCount, lampElementCount, 0, bufferArena, "ElectricalElements.TileLampPlaneIdWork")
+        , mTileLampDistanceCoefficientWorkBuffer(mBufferLampCount, lampElementCount, 0.0f, bufferArena, "ElectricalElements.TileLampDistanceCoefficientWork")
+        , mTileLampLightSpreadMaxDistanceWorkBuffer(mBufferLampCount, lampElementCount, 0.0f, bufferArena, "ElectricalElements.TileLampLightSpreadMaxDistanceWork")
         //////////////////////////////////
         // Container
         //////////////////////////////////
@@ -431,6 +436,44 @@ public:
 
     ElectricalElements(ElectricalElements && other) = default;
 
+    /*
+     * The number of bytes that the buffers of the specified number of electrical elements,
+     * of which the specified number are lamps, take from the ship's buffer arena.
+     */
+    static size_t CalculateBufferArenaByteSize(
+        ElementCount allElementCount,
+        ElementCount lampElementCount)
+    {
+        return CalculateArenaByteSize<
+            decltype(mIsDeletedBuffer),
+            decltype(mPointIndexBuffer),
+            decltype(mMaterialBuffer),
+            decltype(mMaterialTypeBuffer),
+            decltype(mConductivityBuffer),
+            decltype(mMaterialHeatGeneratedBuffer),
+            decltype(mMaterialOperatingTemperaturesBuffer),
+            decltype(mMaterialLuminiscenceBuffer),
+            decltype(mMaterialLightColorBuffer),
+            decltype(mMaterialLightSpreadBuffer),
+            decltype(mConnectedElectricalElementsBuffer),
+            decltype(mConductingConnectedElectricalElementsBuffer),
+            decltype(mElementStateBuffer),
+            decltype(mAvailableLightBuffer),
+            decltype(mCurrentConnectivityVisitSequenceNumberBuffer)
+        >(CalculateBufferElementCount(allElementCount))
+        + CalculateArenaByteSize<
+            decltype(mLampRawDistanceCoefficientBuffer),
+            decltype(mLampLightSpreadMaxDistanceBuffer),
+            decltype(mLampPositionWorkBuffer),
+            decltype(mLampPlaneIdWorkBuffer),
+            decltype(mLampDistanceCoefficientWorkBuffer),
+            decltype(mTileLampPositionWorkBuffer),
+            decltype(mTileLampPlaneIdWorkBuffer),
+            decltype(mTileLampDistanceCoefficientWorkBuffer),
+            decltype(mTileLampLightSpreadMaxDistanceWorkBuffer)
+        >(make_aligned_float_element_count(lampElementCount));
+    }
+
     /*
      * Returns an iterator for the lamp elements only.
      */
@@ -679,6 +722,32 @@ public:
         return mLampDistanceCoefficientWorkBuffer;
     }
 
+    /*
+     * Gets work buffers for gathering the data of the subset of the lamps
+     * that may light a tile of points.
+     *
+     * Size is BufferLampCount, padded to vectorization float count.
+     */
+    Buffer<vec2f> & GetTileLampPositionWorkBuffer()
+    {
+        return mTileLampPositionWorkBuffer;
+    }
+
+    Buffer<PlaneId> & GetTileLampPlaneIdWorkBuffer()
+    {
+        return mTileLampPlaneIdWorkBuffer;
+    }
+
+    Buffer<float> & GetTileLampDistanceCoefficientWorkBuffer()
+    {
+        return mTileLampDistanceCoefficientWorkBuffer;
+    }
+
+    Buffer<float> & GetTileLampLightSpreadMaxDistanceWorkBuffer()
+    {
+        return mTileLampLightSpreadMaxDistanceWorkBuffer;
+    }
+
 private:
 
     void InternalSetSwitchState(
@@ -779,6 +848,10 @@ private:
     Buffer<vec2f> mLampPositionWorkBuffer;
     Buffer<PlaneId> mLampPlaneIdWorkBuffer;
     Buffer<float> mLampDistanceCoefficientWorkBuffer;
+    Buffer<vec2f> mTileLampPositionWorkBuffer;
+    Buffer<PlaneId> mTileLampPlaneIdWorkBuffer;
+    Buffer<float> mTileLampDistanceCoefficientWorkBuffer;
+    Buffer<float> mTileLampLightSpreadMaxDistanceWorkBuffer;
 
     //////////////////////////////////////////////////////////
     // Container
@@ -28,12 +28,17 @@ std::unique_ptr<GameController> GameController::Create(
     // Create perf stats
     std::unique_ptr<PerfStats> perfStats = std::make_unique<PerfStats>();
 
+    // Create the thread pool shared by the simulation and the rendering,
+    // which lives as long as we do
+    auto taskThreadPool = std::make_shared<TaskThreadPool>();
+
     // Create render context
     std::unique_ptr<Render::RenderContext> renderContext = std::make_unique<Render::RenderContext>(
         initialCanvasSize,
         std::move(makeRenderContextCurrentFunction),
         std::move(swapRenderBuffersFunction),
         *perfStats,
+        taskThreadPool,
         resourceLocator,
         [&progressCallback](float progress, ProgressMessageType message)
         {
@@ -49,6 +54,7 @@ std::unique_ptr<GameController> GameController::Create(
             std::move(renderContext),
             std::move(gameEventDispatcher),
             std::move(perfStats),
+            std::move(taskThreadPool),
             std::move(materialDatabase),
             resourceLocator));
 }
@@ -57,6 +63,7 @@ GameController::GameController(
     std::unique_ptr<Render::RenderContext> renderContext,
     std::shared_ptr<GameEventDispatcher> gameEventDispatcher,
     std::unique_ptr<PerfStats> perfStats,
+    std::shared_ptr<TaskThreadPool> taskThreadPool,
     MaterialDatabase materialDatabase,
     ResourceLocator const & resourceLocator)
     // State machines
@@ -74,6 +81,8 @@ GameController::GameController(
     , mDoDrawHeatBlasterFlame(true)
     , mDoAutoZoomOnShipLoad(true)
     // Doers
+    , mTaskThreadPool(std::move(taskThreadPool))
+    , mTaskThreadCount(0)
     , mRenderContext(std::move(renderContext))
     , mGameEventDispatcher(std::move(gameEventDispatcher))
     , mNotificationLayer(
@@ -84,7 +93,7 @@ GameController::GameController(
     , mWorld(new Physics::World(
         OceanFloorTerrain::LoadFromImage(resourceLocator.GetDefaultOceanFloorTerrainFilePath()),
         mGameEventDispatcher,
-        std::make_shared<TaskThreadPool>(),
+        mTaskThreadPool,
         mGameParameters))
     , mMaterialDatabase(std::move(materialDatabase))
     // Smoothing
@@ -100,6 +109,19 @@ GameController::GameController(
     , mTotalFrameCount(0u)
     , mLastPublishedTotalFrameCount(0u)
     , mSkippedFirstStatPublishes(0)
+    , mTelemetryExporter(mTaskThreadPool)
+    // Simulation thread
+    , mWorldLock()
+    , mSimulationThreadSignal()
+    , mWorldLockWaiterCount(0)
+    , mSimulationGameParameters(mGameParameters)
+    , mSimulationCameraWorldPosition(mRenderContext->GetCameraWorldPosition())
+    , mSimulationVectorFieldRenderMode(mRenderContext->GetVectorFieldRenderMode())
+    , mSimulationStepCount(0u)
+    , mLastIterationSimulationStepCount(0u)
+    , mSimulationException()
+    , mIsSimulationThreadStop(false)
+    , mSimulationThread()
 {
     // Verify materials' textures
     mShipTexturizer.VerifyMaterialDatabase(mMaterialDatabase);
@@ -231,6 +253,30 @@ GameController::GameController(
             return this->mRenderContext->ClampCameraWorldPosition(value);
         },
         ControlParameterSmoothingTrajectoryTime);
+
+    //
+    // Start simulation
+    //
+
+    mSimulationThread = std::thread(
+        [this]()
+        {
+            RunSimulationThread();
+        });
+}
+
+GameController::~GameController()
+{
+    // Stop the simulation thread before anything it uses goes away
+    {
+        std::lock_guard<std::mutex> const lock{ mWorldLock };
+
+        mIsSimulationThreadStop = true;
+    }
+
+    mSimulationThreadSignal.notify_all();
+
+    mSimulationThread.join();
 }
 
 void GameController::RebindOpenGLContext(std::function<void()> rebindContextFunction)
@@ -248,6 +294,8 @@ ShipMetadata GameController::ResetAndLoadFallbackShip(ResourceLocator const & re
 
 ShipMetadata GameController::ResetAndLoadShip(std::filesystem::path const & shipDefinitionFilepath)
 {
+    auto const lock = LockWorld();
+
     assert(!!mWorld);
 
     // Load ship definition
@@ -264,7 +312,7 @@ ShipMetadata GameController::ResetAndLoadShip(std::filesystem::path const & ship
     auto newWorld = std::make_unique<Physics::World>(
         OceanFloorTerrain(mWorld->GetOceanFloorTerrain()),
         mGameEventDispatcher,
-        std::make_shared<TaskThreadPool>(),
+        mTaskThreadPool,
         mGameParameters);
 
     // Add ship to new world
@@ -315,6 +363,8 @@ ShipMetadata GameController::AddFallbackShip(ResourceLocator const & resourceLoc
 
 ShipMetadata GameController::AddShip(std::filesystem::path const & shipDefinitionFilepath)
 {
+    auto const lock = LockWorld();
+
     // Load ship definition
     auto shipDefinition = ShipDefinition::Load(shipDefinitionFilepath);
 
@@ -348,6 +398,8 @@ ShipMetadata GameController::AddShip(std::filesystem::path const & shipDefinitio
 
 void GameController::ReloadLastShip()
 {
+    auto const lock = LockWorld();
+
     assert(!!mWorld);
 
     if (mLastShipLoadedFilepath.empty())
@@ -369,7 +421,7 @@ void GameController::ReloadLastShip()
     auto newWorld = std::make_unique<Physics::World>(
         OceanFloorTerrain(mWorld->GetOceanFloorTerrain()),
         mGameEventDispatcher,
-        std::make_shared<TaskThreadPool>(),
+        mTaskThreadPool,
         mGameParameters);
 
     // Load ship into new world
@@ -421,106 +473,112 @@ void GameController::RunGameIteration()
     }
 
     ////////////////////////////////////////////////////////////////////////////
-    // Update
+    // Render Upload
     ////////////////////////////////////////////////////////////////////////////
 
-    // Decide whether we are going to run a simulation update
-    bool const doUpdate = ((!mIsPaused || mIsPulseUpdateSet) && !mIsMoveToolEngaged);
-
-    // Clear pulse
-    mIsPulseUpdateSet = false;
+    // Tell RenderContext we're starting a new rendering cycle
+    mRenderContext->RenderStart();
 
-    if (doUpdate)
     {
-        auto const startTime = GameChronometer::now();
-
-        // Tell RenderContext we're starting an update
-        mRenderContext->UpdateStart();
+        // Wait for the previous draw without holding the world lock,
+        // so that the simulation keeps going in the meantime
+        mRenderContext->UploadStart();
 
         auto const netStartTime = GameChronometer::now();
 
         float const nowGame = GameWallClock::GetInstance().NowAsFloat();
 
-        //
-        // Update parameter smoothers
-        //
+        // Smooth render controls
+        // Note: some Upload()'s need to use ViewModel values, which have then to match the
+        // ViewModel values used by the subsequent render
+        {
+            float const nowReal = GameWallClock::GetInstance().ContinuousNowAsFloat(); // Real wall clock, unpaused
+            mZoomParameterSmoother->Update(nowReal);
+            mCameraWorldPositionParameterSmoother->Update(nowReal);
+        }
 
-        std::for_each(
-            mFloatParameterSmoothers.begin(),
-            mFloatParameterSmoothers.end(),
-            [nowGame](auto & ps)
-            {
-                ps.Update(nowGame);
-            });
+        // The simulation thread only changes these under the world lock,
+        // and we're the only ones changing them otherwise
+        bool const isSimulationRunning = (!mIsPaused && !mIsMoveToolEngaged);
 
         //
-        // Update world
+        // Upload ship point positions from the snapshots published by the
+        // simulation thread; this doesn't need the world
         //
 
         assert(!!mWorld);
-        mWorld->Update(
-            mGameParameters,
-            *mRenderContext,
-            *mTotalPerfStats);
+        mWorld->RenderUploadShipPointPositions(
+            isSimulationRunning, // Interpolate between steps only while they keep coming
+            *mRenderContext);
 
-        // Flush events
-        mGameEventDispatcher->Flush();
+        {
+            auto const lock = LockWorld();
 
-        //
-        // Update misc
-        //
+            if (mSimulationException)
+            {
+                std::rethrow_exception(mSimulationException);
+            }
 
-        // Update state machines
-        UpdateStateMachines(mWorld->GetCurrentSimulationTime());
+            //
+            // Update parameter smoothers, and hand our inputs over to the simulation
+            //
 
-        // Update notification layer
-        mNotificationLayer.Update(nowGame);
+            std::for_each(
+                mFloatParameterSmoothers.begin(),
+                mFloatParameterSmoothers.end(),
+                [nowGame](auto & ps)
+                {
+                    ps.Update(nowGame);
+                });
 
-        // Tell RenderContext we've finished an update
-        mRenderContext->UpdateEnd();
+            mSimulationGameParameters = mGameParameters;
+            mSimulationCameraWorldPosition = mRenderContext->GetCameraWorldPosition();
+            mSimulationVectorFieldRenderMode = mRenderContext->GetVectorFieldRenderMode();
 
-        mTotalPerfStats->TotalNetUpdateDuration.Update(GameChronometer::now() - netStartTime);
-        mTotalPerfStats->TotalUpdateDuration.Update(GameChronometer::now() - startTime);
-    }
+            // Flush events, including those fired by the simulation thread
+            mGameEventDispatcher->Flush();
 
-    ////////////////////////////////////////////////////////////////////////////
-    // Render Upload
-    ////////////////////////////////////////////////////////////////////////////
+            if (mSimulationStepCount != mLastIterationSimulationStepCount)
+            {
+                //
+                // Update misc
+                //
 
-    // Tell RenderContext we're starting a new rendering cycle
-    mRenderContext->RenderStart();
+                // Update state machines
+                UpdateStateMachines(mWorld->GetCurrentSimulationTime());
 
-    {
-        mRenderContext->UploadStart();
+                // Update notification layer
+                mNotificationLayer.Update(nowGame);
 
-        auto const netStartTime = GameChronometer::now();
+                mLastIterationSimulationStepCount = mSimulationStepCount;
+            }
 
-        // Smooth render controls
-        // Note: some Upload()'s need to use ViewModel values, which have then to match the
-        // ViewModel values used by the subsequent render
-        {
-            float const nowReal = GameWallClock::GetInstance().ContinuousNowAsFloat(); // Real wall clock, unpaused
-            mZoomParameterSmoother->Update(nowReal);
-            mCameraWorldPositionParameterSmoother->Update(nowReal);
-        }
+            if (!isSimulationRunning)
+            {
+                // Points might have been moved by interactions, and no steps
+                // are coming to publish them
+                mWorld->PublishRenderSnapshots();
+            }
 
-        //
-        // Upload world
-        //
+            //
+            // Upload world
+            //
 
-        assert(!!mWorld);
-        mWorld->RenderUpload(
-            mGameParameters,
-            *mRenderContext,
-            *mTotalPerfStats);
+            mWorld->RenderUpload(
+                mGameParameters,
+                *mRenderContext,
+                *mTotalPerfStats);
 
-        //
-        // Upload notification layer
-        //
+            //
+            // Upload notification layer
+            //
 
-        mNotificationLayer.RenderUpload(*mRenderContext);
+            mNotificationLayer.RenderUpload(*mRenderContext);
 
-        mRenderContext->UploadEnd();
+            // Still under the lock, so that the next simulation step waits
+            // for the asynchronous uploads of the world's buffers
+            mRenderContext->UploadEnd();
+        }
 
         mTotalPerfStats->TotalNetRenderUploadDuration.Update(GameChronometer::now() - netStartTime);
     }
@@ -548,6 +606,128 @@ void GameController::RunGameIteration()
     ++mTotalFrameCount;
 }
 
+void GameController::RunSimulationThread()
+{
+    auto constexpr StepDuration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<float>(GameParameters::SimulationStepTimeDuration<float>));
+
+    // The time at which the next step is due; the simulation advances in
+    // fixed steps, as many as the real time elapsed calls for
+    std::chrono::steady_clock::time_point nextStepTimestamp = std::chrono::steady_clock::now();
+
+    std::unique_lock<std::mutex> lock(mWorldLock);
+
+    while (!mIsSimulationThreadStop)
+    {
+        // Hand the world over to the main thread if it's waiting for it
+        if (mWorldLockWaiterCount > 0)
+        {
+            mSimulationThreadSignal.wait(
+                lock,
+                [this]()
+                {
+                    return mWorldLockWaiterCount == 0 || mIsSimulationThreadStop;
+                });
+
+            continue;
+        }
+
+        bool const doUpdate = ((!mIsPaused || mIsPulseUpdateSet) && !mIsMoveToolEngaged && !mSimulationException);
+        if (!doUpdate)
+        {
+            mSimulationThreadSignal.wait(lock);
+
+            // Don't catch up with the time we've not been simulating
+            nextStepTimestamp = std::chrono::steady_clock::now();
+
+            continue;
+        }
+
+        auto const now = std::chrono::steady_clock::now();
+
+        if (mIsPulseUpdateSet)
+        {
+            // A pulse is exactly one step
+            mIsPulseUpdateSet = false;
+            nextStepTimestamp = now + StepDuration;
+        }
+        else if (now < nextStepTimestamp)
+        {
+            mSimulationThreadSignal.wait_until(lock, nextStepTimestamp);
+
+            continue;
+        }
+        else
+        {
+            if (now - nextStepTimestamp > MaxSimulationStepsBacklog * StepDuration)
+            {
+                // We can't keep up; drop the time we can't catch up with, so to
+                // avoid spending more and more time catching up
+                nextStepTimestamp = now - MaxSimulationStepsBacklog * StepDuration;
+            }
+
+            nextStepTimestamp += StepDuration;
+        }
+
+        try
+        {
+            RunSimulationStep();
+        }
+        catch (...)
+        {
+            // Stop simulating, and let the main thread know at its next iteration
+            mSimulationException = std::current_exception();
+        }
+    }
+}
+
+void GameController::RunSimulationStep()
+{
+    // Invoked on the simulation thread, with the world lock held
+
+    auto const startTime = GameChronometer::now();
+
+    // Tell RenderContext we're starting an update
+    mRenderContext->UpdateStart();
+
+    auto const netStartTime = GameChronometer::now();
+
+    //
+    // Update world
+    //
+
+    assert(!!mWorld);
+    mWorld->Update(
+        mSimulationGameParameters,
+        mSimulationCameraWorldPosition,
+        mSimulationVectorFieldRenderMode,
+        *mTotalPerfStats);
+
+    ++mSimulationStepCount;
+
+    // Tell RenderContext we've finished an update
+    mRenderContext->UpdateEnd();
+
+    mTotalPerfStats->TotalNetUpdateDuration.Update(GameChronometer::now() - netStartTime);
+    mTotalPerfStats->TotalUpdateDuration.Update(GameChronometer::now() - startTime);
+}
+
+std::unique_lock<std::mutex> GameController::LockWorld() const
+{
+    // Let the simulation thread know we're waiting, so that it
+    // hands the world over to us at the end of its current step
+    ++mWorldLockWaiterCount;
+
+    std::unique_lock<std::mutex> lock(mWorldLock);
+
+    if (--mWorldLockWaiterCount == 0)
+    {
+        mSimulationThreadSignal.notify_all();
+    }
+
+    return lock;
+}
+
 void GameController::LowFrequencyUpdate()
 {
     std::chrono::steady_clock::time_point const nowReal = std::chrono::steady_clock::now();
@@ -584,18 +764,41 @@ void GameController::LowFrequencyUpdate()
 // Interactions
 /////////////////////////////////////////////////////////////
 
+void GameController::PulseUpdateAtNextGameIteration()
+{
+    {
+        auto const lock = LockWorld();
+
+        mIsPulseUpdateSet = true;
+    }
+
+    mSimulationThreadSignal.notify_all();
+}
+
 void GameController::SetPaused(bool isPaused)
 {
-    // Freeze time
-    GameWallClock::GetInstance().SetPaused(isPaused);
+    {
+        auto const lock = LockWorld();
+
+        // Freeze time
+        GameWallClock::GetInstance().SetPaused(isPaused);
 
-    // Change state
-    mIsPaused = isPaused;
+        // Change state
+        mIsPaused = isPaused;
+    }
+
+    mSimulationThreadSignal.notify_all();
 }
 
 void GameController::SetMoveToolEngaged(bool isEngaged)
 {
-    mIsMoveToolEngaged = isEngaged;
+    {
+        auto const lock = LockWorld();
+
+        mIsMoveToolEngaged = isEngaged;
+    }
+
+    mSimulationThreadSignal.notify_all();
 }
 
 void GameController::DisplaySettingsLoadedNotification()
@@ -632,6 +835,8 @@ void GameController::PickObjectToMove(
     vec2f const & screenCoordinates,
     std::optional<ElementId> & elementId)
 {
+    auto const lock = LockWorld();
+
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     // Apply action
@@ -644,6 +849,8 @@ void GameController::PickObjectToMove(
 
 std::optional<ElementId> GameController::PickObjectForPickAndPull(vec2f const & screenCoordinates)
 {
+    auto const lock = LockWorld();
+
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     // Apply action
@@ -657,6 +864,8 @@ void GameController::Pull(
     ElementId elementId,
     vec2f const & screenTarget)
 {
+    auto const lock = LockWorld();
+
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenTarget);
 
     // Apply action
@@ -671,6 +880,8 @@ void GameController::PickObjectToMove(
     vec2f const & screenCoordinates,
     std::optional<ShipId> & shipId)
 {
+    auto const lock = LockWorld();
+
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     // Apply action
@@ -687,6 +898,8 @@ void GameController::MoveBy(
     vec2f const & screenOffset,
     vec2f const & inertialScreenOffset)
 {
+    auto const lock = LockWorld();
+
     vec2f const worldOffset = mRenderContext->ScreenOffsetToWorldOffset(screenOffset);
     vec2f const inertialVelocity = mRenderContext->ScreenOffsetToWorldOffset(inertialScreenOffset);
 
@@ -710,6 +923,8 @@ void GameController::MoveBy(
     vec2f const & screenOffset,
     vec2f const & inertialScreenOffset)
 {
+    auto const lock = LockWorld();
+
     vec2f const worldOffset = mRenderContext->ScreenOffsetToWorldOffset(screenOffset);
     vec2f const inertialVelocity = mRenderContext->ScreenOffsetToWorldOffset(inertialScreenOffset);
 
@@ -734,6 +949,8 @@ void GameController::RotateBy(
     vec2f const & screenCenter,
     float inertialScreenDeltaY)
 {
+    auto const lock = LockWorld();
+
     float const angle =
         2.0f * Pi<float>
         / static_cast<float>(mRenderContext->GetCanvasHeight())
@@ -763,6 +980,8 @@ void GameController::RotateBy(
     vec2f const & screenCenter,
     float inertialScreenDeltaY)
 {
+    auto const lock = LockWorld();
+
     float const angle =
         2.0f * Pi<float>
         / static_cast<float>(mRenderContext->GetCanvasHeight())
@@ -789,6 +1008,8 @@ void GameController::DestroyAt(
     vec2f const & screenCoordinates,
     float radiusFraction)
 {
+    auto const lock = LockWorld();
+
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     // Apply action
@@ -805,6 +1026,8 @@ void GameController::RepairAt(
     RepairSessionId sessionId,
     RepairSessionStepId sessionStepId)
 {
+    auto const lock = LockWorld();
+
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     // Apply action
@@ -821,6 +1044,8 @@ void GameController::SawThrough(
     vec2f const & startScreenCoordinates,
     vec2f const & endScreenCoordinates)
 {
+    auto const lock = LockWorld();
+
     vec2f const startWorldCoordinates = mRenderContext->ScreenToWorld(startScreenCoordinates);
     vec2f const endWorldCoordinates = mRenderContext->ScreenToWorld(endScreenCoordinates);
 
@@ -836,6 +1061,8 @@ bool GameController::ApplyHeatBlasterAt(
     vec2f const & screenCoordinates,
     HeatBlasterActionType action)
 {
+    auto const lock = LockWorld();
+
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     // Calculate radius
@@ -868,6 +1095,8 @@ bool GameController::ApplyHeatBlasterAt(
 
 bool GameController::ExtinguishFireAt(vec2f const & screenCoordinates)
 {
+    auto const lock = LockWorld();
+
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     // Calculate radius
@@ -897,6 +1126,8 @@ void GameController::DrawTo(
     vec2f const & screenCoordinates,
     float strengthFraction)
 {
+    auto const lock = LockWorld();
+
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     // Apply action
@@ -911,6 +1142,8 @@ void GameController::SwirlAt(
     vec2f const & screenCoordinates,
     float strengthFraction)
 {
+    auto const lock = LockWorld();
+
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     // Apply action
@@ -923,6 +1156,8 @@ void GameController::SwirlAt(
 
 void GameController::TogglePinAt(vec2f const & screenCoordinates)
 {
+    auto const lock = LockWorld();
+
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     // Apply action
@@ -934,6 +1169,8 @@ void GameController::TogglePinAt(vec2f const & screenCoordinates)
 
 bool GameController::InjectBubblesAt(vec2f const & screenCoordinates)
 {
+    auto const lock = LockWorld();
+
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     // Apply action
@@ -947,6 +1184,8 @@ bool GameController::FloodAt(
     vec2f const & screenCoordinates,
     float waterQuantityMultiplier)
 {
+    auto const lock = LockWorld();
+
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     // Apply action
@@ -959,6 +1198,8 @@ bool GameController::FloodAt(
 
 void GameController::ToggleAntiMatterBombAt(vec2f const & screenCoordinates)
 {
+    auto const lock = LockWorld();
+
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     // Apply action
@@ -970,6 +1211,8 @@ void GameController::ToggleAntiMatterBombAt(vec2f const & screenCoordinates)
 
 void GameController::ToggleImpactBombAt(vec2f const & screenCoordinates)
 {
+    auto const lock = LockWorld();
+
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     // Apply action
@@ -981,6 +1224,8 @@ void GameController::ToggleImpactBombAt(vec2f const & screenCoordinates)
 
 void GameController::ToggleRCBombAt(vec2f const & screenCoordinates)
 {
+    auto const lock = LockWorld();
+
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     // Apply action
@@ -992,6 +1237,8 @@ void GameController::ToggleRCBombAt(vec2f const & screenCoordinates)
 
 void GameController::ToggleTimerBombAt(vec2f const & screenCoordinates)
 {
+    auto const lock = LockWorld();
+
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     // Apply action
@@ -1003,6 +1250,8 @@ void GameController::ToggleTimerBombAt(vec2f const & screenCoordinates)
 
 void GameController::DetonateRCBombs()
 {
+    auto const lock = LockWorld();
+
     // Apply action
     assert(!!mWorld);
     mWorld->DetonateRCBombs();
@@ -1010,6 +1259,8 @@ void GameController::DetonateRCBombs()
 
 void GameController::DetonateAntiMatterBombs()
 {
+    auto const lock = LockWorld();
+
     // Apply action
     assert(!!mWorld);
     mWorld->DetonateAntiMatterBombs();
@@ -1017,6 +1268,8 @@ void GameController::DetonateAntiMatterBombs()
 
 void GameController::AdjustOceanSurfaceTo(std::optional<vec2f> const & screenCoordinates)
 {
+    auto const lock = LockWorld();
+
     std::optional<vec2f> const worldCoordinates = !!screenCoordinates
         ? mRenderContext->ScreenToWorld(*screenCoordinates)
         : std::optional<vec2f>();
@@ -1028,6 +1281,8 @@ void GameController::AdjustOceanSurfaceTo(std::optional<vec2f> const & screenCoo
 
 std::optional<bool> GameController::AdjustOceanFloorTo(vec2f const & startScreenCoordinates, vec2f const & endScreenCoordinates)
 {
+    auto const lock = LockWorld();
+
     vec2f const startWorldCoordinates = mRenderContext->ScreenToWorld(startScreenCoordinates);
     vec2f const endWorldCoordinates = mRenderContext->ScreenToWorld(endScreenCoordinates);
 
@@ -1043,6 +1298,8 @@ bool GameController::ScrubThrough(
     vec2f const & startScreenCoordinates,
     vec2f const & endScreenCoordinates)
 {
+    auto const lock = LockWorld();
+
     vec2f const startWorldCoordinates = mRenderContext->ScreenToWorld(startScreenCoordinates);
     vec2f const endWorldCoordinates = mRenderContext->ScreenToWorld(endScreenCoordinates);
 
@@ -1056,6 +1313,8 @@ bool GameController::ScrubThrough(
 
 void GameController::ApplyThanosSnapAt(vec2f const & screenCoordinates)
 {
+    auto const lock = LockWorld();
+
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     StartThanosSnapStateMachine(worldCoordinates.x, mWorld->GetCurrentSimulationTime());
@@ -1063,6 +1322,8 @@ void GameController::ApplyThanosSnapAt(vec2f const & screenCoordinates)
 
 std::optional<ElementId> GameController::GetNearestPointAt(vec2f const & screenCoordinates) const
 {
+    auto const lock = LockWorld();
+
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     assert(!!mWorld);
@@ -1071,6 +1332,8 @@ std::optional<ElementId> GameController::GetNearestPointAt(vec2f const & screenC
 
 void GameController::QueryNearestPointAt(vec2f const & screenCoordinates) const
 {
+    auto const lock = LockWorld();
+
     vec2f const worldCoordinates = mRenderContext->ScreenToWorld(screenCoordinates);
 
     assert(!!mWorld);
@@ -1079,30 +1342,40 @@ void GameController::QueryNearestPointAt(vec2f const & screenCoordinates) const
 
 void GameController::TriggerTsunami()
 {
+    auto const lock = LockWorld();
+
     assert(!!mWorld);
     mWorld->TriggerTsunami();
 }
 
 void GameController::TriggerRogueWave()
 {
+    auto const lock = LockWorld();
+
     assert(!!mWorld);
     mWorld->TriggerRogueWave();
 }
 
 void GameController::TriggerStorm()
 {
+    auto const lock = LockWorld();
+
     assert(!!mWorld);
     mWorld->TriggerStorm();
 }
 
 void GameController::TriggerLightning()
 {
+    auto const lock = LockWorld();
+
     assert(!!mWorld);
     mWorld->TriggerLightning();
 }
 
 void GameController::HighlightElectricalElement(ElectricalElementId electricalElementId)
 {
+    auto const lock = LockWorld();
+
     assert(!!mWorld);
     mWorld->HighlightElectricalElement(electricalElementId);
 }
@@ -1111,6 +1384,8 @@ void GameController::SetSwitchState(
     ElectricalElementId electricalElementId,
     ElectricalState switchState)
 {
+    auto const lock = LockWorld();
+
     assert(!!mWorld);
     mWorld->SetSwitchState(
         electricalElementId,
@@ -1122,6 +1397,8 @@ void GameController::SetEngineControllerState(
     ElectricalElementId electricalElementId,
     int telegraphValue)
 {
+    auto const lock = LockWorld();
+
     assert(!!mWorld);
     mWorld->SetEngineControllerState(
         electricalElementId,
@@ -1215,6 +1492,30 @@ void GameController::SetDoDayLightCycle(bool value)
         StopDayLightCycleStateMachine();
     }
 }
+
+void GameController::SetTaskThreadCount(size_t value)
+{
+    mTaskThreadPool->Reconfigure(value, mTaskThreadPool->GetDoPinThreads());
+    mTaskThreadCount = value;
+}
+
+void GameController::SetDoPinTaskThreads(bool value)
+{
+    mTaskThreadPool->Reconfigure(mTaskThreadCount, value);
+}
+
+void GameController::SetTelemetryExportTarget(std::string const & value)
+{
+    try
+    {
+        mTelemetryExporter.SetTarget(value);
+    }
+    catch (std::exception const & ex)
+    {
+        // Telemetry is not worth failing for; it stays disabled
+        LogMessage("Cannot enable telemetry export: ", ex.what());
+    }
+}
 ////////////////////////////////////////////////////////////////////////////////////////
 
 void GameController::OnTsunami(float x)
@@ -1303,6 +1604,8 @@ void GameController::OnShipAdded(
 
 void GameController::PublishStats(std::chrono::steady_clock::time_point nowReal)
 {
+    auto const lock = LockWorld();
+
     PerfStats const lastDeltaPerfStats = *mTotalPerfStats - mLastPublishedTotalPerfStats;
     uint64_t const lastDeltaFrameCount = mTotalFrameCount - mLastPublishedTotalFrameCount;
 
@@ -1340,6 +1643,20 @@ void GameController::PublishStats(std::chrono::steady_clock::time_point nowReal)
         mRenderContext->GetZoom(),
         mRenderContext->GetCameraWorldPosition(),
         mRenderContext->GetStatistics());
+
+    // Export telemetry
+    if (mTelemetryExporter.IsEnabled())
+    {
+        mTelemetryExporter.Export(
+            totalElapsedReal,
+            std::chrono::duration<float>(GameWallClock::GetInstance().Now() - mOriginTimestampGame),
+            mIsPaused,
+            lastFps,
+            totalFps,
+            lastDeltaPerfStats,
+            mRenderContext->GetStatistics(),
+            mWorld->GetSimulationStatistics());
+    }
 }
 
 void GameController::DisplayInertialVelocity(float inertialVelocityMagnitude)
@@ -19,6 +19,7 @@
 #include "ResourceLocator.h"
 #include "ShipMetadata.h"
 #include "ShipTexturizer.h"
+#include "TelemetryExporter.h"
 
 #include <GameCore/Colors.h>
 #include <GameCore/GameChronometer.h>
@@ -28,20 +29,31 @@
 #include <GameCore/ImageSize.h>
 #include <GameCore/ParameterSmoother.h>
 #include <GameCore/ProgressCallback.h>
+#include <GameCore/TaskThreadPool.h>
 #include <GameCore/Vectors.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
+#include <exception>
 #include <filesystem>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 /*
  * This class is responsible for managing the game, from its lifetime to the user
  * interactions.
+ *
+ * The world is updated on a dedicated simulation thread, at a fixed rate; the main
+ * thread renders ship points from the snapshots published at each step, and only
+ * touches the world - to render the rest of it, and for user interactions - while
+ * holding the world lock, which the simulation thread only holds while stepping.
  */
 class GameController final
     : public IGameController
@@ -59,6 +71,8 @@ public:
         ResourceLocator const & resourceLocator,
         ProgressCallback const & progressCallback);
 
+    ~GameController();
+
 public:
 
     /////////////////////////////////////////////////////////
@@ -127,10 +141,7 @@ public:
     void RunGameIteration() override;
     void LowFrequencyUpdate() override;
 
-    void PulseUpdateAtNextGameIteration() override
-    {
-        mIsPulseUpdateSet = true;
-    }
+    void PulseUpdateAtNextGameIteration() override;
 
     //
     // Game Control and notifications
@@ -151,10 +162,10 @@ public:
     // World probing
     //
 
-    float GetCurrentSimulationTime() const override { return mWorld->GetCurrentSimulationTime(); }
+    float GetCurrentSimulationTime() const override { auto const lock = LockWorld(); return mWorld->GetCurrentSimulationTime(); }
     float GetEffectiveAmbientLightIntensity() const override { return mRenderContext->GetEffectiveAmbientLightIntensity(); }
-    bool IsUnderwater(vec2f const & screenCoordinates) const override { return mWorld->IsUnderwater(ScreenToWorld(screenCoordinates)); }
-    bool IsUnderwater(ElementId elementId) const override { return mWorld->IsUnderwater(elementId); }
+    bool IsUnderwater(vec2f const & screenCoordinates) const override { auto const lock = LockWorld(); return mWorld->IsUnderwater(ScreenToWorld(screenCoordinates)); }
+    bool IsUnderwater(ElementId elementId) const override { auto const lock = LockWorld(); return mWorld->IsUnderwater(elementId); }
 
     //
     // Interactions
@@ -232,6 +243,17 @@ public:
     bool GetDoAutoZoomOnShipLoad() const override { return mDoAutoZoomOnShipLoad; }
     void SetDoAutoZoomOnShipLoad(bool value) override { mDoAutoZoomOnShipLoad = value; }
 
+    std::string GetTelemetryExportTarget() const override { return mTelemetryExporter.GetTarget(); }
+    void SetTelemetryExportTarget(std::string const & value) override;
+
+    std::vector<ShipMemoryReport> GetShipMemoryReports() const override { auto const lock = LockWorld(); return mWorld->GetShipMemoryReports(); }
+
+    size_t GetTaskThreadCount() const override { return mTaskThreadCount; }
+    void SetTaskThreadCount(size_t value) override;
+
+    bool GetDoPinTaskThreads() const override { return mTaskThreadPool->GetDoPinThreads(); }
+    void SetDoPinTaskThreads(bool value) override;
+
     ShipAutoTexturizationSettings const & GetShipAutoTexturizationDefaultSettings() const override { return mShipTexturizer.GetDefaultSettings(); }
     ShipAutoTexturizationSettings & GetShipAutoTexturizationDefaultSettings() override { return mShipTexturizer.GetDefaultSettings(); }
     void SetShipAutoTexturizationDefaultSettings(ShipAutoTexturizationSettings const & value) override { mShipTexturizer.SetDefaultSettings(value); }
@@ -337,6 +359,12 @@ public:
     std::chrono::minutes GetMinRogueWaveRate() const override { return GameParameters::MinRogueWaveRate; }
     std::chrono::minutes GetMaxRogueWaveRate() const override { return GameParameters::MaxRogueWaveRate; }
 
+    bool GetDoDisplaceOceanSurfaceWithShips() const override { return mGameParameters.DoDisplaceOceanSurfaceWithShips; }
+    void SetDoDisplaceOceanSurfaceWithShips(bool value) override { mGameParameters.DoDisplaceOceanSurfaceWithShips = value; }
+
+    bool GetDoRefineOceanSurfaceAroundCamera() const override { return mGameParameters.DoRefineOceanSurfaceAroundCamera; }
+    void SetDoRefineOceanSurfaceAroundCamera(bool value) override { mGameParameters.DoRefineOceanSurfaceAroundCamera = value; }
+
     bool GetDoModulateWind() const override { return mGameParameters.DoModulateWind; }
     void SetDoModulateWind(bool value) override { mGameParameters.DoModulateWind = value; }
 
@@ -439,8 +467,8 @@ public:
 
     // Misc
 
-    OceanFloorTerrain const & GetOceanFloorTerrain() const override { return mWorld->GetOceanFloorTerrain(); }
-    void SetOceanFloorTerrain(OceanFloorTerrain const & value) override { mWorld->SetOceanFloorTerrain(value); }
+    OceanFloorTerrain const & GetOceanFloorTerrain() const override { return mWorld->GetOceanFloorTerrain(); } // Only changed by the main thread
+    void SetOceanFloorTerrain(OceanFloorTerrain const & value) override { auto const lock = LockWorld(); mWorld->SetOceanFloorTerrain(value); }
 
     float GetSeaDepth() const override { return mFloatParameterSmoothers[SeaDepthParameterSmoother].GetValue(); }
     void SetSeaDepth(float value) override { mFloatParameterSmoothers[SeaDepthParameterSmoother].SetValue(value); }
@@ -680,6 +708,7 @@ private:
         std::unique_ptr<Render::RenderContext> renderContext,
         std::shared_ptr<GameEventDispatcher> gameEventDispatcher,
         std::unique_ptr<PerfStats> perfStats,
+        std::shared_ptr<TaskThreadPool> taskThreadPool,
         MaterialDatabase materialDatabase,
         ResourceLocator const & resourceLocator);
 
@@ -694,6 +723,12 @@ private:
 
     void PublishStats(std::chrono::steady_clock::time_point nowReal);
 
+    std::unique_lock<std::mutex> LockWorld() const;
+
+    void RunSimulationThread();
+
+    void RunSimulationStep();
+
     void DisplayInertialVelocity(float inertialVelocityMagnitude);
 
 private:
@@ -734,9 +769,13 @@ private:
 
     GameParameters mGameParameters;
     std::filesystem::path mLastShipLoadedFilepath;
-    bool mIsPaused;
-    bool mIsPulseUpdateSet;
-    bool mIsMoveToolEngaged;
+    bool mIsPaused; // Written by the main thread under the world lock
+    bool mIsPulseUpdateSet; // Written by both threads under the world lock
+    bool mIsMoveToolEngaged; // Written by the main thread under the world lock
+
+    // The max number of simulation steps the simulation thread runs back-to-back
+    // in order to catch up with real time; time beyond that is dropped
+    static int constexpr MaxSimulationStepsBacklog = 4;
 
 
     //
@@ -752,6 +791,8 @@ private:
     // The doers
     //
 
+    std::shared_ptr<TaskThreadPool> mTaskThreadPool; // Shared by simulation and rendering, for our whole lifetime
+    size_t mTaskThreadCount; // Zero means as many as hardware threads
     std::shared_ptr<Render::RenderContext> mRenderContext;
     std::shared_ptr<GameEventDispatcher> mGameEventDispatcher;
     NotificationLayer mNotificationLayer;
@@ -795,4 +836,34 @@ private:
     uint64_t mTotalFrameCount;
     uint64_t mLastPublishedTotalFrameCount;
     int mSkippedFirstStatPublishes;
+    TelemetryExporter mTelemetryExporter;
+
+
+    //
+    // The simulation thread
+    //
+
+    // Guards the world, and all the state shared with the simulation thread
+    std::mutex mutable mWorldLock;
+    std::condition_variable mutable mSimulationThreadSignal;
+
+    // The number of main thread calls waiting for the world lock; the simulation
+    // thread hands the world over to them in-between steps
+    std::atomic<int> mutable mWorldLockWaiterCount;
+
+    // The inputs of the simulation, copied from the main thread at each iteration
+    GameParameters mSimulationGameParameters;
+    vec2f mSimulationCameraWorldPosition;
+    VectorFieldRenderModeType mSimulationVectorFieldRenderMode;
+
+    // The number of simulation steps run so far, and as of the last iteration
+    uint64_t mSimulationStepCount;
+    uint64_t mLastIterationSimulationStepCount;
+
+    // The exception that stopped the simulation, rethrown on the main thread
+    std::exception_ptr mSimulationException;
+
+    bool mIsSimulationThreadStop;
+
+    std::thread mSimulationThread; // Last, as it starts once everything else is ready
 };
@@ -7,13 +7,37 @@
 
 #include "IGameEventHandlers.h"
 
+#include <GameCore/GameTypes.h>
 #include <GameCore/Log.h>
-#include <GameCore/TupleKeys.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <thread>
+#include <utility>
 #include <vector>
 
+/*
+ * Dispatches game events to the registered sinks.
+ *
+ * High-frequency events (stress, breaks, repairs, light flickers, ...) are not
+ * dispatched immediately; they are aggregated and only published at Flush().
+ * Aggregation happens in per-thread staging buffers - dense arrays indexed by
+ * material ordinal - which are merged at Flush(); these events may thus be fired
+ * concurrently from worker threads without taking locks, as long as Flush() is
+ * not invoked concurrently with them.
+ *
+ * All other events are dispatched immediately when fired from the thread that
+ * created the dispatcher (the main thread); when fired from any other thread -
+ * e.g. the simulation thread - they are queued instead, and dispatched in order
+ * on the main thread at the next Flush(), as the sinks are not thread-safe.
+ */
 class GameEventDispatcher final
     : public ILifecycleGameEventHandler
     , public IStructuralGameEventHandler
@@ -27,19 +51,13 @@ class GameEventDispatcher final
 public:
 
     GameEventDispatcher()
-        : mStressEvents()
-        , mBreakEvents()
-        , mCombustionExplosionEvents()
-        , mLightningHitEvents()
-        , mLightFlickerEvents()
-        , mSpringRepairedEvents()
-        , mTriangleRepairedEvents()
-        , mAirBubbleSurfacedEvents(0u)
-        , mBombExplosionEvents()
-        , mRCBombPingEvents()
-        , mTimerBombDefusedEvents()
-        , mWatertightDoorOpenedEvents()
-        , mWatertightDoorClosedEvents()
+        : mId(NextId++)
+        , mDispatchThreadId(std::this_thread::get_id())
+        , mDeferredEvents()
+        , mDeferredEventsLock()
+        , mEventStagings()
+        , mEventStagingsLock()
+        , mMergedEventStaging(std::thread::id())
         // Sinks
         , mLifecycleSinks()
         , mStructuralSinks()
@@ -60,10 +78,14 @@ public:
 
     virtual void OnGameReset() override
     {
-        for (auto sink : mLifecycleSinks)
-        {
-            sink->OnGameReset();
-        }
+        DispatchOrDefer(
+            [this]()
+            {
+                for (auto sink : mLifecycleSinks)
+                {
+                    sink->OnGameReset();
+                }
+            });
     }
 
     virtual void OnShipLoaded(
@@ -71,34 +93,50 @@ public:
         std::string const & name,
         std::optional<std::string> const & author) override
     {
-        for (auto sink : mLifecycleSinks)
-        {
-            sink->OnShipLoaded(id, name, author);
-        }
+        DispatchOrDefer(
+            [this, id, name, author]()
+            {
+                for (auto sink : mLifecycleSinks)
+                {
+                    sink->OnShipLoaded(id, name, author);
+                }
+            });
     }
 
     virtual void OnSinkingBegin(ShipId shipId) override
     {
-        for (auto sink : mLifecycleSinks)
-        {
-            sink->OnSinkingBegin(shipId);
-        }
+        DispatchOrDefer(
+            [this, shipId]()
+            {
+                for (auto sink : mLifecycleSinks)
+                {
+                    sink->OnSinkingBegin(shipId);
+                }
+            });
     }
 
     virtual void OnSinkingEnd(ShipId shipId) override
     {
-        for (auto sink : mLifecycleSinks)
-        {
-            sink->OnSinkingEnd(shipId);
-        }
+        DispatchOrDefer(
+            [this, shipId]()
+            {
+                for (auto sink : mLifecycleSinks)
+                {
+                    sink->OnSinkingEnd(shipId);
+                }
+            });
     }
 
     virtual void OnShipRepaired(ShipId shipId) override
     {
-        for (auto sink : mLifecycleSinks)
-        {
-            sink->OnShipRepaired(shipId);
-        }
+        DispatchOrDefer(
+            [this, shipId]()
+            {
+                for (auto sink : mLifecycleSinks)
+                {
+                    sink->OnShipRepaired(shipId);
+                }
+            });
     }
 
     //
@@ -110,7 +148,7 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mStressEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
+        GetThreadEventStaging().StressEvents.Add(structuralMaterial, isUnderwater, size);
     }
 
     virtual void OnBreak(
@@ -118,7 +156,7 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mBreakEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
+        GetThreadEventStaging().BreakEvents.Add(structuralMaterial, isUnderwater, size);
     }
 
     //
@@ -127,18 +165,26 @@ public:
 
     virtual void OnTsunami(float x) override
     {
-        for (auto sink : mWavePhenomenaSinks)
-        {
-            sink->OnTsunami(x);
-        }
+        DispatchOrDefer(
+            [this, x]()
+            {
+                for (auto sink : mWavePhenomenaSinks)
+                {
+                    sink->OnTsunami(x);
+                }
+            });
     }
 
     virtual void OnTsunamiNotification(float x) override
     {
-        for (auto sink : mWavePhenomenaSinks)
-        {
-            sink->OnTsunamiNotification(x);
-        }
+        DispatchOrDefer(
+            [this, x]()
+            {
+                for (auto sink : mWavePhenomenaSinks)
+                {
+                    sink->OnTsunamiNotification(x);
+                }
+            });
     }
 
     //
@@ -147,33 +193,45 @@ public:
 
     virtual void OnPointCombustionBegin() override
     {
-        for (auto sink : mCombustionSinks)
-        {
-            sink->OnPointCombustionBegin();
-        }
+        DispatchOrDefer(
+            [this]()
+            {
+                for (auto sink : mCombustionSinks)
+                {
+                    sink->OnPointCombustionBegin();
+                }
+            });
     }
 
     virtual void OnPointCombustionEnd() override
     {
-        for (auto sink : mCombustionSinks)
-        {
-            sink->OnPointCombustionEnd();
-        }
+        DispatchOrDefer(
+            [this]()
+            {
+                for (auto sink : mCombustionSinks)
+                {
+                    sink->OnPointCombustionEnd();
+                }
+            });
     }
 
     virtual void OnCombustionSmothered() override
     {
-        for (auto sink : mCombustionSinks)
-        {
-            sink->OnCombustionSmothered();
-        }
+        DispatchOrDefer(
+            [this]()
+            {
+                for (auto sink : mCombustionSinks)
+                {
+                    sink->OnCombustionSmothered();
+                }
+            });
     }
 
     virtual void OnCombustionExplosion(
         bool isUnderwater,
         unsigned int size) override
     {
-        mCombustionExplosionEvents[std::make_tuple(isUnderwater)] += size;
+        GetThreadEventStaging().CombustionExplosionEvents[isUnderwater ? 1 : 0] += size;
     }
 
     //
@@ -184,20 +242,28 @@ public:
         float immediateFps,
         float averageFps) override
     {
-        for (auto sink : mStatisticsSinks)
-        {
-            sink->OnFrameRateUpdated(
-                immediateFps,
-                averageFps);
-        }
+        DispatchOrDefer(
+            [this, immediateFps, averageFps]()
+            {
+                for (auto sink : mStatisticsSinks)
+                {
+                    sink->OnFrameRateUpdated(
+                        immediateFps,
+                        averageFps);
+                }
+            });
     }
 
     virtual void OnCurrentUpdateDurationUpdated(float currentUpdateDuration) override
     {
-        for (auto sink : mStatisticsSinks)
-        {
-            sink->OnCurrentUpdateDurationUpdated(currentUpdateDuration);
-        }
+        DispatchOrDefer(
+            [this, currentUpdateDuration]()
+            {
+                for (auto sink : mStatisticsSinks)
+                {
+                    sink->OnCurrentUpdateDurationUpdated(currentUpdateDuration);
+                }
+            });
     }
 
     //
@@ -206,18 +272,26 @@ public:
 
     virtual void OnStormBegin() override
     {
-        for (auto sink : mAtmosphereSinks)
-        {
-            sink->OnStormBegin();
-        }
+        DispatchOrDefer(
+            [this]()
+            {
+                for (auto sink : mAtmosphereSinks)
+                {
+                    sink->OnStormBegin();
+                }
+            });
     }
 
     virtual void OnStormEnd() override
     {
-        for (auto sink : mAtmosphereSinks)
-        {
-            sink->OnStormEnd();
-        }
+        DispatchOrDefer(
+            [this]()
+            {
+                for (auto sink : mAtmosphereSinks)
+                {
+                    sink->OnStormEnd();
+                }
+            });
     }
 
     virtual void OnWindSpeedUpdated(
@@ -228,45 +302,61 @@ public:
         float const maxSpeedMagnitude,
         vec2f const& windSpeed) override
     {
-        for (auto sink : mAtmosphereSinks)
-        {
-            sink->OnWindSpeedUpdated(
-                zeroSpeedMagnitude,
-                baseSpeedMagnitude,
-                baseAndStormSpeedMagnitude,
-                preMaxSpeedMagnitude,
-                maxSpeedMagnitude,
-                windSpeed);
-        }
+        DispatchOrDefer(
+            [this, zeroSpeedMagnitude, baseSpeedMagnitude, baseAndStormSpeedMagnitude, preMaxSpeedMagnitude, maxSpeedMagnitude, windSpeed]()
+            {
+                for (auto sink : mAtmosphereSinks)
+                {
+                    sink->OnWindSpeedUpdated(
+                        zeroSpeedMagnitude,
+                        baseSpeedMagnitude,
+                        baseAndStormSpeedMagnitude,
+                        preMaxSpeedMagnitude,
+                        maxSpeedMagnitude,
+                        windSpeed);
+                }
+            });
     }
 
     virtual void OnRainUpdated(float const density) override
     {
-        for (auto sink : mAtmosphereSinks)
-        {
-            sink->OnRainUpdated(density);
-        }
+        DispatchOrDefer(
+            [this, density]()
+            {
+                for (auto sink : mAtmosphereSinks)
+                {
+                    sink->OnRainUpdated(density);
+                }
+            });
     }
 
     virtual void OnThunder() override
     {
-        for (auto sink : mAtmosphereSinks)
-        {
-            sink->OnThunder();
-        }
+        DispatchOrDefer(
+            [this]()
+            {
+                for (auto sink : mAtmosphereSinks)
+                {
+                    sink->OnThunder();
+                }
+            });
     }
 
     virtual void OnLightning() override
     {
-        for (auto sink : mAtmosphereSinks)
-        {
-            sink->OnLightning();
-        }
+        DispatchOrDefer(
+            [this]()
+            {
+                for (auto sink : mAtmosphereSinks)
+                {
+                    sink->OnLightning();
+                }
+            });
     }
 
     virtual void OnLightningHit(StructuralMaterial const & structuralMaterial) override
     {
-        mLightningHitEvents[std::make_tuple(&structuralMaterial)] += 1;
+        GetThreadEventStaging().LightningHitEvents.Add(structuralMaterial, false, 1);
     }
 
     //
@@ -278,15 +368,19 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mLightFlickerEvents[std::make_tuple(duration, isUnderwater)] += size;
+        GetThreadEventStaging().LightFlickerEvents[static_cast<size_t>(duration)][isUnderwater ? 1 : 0] += size;
     }
 
     virtual void OnElectricalElementAnnouncementsBegin() override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnElectricalElementAnnouncementsBegin();
-        }
+        DispatchOrDefer(
+            [this]()
+            {
+                for (auto sink : mElectricalElementSinks)
+                {
+                    sink->OnElectricalElementAnnouncementsBegin();
+                }
+            });
     }
 
     virtual void OnSwitchCreated(
@@ -298,10 +392,14 @@ public:
     {
         LogMessage("OnSwitchCreated(EEID=", electricalElementId, " IID=", int(instanceIndex), "): State=", static_cast<bool>(state));
 
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnSwitchCreated(electricalElementId, instanceIndex, type, state, panelElementMetadata);
-        }
+        DispatchOrDefer(
+            [this, electricalElementId, instanceIndex, type, state, panelElementMetadata]()
+            {
+                for (auto sink : mElectricalElementSinks)
+                {
+                    sink->OnSwitchCreated(electricalElementId, instanceIndex, type, state, panelElementMetadata);
+                }
+            });
     }
 
     virtual void OnPowerProbeCreated(
@@ -313,10 +411,14 @@ public:
     {
         LogMessage("OnPowerProbeCreated(EEID=", electricalElementId, " IID=", int(instanceIndex), "): State=", static_cast<bool>(state));
 
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnPowerProbeCreated(electricalElementId, instanceIndex, type, state, panelElementMetadata);
-        }
+        DispatchOrDefer(
+            [this, electricalElementId, instanceIndex, type, state, panelElementMetadata]()
+            {
+                for (auto sink : mElectricalElementSinks)
+                {
+                    sink->OnPowerProbeCreated(electricalElementId, instanceIndex, type, state, panelElementMetadata);
+                }
+            });
     }
 
     virtual void OnEngineControllerCreated(
@@ -326,10 +428,14 @@ public:
     {
         LogMessage("OnEngineControllerCreated(EEID=", electricalElementId, " IID=", int(instanceIndex), ")");
 
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnEngineControllerCreated(electricalElementId, instanceIndex, panelElementMetadata);
-        }
+        DispatchOrDefer(
+            [this, electricalElementId, instanceIndex, panelElementMetadata]()
+            {
+                for (auto sink : mElectricalElementSinks)
+                {
+                    sink->OnEngineControllerCreated(electricalElementId, instanceIndex, panelElementMetadata);
+                }
+            });
     }
 
     virtual void OnEngineMonitorCreated(
@@ -342,10 +448,14 @@ public:
     {
         LogMessage("OnEngineMonitorCreated(EEID=", electricalElementId, " IID=", int(instanceIndex), "): Thrust=", thrustMagnitude, " RPM=", rpm);
 
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnEngineMonitorCreated(electricalElementId, instanceIndex, electricalMaterial, thrustMagnitude, rpm, panelElementMetadata);
-        }
+        DispatchOrDefer(
+            [this, electricalElementId, instanceIndex, &electricalMaterial, thrustMagnitude, rpm, panelElementMetadata]()
+            {
+                for (auto sink : mElectricalElementSinks)
+                {
+                    sink->OnEngineMonitorCreated(electricalElementId, instanceIndex, electricalMaterial, thrustMagnitude, rpm, panelElementMetadata);
+                }
+            });
     }
 
     virtual void OnWaterPumpCreated(
@@ -357,10 +467,14 @@ public:
     {
         LogMessage("OnWaterPumpCreated(EEID=", electricalElementId, " IID=", int(instanceIndex), ")");
 
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnWaterPumpCreated(electricalElementId, instanceIndex, electricalMaterial, normalizedForce, panelElementMetadata);
-        }
+        DispatchOrDefer(
+            [this, electricalElementId, instanceIndex, &electricalMaterial, normalizedForce, panelElementMetadata]()
+            {
+                for (auto sink : mElectricalElementSinks)
+                {
+                    sink->OnWaterPumpCreated(electricalElementId, instanceIndex, electricalMaterial, normalizedForce, panelElementMetadata);
+                }
+            });
     }
 
     virtual void OnWatertightDoorCreated(
@@ -372,68 +486,96 @@ public:
     {
         LogMessage("OnWatertightDoorCreated(EEID=", electricalElementId, " IID=", int(instanceIndex), ")");
 
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnWatertightDoorCreated(electricalElementId, instanceIndex, electricalMaterial, isOpen, panelElementMetadata);
-        }
+        DispatchOrDefer(
+            [this, electricalElementId, instanceIndex, &electricalMaterial, isOpen, panelElementMetadata]()
+            {
+                for (auto sink : mElectricalElementSinks)
+                {
+                    sink->OnWatertightDoorCreated(electricalElementId, instanceIndex, electricalMaterial, isOpen, panelElementMetadata);
+                }
+            });
     }
 
     virtual void OnElectricalElementAnnouncementsEnd() override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnElectricalElementAnnouncementsEnd();
-        }
+        DispatchOrDefer(
+            [this]()
+            {
+                for (auto sink : mElectricalElementSinks)
+                {
+                    sink->OnElectricalElementAnnouncementsEnd();
+                }
+            });
     }
 
     virtual void OnSwitchEnabled(
         ElectricalElementId electricalElementId,
         bool isEnabled) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnSwitchEnabled(electricalElementId, isEnabled);
-        }
+        DispatchOrDefer(
+            [this, electricalElementId, isEnabled]()
+            {
+                for (auto sink : mElectricalElementSinks)
+                {
+                    sink->OnSwitchEnabled(electricalElementId, isEnabled);
+                }
+            });
     }
 
     virtual void OnSwitchToggled(
         ElectricalElementId electricalElementId,
         ElectricalState newState) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnSwitchToggled(electricalElementId, newState);
-        }
+        DispatchOrDefer(
+            [this, electricalElementId, newState]()
+            {
+                for (auto sink : mElectricalElementSinks)
+                {
+                    sink->OnSwitchToggled(electricalElementId, newState);
+                }
+            });
     }
 
     virtual void OnPowerProbeToggled(
         ElectricalElementId electricalElementId,
         ElectricalState newState) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnPowerProbeToggled(electricalElementId, newState);
-        }
+        DispatchOrDefer(
+            [this, electricalElementId, newState]()
+            {
+                for (auto sink : mElectricalElementSinks)
+                {
+                    sink->OnPowerProbeToggled(electricalElementId, newState);
+                }
+            });
     }
 
     virtual void OnEngineControllerEnabled(
         ElectricalElementId electricalElementId,
         bool isEnabled) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnEngineControllerEnabled(electricalElementId, isEnabled);
-        }
+        DispatchOrDefer(
+            [this, electricalElementId, isEnabled]()
+            {
+                for (auto sink : mElectricalElementSinks)
+                {
+                    sink->OnEngineControllerEnabled(electricalElementId, isEnabled);
+                }
+            });
     }
 
     virtual void OnEngineControllerUpdated(
         ElectricalElementId electricalElementId,
         int telegraphValue) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnEngineControllerUpdated(electricalElementId, telegraphValue);
-        }
+        DispatchOrDefer(
+            [this, electricalElementId, telegraphValue]()
+            {
+                for (auto sink : mElectricalElementSinks)
+                {
+                    sink->OnEngineControllerUpdated(electricalElementId, telegraphValue);
+                }
+            });
     }
 
     virtual void OnEngineMonitorUpdated(
@@ -441,10 +583,14 @@ public:
         float thrustMagnitude,
         float rpm) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnEngineMonitorUpdated(electricalElementId, thrustMagnitude, rpm);
-        }
+        DispatchOrDefer(
+            [this, electricalElementId, thrustMagnitude, rpm]()
+            {
+                for (auto sink : mElectricalElementSinks)
+                {
+                    sink->OnEngineMonitorUpdated(electricalElementId, thrustMagnitude, rpm);
+                }
+            });
     }
 
     virtual void OnShipSoundUpdated(
@@ -453,50 +599,70 @@ public:
         bool isPlaying,
         bool isUnderwater) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnShipSoundUpdated(electricalElementId, electricalMaterial, isPlaying, isUnderwater);
-        }
+        DispatchOrDefer(
+            [this, electricalElementId, &electricalMaterial, isPlaying, isUnderwater]()
+            {
+                for (auto sink : mElectricalElementSinks)
+                {
+                    sink->OnShipSoundUpdated(electricalElementId, electricalMaterial, isPlaying, isUnderwater);
+                }
+            });
     }
 
     virtual void OnWaterPumpEnabled(
         ElectricalElementId electricalElementId,
         bool isEnabled) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnWaterPumpEnabled(electricalElementId, isEnabled);
-        }
+        DispatchOrDefer(
+            [this, electricalElementId, isEnabled]()
+            {
+                for (auto sink : mElectricalElementSinks)
+                {
+                    sink->OnWaterPumpEnabled(electricalElementId, isEnabled);
+                }
+            });
     }
 
     virtual void OnWaterPumpUpdated(
         ElectricalElementId electricalElementId,
         float normalizedForce) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnWaterPumpUpdated(electricalElementId, normalizedForce);
-        }
+        DispatchOrDefer(
+            [this, electricalElementId, normalizedForce]()
+            {
+                for (auto sink : mElectricalElementSinks)
+                {
+                    sink->OnWaterPumpUpdated(electricalElementId, normalizedForce);
+                }
+            });
     }
 
     virtual void OnWatertightDoorEnabled(
         ElectricalElementId electricalElementId,
         bool isEnabled) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnWatertightDoorEnabled(electricalElementId, isEnabled);
-        }
+        DispatchOrDefer(
+            [this, electricalElementId, isEnabled]()
+            {
+                for (auto sink : mElectricalElementSinks)
+                {
+                    sink->OnWatertightDoorEnabled(electricalElementId, isEnabled);
+                }
+            });
     }
 
     virtual void OnWatertightDoorUpdated(
         ElectricalElementId electricalElementId,
         bool isOpen) override
     {
-        for (auto sink : mElectricalElementSinks)
-        {
-            sink->OnWatertightDoorUpdated(electricalElementId, isOpen);
-        }
+        DispatchOrDefer(
+            [this, electricalElementId, isOpen]()
+            {
+                for (auto sink : mElectricalElementSinks)
+                {
+                    sink->OnWatertightDoorUpdated(electricalElementId, isOpen);
+                }
+            });
     }
 
     //
@@ -508,10 +674,14 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnDestroy(structuralMaterial, isUnderwater, size);
-        }
+        DispatchOrDefer(
+            [this, &structuralMaterial, isUnderwater, size]()
+            {
+                for (auto sink : mGenericSinks)
+                {
+                    sink->OnDestroy(structuralMaterial, isUnderwater, size);
+                }
+            });
     }
 
     virtual void OnSpringRepaired(
@@ -519,7 +689,7 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mSpringRepairedEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
+        GetThreadEventStaging().SpringRepairedEvents.Add(structuralMaterial, isUnderwater, size);
     }
 
     virtual void OnTriangleRepaired(
@@ -527,76 +697,104 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mTriangleRepairedEvents[std::make_tuple(&structuralMaterial, isUnderwater)] += size;
+        GetThreadEventStaging().TriangleRepairedEvents.Add(structuralMaterial, isUnderwater, size);
     }
 
     virtual void OnSawed(
         bool isMetal,
         unsigned int size) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnSawed(isMetal, size);
-        }
+        DispatchOrDefer(
+            [this, isMetal, size]()
+            {
+                for (auto sink : mGenericSinks)
+                {
+                    sink->OnSawed(isMetal, size);
+                }
+            });
     }
 
     virtual void OnPinToggled(
         bool isPinned,
         bool isUnderwater) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnPinToggled(isPinned, isUnderwater);
-        }
+        DispatchOrDefer(
+            [this, isPinned, isUnderwater]()
+            {
+                for (auto sink : mGenericSinks)
+                {
+                    sink->OnPinToggled(isPinned, isUnderwater);
+                }
+            });
     }
 
     virtual void OnWaterTaken(float waterTaken) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnWaterTaken(waterTaken);
-        }
+        DispatchOrDefer(
+            [this, waterTaken]()
+            {
+                for (auto sink : mGenericSinks)
+                {
+                    sink->OnWaterTaken(waterTaken);
+                }
+            });
     }
 
     virtual void OnWaterSplashed(float waterSplashed) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnWaterSplashed(waterSplashed);
-        }
+        DispatchOrDefer(
+            [this, waterSplashed]()
+            {
+                for (auto sink : mGenericSinks)
+                {
+                    sink->OnWaterSplashed(waterSplashed);
+                }
+            });
     }
 
     virtual void OnAirBubbleSurfaced(unsigned int size) override
     {
-        mAirBubbleSurfacedEvents += size;
+        GetThreadEventStaging().AirBubbleSurfacedEvents += size;
     }
 
     virtual void OnSilenceStarted() override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnSilenceStarted();
-        }
+        DispatchOrDefer(
+            [this]()
+            {
+                for (auto sink : mGenericSinks)
+                {
+                    sink->OnSilenceStarted();
+                }
+            });
     }
 
     virtual void OnSilenceLifted() override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnSilenceLifted();
-        }
+        DispatchOrDefer(
+            [this]()
+            {
+                for (auto sink : mGenericSinks)
+                {
+                    sink->OnSilenceLifted();
+                }
+            });
     }
 
     virtual void OnCustomProbe(
         std::string const & name,
         float value) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnCustomProbe(
-                name,
-                value);
-        }
+        DispatchOrDefer(
+            [this, name, value]()
+            {
+                for (auto sink : mGenericSinks)
+                {
+                    sink->OnCustomProbe(
+                        name,
+                        value);
+                }
+            });
     }
 
     virtual void OnBombPlaced(
@@ -604,13 +802,17 @@ public:
         BombType bombType,
         bool isUnderwater) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnBombPlaced(
-                bombId,
-                bombType,
-                isUnderwater);
-        }
+        DispatchOrDefer(
+            [this, bombId, bombType, isUnderwater]()
+            {
+                for (auto sink : mGenericSinks)
+                {
+                    sink->OnBombPlaced(
+                        bombId,
+                        bombType,
+                        isUnderwater);
+                }
+            });
     }
 
     virtual void OnBombRemoved(
@@ -618,13 +820,17 @@ public:
         BombType bombType,
         std::optional<bool> isUnderwater) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnBombRemoved(
-                bombId,
-                bombType,
-                isUnderwater);
-        }
+        DispatchOrDefer(
+            [this, bombId, bombType, isUnderwater]()
+            {
+                for (auto sink : mGenericSinks)
+                {
+                    sink->OnBombRemoved(
+                        bombId,
+                        bombType,
+                        isUnderwater);
+                }
+            });
     }
 
     virtual void OnBombExplosion(
@@ -632,185 +838,250 @@ public:
         bool isUnderwater,
         unsigned int size) override
     {
-        mBombExplosionEvents[std::make_tuple(bombType, isUnderwater)] += size;
+        GetThreadEventStaging().BombExplosionEvents[static_cast<size_t>(bombType)][isUnderwater ? 1 : 0] += size;
     }
 
     virtual void OnRCBombPing(
         bool isUnderwater,
         unsigned int size) override
     {
-        mRCBombPingEvents[std::make_tuple(isUnderwater)] += size;
+        GetThreadEventStaging().RCBombPingEvents[isUnderwater ? 1 : 0] += size;
     }
 
     virtual void OnTimerBombFuse(
         BombId bombId,
         std::optional<bool> isFast) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnTimerBombFuse(
-                bombId,
-                isFast);
-        }
+        DispatchOrDefer(
+            [this, bombId, isFast]()
+            {
+                for (auto sink : mGenericSinks)
+                {
+                    sink->OnTimerBombFuse(
+                        bombId,
+                        isFast);
+                }
+            });
     }
 
     virtual void OnTimerBombDefused(
         bool isUnderwater,
         unsigned int size) override
     {
-        mTimerBombDefusedEvents[std::make_tuple(isUnderwater)] += size;
+        GetThreadEventStaging().TimerBombDefusedEvents[isUnderwater ? 1 : 0] += size;
     }
 
     virtual void OnAntiMatterBombContained(
         BombId bombId,
         bool isContained) override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnAntiMatterBombContained(
-                bombId,
-                isContained);
-        }
+        DispatchOrDefer(
+            [this, bombId, isContained]()
+            {
+                for (auto sink : mGenericSinks)
+                {
+                    sink->OnAntiMatterBombContained(
+                        bombId,
+                        isContained);
+                }
+            });
     }
 
     virtual void OnAntiMatterBombPreImploding() override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnAntiMatterBombPreImploding();
-        }
+        DispatchOrDefer(
+            [this]()
+            {
+                for (auto sink : mGenericSinks)
+                {
+                    sink->OnAntiMatterBombPreImploding();
+                }
+            });
     }
 
     virtual void OnAntiMatterBombImploding() override
     {
-        for (auto sink : mGenericSinks)
-        {
-            sink->OnAntiMatterBombImploding();
-        }
+        DispatchOrDefer(
+            [this]()
+            {
+                for (auto sink : mGenericSinks)
+                {
+                    sink->OnAntiMatterBombImploding();
+                }
+            });
     }
 
     virtual void OnWatertightDoorOpened(
         bool isUnderwater,
         unsigned int size) override
     {
-        mWatertightDoorOpenedEvents[std::make_tuple(isUnderwater)] += size;
+        GetThreadEventStaging().WatertightDoorOpenedEvents[isUnderwater ? 1 : 0] += size;
     }
 
     virtual void OnWatertightDoorClosed(
         bool isUnderwater,
         unsigned int size) override
     {
-        mWatertightDoorClosedEvents[std::make_tuple(isUnderwater)] += size;
+        GetThreadEventStaging().WatertightDoorClosedEvents[isUnderwater ? 1 : 0] += size;
     }
 
 public:
 
     /*
-     * Flushes all events aggregated so far and clears the state.
+     * Dispatches all events deferred by other threads, then flushes all events
+     * aggregated so far and clears the state.
+     *
+     * Must be invoked on the main thread, and not while other threads are firing
+     * aggregated events.
      */
     void Flush()
     {
+        assert(std::this_thread::get_id() == mDispatchThreadId);
+
         //
-        // Publish aggregations
+        // Dispatch deferred events, in the order in which they were fired
         //
 
-        for (auto * sink : mStructuralSinks)
         {
-            for (auto const & entry : mStressEvents)
+            std::vector<std::function<void()>> deferredEvents;
+
             {
-                sink->OnStress(*(std::get<0>(entry.first)), std::get<1>(entry.first), entry.second);
+                std::lock_guard<std::mutex> const lock{ mDeferredEventsLock };
+
+                deferredEvents.swap(mDeferredEvents);
             }
 
-            for (auto const & entry : mBreakEvents)
+            for (auto const & deferredEvent : deferredEvents)
             {
-                sink->OnBreak(*(std::get<0>(entry.first)), std::get<1>(entry.first), entry.second);
+                deferredEvent();
             }
         }
 
-        mStressEvents.clear();
-        mBreakEvents.clear();
+        //
+        // Merge all per-thread stagings
+        //
 
-        for (auto * sink : mCombustionSinks)
         {
-            for (auto const & entry : mCombustionExplosionEvents)
+            std::lock_guard<std::mutex> const lock{ mEventStagingsLock };
+
+            for (auto & eventStaging : mEventStagings)
             {
-                sink->OnCombustionExplosion(std::get<0>(entry.first), entry.second);
+                eventStaging->MergeIntoAndClear(mMergedEventStaging);
             }
         }
 
-        mCombustionExplosionEvents.clear();
+        EventStaging & events = mMergedEventStaging;
 
-        for (auto * sink : mAtmosphereSinks)
+        //
+        // Publish aggregations
+        //
+
+        for (auto * sink : mStructuralSinks)
         {
-            for (auto const & entry : mLightningHitEvents)
-            {
-                sink->OnLightningHit(*(std::get<0>(entry.first)));
-            }
+            events.StressEvents.Visit(
+                [sink](StructuralMaterial const & material, bool isUnderwater, unsigned int size)
+                {
+                    sink->OnStress(material, isUnderwater, size);
+                });
+
+            events.BreakEvents.Visit(
+                [sink](StructuralMaterial const & material, bool isUnderwater, unsigned int size)
+                {
+                    sink->OnBreak(material, isUnderwater, size);
+                });
+        }
+
+        for (auto * sink : mCombustionSinks)
+        {
+            VisitFlagEvents(
+                events.CombustionExplosionEvents,
+                [sink](bool isUnderwater, unsigned int size)
+                {
+                    sink->OnCombustionExplosion(isUnderwater, size);
+                });
         }
 
-        mLightningHitEvents.clear();
+        for (auto * sink : mAtmosphereSinks)
+        {
+            events.LightningHitEvents.Visit(
+                [sink](StructuralMaterial const & material, bool /*isUnderwater*/, unsigned int /*size*/)
+                {
+                    sink->OnLightningHit(material);
+                });
+        }
 
         for (auto * sink : mElectricalElementSinks)
         {
-            for (auto const & entry : mLightFlickerEvents)
+            for (size_t d = 0; d < events.LightFlickerEvents.size(); ++d)
             {
-                sink->OnLightFlicker(std::get<0>(entry.first), std::get<1>(entry.first), entry.second);
+                VisitFlagEvents(
+                    events.LightFlickerEvents[d],
+                    [sink, d](bool isUnderwater, unsigned int size)
+                    {
+                        sink->OnLightFlicker(static_cast<DurationShortLongType>(d), isUnderwater, size);
+                    });
             }
         }
 
-        mLightFlickerEvents.clear();
-
         for (auto * sink : mGenericSinks)
         {
-            for (auto const & entry : mSpringRepairedEvents)
-            {
-                sink->OnSpringRepaired(*(std::get<0>(entry.first)), std::get<1>(entry.first), entry.second);
-            }
-
-            for (auto const & entry : mTriangleRepairedEvents)
+            events.SpringRepairedEvents.Visit(
+                [sink](StructuralMaterial const & material, bool isUnderwater, unsigned int size)
+                {
+                    sink->OnSpringRepaired(material, isUnderwater, size);
+                });
+
+            events.TriangleRepairedEvents.Visit(
+                [sink](StructuralMaterial const & material, bool isUnderwater, unsigned int size)
+                {
+                    sink->OnTriangleRepaired(material, isUnderwater, size);
+                });
+
+            if (events.AirBubbleSurfacedEvents > 0)
             {
-                sink->OnTriangleRepaired(*(std::get<0>(entry.first)), std::get<1>(entry.first), entry.second);
+                sink->OnAirBubbleSurfaced(events.AirBubbleSurfacedEvents);
             }
 
-            if (mAirBubbleSurfacedEvents > 0)
+            for (size_t b = 0; b < events.BombExplosionEvents.size(); ++b)
             {
-                sink->OnAirBubbleSurfaced(mAirBubbleSurfacedEvents);
+                VisitFlagEvents(
+                    events.BombExplosionEvents[b],
+                    [sink, b](bool isUnderwater, unsigned int size)
+                    {
+                        sink->OnBombExplosion(static_cast<BombType>(b), isUnderwater, size);
+                    });
             }
 
-            for (auto const & entry : mBombExplosionEvents)
-            {
-                sink->OnBombExplosion(std::get<0>(entry.first), std::get<1>(entry.first), entry.second);
-            }
-
-            for (auto const & entry : mRCBombPingEvents)
-            {
-                sink->OnRCBombPing(std::get<0>(entry.first), entry.second);
-            }
-
-            for (auto const & entry : mTimerBombDefusedEvents)
-            {
-                sink->OnTimerBombDefused(std::get<0>(entry.first), entry.second);
-            }
-
-            for (auto const & entry : mWatertightDoorOpenedEvents)
-            {
-                sink->OnWatertightDoorOpened(std::get<0>(entry.first), entry.second);
-            }
-
-            for (auto const & entry : mWatertightDoorClosedEvents)
-            {
-                sink->OnWatertightDoorClosed(std::get<0>(entry.first), entry.second);
-            }
+            VisitFlagEvents(
+                events.RCBombPingEvents,
+                [sink](bool isUnderwater, unsigned int size)
+                {
+                    sink->OnRCBombPing(isUnderwater, size);
+                });
+
+            VisitFlagEvents(
+                events.TimerBombDefusedEvents,
+                [sink](bool isUnderwater, unsigned int size)
+                {
+                    sink->OnTimerBombDefused(isUnderwater, size);
+                });
+
+            VisitFlagEvents(
+                events.WatertightDoorOpenedEvents,
+                [sink](bool isUnderwater, unsigned int size)
+                {
+                    sink->OnWatertightDoorOpened(isUnderwater, size);
+                });
+
+            VisitFlagEvents(
+                events.WatertightDoorClosedEvents,
+                [sink](bool isUnderwater, unsigned int size)
+                {
+                    sink->OnWatertightDoorClosed(isUnderwater, size);
+                });
         }
 
-        mSpringRepairedEvents.clear();
-        mTriangleRepairedEvents.clear();
-        mAirBubbleSurfacedEvents = 0u;
-        mBombExplosionEvents.clear();
-        mRCBombPingEvents.clear();
-        mTimerBombDefusedEvents.clear();
-        mWatertightDoorOpenedEvents.clear();
-        mWatertightDoorClosedEvents.clear();
+        events.Clear();
     }
 
     void RegisterLifecycleEventHandler(ILifecycleGameEventHandler * sink)
@@ -855,20 +1126,264 @@ public:
 
 private:
 
-    // The current events being aggregated
-    unordered_tuple_map<std::tuple<StructuralMaterial const *, bool>, unsigned int> mStressEvents;
-    unordered_tuple_map<std::tuple<StructuralMaterial const *, bool>, unsigned int> mBreakEvents;
-    unordered_tuple_map<std::tuple<bool>, unsigned int> mCombustionExplosionEvents;
-    unordered_tuple_map<std::tuple<StructuralMaterial const *>, unsigned int> mLightningHitEvents;
-    unordered_tuple_map<std::tuple<DurationShortLongType, bool>, unsigned int> mLightFlickerEvents;
-    unordered_tuple_map<std::tuple<StructuralMaterial const *, bool>, unsigned int> mSpringRepairedEvents;
-    unordered_tuple_map<std::tuple<StructuralMaterial const *, bool>, unsigned int> mTriangleRepairedEvents;
-    unsigned int mAirBubbleSurfacedEvents;
-    unordered_tuple_map<std::tuple<BombType, bool>, unsigned int> mBombExplosionEvents;
-    unordered_tuple_map<std::tuple<bool>, unsigned int> mRCBombPingEvents;
-    unordered_tuple_map<std::tuple<bool>, unsigned int> mTimerBombDefusedEvents;
-    unordered_tuple_map<std::tuple<bool>, unsigned int> mWatertightDoorOpenedEvents;
-    unordered_tuple_map<std::tuple<bool>, unsigned int> mWatertightDoorClosedEvents;
+    //
+    // Event deferral
+    //
+
+    /*
+     * Dispatches the event right away when invoked on the main thread, or
+     * queues it for the next Flush() otherwise.
+     */
+    template<typename TDispatch>
+    void DispatchOrDefer(TDispatch && dispatch)
+    {
+        if (std::this_thread::get_id() == mDispatchThreadId)
+        {
+            dispatch();
+        }
+        else
+        {
+            std::lock_guard<std::mutex> const lock{ mDeferredEventsLock };
+
+            mDeferredEvents.emplace_back(std::forward<TDispatch>(dispatch));
+        }
+    }
+
+private:
+
+    //
+    // Event aggregation
+    //
+
+    // Counts of events keyed by (material, isUnderwater), in dense arrays indexed by material ordinal
+    class MaterialEventCounts
+    {
+    public:
+
+        inline void Add(
+            StructuralMaterial const & material,
+            bool isUnderwater,
+            unsigned int size)
+        {
+            size_t const ordinal = static_cast<size_t>(material.Ordinal);
+            if (ordinal >= mMaterials.size())
+            {
+                // Grow to accommodate this ordinal; happens only a few times
+                mMaterials.resize(ordinal + 1, nullptr);
+                mCounts.resize(ordinal + 1, { 0u, 0u });
+            }
+
+            if (nullptr == mMaterials[ordinal])
+            {
+                // First time we see this material since last clear
+                mMaterials[ordinal] = &material;
+                mTouchedOrdinals.push_back(ordinal);
+            }
+
+            assert(mMaterials[ordinal] == &material); // Ordinals are unique
+
+            mCounts[ordinal][isUnderwater ? 1 : 0] += size;
+        }
+
+        // Visits (material, isUnderwater, size) for all non-zero counts
+        template<typename TVisitor>
+        inline void Visit(TVisitor && visitor) const
+        {
+            for (size_t const ordinal : mTouchedOrdinals)
+            {
+                for (size_t u = 0; u < 2; ++u)
+                {
+                    if (mCounts[ordinal][u] > 0)
+                    {
+                        visitor(*(mMaterials[ordinal]), u == 1, mCounts[ordinal][u]);
+                    }
+                }
+            }
+        }
+
+        inline void MergeInto(MaterialEventCounts & target) const
+        {
+            Visit(
+                [&target](StructuralMaterial const & material, bool isUnderwater, unsigned int size)
+                {
+                    target.Add(material, isUnderwater, size);
+                });
+        }
+
+        inline void Clear()
+        {
+            for (size_t const ordinal : mTouchedOrdinals)
+            {
+                mMaterials[ordinal] = nullptr;
+                mCounts[ordinal] = { 0u, 0u };
+            }
+
+            mTouchedOrdinals.clear();
+        }
+
+    private:
+
+        std::vector<StructuralMaterial const *> mMaterials; // By ordinal; non-null when touched
+        std::vector<std::array<unsigned int, 2>> mCounts; // By ordinal, then by isUnderwater
+        std::vector<size_t> mTouchedOrdinals;
+    };
+
+    // Counts of events keyed by isUnderwater
+    using FlagEventCounts = std::array<unsigned int, 2>;
+
+    template<typename TVisitor>
+    static inline void VisitFlagEvents(
+        FlagEventCounts const & counts,
+        TVisitor && visitor)
+    {
+        for (size_t u = 0; u < 2; ++u)
+        {
+            if (counts[u] > 0)
+            {
+                visitor(u == 1, counts[u]);
+            }
+        }
+    }
+
+    // All the events being aggregated by one thread
+    struct EventStaging
+    {
+        std::thread::id OwnerThreadId;
+
+        MaterialEventCounts StressEvents;
+        MaterialEventCounts BreakEvents;
+        FlagEventCounts CombustionExplosionEvents;
+        MaterialEventCounts LightningHitEvents;
+        std::array<FlagEventCounts, static_cast<size_t>(DurationShortLongType::_Last) + 1> LightFlickerEvents;
+        MaterialEventCounts SpringRepairedEvents;
+        MaterialEventCounts TriangleRepairedEvents;
+        unsigned int AirBubbleSurfacedEvents;
+        std::array<FlagEventCounts, static_cast<size_t>(BombType::_Last) + 1> BombExplosionEvents;
+        FlagEventCounts RCBombPingEvents;
+        FlagEventCounts TimerBombDefusedEvents;
+        FlagEventCounts WatertightDoorOpenedEvents;
+        FlagEventCounts WatertightDoorClosedEvents;
+
+        explicit EventStaging(std::thread::id ownerThreadId)
+            : OwnerThreadId(ownerThreadId)
+        {
+            Clear();
+        }
+
+        void MergeIntoAndClear(EventStaging & target)
+        {
+            StressEvents.MergeInto(target.StressEvents);
+            BreakEvents.MergeInto(target.BreakEvents);
+            MergeFlagEvents(CombustionExplosionEvents, target.CombustionExplosionEvents);
+            LightningHitEvents.MergeInto(target.LightningHitEvents);
+            for (size_t d = 0; d < LightFlickerEvents.size(); ++d)
+                MergeFlagEvents(LightFlickerEvents[d], target.LightFlickerEvents[d]);
+            SpringRepairedEvents.MergeInto(target.SpringRepairedEvents);
+            TriangleRepairedEvents.MergeInto(target.TriangleRepairedEvents);
+            target.AirBubbleSurfacedEvents += AirBubbleSurfacedEvents;
+            for (size_t b = 0; b < BombExplosionEvents.size(); ++b)
+                MergeFlagEvents(BombExplosionEvents[b], target.BombExplosionEvents[b]);
+            MergeFlagEvents(RCBombPingEvents, target.RCBombPingEvents);
+            MergeFlagEvents(TimerBombDefusedEvents, target.TimerBombDefusedEvents);
+            MergeFlagEvents(WatertightDoorOpenedEvents, target.WatertightDoorOpenedEvents);
+            MergeFlagEvents(WatertightDoorClosedEvents, target.WatertightDoorClosedEvents);
+
+            Clear();
+        }
+
+        void Clear()
+        {
+            StressEvents.Clear();
+            BreakEvents.Clear();
+            CombustionExplosionEvents.fill(0u);
+            LightningHitEvents.Clear();
+            for (auto & counts : LightFlickerEvents)
+                counts.fill(0u);
+            SpringRepairedEvents.Clear();
+            TriangleRepairedEvents.Clear();
+            AirBubbleSurfacedEvents = 0u;
+            for (auto & counts : BombExplosionEvents)
+                counts.fill(0u);
+            RCBombPingEvents.fill(0u);
+            TimerBombDefusedEvents.fill(0u);
+            WatertightDoorOpenedEvents.fill(0u);
+            WatertightDoorClosedEvents.fill(0u);
+        }
+
+    private:
+
+        static inline void MergeFlagEvents(
+            FlagEventCounts const & source,
+            FlagEventCounts & target)
+        {
+            target[0] += source[0];
+            target[1] += source[1];
+        }
+    };
+
+    /*
+     * Returns the staging buffer of the calling thread, creating it the first time
+     * the thread fires an aggregated event; lock-free after the first time.
+     */
+    inline EventStaging & GetThreadEventStaging()
+    {
+        // The last staging used by this thread, and the dispatcher it belongs to
+        thread_local std::uint64_t tDispatcherId = 0;
+        thread_local EventStaging * tEventStaging = nullptr;
+
+        if (tDispatcherId != mId)
+        {
+            tEventStaging = &FindOrCreateThreadEventStaging();
+            tDispatcherId = mId;
+        }
+
+        return *tEventStaging;
+    }
+
+    EventStaging & FindOrCreateThreadEventStaging()
+    {
+        std::lock_guard<std::mutex> const lock{ mEventStagingsLock };
+
+        auto const threadId = std::this_thread::get_id();
+
+        // This thread might have already used this dispatcher before switching to another one
+        auto const it = std::find_if(
+            mEventStagings.cbegin(),
+            mEventStagings.cend(),
+            [&threadId](auto const & eventStaging)
+            {
+                return eventStaging->OwnerThreadId == threadId;
+            });
+
+        if (it != mEventStagings.cend())
+        {
+            return **it;
+        }
+
+        mEventStagings.emplace_back(std::make_unique<EventStaging>(threadId));
+        return *(mEventStagings.back());
+    }
+
+    // Source of unique dispatcher IDs; zero is reserved for "none"
+    static inline std::atomic<std::uint64_t> NextId{ 1 };
+
+    std::uint64_t const mId;
+
+    // The thread on which events are dispatched to the sinks
+    std::thread::id const mDispatchThreadId;
+
+    // Events fired by other threads, waiting for the next Flush(); materials
+    // are captured by reference, as they live in the material database
+    std::vector<std::function<void()>> mDeferredEvents;
+    std::mutex mDeferredEventsLock;
+
+    // The per-thread event stagings; the vector is only modified under the lock,
+    // while each staging is only modified by its owner thread
+    std::vector<std::unique_ptr<EventStaging>> mEventStagings;
+    std::mutex mEventStagingsLock;
+
+    // The staging into which we merge all per-thread stagings at Flush()
+    EventStaging mMergedEventStaging;
 
     // The registered sinks
     std::vector<ILifecycleGameEventHandler *> mLifecycleSinks;
@@ -39,6 +39,8 @@ GameParameters::GameParameters()
     , BasalWaveSpeedAdjustment(4.0f)
     , TsunamiRate(120)
     , RogueWaveRate(2)
+    , DoDisplaceOceanSurfaceWithShips(true)
+    , DoRefineOceanSurfaceAroundCamera(true)
     // Storm
 	, StormRate(60)
     , StormDuration(60 * 4) // 4 minutes
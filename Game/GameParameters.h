@@ -150,7 +150,7 @@ struct GameParameters
 
     // Ephemeral particles
 
-    static constexpr ElementCount MaxEphemeralParticles = 4096;
+    static constexpr ElementCount MaxEphemeralParticles = 16384;
 
     bool DoGenerateDebris;
     static constexpr unsigned int MinDebrisParticlesPerEvent = 4;
@@ -233,6 +233,10 @@ struct GameParameters
     static std::chrono::minutes constexpr MinRogueWaveRate = std::chrono::minutes(0);
     static std::chrono::minutes constexpr MaxRogueWaveRate = std::chrono::minutes(15);
 
+    bool DoDisplaceOceanSurfaceWithShips;
+
+    bool DoRefineOceanSurfaceAroundCamera;
+
     // Storm
 
 	std::chrono::minutes StormRate;
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "IGameEventHandlers.h"
+#include "PerfStats.h"
 #include "ResourceLocator.h"
 #include "ShipMetadata.h"
 
@@ -152,6 +153,17 @@ struct IGameController
     virtual bool GetDoAutoZoomOnShipLoad() const = 0;
     virtual void SetDoAutoZoomOnShipLoad(bool value) = 0;
 
+    virtual std::string GetTelemetryExportTarget() const = 0;
+    virtual void SetTelemetryExportTarget(std::string const & value) = 0;
+
+    virtual std::vector<ShipMemoryReport> GetShipMemoryReports() const = 0;
+
+    virtual size_t GetTaskThreadCount() const = 0;
+    virtual void SetTaskThreadCount(size_t value) = 0;
+
+    virtual bool GetDoPinTaskThreads() const = 0;
+    virtual void SetDoPinTaskThreads(bool value) = 0;
+
     virtual ShipAutoTexturizationSettings const & GetShipAutoTexturizationDefaultSettings() const = 0;
     virtual ShipAutoTexturizationSettings & GetShipAutoTexturizationDefaultSettings() = 0;
     virtual void SetShipAutoTexturizationDefaultSettings(ShipAutoTexturizationSettings const & value) = 0;
@@ -83,6 +83,12 @@ struct IGameControllerSettings
     virtual std::chrono::minutes GetRogueWaveRate() const = 0;
     virtual void SetRogueWaveRate(std::chrono::minutes value) = 0;
 
+    virtual bool GetDoDisplaceOceanSurfaceWithShips() const = 0;
+    virtual void SetDoDisplaceOceanSurfaceWithShips(bool value) = 0;
+
+    virtual bool GetDoRefineOceanSurfaceAroundCamera() const = 0;
+    virtual void SetDoRefineOceanSurfaceAroundCamera(bool value) = 0;
+
     virtual bool GetDoModulateWind() const = 0;
     virtual void SetDoModulateWind(bool value) = 0;
 
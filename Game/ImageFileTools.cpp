@@ -6,6 +6,7 @@
 #include "ImageFileTools.h"
 
 #include <GameCore/GameException.h>
+#include <GameCore/PngDecoder.h>
 
 #include <IL/il.h>
 #include <IL/ilu.h>
@@ -13,12 +14,35 @@
 #include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <fstream>
+#include <iterator>
 #include <regex>
 
 bool ImageFileTools::mIsInitialized = false;
 
+std::mutex ImageFileTools::mDevILMutex;
+
 ImageSize ImageFileTools::GetImageSize(std::filesystem::path const & filepath)
 {
+    //
+    // Try to decode just the PNG header
+    //
+
+    auto const header = ReadFile(filepath, PngDecoder::HeaderSize);
+    if (PngDecoder::CanDecode(header.data(), header.size()))
+    {
+        try
+        {
+            return PngDecoder::DecodeSize(header.data(), header.size());
+        }
+        catch (GameException const & gex)
+        {
+            throw GameException("Could not load image \"" + filepath.string() + "\": " + gex.what());
+        }
+    }
+
+    std::lock_guard<std::mutex> const lock(mDevILMutex);
+
     //
     // Load image
     //
@@ -158,6 +182,39 @@ void ImageFileTools::SaveImage(
 ////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////
 
+std::vector<std::uint8_t> ImageFileTools::ReadFile(
+    std::filesystem::path const & filepath,
+    std::optional<size_t> maxSize)
+{
+    std::ifstream file(filepath, std::ios::binary);
+    if (!file.is_open())
+    {
+        if (!std::filesystem::exists(filepath))
+        {
+            throw GameException("Could not load image \"" + filepath.string() + "\": the file does not exist");
+        }
+
+        throw GameException("Could not load image \"" + filepath.string() + "\": the file cannot be opened");
+    }
+
+    std::vector<std::uint8_t> data;
+
+    if (maxSize.has_value())
+    {
+        data.resize(*maxSize);
+        file.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(*maxSize));
+        data.resize(static_cast<size_t>(file.gcount()));
+    }
+    else
+    {
+        data.assign(
+            std::istreambuf_iterator<char>(file),
+            std::istreambuf_iterator<char>());
+    }
+
+    return data;
+}
+
 void ImageFileTools::CheckInitialized()
 {
     if (!mIsInitialized)
@@ -235,6 +292,49 @@ ImageData<TColor> ImageFileTools::InternalLoadImage(
     int targetOrigin,
     std::optional<ResizeInfo> resizeInfo)
 {
+    //
+    // Decode PNGs ourselves, unless they require filtered magnification
+    //
+
+    if (targetOrigin == IL_ORIGIN_LOWER_LEFT)
+    {
+        auto const fileData = ReadFile(filepath, std::nullopt);
+        if (PngDecoder::CanDecode(fileData.data(), fileData.size()))
+        {
+            try
+            {
+                if (!resizeInfo)
+                {
+                    return PngDecoder::Decode<TColor>(fileData.data(), fileData.size());
+                }
+
+                ImageSize const originalImageSize = PngDecoder::DecodeSize(fileData.data(), fileData.size());
+                ImageSize const newImageSize = resizeInfo->ResizeHandler(originalImageSize);
+
+                if (newImageSize == originalImageSize)
+                {
+                    return PngDecoder::Decode<TColor>(fileData.data(), fileData.size());
+                }
+                else if (newImageSize.Width <= originalImageSize.Width && newImageSize.Height <= originalImageSize.Height)
+                {
+                    return PngDecoder::DecodeAndDownscale<TColor>(fileData.data(), fileData.size(), newImageSize);
+                }
+                else if (resizeInfo->FilterType == ILU_NEAREST)
+                {
+                    return ResizeNearest(
+                        PngDecoder::Decode<TColor>(fileData.data(), fileData.size()),
+                        newImageSize);
+                }
+            }
+            catch (GameException const & gex)
+            {
+                throw GameException("Could not load image \"" + filepath.string() + "\": " + gex.what());
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> const lock(mDevILMutex);
+
     //
     // Load image
     //
@@ -318,6 +418,28 @@ ImageData<TColor> ImageFileTools::InternalLoadImage(
         std::move(data));
 }
 
+template <typename TColor>
+ImageData<TColor> ImageFileTools::ResizeNearest(
+    ImageData<TColor> const & image,
+    ImageSize const & newSize)
+{
+    auto data = std::make_unique<TColor[]>(newSize.Width * newSize.Height);
+
+    for (int y = 0; y < newSize.Height; ++y)
+    {
+        int const srcY = y * image.Size.Height / newSize.Height;
+        for (int x = 0; x < newSize.Width; ++x)
+        {
+            int const srcX = x * image.Size.Width / newSize.Width;
+            data[y * newSize.Width + x] = image.Data[srcY * image.Size.Width + srcX];
+        }
+    }
+
+    return ImageData<TColor>(
+        newSize,
+        std::move(data));
+}
+
 void ImageFileTools::InternalSaveImage(
     ImageSize imageSize,
     void const * imageData,
@@ -325,6 +447,8 @@ void ImageFileTools::InternalSaveImage(
     int format,
     std::filesystem::path filepath)
 {
+    std::lock_guard<std::mutex> const lock(mDevILMutex);
+
     CheckInitialized();
 
     ILuint imghandle;
@@ -7,13 +7,20 @@
 
 #include <GameCore/ImageData.h>
 
+#include <cstdint>
 #include <filesystem>
 #include <functional>
+#include <mutex>
 #include <optional>
+#include <vector>
 
 /*
  * Image standards:
  *  - Coordinates have origin at lower-left
+ *
+ * PNG images are decoded with our own decoder, which may run concurrently on
+ * multiple threads; all other images - and saving - go through DevIL, which
+ * is serialized as it relies on global state.
  */
 class ImageFileTools
 {
@@ -38,6 +45,10 @@ public:
 
 private:
 
+    static std::vector<std::uint8_t> ReadFile(
+        std::filesystem::path const & filepath,
+        std::optional<size_t> maxSize);
+
     static void CheckInitialized();
 
     static unsigned int InternalLoadImage(std::filesystem::path const & filepath);
@@ -68,6 +79,11 @@ private:
         int targetOrigin,
         std::optional<ResizeInfo> resizeInfo);
 
+    template <typename TColor>
+    static ImageData<TColor> ResizeNearest(
+        ImageData<TColor> const & image,
+        ImageSize const & newSize);
+
     static void InternalSaveImage(
         ImageSize imageSize,
         void const * imageData,
@@ -78,4 +94,7 @@ private:
 private:
 
     static bool mIsInitialized;
+
+    // Serializes all DevIL calls
+    static std::mutex mDevILMutex;
 };
@@ -15,10 +15,13 @@
 
 #include <picojson.h>
 
+#include <array>
 #include <cassert>
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <optional>
+#include <vector>
 
 class MaterialDatabase
 {
@@ -115,6 +118,15 @@ public:
             }
         }
 
+        // Assign ordinals
+        {
+            std::uint32_t ordinal = 0;
+            for (auto & entry : structuralMaterialsMap)
+            {
+                entry.second.Ordinal = ordinal++;
+            }
+        }
+
         // Make sure there are no clashes with indexed rope colors
         for (auto const & entry : structuralMaterialsMap)
         {
@@ -205,22 +217,8 @@ public:
 
     StructuralMaterial const * FindStructuralMaterial(ColorKey const & colorKey) const
     {
-        if (auto srchIt = mStructuralMaterialMap.find(colorKey);
-            srchIt != mStructuralMaterialMap.end())
-        {
-            // Found color key verbatim!
-            return &(srchIt->second);
-        }
-
-        // Check whether it's a rope endpoint
-        if (colorKey.r == mUniqueStructuralMaterials[RopeUniqueMaterialIndex].first.r
-            && ((colorKey.g & 0xF0) == (mUniqueStructuralMaterials[RopeUniqueMaterialIndex].first.g & 0xF0)))
-        {
-            return mUniqueStructuralMaterials[RopeUniqueMaterialIndex].second;
-        }
-
-        // No luck
-        return nullptr;
+        // Note: the table resolves both verbatim color keys and rope endpoints
+        return mStructuralMaterialLookupTable.Find(colorKey);
     }
 
     auto const & GetStructuralMaterialsByColorKeys() const
@@ -230,22 +228,8 @@ public:
 
     ElectricalMaterial const * FindElectricalMaterial(ColorKey const & colorKey) const
     {
-        // Try non-instanced first
-        if (auto srchIt = mNonInstancedElectricalMaterialMap.find(colorKey);
-            srchIt != mNonInstancedElectricalMaterialMap.end())
-        {
-            return &(srchIt->second);
-        }
-
-        // Try instanced now
-        if (auto srchIt = mInstancedElectricalMaterialMap.find(colorKey);
-            srchIt != mInstancedElectricalMaterialMap.end())
-        {
-            return &(srchIt->second);
-        }
-
-        // No luck
-        return nullptr;
+        // Note: the table resolves both non-instanced and instanced color keys
+        return mElectricalMaterialLookupTable.Find(colorKey);
     }
 
     StructuralMaterial const & GetUniqueStructuralMaterial(StructuralMaterial::MaterialUniqueType uniqueType) const
@@ -291,6 +275,70 @@ private:
         }
     };
 
+    /*
+     * Two-level table mapping all 24-bit color keys to materials: the first level is indexed
+     * by red and green, and yields the index of a page of 256 materials indexed by blue.
+     *
+     * Pages are only allocated for the (red, green) pairs that have at least one material;
+     * all other pairs share page zero, which is empty.
+     */
+    template<typename TMaterial>
+    class ColorKeyLookupTable
+    {
+    public:
+
+        ColorKeyLookupTable()
+            : mPageIndices(new std::uint16_t[256 * 256])
+            , mPages(1) // Page zero
+        {
+            std::fill(mPageIndices.get(), mPageIndices.get() + 256 * 256, std::uint16_t(0));
+            mPages[0].fill(nullptr);
+        }
+
+        inline TMaterial const * Find(ColorKey const & colorKey) const
+        {
+            return mPages[mPageIndices[(colorKey.r << 8) | colorKey.g]][colorKey.b];
+        }
+
+        void Set(
+            ColorKey const & colorKey,
+            TMaterial const * material)
+        {
+            GetOrCreatePage(colorKey.r, colorKey.g)[colorKey.b] = material;
+        }
+
+        // Sets the material for all blue values of the specified (red, green) pair
+        void SetAllBlues(
+            ColorKey::data_type r,
+            ColorKey::data_type g,
+            TMaterial const * material)
+        {
+            GetOrCreatePage(r, g).fill(material);
+        }
+
+    private:
+
+        using Page = std::array<TMaterial const *, 256>;
+
+        Page & GetOrCreatePage(
+            ColorKey::data_type r,
+            ColorKey::data_type g)
+        {
+            std::uint16_t & pageIndex = mPageIndices[(r << 8) | g];
+            if (pageIndex == 0)
+            {
+                pageIndex = static_cast<std::uint16_t>(mPages.size());
+                mPages.emplace_back();
+                mPages.back().fill(nullptr);
+            }
+
+            return mPages[pageIndex];
+        }
+
+        std::unique_ptr<std::uint16_t[]> mPageIndices;
+        std::vector<Page> mPages;
+    };
+
     MaterialDatabase(
         std::map<ColorKey, StructuralMaterial> structuralMaterialMap,
         std::map<ColorKey, ElectricalMaterial, NonInstancedColorKeyComparer> nonInstancedElectricalMaterialMap,
@@ -300,7 +348,39 @@ private:
         , mNonInstancedElectricalMaterialMap(std::move(nonInstancedElectricalMaterialMap))
         , mInstancedElectricalMaterialMap(std::move(instancedElectricalMaterialMap))
         , mUniqueStructuralMaterials(uniqueStructuralMaterials)
+        , mStructuralMaterialLookupTable()
+        , mElectricalMaterialLookupTable()
     {
+        //
+        // Populate lookup tables; map nodes are stable, hence we may
+        // safely store pointers to their values
+        //
+
+        // Rope endpoints first, so that verbatim color keys take precedence
+        auto const & ropeColorKey = mUniqueStructuralMaterials[RopeUniqueMaterialIndex].first;
+        for (int g = (ropeColorKey.g & 0xF0); g <= (ropeColorKey.g | 0x0F); ++g)
+        {
+            mStructuralMaterialLookupTable.SetAllBlues(
+                ropeColorKey.r,
+                static_cast<ColorKey::data_type>(g),
+                mUniqueStructuralMaterials[RopeUniqueMaterialIndex].second);
+        }
+
+        for (auto const & entry : mStructuralMaterialMap)
+        {
+            mStructuralMaterialLookupTable.Set(entry.first, &(entry.second));
+        }
+
+        // Instanced first, so that non-instanced color keys take precedence
+        for (auto const & entry : mInstancedElectricalMaterialMap)
+        {
+            mElectricalMaterialLookupTable.SetAllBlues(entry.first.r, entry.first.g, &(entry.second));
+        }
+
+        for (auto const & entry : mNonInstancedElectricalMaterialMap)
+        {
+            mElectricalMaterialLookupTable.Set(entry.first, &(entry.second));
+        }
     }
 
     std::map<ColorKey, StructuralMaterial> mStructuralMaterialMap;
@@ -308,4 +388,8 @@ private:
     std::map<ColorKey, ElectricalMaterial, InstancedColorKeyComparer> mInstancedElectricalMaterialMap;
 
     UniqueStructuralMaterialsArray mUniqueStructuralMaterials;
+
+    // Lookup tables for the color keys found in ship images
+    ColorKeyLookupTable<StructuralMaterial> mStructuralMaterialLookupTable;
+    ColorKeyLookupTable<ElectricalMaterial> mElectricalMaterialLookupTable;
 };
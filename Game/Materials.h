@@ -11,6 +11,7 @@
 
 #include <picojson.h>
 
+#include <cstdint>
 #include <optional>
 #include <string>
 
@@ -83,6 +84,10 @@ public:
     float WindReceptivity;
     bool IsLegacyElectrical;
 
+    // Dense, zero-based index of this material among all structural materials
+    // of its database; assigned by the database
+    std::uint32_t Ordinal;
+
 public:
 
     static StructuralMaterial Create(picojson::object const & structuralMaterialJson);
@@ -167,6 +172,7 @@ public:
         , ExplosiveCombustionStrength(explosiveCombustionStrength)
         , WindReceptivity(windReceptivity)
         , IsLegacyElectrical(isLegacyElectrical)
+        , Ordinal(0)
     {}
 };
 
@@ -118,6 +118,7 @@ void NotificationLayer::SetStatusTexts(
 				<< " (" << lastDeltaPerfStats.TotalRenderDrawDuration.ToRatio<std::chrono::milliseconds>() << "MS)"
 				<< " (UPL=" << lastDeltaPerfStats.TotalUploadRenderDrawDuration.ToRatio<std::chrono::milliseconds>() << "MS"
 				<< " MT=" << lastDeltaPerfStats.TotalMainThreadRenderDrawDuration.ToRatio<std::chrono::milliseconds>() << "MS)"
+				<< " PTA=" << lastDeltaPerfStats.TotalUploadedShipPointAttributeBytes.ToAverage() / 1024.0f << "KB"
 				;
 
 			mStatusTextLines[2] = ss.str();
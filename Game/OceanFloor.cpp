@@ -15,9 +15,13 @@ template<typename T>
 static constexpr T RenderSlices = 500;
 
 OceanFloor::OceanFloor(OceanFloorTerrain && terrain)
-    : mBumpProfile(SamplesCount)
+    : mBumpProfile(TerrainSamplesCount)
     , mTerrain(std::move(terrain))
-    , mSamples(new Sample[SamplesCount + 1])
+    , mBaseSampleValues(TerrainSamplesCount + 1)
+    , mChunkDetails(ChunksCount)
+    , mMaxHeightTree(2 * TerrainSamplesCount)
+    , mSamples(SamplesCount + 1)
+    , mIsChunkStale(ChunksCount)
     , mCurrentSeaDepth(0.0f)
     , mCurrentOceanFloorBumpiness(0.0f)
     , mCurrentOceanFloorDetailAmplification(0.0f)
@@ -25,8 +29,8 @@ OceanFloor::OceanFloor(OceanFloorTerrain && terrain)
     // Calculate bump profile
     CalculateBumpProfile();
 
-    // Calculate samples
-    CalculateResultantSampleValues();
+    // Calculate base
+    CalculateBaseSampleValues();
 }
 
 void OceanFloor::SetTerrain(OceanFloorTerrain const & terrain)
@@ -34,8 +38,8 @@ void OceanFloor::SetTerrain(OceanFloorTerrain const & terrain)
     // Update terrain
     mTerrain = terrain;
 
-    // Recalculate samples
-    CalculateResultantSampleValues();
+    // Recalculate base
+    CalculateBaseSampleValues();
 }
 
 void OceanFloor::Update(GameParameters const & gameParameters)
@@ -63,8 +67,8 @@ void OceanFloor::Update(GameParameters const & gameParameters)
         mCurrentSeaDepth = gameParameters.SeaDepth;
         mCurrentOceanFloorDetailAmplification = gameParameters.OceanFloorDetailAmplification;
 
-        // Recalculate samples
-        CalculateResultantSampleValues();
+        // Recalculate base
+        CalculateBaseSampleValues();
     }
 }
 
@@ -121,7 +125,7 @@ void OceanFloor::Upload(
         {
             renderContext.UploadLand(
                 sampleIndexX,
-                mSamples[s + sampleIndex].SampleValue);
+                GetSample(s + sampleIndex).SampleValue);
         }
     }
 
@@ -166,29 +170,29 @@ std::optional<bool> OceanFloor::AdjustTo(
         : 1.0f;
 
     //
-    // Calculate left first sample index, minimizing error
+    // Calculate left first terrain sample index, minimizing error
     //
 
-    float const sampleIndexF = (leftX + GameParameters::HalfMaxWorldWidth) / Dx;
+    float const sampleIndexF = (leftX + GameParameters::HalfMaxWorldWidth) / TerrainDx;
 
     auto const sampleIndex = FastTruncateToArchInt(sampleIndexF + 0.5f);
 
-    assert(sampleIndex >= 0 && sampleIndex <= SamplesCount);
+    assert(sampleIndex >= 0 && sampleIndex <= TerrainSamplesCount);
 
 
     //
-    // Update values for all samples in the trajectory
+    // Update values for all terrain samples in the trajectory
     //
 
     bool hasAdjusted = false;
     float x = leftX;
-    for (auto s = sampleIndex; x <= rightX && s < SamplesCount; ++s, x += Dx)
+    for (size_t s = sampleIndex; x <= rightX && s < TerrainSamplesCount; ++s, x += TerrainDx)
     {
         // Calculate new sample value, i.e. trajectory's value
         float const newSampleValue = leftTargetY + slopeY * (x - leftX);
 
         // Decide whether it's a significant change
-        hasAdjusted |= std::abs(newSampleValue - mSamples[s].SampleValue) > 0.2f;
+        hasAdjusted |= std::abs(newSampleValue - CalculateResultantSampleValue(s * SamplesPerTerrainSample)) > 0.2f;
 
         // Translate sample value into terrain change
         // (inverse of CalculateResultantSampleValue(.))
@@ -197,8 +201,14 @@ std::optional<bool> OceanFloor::AdjustTo(
             (newSampleValue - mBumpProfile[s] + mCurrentSeaDepth)
             / mCurrentOceanFloorDetailAmplification;
 
-        // Update terrain and samples
+        // Update terrain
         SetTerrainHeight(s, newTerrainProfileSampleValue);
+
+        // The trajectory replaces whatever detail there was
+        for (size_t ds = s * SamplesPerTerrainSample; ds < (s + 1) * SamplesPerTerrainSample; ++ds)
+        {
+            SetDetailHeight(ds, 0.0f);
+        }
     }
 
     return hasAdjusted;
@@ -234,50 +244,174 @@ void OceanFloor::DisplaceAt(
     {
         // Left
         float lYOffset = yOffset * (1.0f - sampleIndexDx);
-        SetTerrainHeight(sampleIndexI, mTerrain[sampleIndexI] + lYOffset);
+        SetDetailHeight(sampleIndexI, GetDetailHeight(sampleIndexI) + lYOffset);
 
         // Right
         if (sampleIndexI < SamplesCount - 1)
         {
             float rYOffset = yOffset * sampleIndexDx;
-            SetTerrainHeight(sampleIndexI + 1, mTerrain[sampleIndexI + 1] + rYOffset);
+            SetDetailHeight(sampleIndexI + 1, GetDetailHeight(sampleIndexI + 1) + rYOffset);
         }
     }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////
 
+void OceanFloor::GenerateChunkSamples(size_t chunkIndex) const noexcept
+{
+    assert(chunkIndex < ChunksCount);
+
+    size_t const firstSampleIndex = chunkIndex * ChunkSamplesCount;
+    Sample * const samples = &(mSamples[firstSampleIndex]);
+
+    float previousSampleValue = CalculateResultantSampleValue(firstSampleIndex);
+
+    // The last sample's delta is with the first sample of the next chunk
+    for (size_t i = 1; i <= ChunkSamplesCount; ++i)
+    {
+        float const sampleValue = CalculateResultantSampleValue(firstSampleIndex + i);
+
+        samples[i - 1].SampleValue = previousSampleValue;
+        samples[i - 1].SampleValuePlusOneMinusSampleValue = sampleValue - previousSampleValue;
+
+        previousSampleValue = sampleValue;
+    }
+
+    if (chunkIndex == ChunksCount - 1)
+    {
+        // Populate extra sample - for x==MaxWorldWidth, where it has the same value as the last sample
+        samples[ChunkSamplesCount].SampleValue = previousSampleValue;
+        samples[ChunkSamplesCount].SampleValuePlusOneMinusSampleValue = 0.0f;
+    }
+
+    mIsChunkStale[chunkIndex] = false;
+}
+
+void OceanFloor::InvalidateChunks(
+    size_t firstSampleIndex,
+    size_t lastSampleIndex)
+{
+    assert(firstSampleIndex <= lastSampleIndex && lastSampleIndex <= SamplesCount);
+
+    // The previous sample's delta depends on the first sample
+    size_t const firstChunkIndex = (firstSampleIndex > 0 ? firstSampleIndex - 1 : 0) / ChunkSamplesCount;
+    size_t const lastChunkIndex = std::min(lastSampleIndex / ChunkSamplesCount, ChunksCount - 1);
+
+    for (size_t c = firstChunkIndex; c <= lastChunkIndex; ++c)
+    {
+        mIsChunkStale[c] = true;
+    }
+}
+
+void OceanFloor::InvalidateAllChunks()
+{
+    mIsChunkStale.fill(true);
+}
+
 void OceanFloor::SetTerrainHeight(
-    size_t sampleIndex,
+    size_t terrainSampleIndex,
     float terrainHeight)
 {
-    assert(sampleIndex >= 0 && sampleIndex < SamplesCount);
+    assert(terrainSampleIndex < TerrainSamplesCount);
 
     // Update terrain
-    mTerrain[sampleIndex] = terrainHeight;
+    mTerrain[terrainSampleIndex] = terrainHeight;
+
+    // Recalculate base value
+    mBaseSampleValues[terrainSampleIndex] = CalculateBaseSampleValue(terrainSampleIndex);
+
+    if (terrainSampleIndex == TerrainSamplesCount - 1)
+    {
+        // Make sure the final extra value is the same as the last value
+        mBaseSampleValues[TerrainSamplesCount] = mBaseSampleValues[TerrainSamplesCount - 1];
+    }
+
+    // Invalidate all the samples interpolating this value
+    size_t const firstSampleIndex = terrainSampleIndex > 0 ? (terrainSampleIndex - 1) * SamplesPerTerrainSample + 1 : 0;
+    size_t const lastSampleIndex = (terrainSampleIndex + 1) * SamplesPerTerrainSample;
+    InvalidateChunks(firstSampleIndex, lastSampleIndex);
+    UpdateMaxHeights(firstSampleIndex, lastSampleIndex);
+}
+
+void OceanFloor::SetDetailHeight(
+    size_t sampleIndex,
+    float detailHeight)
+{
+    assert(sampleIndex < SamplesCount);
+
+    size_t const chunkIndex = sampleIndex / ChunkSamplesCount;
+
+    if (!mChunkDetails[chunkIndex])
+    {
+        if (detailHeight == 0.0f)
+        {
+            // Nothing to do
+            return;
+        }
+
+        // Allocate detail for this chunk, with zeroes
+        mChunkDetails[chunkIndex] = std::make_unique<float[]>(ChunkSamplesCount);
+    }
 
-    // Recalculate sample value
-    float const newSampleValue = CalculateResultantSampleValue(sampleIndex);
+    mChunkDetails[chunkIndex][sampleIndex - chunkIndex * ChunkSamplesCount] = detailHeight;
 
-    // Update sample value
-    mSamples[sampleIndex].SampleValue = newSampleValue;
+    InvalidateChunks(sampleIndex, sampleIndex);
+    UpdateMaxHeights(sampleIndex, sampleIndex);
+}
+
+void OceanFloor::UpdateMaxHeights(
+    size_t firstSampleIndex,
+    size_t lastSampleIndex)
+{
+    assert(firstSampleIndex <= lastSampleIndex && lastSampleIndex <= SamplesCount);
+
+    // A sample at the start of a segment also ends the previous segment
+    size_t const firstTerrainSegmentIndex = (firstSampleIndex > 0 ? firstSampleIndex - 1 : 0) / SamplesPerTerrainSample;
+    size_t const lastTerrainSegmentIndex = std::min(lastSampleIndex / SamplesPerTerrainSample, TerrainSamplesCount - 1);
+
+    // Leaves
+    for (size_t t = firstTerrainSegmentIndex; t <= lastTerrainSegmentIndex; ++t)
+    {
+        mMaxHeightTree[TerrainSamplesCount + t] = CalculateTerrainSegmentMaxHeight(t);
+    }
+
+    // Ancestors, level by level
+    for (size_t l = (TerrainSamplesCount + firstTerrainSegmentIndex) / 2, r = (TerrainSamplesCount + lastTerrainSegmentIndex) / 2;
+        l >= 1;
+        l /= 2, r /= 2)
+    {
+        for (size_t i = l; i <= r; ++i)
+        {
+            mMaxHeightTree[i] = std::max(mMaxHeightTree[2 * i], mMaxHeightTree[2 * i + 1]);
+        }
+    }
+}
 
-    // Update previous sample's delta
-    if (sampleIndex > 0)
-        mSamples[sampleIndex - 1].SampleValuePlusOneMinusSampleValue = newSampleValue - mSamples[sampleIndex - 1].SampleValue;
+void OceanFloor::UpdateAllMaxHeights()
+{
+    // Leaves
+    for (size_t t = 0; t < TerrainSamplesCount; ++t)
+    {
+        mMaxHeightTree[TerrainSamplesCount + t] = CalculateTerrainSegmentMaxHeight(t);
+    }
 
-    if (sampleIndex < SamplesCount - 1)
+    // Ancestors
+    for (size_t i = TerrainSamplesCount - 1; i >= 1; --i)
     {
-        // Update this sample's delta;
-        // no point in updating delta of extra sample, as it's always zero,
-        // and no point in updating delta of last sample, as it's always zero
-        mSamples[sampleIndex].SampleValuePlusOneMinusSampleValue = mSamples[sampleIndex + 1].SampleValue - newSampleValue;
+        mMaxHeightTree[i] = std::max(mMaxHeightTree[2 * i], mMaxHeightTree[2 * i + 1]);
     }
-    else if (sampleIndex == SamplesCount - 1)
+}
+
+float OceanFloor::CalculateTerrainSegmentMaxHeight(size_t terrainSampleIndex) const
+{
+    // The floor is linear between samples, hence its maximum is at one of the samples
+    float maxHeight = std::numeric_limits<float>::lowest();
+    for (size_t s = terrainSampleIndex * SamplesPerTerrainSample; s <= (terrainSampleIndex + 1) * SamplesPerTerrainSample; ++s)
     {
-        // Make sure the final extra sample has the same value as the last sample
-        mSamples[SamplesCount].SampleValue = mSamples[SamplesCount - 1].SampleValue;
+        maxHeight = std::max(maxHeight, CalculateResultantSampleValue(s));
     }
+
+    return maxHeight;
 }
 
 void OceanFloor::CalculateBumpProfile()
@@ -287,7 +421,7 @@ void OceanFloor::CalculateBumpProfile()
     static constexpr float BumpFrequency3 = 0.001f;
 
     float x = 0.0;
-    for (size_t i = 0; i < SamplesCount; ++i, x += Dx)
+    for (size_t i = 0; i < TerrainSamplesCount; ++i, x += TerrainDx)
     {
         float const c1 = sinf(x * BumpFrequency1) * 10.f;
         float const c2 = sinf(x * BumpFrequency2) * 6.f;
@@ -296,33 +430,19 @@ void OceanFloor::CalculateBumpProfile()
     }
 }
 
-void OceanFloor::CalculateResultantSampleValues()
+void OceanFloor::CalculateBaseSampleValues()
 {
-    // sample index = 0
-    float previousSampleValue;
+    for (size_t i = 0; i < TerrainSamplesCount; ++i)
     {
-        previousSampleValue = CalculateResultantSampleValue(0);
-
-        mSamples[0].SampleValue = previousSampleValue;
-    }
-
-    // sample index = 1...SamplesCount-1
-    for (size_t i = 1; i < SamplesCount; ++i)
-    {
-        float const sampleValue = CalculateResultantSampleValue(i);
-
-        mSamples[i].SampleValue = sampleValue;
-        mSamples[i - 1].SampleValuePlusOneMinusSampleValue = sampleValue - previousSampleValue;
-
-        previousSampleValue = sampleValue;
+        mBaseSampleValues[i] = CalculateBaseSampleValue(i);
     }
 
-    // Populate last delta (extra sample has same value as this sample)
-    mSamples[SamplesCount - 1].SampleValuePlusOneMinusSampleValue = 0.0f;
+    // Populate extra value - same value as last value
+    mBaseSampleValues[TerrainSamplesCount] = mBaseSampleValues[TerrainSamplesCount - 1];
 
-    // Populate extra sample - same value as last sample
-    mSamples[SamplesCount].SampleValue = mSamples[SamplesCount - 1].SampleValue;
-    mSamples[SamplesCount].SampleValuePlusOneMinusSampleValue = 0.0f; // Accessed only for derivative at x=MaxWorldWidth
+    // All samples have changed
+    InvalidateAllChunks();
+    UpdateAllMaxHeights();
 }
 
 }
\ No newline at end of file
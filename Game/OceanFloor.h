@@ -13,8 +13,12 @@
 #include <GameCore/GameMath.h>
 #include <GameCore/UniqueBuffer.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <optional>
+#include <vector>
 
 namespace Physics
 {
@@ -52,6 +56,9 @@ public:
 
     /*
      * Assumption: x is in world boundaries.
+     *
+     * Not thread-safe, as chunks are made resident on demand; queries are
+     * expected to come from the simulation thread only.
      */
     float GetHeightAt(float x) const noexcept
     {
@@ -74,60 +81,274 @@ public:
         assert(sampleIndexI >= 0 && sampleIndexI <= SamplesCount);
         assert(sampleIndexDx >= 0.0f && sampleIndexDx <= 1.0f);
 
-        return mSamples[sampleIndexI].SampleValue
-            + mSamples[sampleIndexI].SampleValuePlusOneMinusSampleValue * sampleIndexDx;
+        Sample const & sample = GetSample(static_cast<size_t>(sampleIndexI));
+
+        return sample.SampleValue
+            + sample.SampleValuePlusOneMinusSampleValue * sampleIndexDx;
+    }
+
+    /*
+     * Batch version of GetHeightAt(); cheapest when the x's are close to each other,
+     * as then only the few chunks they span need to be made current.
+     *
+     * Assumption: all xs are in world boundaries.
+     */
+    void GetHeightsAt(
+        float const * restrict xs,
+        float * restrict heights,
+        size_t count) const noexcept
+    {
+        if (count == 0)
+            return;
+
+        //
+        // 1. Make current all the chunks spanned by the x's
+        //
+
+        float minX = xs[0];
+        float maxX = xs[0];
+        for (size_t i = 1; i < count; ++i)
+        {
+            minX = std::min(minX, xs[i]);
+            maxX = std::max(maxX, xs[i]);
+        }
+
+        MakeChunksCurrent(
+            static_cast<size_t>(FastTruncateToArchInt((minX + GameParameters::HalfMaxWorldWidth) / Dx)),
+            static_cast<size_t>(FastTruncateToArchInt((maxX + GameParameters::HalfMaxWorldWidth) / Dx)));
+
+        //
+        // 2. Interpolate samples
+        //
+
+        Sample const * const restrict samples = mSamples.get();
+        for (size_t i = 0; i < count; ++i)
+        {
+            float const sampleIndexF = (xs[i] + GameParameters::HalfMaxWorldWidth) / Dx;
+            auto const sampleIndexI = FastTruncateToArchInt(sampleIndexF);
+            float const sampleIndexDx = sampleIndexF - sampleIndexI;
+
+            assert(sampleIndexI >= 0 && static_cast<size_t>(sampleIndexI) <= SamplesCount);
+            assert(sampleIndexDx >= 0.0f && sampleIndexDx <= 1.0f);
+
+            heights[i] = samples[sampleIndexI].SampleValue
+                + samples[sampleIndexI].SampleValuePlusOneMinusSampleValue * sampleIndexDx;
+        }
+    }
+
+    /*
+     * Returns an upper bound of the height of the ocean floor between the two x's;
+     * x's outside of world boundaries are clamped to the boundaries.
+     */
+    float GetMaxHeightIn(
+        float leftX,
+        float rightX) const noexcept
+    {
+        assert(leftX <= rightX);
+
+        // Find the leaves of the terrain segments spanned by the x's
+        size_t leftLeaf = TerrainSegmentIndexOf(leftX) + TerrainSamplesCount;
+        size_t rightLeaf = TerrainSegmentIndexOf(rightX) + TerrainSamplesCount + 1;
+
+        // Visit the tree bottom-up
+        float maxHeight = std::numeric_limits<float>::lowest();
+        for (; leftLeaf < rightLeaf; leftLeaf /= 2, rightLeaf /= 2)
+        {
+            if (leftLeaf & 1)
+                maxHeight = std::max(maxHeight, mMaxHeightTree[leftLeaf++]);
+            if (rightLeaf & 1)
+                maxHeight = std::max(maxHeight, mMaxHeightTree[--rightLeaf]);
+        }
+
+        return maxHeight;
     }
 
 private:
 
+    // What we store for each sample
+    struct Sample
+    {
+        float SampleValue;
+        float SampleValuePlusOneMinusSampleValue; // Delta w/next
+    };
+
+    static inline size_t ChunkIndexOf(size_t sampleIndex) noexcept
+    {
+        assert(sampleIndex <= SamplesCount);
+
+        // The extra sample at x==MaxWorldWidth belongs to the last chunk
+        return std::min(sampleIndex / ChunkSamplesCount, ChunksCount - 1);
+    }
+
+    inline Sample const & GetSample(size_t sampleIndex) const noexcept
+    {
+        size_t const chunkIndex = ChunkIndexOf(sampleIndex);
+        if (mIsChunkStale[chunkIndex])
+        {
+            GenerateChunkSamples(chunkIndex);
+        }
+
+        return mSamples[sampleIndex];
+    }
+
+    inline void MakeChunksCurrent(
+        size_t firstSampleIndex,
+        size_t lastSampleIndex) const noexcept
+    {
+        for (size_t c = ChunkIndexOf(firstSampleIndex), lastChunkIndex = ChunkIndexOf(lastSampleIndex); c <= lastChunkIndex; ++c)
+        {
+            if (mIsChunkStale[c])
+            {
+                GenerateChunkSamples(c);
+            }
+        }
+    }
+
+    void GenerateChunkSamples(size_t chunkIndex) const noexcept;
+
+    void InvalidateChunks(
+        size_t firstSampleIndex,
+        size_t lastSampleIndex);
+
+    void InvalidateAllChunks();
+
+    static inline size_t TerrainSegmentIndexOf(float x) noexcept
+    {
+        float const terrainSampleIndexF = (Clamp(x, -GameParameters::HalfMaxWorldWidth, GameParameters::HalfMaxWorldWidth) + GameParameters::HalfMaxWorldWidth) / TerrainDx;
+        return std::min(static_cast<size_t>(terrainSampleIndexF), TerrainSamplesCount - 1);
+    }
+
+    void UpdateMaxHeights(
+        size_t firstSampleIndex,
+        size_t lastSampleIndex);
+
+    void UpdateAllMaxHeights();
+
+    float CalculateTerrainSegmentMaxHeight(size_t terrainSampleIndex) const;
+
     void SetTerrainHeight(
-        size_t sampleIndex,
+        size_t terrainSampleIndex,
         float terrainHeight);
 
+    inline float GetDetailHeight(size_t sampleIndex) const
+    {
+        assert(sampleIndex < SamplesCount);
+
+        size_t const chunkIndex = sampleIndex / ChunkSamplesCount;
+        return mChunkDetails[chunkIndex]
+            ? mChunkDetails[chunkIndex][sampleIndex - chunkIndex * ChunkSamplesCount]
+            : 0.0f;
+    }
+
+    void SetDetailHeight(
+        size_t sampleIndex,
+        float detailHeight);
+
     void CalculateBumpProfile();
 
-    void CalculateResultantSampleValues();
+    void CalculateBaseSampleValues();
 
-    inline float CalculateResultantSampleValue(size_t sampleIndex) const
+    inline float CalculateBaseSampleValue(size_t terrainSampleIndex) const
     {
-        assert(sampleIndex < SamplesCount);
+        assert(terrainSampleIndex < TerrainSamplesCount);
 
         return
             -mCurrentSeaDepth
-            + mBumpProfile[sampleIndex]
-            + mTerrain[sampleIndex] * mCurrentOceanFloorDetailAmplification;
+            + mBumpProfile[terrainSampleIndex]
+            + mTerrain[terrainSampleIndex] * mCurrentOceanFloorDetailAmplification;
+    }
+
+    inline float CalculateResultantSampleValue(size_t sampleIndex) const
+    {
+        assert(sampleIndex <= SamplesCount);
+
+        // The extra sample has the same value as the last sample
+        sampleIndex = std::min(sampleIndex, SamplesCount - 1);
+
+        // Base, linearly interpolated between terrain samples
+        size_t const terrainSampleIndex = sampleIndex / SamplesPerTerrainSample;
+        float const terrainSampleIndexDx =
+            static_cast<float>(sampleIndex - terrainSampleIndex * SamplesPerTerrainSample)
+            / static_cast<float>(SamplesPerTerrainSample);
+
+        float value =
+            mBaseSampleValues[terrainSampleIndex]
+            + (mBaseSampleValues[terrainSampleIndex + 1] - mBaseSampleValues[terrainSampleIndex]) * terrainSampleIndexDx;
+
+        // Detail, if any
+        size_t const chunkIndex = sampleIndex / ChunkSamplesCount;
+        if (mChunkDetails[chunkIndex])
+        {
+            value += mChunkDetails[chunkIndex][sampleIndex - chunkIndex * ChunkSamplesCount];
+        }
+
+        return value;
     }
 
 private:
 
+    //
+    // The ocean floor is the sum of two components:
+    //  - The base, at the resolution of the terrain: the bump profile plus the
+    //    (persisted) user-provided terrain;
+    //  - The detail, at a higher resolution, which we store sparsely in chunks,
+    //    allocated only for those chunks that have been displaced.
+    //
+    // We then sample the floor at the higher resolution; all samples are resident,
+    // but since only a few regions of the world are queried at any given moment,
+    // after a change they are regenerated lazily, one chunk at a time, and only
+    // when queried.
+    //
+
+    // The number of terrain samples
+    static constexpr size_t TerrainSamplesCount = GameParameters::OceanFloorTerrainSamples<size_t>;
+
+    // The x step of the terrain samples
+    static constexpr float TerrainDx = GameParameters::MaxWorldWidth / GameParameters::OceanFloorTerrainSamples<float>;
+
+    // The number of (high-resolution) samples for each terrain sample
+    static constexpr size_t SamplesPerTerrainSample = 8;
+
+    // The number of samples
+    static constexpr size_t SamplesCount = TerrainSamplesCount * SamplesPerTerrainSample;
+
+    // The x step of the samples
+    static constexpr float Dx = TerrainDx / static_cast<float>(SamplesPerTerrainSample);
+
+    // The number of samples in each chunk
+    static constexpr size_t ChunkSamplesCount = 256;
+
+    // The number of chunks
+    static constexpr size_t ChunksCount = SamplesCount / ChunkSamplesCount;
+
+    static_assert(SamplesCount % ChunkSamplesCount == 0);
+
     // The bump profile (ondulating component seafloor);
-    // one value for each sample
+    // one value for each terrain sample
     unique_buffer<float> mBumpProfile;
 
     // The terrain (user-provided component of seafloor);
-    // one value for each sample
+    // one value for each terrain sample
     OceanFloorTerrain mTerrain;
 
-    //
-    // Pre-calculated samples, i.e. world y of ocean floor at the sample's x
-    //
+    // The base values (plus 1 to account for x==MaxWorldWidth),
+    // derived from the bump profile and the terrain
+    unique_buffer<float> mBaseSampleValues;
 
-    // The number of samples
-    static constexpr size_t SamplesCount = GameParameters::OceanFloorTerrainSamples<size_t>;
+    // The detail of each chunk - ChunkSamplesCount values - or nullptr
+    // when the chunk has no detail
+    std::vector<std::unique_ptr<float[]>> mChunkDetails;
 
-    // The x step of the samples
-    static constexpr float Dx = GameParameters::MaxWorldWidth / GameParameters::OceanFloorTerrainSamples<float>;
+    // A segment tree of the maximum height of the floor in each terrain segment,
+    // i.e. between one terrain sample and the next, for bounding queries;
+    // node i has children 2i and 2i+1, and the leaves start at TerrainSamplesCount
+    unique_buffer<float> mMaxHeightTree;
 
-    // What we store for each sample
-    struct Sample
-    {
-        float SampleValue;
-        float SampleValuePlusOneMinusSampleValue; // Delta w/next
-    };
+    // The samples (plus 1 to account for x==MaxWorldWidth), generated lazily
+    unique_buffer<Sample> mutable mSamples;
 
-    // The current samples (plus 1 to account for x==MaxWorldWidth),
-    // derived from the components
-    std::unique_ptr<Sample[]> mSamples;
+    // For each chunk: whether its samples need to be regenerated
+    unique_buffer<bool> mutable mIsChunkStale;
 
     //
     // The game parameters for which we're current
@@ -7,8 +7,10 @@
 
 #include <GameCore/GameRandomEngine.h>
 #include <GameCore/GameWallClock.h>
+#include <GameCore/SysSpecifics.h>
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cmath>
 
@@ -19,6 +21,9 @@ namespace Physics {
 template<typename T>
 T constexpr RenderSlices = 500;
 
+// The wave number of wind gust ripples (# waves per unit of length)
+static float constexpr WindRippleWaveNumber = 5.0f;
+
 OceanSurface::OceanSurface(std::shared_ptr<GameEventDispatcher> gameEventDispatcher)
     : mGameEventHandler(std::move(gameEventDispatcher))
     , mSamples(new Sample[SamplesCount + 1]) // One extra sample for the rightmost X
@@ -43,6 +48,14 @@ OceanSurface::OceanSurface(std::shared_ptr<GameEventDispatcher> gameEventDispatc
     , mHeightField(new float[SWETotalSamples + 1]) // One extra cell just to ease interpolations
     , mVelocityField(new float[SWETotalSamples + 1]) // One extra cell just to ease interpolations
     ////////
+    , mRefinementFocusX()
+    , mRefinementWindowStartSample()
+    , mRefinedSamplesLeftX(std::numeric_limits<float>::max())
+    , mRefinedSamplesRightX(std::numeric_limits<float>::lowest())
+    , mRefinedHeightField() // Allocated when first needed
+    , mRefinedVelocityField() // Allocated when first needed
+    , mRefinedSamples() // Allocated when first needed
+    ////////
     , mSWEInteractiveWaveStateMachine()
     , mSWETsunamiWaveStateMachine()
     , mSWERogueWaveWaveStateMachine()
@@ -192,7 +205,17 @@ void OceanSurface::Update(
 
     ApplyDampingBoundaryConditions();
 
-    UpdateFields();
+    UpdateFields(
+        mHeightField.get(),
+        mVelocityField.get(),
+        SWETotalSamples);
+
+    UpdateRefinementWindow();
+
+    if (mRefinementWindowStartSample.has_value())
+    {
+        UpdateRefinedFields();
+    }
 
     ////// Calc avg height among all samples
     ////float avgHeight = 0.0f;
@@ -217,19 +240,48 @@ void OceanSurface::Update(
 void OceanSurface::Upload(
     GameParameters const & gameParameters,
     Render::RenderContext & renderContext) const
+{
+    if (renderContext.GetVisibleWorldLeft() >= mRefinedSamplesLeftX
+        && renderContext.GetVisibleWorldRight() <= mRefinedSamplesRightX)
+    {
+        // The refinement window covers the whole visible world
+        UploadSamples(
+            mRefinedSamples.get(),
+            mRefinedSamplesLeftX,
+            RefinedDx,
+            gameParameters,
+            renderContext);
+    }
+    else
+    {
+        UploadSamples(
+            mSamples.get(),
+            -GameParameters::HalfMaxWorldWidth,
+            Dx,
+            gameParameters,
+            renderContext);
+    }
+}
+
+void OceanSurface::UploadSamples(
+    Sample const * samples,
+    float samplesLeftX,
+    float dx,
+    GameParameters const & gameParameters,
+    Render::RenderContext & renderContext) const
 {
     //
     // We want to upload at most RenderSlices slices
     //
 
     // Find index of leftmost sample, and its corresponding world X
-    auto const sampleIndex = FastTruncateToArchInt((renderContext.GetVisibleWorldLeft() + GameParameters::HalfMaxWorldWidth) / Dx);
-    float sampleIndexX = -GameParameters::HalfMaxWorldWidth + (Dx * sampleIndex);
+    auto const sampleIndex = FastTruncateToArchInt((renderContext.GetVisibleWorldLeft() - samplesLeftX) / dx);
+    float sampleIndexX = samplesLeftX + (dx * sampleIndex);
 
     // Calculate number of samples required to cover screen from leftmost sample
     // up to the visible world right (included)
     float const coverageWidth = renderContext.GetVisibleWorldRight() - sampleIndexX;
-    auto const numberOfSamplesToRender = static_cast<size_t>(ceil(coverageWidth / Dx));
+    auto const numberOfSamplesToRender = static_cast<size_t>(ceil(coverageWidth / dx));
 
     if (numberOfSamplesToRender >= RenderSlices<size_t>)
     {
@@ -264,11 +316,11 @@ void OceanSurface::Upload(
 
         // We do one extra iteration as the number of slices is the number of quads, and the last vertical
         // quad side must be at the end of the width
-        for (size_t s = 0; s <= numberOfSamplesToRender; ++s, sampleIndexX += Dx)
+        for (size_t s = 0; s <= numberOfSamplesToRender; ++s, sampleIndexX += dx)
         {
             renderContext.UploadOcean(
                 sampleIndexX,
-                mSamples[s + sampleIndex].SampleValue,
+                samples[s + sampleIndex].SampleValue,
                 gameParameters.SeaDepth);
         }
     }
@@ -329,6 +381,57 @@ void OceanSurface::AdjustTo(
     }
 }
 
+void OceanSurface::DisplaceByVolumeDeltas(
+    float const * volumeDeltas,
+    size_t firstSampleIndex,
+    size_t endSampleIndex)
+{
+    assert(firstSampleIndex <= endSampleIndex && endSampleIndex <= SamplesCount + 1);
+
+    // The height raised by a unit of displaced volume
+    float constexpr VolumeToHeight = 0.02f / SWEHeightFieldAmplification; // Magic number
+
+    float const * restrict const deltas = volumeDeltas;
+    float * restrict const heightField = mHeightField.get() + SWEOuterLayerSamples;
+
+    for (size_t s = firstSampleIndex; s < endSampleIndex; ++s)
+    {
+        heightField[s] += deltas[s] * VolumeToHeight;
+    }
+
+    if (mRefinementWindowStartSample.has_value()
+        && firstSampleIndex < *mRefinementWindowStartSample + SWERefinementWindowSamples
+        && endSampleIndex > *mRefinementWindowStartSample)
+    {
+        //
+        // Displace the refined field too, interpolating the deltas
+        //
+
+        size_t const windowStartSample = *mRefinementWindowStartSample;
+
+        // The refined samples whose coarse neighbors are in the range
+        size_t const firstRefinedSample = (firstSampleIndex > windowStartSample)
+            ? (firstSampleIndex - 1 - windowStartSample) * SWERefinementFactor + 1
+            : 0;
+        size_t const endRefinedSample = std::min(
+            (endSampleIndex - windowStartSample) * SWERefinementFactor,
+            SWERefinedSamplesCount);
+
+        float * restrict const refinedHeightField = mRefinedHeightField.get();
+
+        for (size_t r = firstRefinedSample; r < endRefinedSample; ++r)
+        {
+            size_t const s = windowStartSample + r / SWERefinementFactor;
+            float const sDx = static_cast<float>(r % SWERefinementFactor) / static_cast<float>(SWERefinementFactor);
+
+            float const delta0 = (s >= firstSampleIndex && s < endSampleIndex) ? deltas[s] : 0.0f;
+            float const delta1 = (s + 1 >= firstSampleIndex && s + 1 < endSampleIndex) ? deltas[s + 1] : 0.0f;
+
+            refinedHeightField[r] += ((1.0f - sDx) * delta0 + sDx * delta1) * VolumeToHeight;
+        }
+    }
+}
+
 void OceanSurface::ApplyThanosSnap(
     float leftFrontX,
     float rightFrontX)
@@ -342,6 +445,16 @@ void OceanSurface::ApplyThanosSnap(
 
     for (auto idx = sampleIndexStart; idx <= sampleIndexEnd; ++idx)
         mHeightField[idx] -= WaterDepression;
+
+    if (mRefinementWindowStartSample.has_value())
+    {
+        for (size_t r = 0; r < SWERefinedSamplesCount; ++r)
+        {
+            float const x = mRefinedSamplesLeftX + static_cast<float>(r) * RefinedDx;
+            if (x >= leftFrontX && x <= rightFrontX)
+                mRefinedHeightField[r] -= WaterDepression;
+        }
+    }
 }
 
 void OceanSurface::TriggerTsunami(float currentSimulationTime)
@@ -430,6 +543,21 @@ void OceanSurface::SetSWEWaveHeight(
             && idx < SWEOuterLayerSamples + SamplesCount + SWEWaveGenerationSamples)
         {
             mHeightField[idx] = height;
+
+            if (mRefinementWindowStartSample.has_value())
+            {
+                // Set the refined cells covered by this sample, if any
+                int const refinedCenterIndex =
+                    (idx - static_cast<int>(SWEOuterLayerSamples + *mRefinementWindowStartSample))
+                    * static_cast<int>(SWERefinementFactor);
+
+                for (int r = std::max(refinedCenterIndex - static_cast<int>(SWERefinementFactor / 2), 0);
+                    r <= std::min(refinedCenterIndex + static_cast<int>(SWERefinementFactor / 2), static_cast<int>(SWERefinedSamplesCount) - 1);
+                    ++r)
+                {
+                    mRefinedHeightField[r] = height;
+                }
+            }
         }
     }
 }
@@ -662,34 +790,211 @@ void OceanSurface::ApplyDampingBoundaryConditions()
 
 }
 
-void OceanSurface::UpdateFields()
+void OceanSurface::UpdateFields(
+    float * restrict heightField,
+    float * restrict velocityField,
+    size_t samplesCount)
 {
-    // Height field  : from 0 to SWETotalSamples
-    // Velocity field: from 1 to SWETotalSamples
+    // Height field  : from 0 to samplesCount
+    // Velocity field: from 1 to samplesCount
 
     // We will divide deltaField by Dx (spatial derivatives) and
-    // then multiply by dt (because we are integrating over time)
+    // then multiply by dt (because we are integrating over time);
+    // the refined grid divides both by the same factor, hence it
+    // shares these factors
     float constexpr FactorH = GameParameters::SimulationStepTimeDuration<float> / Dx;
     float constexpr FactorV = FactorH * GameParameters::GravityMagnitude;
 
-    mHeightField[0] -=
-        mHeightField[0]
-        * (mVelocityField[0 + 1] - mVelocityField[0])
-        * FactorH;
+    //
+    // Each height only depends on the velocities at its two edges, and each
+    // velocity only on the (updated) heights at its two sides, hence we
+    // update all heights first and all velocities next, in two independent
+    // sweeps without loop-carried dependencies
+    //
 
-    for (size_t i = 1; i < SWETotalSamples; ++i)
+    for (size_t i = 0; i < samplesCount; ++i)
     {
-        mHeightField[i] -=
-            mHeightField[i]
-            * (mVelocityField[i + 1] - mVelocityField[i])
+        heightField[i] -=
+            heightField[i]
+            * (velocityField[i + 1] - velocityField[i])
             * FactorH;
+    }
 
-        mVelocityField[i] +=
-            (mHeightField[i - 1] - mHeightField[i])
+    for (size_t i = 1; i < samplesCount; ++i)
+    {
+        velocityField[i] +=
+            (heightField[i - 1] - heightField[i])
             * FactorV;
     }
 }
 
+void OceanSurface::UpdateRefinementWindow()
+{
+    if (!mRefinementFocusX.has_value())
+    {
+        if (mRefinementWindowStartSample.has_value())
+        {
+            // Disable
+            mRefinementWindowStartSample.reset();
+            mRefinedSamplesLeftX = std::numeric_limits<float>::max();
+            mRefinedSamplesRightX = std::numeric_limits<float>::lowest();
+        }
+
+        return;
+    }
+
+    size_t const focusSample = static_cast<size_t>(ToSampleIndex(
+        Clamp(*mRefinementFocusX, -GameParameters::HalfMaxWorldWidth, GameParameters::HalfMaxWorldWidth)));
+
+    // Only move the window when the focus leaves its central half, as
+    // moving it loses the detail accumulated so far
+    if (!mRefinementWindowStartSample.has_value()
+        || focusSample < *mRefinementWindowStartSample + SWERefinementWindowSamples / 4
+        || focusSample >= *mRefinementWindowStartSample + SWERefinementWindowSamples * 3 / 4)
+    {
+        size_t const windowStartSample = std::min(
+            focusSample - std::min(focusSample, SWERefinementWindowSamples / 2),
+            SamplesCount - SWERefinementWindowSamples);
+
+        PlaceRefinementWindow(windowStartSample);
+    }
+}
+
+void OceanSurface::PlaceRefinementWindow(size_t windowStartSample)
+{
+    assert(windowStartSample + SWERefinementWindowSamples <= SamplesCount);
+
+    if (!mRefinedHeightField)
+    {
+        // One extra cell just to ease interpolations
+        mRefinedHeightField.reset(new float[SWERefinedSamplesCount + 1]);
+        mRefinedVelocityField.reset(new float[SWERefinedSamplesCount + 1]);
+
+        // One extra sample for the rightmost X
+        mRefinedSamples.reset(new Sample[SWERefinedSamplesCount + 1]);
+        mRefinedSamples[SWERefinedSamplesCount].SampleValuePlusOneMinusSampleValue = 0.0f;
+    }
+
+    mRefinementWindowStartSample = windowStartSample;
+    mRefinedSamplesLeftX = -GameParameters::HalfMaxWorldWidth + static_cast<float>(windowStartSample) * Dx;
+    mRefinedSamplesRightX = mRefinedSamplesLeftX + static_cast<float>(SWERefinedSamplesCount - 1) * RefinedDx;
+
+    //
+    // Initialize the refined fields by interpolating the coarse fields
+    //
+
+    for (size_t i = 0; i <= SWERefinedSamplesCount; ++i)
+    {
+        mRefinedHeightField[i] = GetCoarseHeightAt(
+            mRefinedSamplesLeftX + static_cast<float>(i) * RefinedDx);
+
+        // Velocities are at the left edge of their cell
+        mRefinedVelocityField[i] = GetCoarseVelocityAt(
+            mRefinedSamplesLeftX + (static_cast<float>(i) - 0.5f) * RefinedDx);
+    }
+}
+
+void OceanSurface::UpdateRefinedFields()
+{
+    assert(mRefinementWindowStartSample.has_value());
+
+    //
+    // 1. Advance the refined fields - in as many steps as the refinement factor, so that
+    //    the refined fields are as stable as the coarse ones - relaxing them towards the
+    //    (already updated) coarse fields at both ends of the window
+    //
+
+    // The coarse fields at the relaxation samples, from the edges inwards
+    std::array<float, SWERefinementRelaxationSamples + 1> leftTargetHeights;
+    std::array<float, SWERefinementRelaxationSamples + 1> leftTargetVelocities;
+    std::array<float, SWERefinementRelaxationSamples + 1> rightTargetHeights;
+    std::array<float, SWERefinementRelaxationSamples + 1> rightTargetVelocities;
+    for (size_t i = 0; i <= SWERefinementRelaxationSamples; ++i)
+    {
+        size_t const r = SWERefinedSamplesCount - 1 - i;
+
+        leftTargetHeights[i] = GetCoarseHeightAt(mRefinedSamplesLeftX + static_cast<float>(i) * RefinedDx);
+        leftTargetVelocities[i] = GetCoarseVelocityAt(mRefinedSamplesLeftX + (static_cast<float>(i) - 0.5f) * RefinedDx);
+        rightTargetHeights[i] = GetCoarseHeightAt(mRefinedSamplesLeftX + static_cast<float>(r) * RefinedDx);
+        rightTargetVelocities[i] = GetCoarseVelocityAt(mRefinedSamplesLeftX + (static_cast<float>(r) + 0.5f) * RefinedDx);
+    }
+
+    for (size_t step = 0; step < SWERefinementFactor; ++step)
+    {
+        UpdateFields(
+            mRefinedHeightField.get(),
+            mRefinedVelocityField.get(),
+            SWERefinedSamplesCount);
+
+        // Relax - fully at the edges, and fading inwards; without this, the
+        // mismatch between the two fields at the edges grows unbounded
+        for (size_t i = 0; i <= SWERefinementRelaxationSamples; ++i)
+        {
+            float const relaxation = 1.0f - static_cast<float>(i) / static_cast<float>(SWERefinementRelaxationSamples);
+            size_t const r = SWERefinedSamplesCount - 1 - i;
+
+            mRefinedHeightField[i] += (leftTargetHeights[i] - mRefinedHeightField[i]) * relaxation;
+            mRefinedVelocityField[i] += (leftTargetVelocities[i] - mRefinedVelocityField[i]) * relaxation;
+            mRefinedHeightField[r] += (rightTargetHeights[i] - mRefinedHeightField[r]) * relaxation;
+            mRefinedVelocityField[r + 1] += (rightTargetVelocities[i] - mRefinedVelocityField[r + 1]) * relaxation;
+        }
+    }
+
+    //
+    // 2. Replace the coarse fields in the window with the average of the refined fields,
+    //    leaving alone the samples at each end which keep feeding the refined fields
+    //
+
+    static_assert(SWERefinementFactor % 2 == 0);
+    size_t constexpr HalfFactor = SWERefinementFactor / 2;
+
+    float const * restrict const refinedHeightField = mRefinedHeightField.get();
+    float const * restrict const refinedVelocityField = mRefinedVelocityField.get();
+    float * restrict const heightField = mHeightField.get() + SWEOuterLayerSamples + *mRefinementWindowStartSample;
+    float * restrict const velocityField = mVelocityField.get() + SWEOuterLayerSamples + *mRefinementWindowStartSample;
+
+    for (size_t i = SWERefinementBoundarySamples; i < SWERefinementWindowSamples - SWERefinementBoundarySamples; ++i)
+    {
+        size_t const r = i * SWERefinementFactor;
+
+        // The coarse height averages the refined cells it covers, with the
+        // two extreme ones shared with the neighbors
+        float height = 0.5f * (refinedHeightField[r - HalfFactor] + refinedHeightField[r + HalfFactor]);
+        for (size_t j = r - HalfFactor + 1; j < r + HalfFactor; ++j)
+            height += refinedHeightField[j];
+
+        heightField[i] = height / static_cast<float>(SWERefinementFactor);
+
+        // The coarse velocity sits halfway between two refined velocities
+        velocityField[i] = 0.5f * (refinedVelocityField[r - HalfFactor] + refinedVelocityField[r - HalfFactor + 1]);
+    }
+}
+
+float OceanSurface::GetCoarseHeightAt(float x) const
+{
+    float const indexF = (x + GameParameters::HalfMaxWorldWidth) / Dx + static_cast<float>(SWEOuterLayerSamples);
+    auto const indexI = FastTruncateToArchInt(indexF);
+    float const indexDx = indexF - indexI;
+
+    assert(indexI >= 0 && static_cast<size_t>(indexI) < SWETotalSamples);
+
+    return (1.0f - indexDx) * mHeightField[indexI]
+        + indexDx * mHeightField[indexI + 1];
+}
+
+float OceanSurface::GetCoarseVelocityAt(float x) const
+{
+    // Velocities are at the left edge of their cell
+    float const indexF = (x + GameParameters::HalfMaxWorldWidth) / Dx + static_cast<float>(SWEOuterLayerSamples) + 0.5f;
+    auto const indexI = FastTruncateToArchInt(indexF);
+    float const indexDx = indexF - indexI;
+
+    assert(indexI >= 0 && static_cast<size_t>(indexI) < SWETotalSamples);
+
+    return (1.0f - indexDx) * mVelocityField[indexI]
+        + indexDx * mVelocityField[indexI + 1];
+}
+
 void OceanSurface::GenerateSamples(
     float currentSimulationTime,
     Wind const & wind,
@@ -709,7 +1014,6 @@ void OceanSurface::GenerateSamples(
     // Wind gust ripples
     //
 
-    float constexpr WindRippleWaveNumber = 5.0f; // # waves per unit of length
     float constexpr WindRippleWaveHeight = 0.25f;
 
     float const windSpeedAbsoluteMagnitude = wind.GetCurrentWindSpeed().length();
@@ -731,38 +1035,69 @@ void OceanSurface::GenerateSamples(
     // Generate samples
     //
 
-    float const x = -GameParameters::HalfMaxWorldWidth;
-
-    float const basalWave2AmplitudeCoeff =
+    SampleGenerationParameters const sampleGenerationParameters{
+        currentSimulationTime,
+        secondaryBasalComponentPhase,
+        windRipplesAngularVelocity,
+        // Basal wave 2 amplitude coefficient
         (mBasalWaveAmplitude1 != 0.0f)
-        ? mBasalWaveAmplitude2 / mBasalWaveAmplitude1
-        : 0.0f;
-
-    float const rippleWaveAmplitudeCoeff =
+            ? mBasalWaveAmplitude2 / mBasalWaveAmplitude1
+            : 0.0f,
+        // Ripple wave amplitude coefficient
         (mBasalWaveAmplitude1 != 0.0f)
-        ? windRipplesWaveHeight / mBasalWaveAmplitude1
-        : 0.0f;
+            ? windRipplesWaveHeight / mBasalWaveAmplitude1
+            : 0.0f };
+
+    GenerateSampleRange(
+        mSamples.get(),
+        SamplesCount,
+        mHeightField.get() + SWEOuterLayerSamples,
+        -GameParameters::HalfMaxWorldWidth,
+        Dx,
+        sampleGenerationParameters);
+
+    if (mRefinementWindowStartSample.has_value())
+    {
+        GenerateSampleRange(
+            mRefinedSamples.get(),
+            SWERefinedSamplesCount,
+            mRefinedHeightField.get(),
+            mRefinedSamplesLeftX,
+            RefinedDx,
+            sampleGenerationParameters);
+    }
+}
+
+void OceanSurface::GenerateSampleRange(
+    Sample * samples,
+    size_t samplesCount,
+    float const * heightField,
+    float x,
+    float dx,
+    SampleGenerationParameters const & parameters) const
+{
+    assert(samplesCount > 0);
 
-    float sinArg1 = (mBasalWaveNumber1 * x - mBasalWaveAngularVelocity1 * currentSimulationTime) / (2 * Pi<float>);
-    float sinArg2 = (mBasalWaveNumber2 * x - mBasalWaveAngularVelocity2 * currentSimulationTime + secondaryBasalComponentPhase) / (2 * Pi<float>);
-    float sinArgRipple = (WindRippleWaveNumber * x - windRipplesAngularVelocity * currentSimulationTime) / (2 * Pi<float>);
+    float sinArg1 = (mBasalWaveNumber1 * x - mBasalWaveAngularVelocity1 * parameters.CurrentSimulationTime) / (2 * Pi<float>);
+    float sinArg2 = (mBasalWaveNumber2 * x - mBasalWaveAngularVelocity2 * parameters.CurrentSimulationTime + parameters.SecondaryBasalComponentPhase) / (2 * Pi<float>);
+    float sinArgRipple = (WindRippleWaveNumber * x - parameters.WindRipplesAngularVelocity * parameters.CurrentSimulationTime) / (2 * Pi<float>);
 
     // sample index = 0
     float previousSampleValue;
     {
         float const sweValue =
-            (mHeightField[SWEOuterLayerSamples + 0] - SWEHeightFieldOffset)
+            (heightField[0] - SWEHeightFieldOffset)
             * SWEHeightFieldAmplification;
 
         float const basalValue1 =
             mBasalWaveSin1.GetLinearlyInterpolatedPeriodic(sinArg1);
 
         float const basalValue2 =
-            basalWave2AmplitudeCoeff
+            parameters.BasalWave2AmplitudeCoeff
             * mBasalWaveSin1.GetLinearlyInterpolatedPeriodic(sinArg2);
 
         float const rippleValue =
-            rippleWaveAmplitudeCoeff
+            parameters.RippleWaveAmplitudeCoeff
             * mBasalWaveSin1.GetLinearlyInterpolatedPeriodic(sinArgRipple);
 
         previousSampleValue =
@@ -771,18 +1106,18 @@ void OceanSurface::GenerateSamples(
             + basalValue2
             + rippleValue;
 
-        mSamples[0].SampleValue = previousSampleValue;
+        samples[0].SampleValue = previousSampleValue;
     }
 
-    float const sinArg1Dx = mBasalWaveNumber1 * Dx / (2 * Pi<float>);
-    float const sinArg2Dx = mBasalWaveNumber2 * Dx / (2 * Pi<float>);
-    float const sinArgRippleDx = WindRippleWaveNumber * Dx / (2 * Pi<float>);
+    float const sinArg1Dx = mBasalWaveNumber1 * dx / (2 * Pi<float>);
+    float const sinArg2Dx = mBasalWaveNumber2 * dx / (2 * Pi<float>);
+    float const sinArgRippleDx = WindRippleWaveNumber * dx / (2 * Pi<float>);
 
-    // sample index = 1...SamplesCount - 1
-    for (size_t i = 1; i < SamplesCount; ++i)
+    // sample index = 1...samplesCount - 1
+    for (size_t i = 1; i < samplesCount; ++i)
     {
         float const sweValue =
-            (mHeightField[SWEOuterLayerSamples + i] - SWEHeightFieldOffset)
+            (heightField[i] - SWEHeightFieldOffset)
             * SWEHeightFieldAmplification;
 
         sinArg1 += sinArg1Dx;
@@ -791,12 +1126,12 @@ void OceanSurface::GenerateSamples(
 
         sinArg2 += sinArg2Dx;
         float const basalValue2 =
-            basalWave2AmplitudeCoeff
+            parameters.BasalWave2AmplitudeCoeff
             * mBasalWaveSin1.GetLinearlyInterpolatedPeriodic(sinArg2);
 
         sinArgRipple += sinArgRippleDx;
         float const rippleValue =
-            rippleWaveAmplitudeCoeff
+            parameters.RippleWaveAmplitudeCoeff
             * mBasalWaveSin1.GetLinearlyInterpolatedPeriodic(sinArgRipple);
 
         float const sampleValue =
@@ -805,20 +1140,20 @@ void OceanSurface::GenerateSamples(
             + basalValue2
             + rippleValue;
 
-        mSamples[i].SampleValue = sampleValue;
-        mSamples[i - 1].SampleValuePlusOneMinusSampleValue = sampleValue - previousSampleValue;
+        samples[i].SampleValue = sampleValue;
+        samples[i - 1].SampleValuePlusOneMinusSampleValue = sampleValue - previousSampleValue;
 
         previousSampleValue = sampleValue;
     }
 
     // Populate last delta (extra sample will have same value as this sample)
-    mSamples[SamplesCount - 1].SampleValuePlusOneMinusSampleValue = 0.0f;
+    samples[samplesCount - 1].SampleValuePlusOneMinusSampleValue = 0.0f;
 
     // Populate extra sample - same value as last sample
-    assert(previousSampleValue == mSamples[SamplesCount - 1].SampleValue);
-    mSamples[SamplesCount].SampleValue = previousSampleValue;
+    assert(previousSampleValue == samples[samplesCount - 1].SampleValue);
+    samples[samplesCount].SampleValue = previousSampleValue;
 
-    assert(mSamples[SamplesCount].SampleValuePlusOneMinusSampleValue == 0.0f);
+    assert(samples[samplesCount].SampleValuePlusOneMinusSampleValue == 0.0f);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////
@@ -33,6 +33,15 @@ public:
         GameParameters const & gameParameters,
         Render::RenderContext & renderContext) const;
 
+    /*
+     * Sets the world X around which the ocean surface is simulated at a higher resolution,
+     * starting from the next update; none disables the higher resolution.
+     */
+    void SetRefinementFocus(std::optional<float> focusX)
+    {
+        mRefinementFocusX = focusX;
+    }
+
 private:
 
     static inline auto ToSampleIndex(float x)
@@ -55,6 +64,23 @@ public:
         assert(x >= -GameParameters::HalfMaxWorldWidth
             && x <= GameParameters::HalfMaxWorldWidth + 0.01f); // Allow for derivative taking
 
+        if (x >= mRefinedSamplesLeftX && x <= mRefinedSamplesRightX)
+        {
+            //
+            // Served by the refinement window
+            //
+
+            float const refinedSampleIndexF = (x - mRefinedSamplesLeftX) / RefinedDx;
+            auto const refinedSampleIndexI = FastTruncateToArchInt(refinedSampleIndexF);
+            float const refinedSampleIndexDx = refinedSampleIndexF - refinedSampleIndexI;
+
+            assert(refinedSampleIndexI >= 0 && static_cast<size_t>(refinedSampleIndexI) < SWERefinedSamplesCount);
+            assert(refinedSampleIndexDx >= 0.0f && refinedSampleIndexDx <= 1.0f);
+
+            return mRefinedSamples[refinedSampleIndexI].SampleValue
+                + mRefinedSamples[refinedSampleIndexI].SampleValuePlusOneMinusSampleValue * refinedSampleIndexDx;
+        }
+
         //
         // Find sample index and interpolate in-between that sample and the next
         //
@@ -75,6 +101,22 @@ public:
             + mSamples[sampleIndexI].SampleValuePlusOneMinusSampleValue * sampleIndexDx;
     }
 
+    /*
+     * Batch version of GetHeightAt().
+     *
+     * Assumption: all xs are in world boundaries.
+     */
+    void GetHeightsAt(
+        float const * xs,
+        float * heights,
+        size_t count) const noexcept
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            heights[i] = GetHeightAt(xs[i]);
+        }
+    }
+
     void AdjustTo(
         std::optional<vec2f> const & worldCoordinates,
         float currentSimulationTime);
@@ -105,8 +147,33 @@ public:
         // Distribute among the two samples
         mHeightField[SWEOuterLayerSamples + sampleIndexI] += (1.0f - sampleIndexDx) * yOffset / SWEHeightFieldAmplification;
         mHeightField[SWEOuterLayerSamples + sampleIndexI + 1] += sampleIndexDx * yOffset / SWEHeightFieldAmplification;
+
+        if (x >= mRefinedSamplesLeftX && x <= mRefinedSamplesRightX)
+        {
+            // Distribute among the two refined samples too
+            float const refinedSampleIndexF = (x - mRefinedSamplesLeftX) / RefinedDx;
+            auto const refinedSampleIndexI = FastTruncateToArchInt(refinedSampleIndexF);
+            float const refinedSampleIndexDx = refinedSampleIndexF - refinedSampleIndexI;
+
+            assert(refinedSampleIndexI >= 0 && static_cast<size_t>(refinedSampleIndexI) < SWERefinedSamplesCount);
+
+            mRefinedHeightField[refinedSampleIndexI] += (1.0f - refinedSampleIndexDx) * yOffset / SWEHeightFieldAmplification;
+            mRefinedHeightField[refinedSampleIndexI + 1] += refinedSampleIndexDx * yOffset / SWEHeightFieldAmplification;
+        }
     }
 
+    /*
+     * Displaces the ocean surface by changes in the volume of water displaced by a body,
+     * one per sample, for the samples in [firstSampleIndex, endSampleIndex).
+     *
+     * A growing displacement raises the surface - e.g. a bow wave - while a shrinking one
+     * lowers it - e.g. a wake.
+     */
+    void DisplaceByVolumeDeltas(
+        float const * volumeDeltas,
+        size_t firstSampleIndex,
+        size_t endSampleIndex);
+
     void ApplyThanosSnap(
         float leftFrontX,
         float rightFrontX);
@@ -143,17 +210,26 @@ private:
 
     void ApplyDampingBoundaryConditions();
 
-    void UpdateFields();
+    static void UpdateFields(
+        float * heightField,
+        float * velocityField,
+        size_t samplesCount);
+
+    void UpdateRefinementWindow();
+
+    void PlaceRefinementWindow(size_t windowStartSample);
+
+    void UpdateRefinedFields();
+
+    float GetCoarseHeightAt(float x) const;
+
+    float GetCoarseVelocityAt(float x) const;
 
     void GenerateSamples(
         float currentSimulationTime,
         Wind const & wind,
         GameParameters const & gameParameters);
 
-private:
-
-    std::shared_ptr<GameEventDispatcher> mGameEventHandler;
-
     // What we store for each sample
     struct Sample
     {
@@ -161,6 +237,35 @@ private:
         float SampleValuePlusOneMinusSampleValue; // Delta between next sample and this sample
     };
 
+    // The non-SWE components of the samples at the current step
+    struct SampleGenerationParameters
+    {
+        float CurrentSimulationTime;
+        float SecondaryBasalComponentPhase;
+        float WindRipplesAngularVelocity;
+        float BasalWave2AmplitudeCoeff;
+        float RippleWaveAmplitudeCoeff;
+    };
+
+    void GenerateSampleRange(
+        Sample * samples,
+        size_t samplesCount,
+        float const * heightField,
+        float x,
+        float dx,
+        SampleGenerationParameters const & parameters) const;
+
+    void UploadSamples(
+        Sample const * samples,
+        float samplesLeftX,
+        float dx,
+        GameParameters const & gameParameters,
+        Render::RenderContext & renderContext) const;
+
+private:
+
+    std::shared_ptr<GameEventDispatcher> mGameEventHandler;
+
     // The samples (plus 1 to account for x==MaxWorldWidth)
     std::unique_ptr<Sample[]> mSamples;
 
@@ -200,6 +305,27 @@ private:
         + SamplesCount
         + SWEOuterLayerSamples;
 
+    // The number of refined samples for each sample in the refinement window
+    static size_t constexpr SWERefinementFactor = 4;
+
+    // The width of the refinement window, in (coarse) samples
+    static size_t constexpr SWERefinementWindowSamples = 256;
+
+    // The number of refined samples at each end of the refinement window which
+    // are relaxed towards the coarse fields
+    static size_t constexpr SWERefinementRelaxationSamples = 16;
+
+    // The number of (coarse) samples at each end of the refinement window which
+    // are not overwritten by the refined fields, as they provide the refined
+    // fields with their boundary conditions
+    static size_t constexpr SWERefinementBoundarySamples = 6;
+
+    // The total number of samples in the refined SWE buffers
+    static size_t constexpr SWERefinedSamplesCount = SWERefinementWindowSamples * SWERefinementFactor;
+
+    // The x step of the refined samples
+    static float constexpr RefinedDx = Dx / static_cast<float>(SWERefinementFactor);
+
     //
     // Calculated coefficients
     //
@@ -236,6 +362,26 @@ private:
     // - Velocity values are at the edges of the staggered grid cells
     std::unique_ptr<float[]> mVelocityField;
 
+    //
+    // Refinement window: a window of the SWE layer simulated at a higher resolution,
+    // nested in the coarse layer - which provides it with its boundary conditions, and
+    // which takes back its averaged fields.
+    // Queries and rendering are served by the refined samples where available
+    //
+
+    std::optional<float> mRefinementFocusX;
+
+    // The (coarse) sample at which the window starts; none when there's no window
+    std::optional<size_t> mRefinementWindowStartSample;
+
+    // The world X of the first and last refined samples; an empty interval when there's no window
+    float mRefinedSamplesLeftX;
+    float mRefinedSamplesRightX;
+
+    std::unique_ptr<float[]> mRefinedHeightField;
+    std::unique_ptr<float[]> mRefinedVelocityField;
+    std::unique_ptr<Sample[]> mRefinedSamples;
+
 private:
 
     //
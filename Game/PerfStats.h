@@ -5,9 +5,13 @@
 ***************************************************************************************/
 #pragma once
 
+#include <GameCore/BufferArena.h>
 #include <GameCore/GameChronometer.h>
+#include <GameCore/GameTypes.h>
 
 #include <atomic>
+#include <cstdint>
+#include <vector>
 
 struct PerfStats
 {
@@ -92,6 +96,84 @@ struct PerfStats
         }
     };
 
+    struct Quantity
+    {
+    private:
+
+        struct _Quantity
+        {
+            std::uint64_t Total;
+            size_t Denominator;
+
+            _Quantity() noexcept
+                : Total(0)
+                , Denominator(0)
+            {}
+
+            _Quantity(
+                std::uint64_t total,
+                size_t denominator)
+                : Total(total)
+                , Denominator(denominator)
+            {}
+        };
+
+        std::atomic<_Quantity> mQuantity;
+
+    public:
+
+        Quantity()
+            : mQuantity()
+        {}
+
+        Quantity(Quantity const & other)
+        {
+            mQuantity.store(other.mQuantity.load());
+        }
+
+        Quantity const & operator=(Quantity const & other)
+        {
+            mQuantity.store(other.mQuantity.load());
+            return *this;
+        }
+
+        inline void Update(std::uint64_t amount)
+        {
+            auto quantity = mQuantity.load();
+            quantity.Total += amount;
+            quantity.Denominator += 1;
+            mQuantity.store(quantity);
+        }
+
+        inline float ToAverage() const
+        {
+            _Quantity const quantity = mQuantity.load();
+
+            if (quantity.Denominator == 0)
+                return 0.0f;
+
+            return static_cast<float>(quantity.Total) / static_cast<float>(quantity.Denominator);
+        }
+
+        inline void Reset()
+        {
+            mQuantity.store(_Quantity());
+        }
+
+        friend Quantity operator-(Quantity const & lhs, Quantity const & rhs)
+        {
+            auto const lQuantity = lhs.mQuantity.load();
+            auto const rQuantity = rhs.mQuantity.load();
+            _Quantity result(
+                lQuantity.Total - rQuantity.Total,
+                lQuantity.Denominator - rQuantity.Denominator);
+
+            Quantity res;
+            res.mQuantity.store(result);
+            return res;
+        }
+    };
+
     // Update
     Ratio TotalUpdateDuration;
     Ratio TotalOceanSurfaceUpdateDuration;
@@ -107,6 +189,7 @@ struct PerfStats
     Ratio TotalMainThreadRenderDrawDuration;
     Ratio TotalRenderDrawDuration; // In render thread
     Ratio TotalUploadRenderDrawDuration;
+    Quantity TotalUploadedShipPointAttributeBytes; // Per render-draw
 
     PerfStats()
     {
@@ -127,6 +210,7 @@ struct PerfStats
         TotalMainThreadRenderDrawDuration.Reset();
         TotalRenderDrawDuration.Reset();
         TotalUploadRenderDrawDuration.Reset();
+        TotalUploadedShipPointAttributeBytes.Reset();
     }
 
     PerfStats & operator=(PerfStats const & other) = default;
@@ -148,6 +232,51 @@ inline PerfStats operator-(PerfStats const & lhs, PerfStats const & rhs)
     perfStats.TotalMainThreadRenderDrawDuration = lhs.TotalMainThreadRenderDrawDuration - rhs.TotalMainThreadRenderDrawDuration;
     perfStats.TotalRenderDrawDuration = lhs.TotalRenderDrawDuration - rhs.TotalRenderDrawDuration;
     perfStats.TotalUploadRenderDrawDuration = lhs.TotalUploadRenderDrawDuration - rhs.TotalUploadRenderDrawDuration;
+    perfStats.TotalUploadedShipPointAttributeBytes = lhs.TotalUploadedShipPointAttributeBytes - rhs.TotalUploadedShipPointAttributeBytes;
 
     return perfStats;
-}
\ No newline at end of file
+}
+
+/*
+ * Counts of the elements currently being simulated.
+ */
+struct SimulationStatistics
+{
+    std::uint64_t ShipCount;
+    std::uint64_t PointCount; // Ship points, excluding ephemeral points
+    std::uint64_t SpringCount;
+    std::uint64_t TriangleCount;
+    std::uint64_t EphemeralParticleCount;
+
+    SimulationStatistics()
+        : ShipCount(0)
+        , PointCount(0)
+        , SpringCount(0)
+        , TriangleCount(0)
+        , EphemeralParticleCount(0)
+    {}
+};
+
+/*
+ * Breakdown of the memory taken by a ship's element buffers.
+ */
+struct ShipMemoryReport
+{
+    ShipId Ship;
+    size_t ArenaCapacityByteSize;
+    size_t ArenaAllocatedByteSize;
+    size_t ArenaBlockCount;
+    bool IsArenaHugePageBacked;
+    std::vector<BufferArena::AllocationInfo> Buffers;
+
+    ShipMemoryReport(
+        ShipId ship,
+        BufferArena const & arena)
+        : Ship(ship)
+        , ArenaCapacityByteSize(arena.GetCapacityByteSize())
+        , ArenaAllocatedByteSize(arena.GetAllocatedByteSize())
+        , ArenaBlockCount(arena.GetBlockCount())
+        , IsArenaHugePageBacked(arena.IsHugePageBacked())
+        , Buffers(arena.GetAllocations())
+    {}
+};
\ No newline at end of file
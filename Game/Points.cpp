@@ -119,7 +119,11 @@ void Points::CreateEphemeralParticleAirBubble(
     PlaneId planeId)
 {
     // Get a free slot (but don't steal one)
-    auto pointIndex = FindFreeEphemeralParticle(currentSimulationTime, false);
+    auto pointIndex = AllocateEphemeralParticle(
+        EphemeralType::AirBubble,
+        currentSimulationTime,
+        std::numeric_limits<float>::max(),
+        false);
     if (NoneElementIndex == pointIndex)
         return; // No luck
 
@@ -173,9 +177,6 @@ void Points::CreateEphemeralParticleAirBubble(
     assert(mMaterialRustReceptivityBuffer[pointIndex] == 0.0f);
     //mMaterialRustReceptivityBuffer[pointIndex] = 0.0f;
 
-    mEphemeralParticleAttributes1Buffer[pointIndex].Type = EphemeralType::AirBubble;
-    mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime = currentSimulationTime;
-    mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime = std::numeric_limits<float>::max();
     mEphemeralParticleAttributes2Buffer[pointIndex].State = EphemeralState::AirBubbleState(
         vortexAmplitude,
         vortexPeriod);
@@ -199,7 +200,11 @@ void Points::CreateEphemeralParticleDebris(
     PlaneId planeId)
 {
     // Get a free slot (or steal one)
-    auto pointIndex = FindFreeEphemeralParticle(currentSimulationTime, true);
+    auto pointIndex = AllocateEphemeralParticle(
+        EphemeralType::Debris,
+        currentSimulationTime,
+        maxSimulationLifetime,
+        true);
     assert(NoneElementIndex != pointIndex);
 
     //
@@ -245,9 +250,6 @@ void Points::CreateEphemeralParticleDebris(
     assert(mMaterialRustReceptivityBuffer[pointIndex] == 0.0f);
     //mMaterialRustReceptivityBuffer[pointIndex] = 0.0f;
 
-    mEphemeralParticleAttributes1Buffer[pointIndex].Type = EphemeralType::Debris;
-    mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime = currentSimulationTime;
-    mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime = maxSimulationLifetime;
     mEphemeralParticleAttributes2Buffer[pointIndex].State = EphemeralState::DebrisState();
 
     assert(mConnectedComponentIdBuffer[pointIndex] == NoneConnectedComponentId);
@@ -272,10 +274,6 @@ void Points::CreateEphemeralParticleSmoke(
     PlaneId planeId,
     GameParameters const & gameParameters)
 {
-    // Get a free slot (or steal one)
-    auto pointIndex = FindFreeEphemeralParticle(currentSimulationTime, true);
-    assert(NoneElementIndex != pointIndex);
-
     // Choose a lifetime
     float const maxSimulationLifetime =
         gameParameters.SmokeParticleLifetimeAdjustment
@@ -283,6 +281,14 @@ void Points::CreateEphemeralParticleSmoke(
             GameParameters::MinSmokeParticlesLifetime,
             GameParameters::MaxSmokeParticlesLifetime);
 
+    // Get a free slot (or steal one)
+    auto pointIndex = AllocateEphemeralParticle(
+        EphemeralType::Smoke,
+        currentSimulationTime,
+        maxSimulationLifetime,
+        true);
+    assert(NoneElementIndex != pointIndex);
+
     //
     // Store attributes
     //
@@ -332,9 +338,6 @@ void Points::CreateEphemeralParticleSmoke(
     assert(mMaterialRustReceptivityBuffer[pointIndex] == 0.0f);
     //mMaterialRustReceptivityBuffer[pointIndex] = 0.0f;
 
-    mEphemeralParticleAttributes1Buffer[pointIndex].Type = EphemeralType::Smoke;
-    mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime = currentSimulationTime;
-    mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime = maxSimulationLifetime;
     mEphemeralParticleAttributes2Buffer[pointIndex].State = EphemeralState::SmokeState(
         textureGroup,
         growth,
@@ -359,7 +362,11 @@ void Points::CreateEphemeralParticleSparkle(
     PlaneId planeId)
 {
     // Get a free slot (or steal one)
-    auto pointIndex = FindFreeEphemeralParticle(currentSimulationTime, true);
+    auto pointIndex = AllocateEphemeralParticle(
+        EphemeralType::Sparkle,
+        currentSimulationTime,
+        maxSimulationLifetime,
+        true);
     assert(NoneElementIndex != pointIndex);
 
     //
@@ -405,9 +412,6 @@ void Points::CreateEphemeralParticleSparkle(
     assert(mMaterialRustReceptivityBuffer[pointIndex] == 0.0f);
     //mMaterialRustReceptivityBuffer[pointIndex] = 0.0f;
 
-    mEphemeralParticleAttributes1Buffer[pointIndex].Type = EphemeralType::Sparkle;
-    mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime = currentSimulationTime;
-    mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime = maxSimulationLifetime;
     mEphemeralParticleAttributes2Buffer[pointIndex].State = EphemeralState::SparkleState();
 
     assert(mConnectedComponentIdBuffer[pointIndex] == NoneConnectedComponentId);
@@ -425,7 +429,11 @@ void Points::CreateEphemeralParticleWakeBubble(
     GameParameters const & gameParameters)
 {
     // Get a free slot (but don't steal one)
-    auto pointIndex = FindFreeEphemeralParticle(currentSimulationTime, false);
+    auto pointIndex = AllocateEphemeralParticle(
+        EphemeralType::WakeBubble,
+        currentSimulationTime,
+        0.4f, // Magic number
+        false);
     if (NoneElementIndex == pointIndex)
         return; // No luck
 
@@ -476,9 +484,6 @@ void Points::CreateEphemeralParticleWakeBubble(
     assert(mMaterialRustReceptivityBuffer[pointIndex] == 0.0f);
     //mMaterialRustReceptivityBuffer[pointIndex] = 0.0f;
 
-    mEphemeralParticleAttributes1Buffer[pointIndex].Type = EphemeralType::WakeBubble;
-    mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime = currentSimulationTime;
-    mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime = 0.4f; // Magic number
     mEphemeralParticleAttributes2Buffer[pointIndex].State = EphemeralState::WakeBubbleState();
 
     assert(mConnectedComponentIdBuffer[pointIndex] == NoneConnectedComponentId);
@@ -643,7 +648,7 @@ void Points::UpdateCombustionLowFrequency(
     // - Burning->Decay, Extinguishing transition
     //
 
-    // Prepare candidates for ignition and explosion; we'll pick the top N ones
+    // Prepare candidates for ignition and explosion; we only keep the top N ones
     // based on the ignition temperature delta
     mCombustionIgnitionCandidates.clear();
     mCombustionExplosionCandidates.clear();
@@ -680,14 +685,14 @@ void Points::UpdateCombustionLowFrequency(
                     && !mParentWorld.IsUnderwater(GetPosition(pointIndex)))
                 {
                     // Store point as ignition candidate
-                    mCombustionIgnitionCandidates.emplace_back(
+                    mCombustionIgnitionCandidates.emplace(
                         pointIndex,
                         (GetTemperature(pointIndex) - effectiveIgnitionTemperature) / effectiveIgnitionTemperature);
                 }
                 else if (combustionType == StructuralMaterial::MaterialCombustionType::Explosion)
                 {
                     // Store point as explosion candidate
-                    mCombustionExplosionCandidates.emplace_back(
+                    mCombustionExplosionCandidates.emplace(
                         pointIndex,
                         (GetTemperature(pointIndex) - effectiveIgnitionTemperature) / effectiveIgnitionTemperature);
                 }
@@ -754,6 +759,7 @@ void Points::UpdateCombustionLowFrequency(
 
                 // Decay point
                 mDecayBuffer[pointIndex] *= decayAlpha;
+                mDecayRenderDirtyChunks.MarkDirty(pointIndex);
 
 
                 //
@@ -763,6 +769,7 @@ void Points::UpdateCombustionLowFrequency(
                 for (auto const s : GetConnectedSprings(pointIndex).ConnectedSprings)
                 {
                     mDecayBuffer[s.OtherEndpointIndex] *= decayAlpha;
+                    mDecayRenderDirtyChunks.MarkDirty(s.OtherEndpointIndex);
                 }
             }
         }
@@ -775,6 +782,9 @@ void Points::UpdateCombustionLowFrequency(
 
     if (!mCombustionIgnitionCandidates.empty())
     {
+        // Sort top N candidates by ignition temperature delta
+        mCombustionIgnitionCandidates.finalize();
+
         // Randomly choose the max number of points we want to ignite now,
         // honoring MaxBurningParticles at the same time
         size_t const maxIgnitionPoints = std::min(
@@ -785,22 +795,12 @@ void Points::UpdateCombustionLowFrequency(
                 : size_t(0)),
             mCombustionIgnitionCandidates.size());
 
-        // Sort top N candidates by ignition temperature delta
-        std::nth_element(
-            mCombustionIgnitionCandidates.data(),
-            mCombustionIgnitionCandidates.data() + maxIgnitionPoints,
-            mCombustionIgnitionCandidates.data() + mCombustionIgnitionCandidates.size(),
-            [](auto const & t1, auto const & t2)
-            {
-                return std::get<1>(t1) > std::get<1>(t2);
-            });
-
         // Ignite these points
         for (size_t i = 0; i < maxIgnitionPoints; ++i)
         {
             assert(i < mCombustionIgnitionCandidates.size());
 
-            auto const pointIndex = std::get<0>(mCombustionIgnitionCandidates[i]);
+            auto const pointIndex = mCombustionIgnitionCandidates[i].Element;
 
             //
             // Ignite!
@@ -810,7 +810,7 @@ void Points::UpdateCombustionLowFrequency(
 
             // Initial development depends on how deep this particle is in its burning zone
             mCombustionStateBuffer[pointIndex].FlameDevelopment =
-                0.1f + 0.5f * SmoothStep(0.0f, 2.0f, std::get<1>(mCombustionIgnitionCandidates[i]));
+                0.1f + 0.5f * SmoothStep(0.0f, 2.0f, mCombustionIgnitionCandidates[i].Priority);
 
             // Max development: random and depending on number of springs connected to this point
             // (so chains have smaller flames)
@@ -851,19 +851,10 @@ void Points::UpdateCombustionLowFrequency(
 
     if (!mCombustionExplosionCandidates.empty())
     {
-        size_t const maxExplosionPoints = std::min(
-            size_t(10), // Magic number
-            mCombustionExplosionCandidates.size());
-
         // Sort top N candidates by ignition temperature delta
-        std::nth_element(
-            mCombustionExplosionCandidates.data(),
-            mCombustionExplosionCandidates.data() + maxExplosionPoints,
-            mCombustionExplosionCandidates.data() + mCombustionExplosionCandidates.size(),
-            [](auto const & t1, auto const & t2)
-            {
-                return std::get<1>(t1) > std::get<1>(t2);
-            });
+        mCombustionExplosionCandidates.finalize();
+
+        size_t const maxExplosionPoints = mCombustionExplosionCandidates.size();
 
         // Calculate blast heat
         float const blastHeat =
@@ -878,7 +869,7 @@ void Points::UpdateCombustionLowFrequency(
         {
             assert(i < mCombustionExplosionCandidates.size());
 
-            auto const pointIndex = std::get<0>(mCombustionExplosionCandidates[i]);
+            auto const pointIndex = mCombustionExplosionCandidates[i].Element;
             auto const pointPosition = GetPosition(pointIndex);
 
             //
@@ -1228,221 +1219,315 @@ void Points::UpdateEphemeralParticles(
     float currentSimulationTime,
     GameParameters const & gameParameters)
 {
-    // Transformation from desired velocity impulse to force
-    float const randomWalkVelocityImpulseToForceCoefficient =
-        GameParameters::AirMass
-        / gameParameters.SimulationStepTimeDuration<float>;
+    //
+    // Run the state machines of each type of particle as a batch: first expired
+    // particles are compacted out of their lanes, and then the survivors are
+    // updated in tight loops over the lanes
+    //
+
+    UpdateEphemeralParticlesAirBubble(currentSimulationTime, gameParameters);
+    UpdateEphemeralParticlesDebris(currentSimulationTime);
+    UpdateEphemeralParticlesSmoke(currentSimulationTime, gameParameters);
+    UpdateEphemeralParticlesSparkle(currentSimulationTime);
+    UpdateEphemeralParticlesWakeBubble(currentSimulationTime);
+}
+
+void Points::CalculateEphemeralParticleLifetimes(
+    EphemeralParticleLane & lane,
+    float currentSimulationTime)
+{
+    size_t const count = lane.size();
 
-    // Ocean surface displacement at bubbles surfacing
-    float const oceanFloorDisplacementAtAirBubbleSurfacingSurfaceOffset =
-        (gameParameters.DoDisplaceOceanSurfaceAtAirBubblesSurfacing ? 1.0f : 0.0f)
-        * 1.0f;
+    lane.ElapsedSimulationLifetimes.resize(count);
+    lane.LifetimeProgresses.resize(count);
 
-    for (ElementIndex pointIndex : this->EphemeralPoints())
+    float const * const restrict startSimulationTimes = lane.StartSimulationTimes.data();
+    float const * const restrict maxSimulationLifetimes = lane.MaxSimulationLifetimes.data();
+    float * const restrict elapsedSimulationLifetimes = lane.ElapsedSimulationLifetimes.data();
+    float * const restrict lifetimeProgresses = lane.LifetimeProgresses.data();
+
+    // Branch-free, vectorized by the compiler
+    for (size_t i = 0; i < count; ++i)
     {
-        auto const ephemeralType = GetEphemeralType(pointIndex);
-        if (EphemeralType::None != ephemeralType)
+        elapsedSimulationLifetimes[i] = currentSimulationTime - startSimulationTimes[i];
+        lifetimeProgresses[i] = elapsedSimulationLifetimes[i] / maxSimulationLifetimes[i];
+    }
+}
+
+void Points::CalculateEphemeralParticleOceanSurfaceDepths(EphemeralParticleLane & lane) const
+{
+    size_t const count = lane.size();
+
+    lane.PositionXs.resize(count);
+    lane.OceanSurfaceDepths.resize(count);
+
+    ElementIndex const * const restrict pointIndices = lane.PointIndices.data();
+    vec2f const * const restrict positions = mPositionBuffer.data();
+    float * const restrict positionXs = lane.PositionXs.data();
+    float * const restrict oceanSurfaceDepths = lane.OceanSurfaceDepths.data();
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        positionXs[i] = positions[pointIndices[i]].x;
+    }
+
+    // Look up the ocean surface under all particles in one go
+    mParentWorld.GetOceanSurfaceHeightsAt(positionXs, oceanSurfaceDepths, count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        oceanSurfaceDepths[i] -= positions[pointIndices[i]].y;
+    }
+}
+
+void Points::UpdateEphemeralParticlesAirBubble(
+    float currentSimulationTime,
+    GameParameters const & gameParameters)
+{
+    auto & lane = mEphemeralParticleLanes[static_cast<size_t>(EphemeralType::AirBubble)];
+
+    CalculateEphemeralParticleLifetimes(lane, currentSimulationTime);
+    CalculateEphemeralParticleOceanSurfaceDepths(lane);
+
+    //
+    // Expire bubbles that got to the surface, unless they're pinned
+    //
+
+    CompactEphemeralParticleLane<true>(
+        lane,
+        [this, &lane](size_t i)
         {
-            //
-            // Run this particle's state machine
-            //
+            return lane.OceanSurfaceDepths[i] <= 0.0f
+                && !IsPinned(lane.PointIndices[i]);
+        });
 
-            switch (ephemeralType)
-            {
-                case EphemeralType::AirBubble:
-                {
-                    // Do not advance air bubble if it's pinned
-                    if (!IsPinned(pointIndex))
-                    {
-                        auto const & position = GetPosition(pointIndex);
-                        float const waterHeight = mParentWorld.GetOceanSurfaceHeightAt(position.x);
-                        float const deltaY = waterHeight - position.y; // Positive when point _below_ surface
-                        if (deltaY <= 0.0f)
-                        {
-                            // Got to the surface, expire
-                            ExpireEphemeralParticle(pointIndex);
-                        }
-                        else
-                        {
-                            //
-                            // Update progress based off y
-                            //
-
-                            auto & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.AirBubble;
-
-                            state.CurrentDeltaY = deltaY;
-                            state.Progress = // 0.00..001 (@ way below surface) -> 1.0 (@ surface)
-                                -1.0f
-                                / (-1.0f + std::min(GetPosition(pointIndex).y, 0.0f));
-
-                            //
-                            // Update vortex
-                            //
-
-                            float const simulationLifetime =
-                                currentSimulationTime
-                                - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
-
-                            float const vortexAmplitude = 
-                                state.VortexAmplitude 
-                                * std::min(1.0f, simulationLifetime / 5.0f);
-
-                            float const vortexValue =
-                                vortexAmplitude
-                                * PrecalcLoFreqSin.GetNearestPeriodic(
-                                    state.NormalizedVortexAngularVelocity * simulationLifetime);
-
-                            // Update position with delta
-                            mPositionBuffer[pointIndex].x += vortexValue - state.LastVortexValue;
-
-                            state.LastVortexValue = vortexValue;
-
-                            //
-                            // Displace ocean surface, if surfacing
-                            //
-
-                            if (deltaY < oceanFloorDisplacementAtAirBubbleSurfacingSurfaceOffset)
-                            {
-                                mParentWorld.DisplaceOceanSurfaceAt(
-                                    mPositionBuffer[pointIndex].x,
-                                    (oceanFloorDisplacementAtAirBubbleSurfacingSurfaceOffset - deltaY) / 8.0f); // Magic number
-
-                                mGameEventHandler->OnAirBubbleSurfaced(1);
-                            }
-                        }
-                    }
+    size_t const count = lane.size();
+    ElementIndex const * const restrict pointIndices = lane.PointIndices.data();
+    float const * const restrict elapsedSimulationLifetimes = lane.ElapsedSimulationLifetimes.data();
+    float const * const restrict oceanSurfaceDepths = lane.OceanSurfaceDepths.data(); // Positive when point _below_ surface
 
-                    break;
-                }
+    //
+    // Rise: update progress and vortex; pinned bubbles do not advance
+    //
 
-                case EphemeralType::Debris:
-                {
-                    // Check if expired
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
-                    auto const maxSimulationLifetime = mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
-                    if (elapsedSimulationLifetime >= maxSimulationLifetime)
-                    {
-                        ExpireEphemeralParticle(pointIndex);
+    for (size_t i = 0; i < count; ++i)
+    {
+        ElementIndex const pointIndex = pointIndices[i];
+        assert(EphemeralType::AirBubble == GetEphemeralType(pointIndex));
 
-                        // Remember that ephemeral points are now dirty
-                        mAreEphemeralPointsDirtyForRendering = true;
-                    }
-                    else
-                    {
-                        // Update alpha based off remaining time
+        if (IsPinned(pointIndex))
+            continue;
 
-                        float alpha = std::max(
-                            1.0f - elapsedSimulationLifetime / maxSimulationLifetime,
-                            0.0f);
+        auto & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.AirBubble;
 
-                        mColorBuffer[pointIndex].w = alpha;
-                        mIsEphemeralColorBufferDirty = true;
-                    }
+        // Update progress based off y
+        state.CurrentDeltaY = oceanSurfaceDepths[i];
+        state.Progress = // 0.00..001 (@ way below surface) -> 1.0 (@ surface)
+            -1.0f
+            / (-1.0f + std::min(mPositionBuffer[pointIndex].y, 0.0f));
 
-                    break;
-                }
+        // Update vortex
 
-                case EphemeralType::Smoke:
-                {
-                    // Calculate progress
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
-                    assert(mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime > 0.0f);
-                    float const lifetimeProgress =
-                        elapsedSimulationLifetime
-                        / mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
-
-                    // Check if expired
-                    auto const & position = GetPosition(pointIndex);
-                    if (lifetimeProgress >= 1.0f
-                        || mParentWorld.IsUnderwater(position))
-                    {
-                        //
-                        /// Expired
-                        //
+        float const simulationLifetime = elapsedSimulationLifetimes[i];
 
-                        ExpireEphemeralParticle(pointIndex);
-                    }
-                    else
-                    {
-                        //
-                        // Still alive
-                        //
-
-                        // Update progress
-                        mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.LifetimeProgress = lifetimeProgress;
-                        if (EphemeralState::SmokeState::GrowthType::Slow == mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.Growth)
-                        {
-                            mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.ScaleProgress =
-                                std::min(1.0f, elapsedSimulationLifetime / 5.0f);
-                        }
-                        else
-                        {
-                            assert(EphemeralState::SmokeState::GrowthType::Fast == mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.Growth);
-                            mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke.ScaleProgress =
-                                1.07f * (1.0f - exp(-3.0f * lifetimeProgress));
-                        }
-
-                        // Inject random walk in direction orthogonal to current velocity
-                        float const randomWalkMagnitude =
-                            0.3f * (static_cast<float>(GameRandomEngine::GetInstance().Choose<int>(2)) - 0.5f);
-                        vec2f const deviationDirection =
-                            GetVelocity(pointIndex).normalise().to_perpendicular();
-                        mNonSpringForceBuffer[pointIndex] +=
-                            deviationDirection * randomWalkMagnitude
-                            * randomWalkVelocityImpulseToForceCoefficient;
-                    }
+        float const vortexAmplitude =
+            state.VortexAmplitude
+            * std::min(1.0f, simulationLifetime / 5.0f);
 
-                    break;
-                }
+        float const vortexValue =
+            vortexAmplitude
+            * PrecalcLoFreqSin.GetNearestPeriodic(
+                state.NormalizedVortexAngularVelocity * simulationLifetime);
 
-                case EphemeralType::Sparkle:
-                {
-                    // Check if expired
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
-                    auto const maxSimulationLifetime = mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
-                    if (elapsedSimulationLifetime >= maxSimulationLifetime
-                        || mParentWorld.IsUnderwater(GetPosition(pointIndex)))
-                    {
-                        ExpireEphemeralParticle(pointIndex);
-                    }
-                    else
-                    {
-                        // Update progress based off remaining time
-                        assert(maxSimulationLifetime > 0.0f);
-                        mEphemeralParticleAttributes2Buffer[pointIndex].State.Sparkle.Progress =
-                            elapsedSimulationLifetime / maxSimulationLifetime;
-                    }
+        // Update position with delta
+        mPositionBuffer[pointIndex].x += vortexValue - state.LastVortexValue;
 
-                    break;
-                }
+        state.LastVortexValue = vortexValue;
+    }
 
-                case EphemeralType::WakeBubble:
-                {
-                    // Check if expired
-                    auto const elapsedSimulationLifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[pointIndex].StartSimulationTime;
-                    auto const maxSimulationLifetime = mEphemeralParticleAttributes2Buffer[pointIndex].MaxSimulationLifetime;
-                    if (elapsedSimulationLifetime >= maxSimulationLifetime
-                        || !mParentWorld.IsUnderwater(GetPosition(pointIndex)))
-                    {
-                        ExpireEphemeralParticle(pointIndex);
-                    }
-                    else
-                    {
-                        // Update progress based off remaining time
-                        assert(maxSimulationLifetime > 0.0f);
-                        mEphemeralParticleAttributes2Buffer[pointIndex].State.WakeBubble.Progress =
-                            elapsedSimulationLifetime / maxSimulationLifetime;
-                    }
+    //
+    // Displace ocean surface at bubbles that are surfacing
+    //
 
-                    break;
-                }
+    if (gameParameters.DoDisplaceOceanSurfaceAtAirBubblesSurfacing)
+    {
+        float constexpr SurfacingDepth = 1.0f;
 
-                default:
-                {
-                    // Do nothing
-                }
+        unsigned int surfacedCount = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (oceanSurfaceDepths[i] < SurfacingDepth
+                && !IsPinned(pointIndices[i]))
+            {
+                mParentWorld.DisplaceOceanSurfaceAt(
+                    mPositionBuffer[pointIndices[i]].x,
+                    (SurfacingDepth - oceanSurfaceDepths[i]) / 8.0f); // Magic number
+
+                ++surfacedCount;
             }
         }
+
+        if (surfacedCount > 0)
+        {
+            mGameEventHandler->OnAirBubbleSurfaced(surfacedCount);
+        }
+    }
+}
+
+void Points::UpdateEphemeralParticlesDebris(float currentSimulationTime)
+{
+    auto & lane = mEphemeralParticleLanes[static_cast<size_t>(EphemeralType::Debris)];
+
+    CalculateEphemeralParticleLifetimes(lane, currentSimulationTime);
+
+    size_t const expiredCount = CompactEphemeralParticleLane<false>(
+        lane,
+        [&lane](size_t i)
+        {
+            return lane.LifetimeProgresses[i] >= 1.0f;
+        });
+
+    if (expiredCount > 0)
+    {
+        // Remember that ephemeral points are now dirty
+        mAreEphemeralPointsDirtyForRendering = true;
+    }
+
+    size_t const count = lane.size();
+    ElementIndex const * const restrict pointIndices = lane.PointIndices.data();
+    float const * const restrict lifetimeProgresses = lane.LifetimeProgresses.data();
+    vec4f * const restrict colors = mColorBuffer.data();
+
+    // Update alpha based off remaining time
+    for (size_t i = 0; i < count; ++i)
+    {
+        assert(EphemeralType::Debris == GetEphemeralType(pointIndices[i]));
+
+        colors[pointIndices[i]].w = std::max(1.0f - lifetimeProgresses[i], 0.0f);
+    }
+
+    if (count > 0)
+    {
+        mIsEphemeralColorBufferDirty = true;
+    }
+}
+
+void Points::UpdateEphemeralParticlesSmoke(
+    float currentSimulationTime,
+    GameParameters const & gameParameters)
+{
+    auto & lane = mEphemeralParticleLanes[static_cast<size_t>(EphemeralType::Smoke)];
+
+    CalculateEphemeralParticleLifetimes(lane, currentSimulationTime);
+    CalculateEphemeralParticleOceanSurfaceDepths(lane);
+
+    CompactEphemeralParticleLane<true>(
+        lane,
+        [&lane](size_t i)
+        {
+            return lane.LifetimeProgresses[i] >= 1.0f
+                || lane.OceanSurfaceDepths[i] > 0.0f; // Underwater
+        });
+
+    size_t const count = lane.size();
+    ElementIndex const * const restrict pointIndices = lane.PointIndices.data();
+    float const * const restrict elapsedSimulationLifetimes = lane.ElapsedSimulationLifetimes.data();
+    float const * const restrict lifetimeProgresses = lane.LifetimeProgresses.data();
+
+    //
+    // Growth
+    //
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        ElementIndex const pointIndex = pointIndices[i];
+        assert(EphemeralType::Smoke == GetEphemeralType(pointIndex));
+        assert(lane.MaxSimulationLifetimes[i] > 0.0f);
+
+        auto & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke;
+
+        state.LifetimeProgress = lifetimeProgresses[i];
+        state.ScaleProgress = (EphemeralState::SmokeState::GrowthType::Slow == state.Growth)
+            ? std::min(1.0f, elapsedSimulationLifetimes[i] / 5.0f)
+            : 1.07f * (1.0f - exp(-3.0f * lifetimeProgresses[i]));
+    }
+
+    //
+    // Random walk in direction orthogonal to current velocity
+    //
+
+    // Transformation from desired velocity impulse to force
+    float const randomWalkVelocityImpulseToForceCoefficient =
+        GameParameters::AirMass
+        / gameParameters.SimulationStepTimeDuration<float>;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        ElementIndex const pointIndex = pointIndices[i];
+
+        float const randomWalkMagnitude =
+            0.3f * (static_cast<float>(GameRandomEngine::GetInstance().Choose<int>(2)) - 0.5f);
+        vec2f const deviationDirection =
+            GetVelocity(pointIndex).normalise().to_perpendicular();
+        mNonSpringForceBuffer[pointIndex] +=
+            deviationDirection * randomWalkMagnitude
+            * randomWalkVelocityImpulseToForceCoefficient;
+    }
+}
+
+void Points::UpdateEphemeralParticlesSparkle(float currentSimulationTime)
+{
+    auto & lane = mEphemeralParticleLanes[static_cast<size_t>(EphemeralType::Sparkle)];
+
+    CalculateEphemeralParticleLifetimes(lane, currentSimulationTime);
+    CalculateEphemeralParticleOceanSurfaceDepths(lane);
+
+    CompactEphemeralParticleLane<true>(
+        lane,
+        [&lane](size_t i)
+        {
+            return lane.LifetimeProgresses[i] >= 1.0f
+                || lane.OceanSurfaceDepths[i] > 0.0f; // Underwater
+        });
+
+    size_t const count = lane.size();
+    ElementIndex const * const restrict pointIndices = lane.PointIndices.data();
+    float const * const restrict lifetimeProgresses = lane.LifetimeProgresses.data();
+
+    // Update progress based off remaining time
+    for (size_t i = 0; i < count; ++i)
+    {
+        assert(EphemeralType::Sparkle == GetEphemeralType(pointIndices[i]));
+
+        mEphemeralParticleAttributes2Buffer[pointIndices[i]].State.Sparkle.Progress = lifetimeProgresses[i];
+    }
+}
+
+void Points::UpdateEphemeralParticlesWakeBubble(float currentSimulationTime)
+{
+    auto & lane = mEphemeralParticleLanes[static_cast<size_t>(EphemeralType::WakeBubble)];
+
+    CalculateEphemeralParticleLifetimes(lane, currentSimulationTime);
+    CalculateEphemeralParticleOceanSurfaceDepths(lane);
+
+    CompactEphemeralParticleLane<true>(
+        lane,
+        [&lane](size_t i)
+        {
+            return lane.LifetimeProgresses[i] >= 1.0f
+                || lane.OceanSurfaceDepths[i] <= 0.0f; // Not underwater
+        });
+
+    size_t const count = lane.size();
+    ElementIndex const * const restrict pointIndices = lane.PointIndices.data();
+    float const * const restrict lifetimeProgresses = lane.LifetimeProgresses.data();
+
+    // Update progress based off remaining time
+    for (size_t i = 0; i < count; ++i)
+    {
+        assert(EphemeralType::WakeBubble == GetEphemeralType(pointIndices[i]));
+
+        mEphemeralParticleAttributes2Buffer[pointIndices[i]].State.WakeBubble.Progress = lifetimeProgresses[i];
     }
 }
 
@@ -1509,6 +1594,64 @@ void Points::Query(ElementIndex pointElementIndex) const
     LogMessage("PlaneID: ", mPlaneIdBuffer[pointElementIndex], " ConnectedComponentID: ", mConnectedComponentIdBuffer[pointElementIndex]);
 }
 
+void Points::UploadPositions(
+    ShipId shipId,
+    bool doInterpolate,
+    std::chrono::steady_clock::time_point now,
+    Render::RenderContext & renderContext) const
+{
+    auto const snapshots = mPositionSnapshots->BeginRead();
+
+    if (nullptr != snapshots.Latest)
+    {
+        vec2f const * positions = snapshots.Latest->Positions.data();
+
+        // Only interpolate between consecutive simulation steps - e.g. not
+        // across a pause, or across a snapshot dropped while we were reading
+        auto const snapshotInterval = snapshots.Latest->Timestamp - snapshots.Previous->Timestamp;
+        auto constexpr MaxSnapshotInterval = std::chrono::duration<float>(2.0f * GameParameters::SimulationStepTimeDuration<float>);
+
+        if (doInterpolate
+            && snapshots.Previous != snapshots.Latest
+            && snapshotInterval > std::chrono::steady_clock::duration::zero()
+            && snapshotInterval <= MaxSnapshotInterval)
+        {
+            float const interpolationFactor = std::clamp(
+                std::chrono::duration<float>(now - snapshots.Latest->Timestamp).count()
+                    / std::chrono::duration<float>(snapshotInterval).count(),
+                0.0f,
+                1.0f);
+
+            // Render ship points in-between their last two snapshots; ephemeral
+            // particles come and go at each step, hence we render them at their
+            // latest positions
+            vec2f const * restrict const previousPositions = snapshots.Previous->Positions.data();
+            vec2f const * restrict const latestPositions = snapshots.Latest->Positions.data();
+            vec2f * restrict const renderPositions = mRenderPositionBuffer.data();
+
+            for (ElementIndex p = 0; p < mRawShipPointCount; ++p)
+            {
+                renderPositions[p] =
+                    previousPositions[p]
+                    + (latestPositions[p] - previousPositions[p]) * interpolationFactor;
+            }
+
+            std::copy(
+                latestPositions + mRawShipPointCount,
+                latestPositions + mAllPointCount,
+                renderPositions + mRawShipPointCount);
+
+            positions = renderPositions;
+        }
+
+        renderContext.UploadShipPointMutableAttributes(
+            shipId,
+            positions);
+    }
+
+    mPositionSnapshots->EndRead();
+}
+
 void Points::UploadAttributes(
     ShipId shipId,
     Render::RenderContext & renderContext) const
@@ -1558,63 +1701,67 @@ void Points::UploadAttributes(
 
     renderContext.UploadShipPointMutableAttributesStart(shipId);
 
-    renderContext.UploadShipPointMutableAttributes(
-        shipId,
-        mPositionBuffer.data(),
-        mLightBuffer.data(),
-        mWaterBuffer.data(),
-        partialPointCount);
+    // Note: positions are uploaded separately, from the snapshots
 
-    if (mIsPlaneIdBufferNonEphemeralDirty)
+    //
+    // Upload light, water, plane IDs, and decay; these change for a
+    // few points at a time, hence we only upload the chunks of points
+    // that have been modified since the last upload
+    //
+
+    if (!mHaveWholeBuffersBeenUploadedOnce)
+    {
+        renderContext.UploadShipPointMutableAttributesLight(shipId, mLightBuffer.data(), 0, mAllPointCount);
+        renderContext.UploadShipPointMutableAttributesWater(shipId, mWaterBuffer.data(), 0, mAllPointCount);
+        renderContext.UploadShipPointMutableAttributesPlaneId(shipId, mPlaneIdFloatBuffer.data(), 0, mAllPointCount);
+        renderContext.UploadShipPointMutableAttributesDecay(shipId, mDecayBuffer.data(), 0, mAllPointCount);
+
+        mIsPlaneIdBufferEphemeralDirty = false;
+    }
+    else
     {
+        mLightRenderDirtyChunks.VisitDirtyRanges(
+            [&](size_t start, size_t count)
+            {
+                renderContext.UploadShipPointMutableAttributesLight(shipId, &(mLightBuffer.data()[start]), start, count);
+            });
+
+        mWaterRenderDirtyChunks.VisitDirtyRanges(
+            [&](size_t start, size_t count)
+            {
+                renderContext.UploadShipPointMutableAttributesWater(shipId, &(mWaterBuffer.data()[start]), start, count);
+            });
+
+        mPlaneIdRenderDirtyChunks.VisitDirtyRanges(
+            [&](size_t start, size_t count)
+            {
+                renderContext.UploadShipPointMutableAttributesPlaneId(shipId, &(mPlaneIdFloatBuffer.data()[start]), start, count);
+            });
+
         if (mIsPlaneIdBufferEphemeralDirty)
         {
-            // Whole
+            // Just ephemeral portion
 
             renderContext.UploadShipPointMutableAttributesPlaneId(
                 shipId,
-                mPlaneIdFloatBuffer.data(),
-                0,
-                mAllPointCount);
+                &(mPlaneIdFloatBuffer.data()[mAlignedShipPointCount]),
+                mAlignedShipPointCount,
+                mEphemeralPointCount);
 
             mIsPlaneIdBufferEphemeralDirty = false;
         }
-        else
-        {
-            // Just non-ephemeral portion
-
-            renderContext.UploadShipPointMutableAttributesPlaneId(
-                shipId,
-                mPlaneIdFloatBuffer.data(),
-                0,
-                mRawShipPointCount);
-        }
-
-        mIsPlaneIdBufferNonEphemeralDirty = false;
-    }
-    else if (mIsPlaneIdBufferEphemeralDirty)
-    {
-        // Just ephemeral portion
 
-        renderContext.UploadShipPointMutableAttributesPlaneId(
-            shipId,
-            &(mPlaneIdFloatBuffer.data()[mAlignedShipPointCount]),
-            mAlignedShipPointCount,
-            mEphemeralPointCount);
-
-        mIsPlaneIdBufferEphemeralDirty = false;
+        mDecayRenderDirtyChunks.VisitDirtyRanges(
+            [&](size_t start, size_t count)
+            {
+                renderContext.UploadShipPointMutableAttributesDecay(shipId, &(mDecayBuffer.data()[start]), start, count);
+            });
     }
 
-    if (mIsDecayBufferDirty)
-    {
-        renderContext.UploadShipPointMutableAttributesDecay(
-            shipId,
-            mDecayBuffer.data(),
-            0,
-            partialPointCount);
-
-        mIsDecayBufferDirty = false;
-    }
+    mLightRenderDirtyChunks.Clear();
+    mWaterRenderDirtyChunks.Clear();
+    mPlaneIdRenderDirtyChunks.Clear();
+    mDecayRenderDirtyChunks.Clear();
 
     if (renderContext.GetDrawHeatOverlay())
     {
@@ -1744,105 +1891,108 @@ void Points::UploadEphemeralParticles(
         renderContext.UploadShipElementEphemeralPointsStart(shipId);
     }
 
-    for (ElementIndex pointIndex : this->EphemeralPoints())
+    for (auto const & lane : mEphemeralParticleLanes)
     {
-        switch (GetEphemeralType(pointIndex))
+        for (ElementIndex pointIndex : lane.PointIndices)
         {
-            case EphemeralType::AirBubble:
+            switch (GetEphemeralType(pointIndex))
             {
-                auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.AirBubble;
+                case EphemeralType::AirBubble:
+                {
+                    auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.AirBubble;
 
-                float constexpr ScaleMax = 0.3f;
-                float constexpr ScaleMin = 0.1f;
-                float const scale =
-                    ScaleMin + (ScaleMax - ScaleMin) * (1.0f - LinearStep(80.0f, 400.0f, state.CurrentDeltaY));
+                    float constexpr ScaleMax = 0.3f;
+                    float constexpr ScaleMin = 0.1f;
+                    float const scale =
+                        ScaleMin + (ScaleMax - ScaleMin) * (1.0f - LinearStep(80.0f, 400.0f, state.CurrentDeltaY));
 
-                renderContext.UploadShipAirBubble(
-                    shipId,
-                    GetPlaneId(pointIndex),
-                    GetPosition(pointIndex),
-                    scale,
-                    std::min(1.0f, state.CurrentDeltaY)); // Alpha
+                    renderContext.UploadShipAirBubble(
+                        shipId,
+                        GetPlaneId(pointIndex),
+                        GetPosition(pointIndex),
+                        scale,
+                        std::min(1.0f, state.CurrentDeltaY)); // Alpha
 
-                break;
-            }
+                    break;
+                }
 
-            case EphemeralType::Debris:
-            {
-                // Don't upload point unless there's been a change
-                if (mAreEphemeralPointsDirtyForRendering)
+                case EphemeralType::Debris:
                 {
-                    renderContext.UploadShipElementEphemeralPoint(
-                        shipId,
-                        pointIndex);
-                }
+                    // Don't upload point unless there's been a change
+                    if (mAreEphemeralPointsDirtyForRendering)
+                    {
+                        renderContext.UploadShipElementEphemeralPoint(
+                            shipId,
+                            pointIndex);
+                    }
 
-                break;
-            }
+                    break;
+                }
 
-            case EphemeralType::Smoke:
-            {
-                auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke;
+                case EphemeralType::Smoke:
+                {
+                    auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.Smoke;
 
-                // Calculate scale
-                float const scale = state.ScaleProgress;
+                    // Calculate scale
+                    float const scale = state.ScaleProgress;
 
-                // Calculate alpha
-                float const lifetimeProgress = state.LifetimeProgress;
-                float const alpha =
-                    SmoothStep(0.0f, 0.05f, lifetimeProgress)
-                    - SmoothStep(0.7f, 1.0f, lifetimeProgress);
+                    // Calculate alpha
+                    float const lifetimeProgress = state.LifetimeProgress;
+                    float const alpha =
+                        SmoothStep(0.0f, 0.05f, lifetimeProgress)
+                        - SmoothStep(0.7f, 1.0f, lifetimeProgress);
 
-                // Upload smoke
-                renderContext.UploadShipGenericMipMappedTextureRenderSpecification(
-                    shipId,
-                    GetPlaneId(pointIndex),
-                    state.PersonalitySeed,
-                    state.TextureGroup,
-                    GetPosition(pointIndex),
-                    scale,
-                    alpha);
+                    // Upload smoke
+                    renderContext.UploadShipGenericMipMappedTextureRenderSpecification(
+                        shipId,
+                        GetPlaneId(pointIndex),
+                        state.PersonalitySeed,
+                        state.TextureGroup,
+                        GetPosition(pointIndex),
+                        scale,
+                        alpha);
 
-                break;
-            }
+                    break;
+                }
 
-            case EphemeralType::Sparkle:
-            {
-                vec2f const velocityVector =
-                    -GetVelocity(pointIndex)
-                    / GameParameters::MaxSparkleParticlesForCutVelocity; // We use the cut sparkles arbitrarily
+                case EphemeralType::Sparkle:
+                {
+                    vec2f const velocityVector =
+                        -GetVelocity(pointIndex)
+                        / GameParameters::MaxSparkleParticlesForCutVelocity; // We use the cut sparkles arbitrarily
 
-                renderContext.UploadShipSparkle(
-                    shipId,
-                    GetPlaneId(pointIndex),
-                    GetPosition(pointIndex),
-                    velocityVector,
-                    mEphemeralParticleAttributes2Buffer[pointIndex].State.Sparkle.Progress);
+                    renderContext.UploadShipSparkle(
+                        shipId,
+                        GetPlaneId(pointIndex),
+                        GetPosition(pointIndex),
+                        velocityVector,
+                        mEphemeralParticleAttributes2Buffer[pointIndex].State.Sparkle.Progress);
 
-                break;
-            }
+                    break;
+                }
 
-            case EphemeralType::WakeBubble:
-            {
-                auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.WakeBubble;
+                case EphemeralType::WakeBubble:
+                {
+                    auto const & state = mEphemeralParticleAttributes2Buffer[pointIndex].State.WakeBubble;
 
-                renderContext.UploadShipGenericMipMappedTextureRenderSpecification(
-                    shipId,
-                    GetPlaneId(pointIndex),
-                    TextureFrameId(Render::GenericMipMappedTextureGroups::EngineWake, 0),
-                    GetPosition(pointIndex),
-                    0.10f + 1.22f * state.Progress, // Scale, magic formula
-                    mRandomNormalizedUniformFloatBuffer[pointIndex] * 2.0f * Pi<float>, // Angle
-                    1.0f - state.Progress); // Alpha
+                    renderContext.UploadShipGenericMipMappedTextureRenderSpecification(
+                        shipId,
+                        GetPlaneId(pointIndex),
+                        TextureFrameId(Render::GenericMipMappedTextureGroups::EngineWake, 0),
+                        GetPosition(pointIndex),
+                        0.10f + 1.22f * state.Progress, // Scale, magic formula
+                        mRandomNormalizedUniformFloatBuffer[pointIndex] * 2.0f * Pi<float>, // Angle
+                        1.0f - state.Progress); // Alpha
 
-                break;
-            }
+                    break;
+                }
 
-            case EphemeralType::None:
-            default:
-            {
-                // Ignore
-                break;
+                case EphemeralType::None:
+                default:
+                {
+                    // Ignore
+                    break;
+                }
             }
         }
     }
@@ -1970,75 +2120,58 @@ vec2f Points::CalculateIdealFlameVector(
     return Q;
 }
 
-ElementIndex Points::FindFreeEphemeralParticle(
+ElementIndex Points::AllocateEphemeralParticle(
+    EphemeralType ephemeralType,
     float currentSimulationTime,
+    float maxSimulationLifetime,
     bool doForce)
 {
-    //
-    // Search for the firt free ephemeral particle; if a free one is not found, reuse the
-    // oldest particle
-    //
-
-    ElementIndex oldestParticle = NoneElementIndex;
-    float oldestParticleLifetime = 0.0f;
-
-    assert(mFreeEphemeralParticleSearchStartIndex >= mAlignedShipPointCount
-        && mFreeEphemeralParticleSearchStartIndex < mAllPointCount);
+    assert(EphemeralType::None != ephemeralType);
 
-    for (ElementIndex p = mFreeEphemeralParticleSearchStartIndex; ; /*incremented in loop*/)
+    if (mFreeEphemeralParticles.empty())
     {
-        if (EphemeralType::None == mEphemeralParticleAttributes1Buffer[p].Type)
-        {
-            // Found!
-
-            // Remember to start after this one next time
-            mFreeEphemeralParticleSearchStartIndex = p + 1;
-            if (mFreeEphemeralParticleSearchStartIndex >= mAllPointCount)
-                mFreeEphemeralParticleSearchStartIndex = mAlignedShipPointCount;
+        //
+        // No luck
+        //
 
-            return p;
-        }
+        if (!doForce || mEphemeralParticleStartTimes.empty())
+            return NoneElementIndex;
 
-        // Check whether it's the oldest
-        auto const lifetime = currentSimulationTime - mEphemeralParticleAttributes1Buffer[p].StartSimulationTime;
-        if (lifetime >= oldestParticleLifetime)
-        {
-            oldestParticle = p;
-            oldestParticleLifetime = lifetime;
-        }
+        //
+        // Steal the oldest
+        //
 
-        // Advance
-        ++p;
-        if (p >= mAllPointCount)
-            p = mAlignedShipPointCount;
+        ElementIndex const oldestParticle = mAlignedShipPointCount + mEphemeralParticleStartTimes.pop();
 
-        if (p == mFreeEphemeralParticleSearchStartIndex)
+        if (EphemeralType::Debris == GetEphemeralType(oldestParticle))
         {
-            // Went around
-            break;
+            // Remember that ephemeral points are now dirty
+            mAreEphemeralPointsDirtyForRendering = true;
         }
+
+        ExpireEphemeralParticle(oldestParticle);
     }
 
     //
-    // No luck
+    // Take a free particle and make it active
     //
 
-    if (!doForce)
-        return NoneElementIndex;
+    assert(!mFreeEphemeralParticles.empty());
+    ElementIndex const pointIndex = mFreeEphemeralParticles.back();
+    mFreeEphemeralParticles.pop_back();
 
+    assert(EphemeralType::None == mEphemeralParticleAttributes1Buffer[pointIndex].Type);
+    mEphemeralParticleAttributes1Buffer[pointIndex].Type = ephemeralType;
 
-    //
-    // Steal the oldest
-    //
+    ElementIndex const ephemeralOrdinal = pointIndex - mAlignedShipPointCount;
 
-    assert(NoneElementIndex != oldestParticle);
+    auto & lane = mEphemeralParticleLanes[static_cast<size_t>(ephemeralType)];
+    mEphemeralParticleLaneSlots[ephemeralOrdinal] = static_cast<ElementIndex>(lane.size());
+    lane.push_back(pointIndex, currentSimulationTime, maxSimulationLifetime);
 
-    // Remember to start after this one next time
-    mFreeEphemeralParticleSearchStartIndex = oldestParticle + 1;
-    if (mFreeEphemeralParticleSearchStartIndex >= mAllPointCount)
-        mFreeEphemeralParticleSearchStartIndex = mAlignedShipPointCount;
+    mEphemeralParticleStartTimes.add_or_update(ephemeralOrdinal, currentSimulationTime);
 
-    return oldestParticle;
+    return pointIndex;
 }
 
 }
\ No newline at end of file
@@ -14,6 +14,7 @@
 #include <GameCore/AABB.h>
 #include <GameCore/Buffer.h>
 #include <GameCore/BufferAllocator.h>
+#include <GameCore/DirtyChunkBitmap.h>
 #include <GameCore/ElementContainer.h>
 #include <GameCore/ElementIndexRangeIterator.h>
 #include <GameCore/EnumFlags.h>
@@ -21,13 +22,18 @@
 #include <GameCore/GameRandomEngine.h>
 #include <GameCore/GameTypes.h>
 #include <GameCore/GameWallClock.h>
+#include <GameCore/SnapshotTripleBuffer.h>
+#include <GameCore/TemporallyCoherentPriorityQueue.h>
+#include <GameCore/TopNSelector.h>
 #include <GameCore/Vectors.h>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <chrono>
 #include <cstring>
 #include <functional>
+#include <memory>
 #include <vector>
 
 namespace Physics
@@ -56,7 +62,9 @@ public:
         Debris,
         Smoke,
         Sparkle,
-        WakeBubble
+        WakeBubble,
+
+        _Last = WakeBubble
     };
 
     /*
@@ -189,6 +197,9 @@ public:
 
 private:
 
+    // Granularity (in points) at which we track changes to render attributes
+    static size_t constexpr RenderDirtyChunkSize = 256;
+
     /*
      * Packed precalculated buoyancy coefficients.
      */
@@ -372,11 +383,9 @@ private:
     struct EphemeralParticleAttributes1
     {
         EphemeralType Type;
-        float StartSimulationTime;
 
         EphemeralParticleAttributes1()
             : Type(EphemeralType::None)
-            , StartSimulationTime(0.0f)
         {}
     };
 
@@ -387,14 +396,63 @@ private:
     struct EphemeralParticleAttributes2
     {
         EphemeralState State;
-        float MaxSimulationLifetime;
 
         EphemeralParticleAttributes2()
             : State(EphemeralState::DebrisState()) // Arbitrary
-            , MaxSimulationLifetime(0.0f)
         {}
     };
 
+    /*
+     * The active ephemeral particles of one type, compacted in no particular order.
+     *
+     * The timing attributes of the particles live here rather than in per-point
+     * buffers, so that the update of the type may process them as contiguous
+     * streams.
+     */
+    struct EphemeralParticleLane
+    {
+        std::vector<ElementIndex> PointIndices;
+        std::vector<float> StartSimulationTimes;
+        std::vector<float> MaxSimulationLifetimes;
+
+        // Calculated at each update
+        std::vector<float> ElapsedSimulationLifetimes;
+        std::vector<float> LifetimeProgresses;
+        std::vector<float> OceanSurfaceDepths; // Positive when underwater; only for types that need it
+        std::vector<float> PositionXs; // Scratch for the ocean surface lookup
+
+        inline size_t size() const
+        {
+            return PointIndices.size();
+        }
+
+        inline void push_back(
+            ElementIndex pointIndex,
+            float startSimulationTime,
+            float maxSimulationLifetime)
+        {
+            PointIndices.push_back(pointIndex);
+            StartSimulationTimes.push_back(startSimulationTime);
+            MaxSimulationLifetimes.push_back(maxSimulationLifetime);
+        }
+
+        inline void move(
+            size_t from,
+            size_t to)
+        {
+            PointIndices[to] = PointIndices[from];
+            StartSimulationTimes[to] = StartSimulationTimes[from];
+            MaxSimulationLifetimes[to] = MaxSimulationLifetimes[from];
+        }
+
+        inline void resize(size_t size)
+        {
+            PointIndices.resize(size);
+            StartSimulationTimes.resize(size);
+            MaxSimulationLifetimes.resize(size);
+        }
+    };
+
     /*
      * The metadata of all the triangles connected to a point.
      */
@@ -523,84 +581,89 @@ public:
         World & parentWorld,
         MaterialDatabase const & materialDatabase,
         std::shared_ptr<GameEventDispatcher> gameEventDispatcher,
-        GameParameters const & gameParameters)
-        : ElementContainer(make_aligned_float_element_count(shipPointCount) + GameParameters::MaxEphemeralParticles)
+        GameParameters const & gameParameters,
+        BufferArena & bufferArena)
+        : ElementContainer(CalculateElementCount(shipPointCount))
         //////////////////////////////////
         // Buffers
         //////////////////////////////////
-        , mIsDamagedBuffer(mBufferElementCount, shipPointCount, false)
+        , mIsDamagedBuffer(mBufferElementCount, shipPointCount, false, bufferArena, "Points.IsDamaged")
         // Materials
-        , mMaterialsBuffer(mBufferElementCount, shipPointCount, Materials(nullptr, nullptr))
-        , mIsRopeBuffer(mBufferElementCount, shipPointCount, false)
+        , mMaterialsBuffer(mBufferElementCount, shipPointCount, Materials(nullptr, nullptr), bufferArena, "Points.Materials")
+        , mIsRopeBuffer(mBufferElementCount, shipPointCount, false, bufferArena, "Points.IsRope")
         // Mechanical dynamics
-        , mPositionBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
-        , mVelocityBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
-        , mSpringForceBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
-        , mNonSpringForceBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
-        , mAugmentedMaterialMassBuffer(mBufferElementCount, shipPointCount, 1.0f)
-        , mMassBuffer(mBufferElementCount, shipPointCount, 1.0f)
-        , mMaterialBuoyancyVolumeFillBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mDecayBuffer(mBufferElementCount, shipPointCount, 1.0f)
-        , mIsDecayBufferDirty(true)
-        , mFrozenCoefficientBuffer(mBufferElementCount, shipPointCount, 1.0f)
-        , mIntegrationFactorTimeCoefficientBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mBuoyancyCoefficientsBuffer(mBufferElementCount, shipPointCount, BuoyancyCoefficients(0.0f, 0.0f))
-        , mIntegrationFactorBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
-        , mForceRenderBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
+        , mPositionBuffer(mBufferElementCount, shipPointCount, vec2f::zero(), bufferArena, "Points.Position")
+        , mVelocityBuffer(mBufferElementCount, shipPointCount, vec2f::zero(), bufferArena, "Points.Velocity")
+        , mSpringForceBuffer(mBufferElementCount, shipPointCount, vec2f::zero(), bufferArena, "Points.SpringForce")
+        , mNonSpringForceBuffer(mBufferElementCount, shipPointCount, vec2f::zero(), bufferArena, "Points.NonSpringForce")
+        , mAugmentedMaterialMassBuffer(mBufferElementCount, shipPointCount, 1.0f, bufferArena, "Points.AugmentedMaterialMass")
+        , mMassBuffer(mBufferElementCount, shipPointCount, 1.0f, bufferArena, "Points.Mass")
+        , mMaterialBuoyancyVolumeFillBuffer(mBufferElementCount, shipPointCount, 0.0f, bufferArena, "Points.MaterialBuoyancyVolumeFill")
+        , mDecayBuffer(mBufferElementCount, shipPointCount, 1.0f, bufferArena, "Points.Decay")
+        , mDecayRenderDirtyChunks(make_aligned_float_element_count(shipPointCount))
+        , mFrozenCoefficientBuffer(mBufferElementCount, shipPointCount, 1.0f, bufferArena, "Points.FrozenCoefficient")
+        , mIntegrationFactorTimeCoefficientBuffer(mBufferElementCount, shipPointCount, 0.0f, bufferArena, "Points.IntegrationFactorTimeCoefficient")
+        , mBuoyancyCoefficientsBuffer(mBufferElementCount, shipPointCount, BuoyancyCoefficients(0.0f, 0.0f), bufferArena, "Points.BuoyancyCoefficients")
+        , mIntegrationFactorBuffer(mBufferElementCount, shipPointCount, vec2f::zero(), bufferArena, "Points.IntegrationFactor")
+        , mForceRenderBuffer(mBufferElementCount, shipPointCount, vec2f::zero(), bufferArena, "Points.ForceRender")
         // Water dynamics
-        , mIsHullBuffer(mBufferElementCount, shipPointCount, false)
-        , mMaterialWaterIntakeBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mMaterialWaterRestitutionBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mMaterialWaterDiffusionSpeedBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mWaterBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mWaterVelocityBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
-        , mWaterMomentumBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
-        , mCumulatedIntakenWater(mBufferElementCount, shipPointCount, 0.0f)
-        , mLeakingCompositeBuffer(mBufferElementCount, shipPointCount, LeakingComposite(false))
-        , mFactoryIsStructurallyLeakingBuffer(mBufferElementCount, shipPointCount, false)
+        , mIsHullBuffer(mBufferElementCount, shipPointCount, false, bufferArena, "Points.IsHull")
+        , mMaterialWaterIntakeBuffer(mBufferElementCount, shipPointCount, 0.0f, bufferArena, "Points.MaterialWaterIntake")
+        , mMaterialWaterRestitutionBuffer(mBufferElementCount, shipPointCount, 0.0f, bufferArena, "Points.MaterialWaterRestitution")
+        , mMaterialWaterDiffusionSpeedBuffer(mBufferElementCount, shipPointCount, 0.0f, bufferArena, "Points.MaterialWaterDiffusionSpeed")
+        , mWaterBuffer(mBufferElementCount, shipPointCount, 0.0f, bufferArena, "Points.Water")
+        , mWaterRenderDirtyChunks(make_aligned_float_element_count(shipPointCount))
+        , mWaterVelocityBuffer(mBufferElementCount, shipPointCount, vec2f::zero(), bufferArena, "Points.WaterVelocity")
+        , mWaterMomentumBuffer(mBufferElementCount, shipPointCount, vec2f::zero(), bufferArena, "Points.WaterMomentum")
+        , mCumulatedIntakenWater(mBufferElementCount, shipPointCount, 0.0f, bufferArena, "Points.CumulatedIntakenWater")
+        , mLeakingCompositeBuffer(mBufferElementCount, shipPointCount, LeakingComposite(false), bufferArena, "Points.LeakingComposite")
+        , mFactoryIsStructurallyLeakingBuffer(mBufferElementCount, shipPointCount, false, bufferArena, "Points.FactoryIsStructurallyLeaking")
         , mTotalFactoryWetPoints(0)
         // Heat dynamics
-        , mTemperatureBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mMaterialHeatCapacityReciprocalBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mMaterialThermalExpansionCoefficientBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mMaterialIgnitionTemperatureBuffer(mBufferElementCount, shipPointCount, 0.0f)
-        , mMaterialCombustionTypeBuffer(mBufferElementCount, shipPointCount, StructuralMaterial::MaterialCombustionType::Combustion) // Arbitrary
-        , mCombustionStateBuffer(mBufferElementCount, shipPointCount, CombustionState())
+        , mTemperatureBuffer(mBufferElementCount, shipPointCount, 0.0f, bufferArena, "Points.Temperature")
+        , mMaterialHeatCapacityReciprocalBuffer(mBufferElementCount, shipPointCount, 0.0f, bufferArena, "Points.MaterialHeatCapacityReciprocal")
+        , mMaterialThermalExpansionCoefficientBuffer(mBufferElementCount, shipPointCount, 0.0f, bufferArena, "Points.MaterialThermalExpansionCoefficient")
+        , mMaterialIgnitionTemperatureBuffer(mBufferElementCount, shipPointCount, 0.0f, bufferArena, "Points.MaterialIgnitionTemperature")
+        , mMaterialCombustionTypeBuffer(mBufferElementCount, shipPointCount, StructuralMaterial::MaterialCombustionType::Combustion, bufferArena, "Points.MaterialCombustionType") // Arbitrary
+        , mCombustionStateBuffer(mBufferElementCount, shipPointCount, CombustionState(), bufferArena, "Points.CombustionState")
         // Electrical dynamics
-        , mElectricalElementBuffer(mBufferElementCount, shipPointCount, NoneElementIndex)
-        , mLightBuffer(mBufferElementCount, shipPointCount, 0.0f)
+        , mElectricalElementBuffer(mBufferElementCount, shipPointCount, NoneElementIndex, bufferArena, "Points.ElectricalElement")
+        , mLightBuffer(mBufferElementCount, shipPointCount, 0.0f, bufferArena, "Points.Light")
+        , mLightRenderDirtyChunks(make_aligned_float_element_count(shipPointCount))
         // Wind dynamics
-        , mMaterialWindReceptivityBuffer(mBufferElementCount, shipPointCount, 0.0f)
+        , mMaterialWindReceptivityBuffer(mBufferElementCount, shipPointCount, 0.0f, bufferArena, "Points.MaterialWindReceptivity")
         // Rust dynamics
-        , mMaterialRustReceptivityBuffer(mBufferElementCount, shipPointCount, 0.0f)
+        , mMaterialRustReceptivityBuffer(mBufferElementCount, shipPointCount, 0.0f, bufferArena, "Points.MaterialRustReceptivity")
         // Ephemeral particles
-        , mEphemeralParticleAttributes1Buffer(mBufferElementCount, shipPointCount, EphemeralParticleAttributes1())
-        , mEphemeralParticleAttributes2Buffer(mBufferElementCount, shipPointCount, EphemeralParticleAttributes2())
+        , mEphemeralParticleAttributes1Buffer(mBufferElementCount, shipPointCount, EphemeralParticleAttributes1(), bufferArena, "Points.EphemeralParticleAttributes1")
+        , mEphemeralParticleAttributes2Buffer(mBufferElementCount, shipPointCount, EphemeralParticleAttributes2(), bufferArena, "Points.EphemeralParticleAttributes2")
         // Structure
-        , mConnectedSpringsBuffer(mBufferElementCount, shipPointCount, ConnectedSpringsVector())
-        , mFactoryConnectedSpringsBuffer(mBufferElementCount, shipPointCount, ConnectedSpringsVector())
-        , mConnectedTrianglesBuffer(mBufferElementCount, shipPointCount, ConnectedTrianglesVector())
-        , mFactoryConnectedTrianglesBuffer(mBufferElementCount, shipPointCount, ConnectedTrianglesVector())
+        , mConnectedSpringsBuffer(mBufferElementCount, shipPointCount, ConnectedSpringsVector(), bufferArena, "Points.ConnectedSprings")
+        , mFactoryConnectedSpringsBuffer(mBufferElementCount, shipPointCount, ConnectedSpringsVector(), bufferArena, "Points.FactoryConnectedSprings")
+        , mConnectedTrianglesBuffer(mBufferElementCount, shipPointCount, ConnectedTrianglesVector(), bufferArena, "Points.ConnectedTriangles")
+        , mFactoryConnectedTrianglesBuffer(mBufferElementCount, shipPointCount, ConnectedTrianglesVector(), bufferArena, "Points.FactoryConnectedTriangles")
         // Connected component and plane ID
-        , mConnectedComponentIdBuffer(mBufferElementCount, shipPointCount, NoneConnectedComponentId)
-        , mPlaneIdBuffer(mBufferElementCount, shipPointCount, NonePlaneId)
-        , mPlaneIdFloatBuffer(mBufferElementCount, shipPointCount, 0.0)
-        , mIsPlaneIdBufferNonEphemeralDirty(true)
+        , mConnectedComponentIdBuffer(mBufferElementCount, shipPointCount, NoneConnectedComponentId, bufferArena, "Points.ConnectedComponentId")
+        , mPlaneIdBuffer(mBufferElementCount, shipPointCount, NonePlaneId, bufferArena, "Points.PlaneId")
+        , mPlaneIdFloatBuffer(mBufferElementCount, shipPointCount, 0.0, bufferArena, "Points.PlaneIdFloat")
+        , mPlaneIdRenderDirtyChunks(make_aligned_float_element_count(shipPointCount))
         , mIsPlaneIdBufferEphemeralDirty(true)
-        , mCurrentConnectivityVisitSequenceNumberBuffer(mBufferElementCount, shipPointCount, SequenceNumber())
+        , mCurrentConnectivityVisitSequenceNumberBuffer(mBufferElementCount, shipPointCount, SequenceNumber(), bufferArena, "Points.CurrentConnectivityVisitSequenceNumber")
         // Repair
-        , mRepairStateBuffer(mBufferElementCount, shipPointCount, RepairState())
+        , mRepairStateBuffer(mBufferElementCount, shipPointCount, RepairState(), bufferArena, "Points.RepairState")
         // Highlights
         , mElectricalElementHighlightedPoints()
         , mCircleHighlightedPoints()
         // Randomness
-        , mRandomNormalizedUniformFloatBuffer(mBufferElementCount, shipPointCount, [](size_t){ return GameRandomEngine::GetInstance().GenerateNormalizedUniformReal(); })
+        , mRandomNormalizedUniformFloatBuffer(mBufferElementCount, shipPointCount, [](size_t){ return GameRandomEngine::GetInstance().GenerateNormalizedUniformReal(); }, bufferArena, "Points.RandomNormalizedUniformFloat")
         // Immutable render attributes
-        , mColorBuffer(mBufferElementCount, shipPointCount, vec4f::zero())
+        , mColorBuffer(mBufferElementCount, shipPointCount, vec4f::zero(), bufferArena, "Points.Color")
         , mIsWholeColorBufferDirty(true)
         , mIsEphemeralColorBufferDirty(true)
-        , mTextureCoordinatesBuffer(mBufferElementCount, shipPointCount, vec2f::zero())
+        , mTextureCoordinatesBuffer(mBufferElementCount, shipPointCount, vec2f::zero(), bufferArena, "Points.TextureCoordinates")
         , mIsTextureCoordinatesBufferDirty(true)
+        , mPositionSnapshots(std::make_unique<SnapshotTripleBuffer<PositionSnapshot>>(mBufferElementCount))
+        , mRenderPositionBuffer(mBufferElementCount, bufferArena, "Points.RenderPosition")
         //////////////////////////////////
         // Container
         //////////////////////////////////
@@ -618,17 +681,85 @@ public:
         , mCurrentCumulatedIntakenWaterThresholdForAirBubbles(gameParameters.CumulatedIntakenWaterThresholdForAirBubbles)
         , mFloatBufferAllocator(mBufferElementCount)
         , mVec2fBufferAllocator(mBufferElementCount)
-        , mCombustionIgnitionCandidates(mRawShipPointCount)
-        , mCombustionExplosionCandidates(mRawShipPointCount)
+        , mCombustionIgnitionCandidates(MaxCombustionIgnitionPoints)
+        , mCombustionExplosionCandidates(MaxCombustionExplosionPoints)
         , mBurningPoints()
         , mStoppedBurningPoints()
-        , mFreeEphemeralParticleSearchStartIndex(mAlignedShipPointCount)
+        , mFreeEphemeralParticles()
+        , mEphemeralParticleLanes()
+        , mEphemeralParticleLaneSlots(mEphemeralPointCount, NoneElementIndex)
+        , mEphemeralParticleStartTimes(mEphemeralPointCount)
         , mAreEphemeralPointsDirtyForRendering(false)
     {
+        // All ephemeral particles start free; stacked so that lower indices are taken first
+        mFreeEphemeralParticles.reserve(mEphemeralPointCount);
+        for (ElementIndex p = mAllPointCount; p > mAlignedShipPointCount; --p)
+            mFreeEphemeralParticles.push_back(p - 1);
     }
 
     Points(Points && other) = default;
 
+    /*
+     * The number of bytes that the buffers of Points with the specified number of
+     * ship points take from the ship's buffer arena.
+     */
+    static size_t CalculateBufferArenaByteSize(ElementCount shipPointCount)
+    {
+        return CalculateArenaByteSize<
+            decltype(mIsDamagedBuffer),
+            decltype(mMaterialsBuffer),
+            decltype(mIsRopeBuffer),
+            decltype(mPositionBuffer),
+            decltype(mVelocityBuffer),
+            decltype(mSpringForceBuffer),
+            decltype(mNonSpringForceBuffer),
+            decltype(mAugmentedMaterialMassBuffer),
+            decltype(mMassBuffer),
+            decltype(mMaterialBuoyancyVolumeFillBuffer),
+            decltype(mDecayBuffer),
+            decltype(mFrozenCoefficientBuffer),
+            decltype(mIntegrationFactorTimeCoefficientBuffer),
+            decltype(mBuoyancyCoefficientsBuffer),
+            decltype(mIntegrationFactorBuffer),
+            decltype(mForceRenderBuffer),
+            decltype(mIsHullBuffer),
+            decltype(mMaterialWaterIntakeBuffer),
+            decltype(mMaterialWaterRestitutionBuffer),
+            decltype(mMaterialWaterDiffusionSpeedBuffer),
+            decltype(mWaterBuffer),
+            decltype(mWaterVelocityBuffer),
+            decltype(mWaterMomentumBuffer),
+            decltype(mCumulatedIntakenWater),
+            decltype(mLeakingCompositeBuffer),
+            decltype(mFactoryIsStructurallyLeakingBuffer),
+            decltype(mTemperatureBuffer),
+            decltype(mMaterialHeatCapacityReciprocalBuffer),
+            decltype(mMaterialThermalExpansionCoefficientBuffer),
+            decltype(mMaterialIgnitionTemperatureBuffer),
+            decltype(mMaterialCombustionTypeBuffer),
+            decltype(mCombustionStateBuffer),
+            decltype(mElectricalElementBuffer),
+            decltype(mLightBuffer),
+            decltype(mMaterialWindReceptivityBuffer),
+            decltype(mMaterialRustReceptivityBuffer),
+            decltype(mEphemeralParticleAttributes1Buffer),
+            decltype(mEphemeralParticleAttributes2Buffer),
+            decltype(mConnectedSpringsBuffer),
+            decltype(mFactoryConnectedSpringsBuffer),
+            decltype(mConnectedTrianglesBuffer),
+            decltype(mFactoryConnectedTrianglesBuffer),
+            decltype(mConnectedComponentIdBuffer),
+            decltype(mPlaneIdBuffer),
+            decltype(mPlaneIdFloatBuffer),
+            decltype(mCurrentConnectivityVisitSequenceNumberBuffer),
+            decltype(mRepairStateBuffer),
+            decltype(mRandomNormalizedUniformFloatBuffer),
+            decltype(mColorBuffer),
+            decltype(mTextureCoordinatesBuffer),
+            decltype(mRenderPositionBuffer)
+        >(CalculateBufferElementCount(CalculateElementCount(shipPointCount)));
+    }
+
     /*
      * Returns an iterator for the (unaligned) ship (i.e. non-ephemeral) points only.
      */
@@ -663,6 +794,18 @@ public:
         return ElementIndexRangeIterable(mAlignedShipPointCount, mAllPointCount);
     }
 
+    /*
+     * Returns the number of ephemeral points that are currently active.
+     */
+    inline size_t GetActiveEphemeralPointCount() const
+    {
+        size_t count = 0;
+        for (auto const & lane : mEphemeralParticleLanes)
+            count += lane.size();
+
+        return count;
+    }
+
     /*
      * Returns a flag indicating whether the point is active in the world.
      *
@@ -824,6 +967,40 @@ public:
     // Render
     //
 
+    /*
+     * Publishes the current positions of all points for rendering; invoked by the
+     * simulation thread at the end of each simulation step, and by the main thread
+     * whenever it moves points while the simulation is not running.
+     *
+     * The render side never waits for this, nor this for the render side.
+     */
+    void PublishPositionSnapshot()
+    {
+        PositionSnapshot & snapshot = mPositionSnapshots->BeginWrite();
+
+        std::copy(
+            mPositionBuffer.data(),
+            mPositionBuffer.data() + mAllPointCount,
+            snapshot.Positions.data());
+
+        snapshot.Timestamp = std::chrono::steady_clock::now();
+
+        mPositionSnapshots->EndWrite();
+    }
+
+    /*
+     * Uploads the positions of the latest published snapshot; when interpolating,
+     * ship points are rendered in-between the last two snapshots, at the point that
+     * lags the latest one by as much as the latest lags the previous one.
+     *
+     * May be invoked on the main thread while the simulation thread is updating.
+     */
+    void UploadPositions(
+        ShipId shipId,
+        bool doInterpolate,
+        std::chrono::steady_clock::time_point now,
+        Render::RenderContext & renderContext) const;
+
     void UploadAttributes(
         ShipId shipId,
         Render::RenderContext & renderContext) const;
@@ -1039,12 +1216,11 @@ public:
         ElementIndex pointElementIndex,
         float value)
     {
-        mDecayBuffer[pointElementIndex] = value;
-    }
-
-    void MarkDecayBufferAsDirty()
-    {
-        mIsDecayBufferDirty = true;
+        if (value != mDecayBuffer[pointElementIndex])
+        {
+            mDecayBuffer[pointElementIndex] = value;
+            mDecayRenderDirtyChunks.MarkDirty(pointElementIndex);
+        }
     }
 
     bool IsPinned(ElementIndex pointElementIndex) const
@@ -1152,16 +1328,23 @@ public:
         return mWaterBuffer[pointElementIndex];
     }
 
-    float & GetWater(ElementIndex pointElementIndex)
-    {
-        return mWaterBuffer[pointElementIndex];
-    }
-
     void SetWater(
         ElementIndex pointElementIndex,
         float value)
     {
-        mWaterBuffer[pointElementIndex] = value;
+        if (value != mWaterBuffer[pointElementIndex])
+        {
+            mWaterBuffer[pointElementIndex] = value;
+            mWaterRenderDirtyChunks.MarkDirty(pointElementIndex);
+        }
+    }
+
+    /*
+     * To be invoked by whoever modifies the water buffer directly.
+     */
+    void MarkWaterAsDirty(ElementIndex pointElementIndex)
+    {
+        mWaterRenderDirtyChunks.MarkDirty(pointElementIndex);
     }
 
     bool IsWet(
@@ -1182,6 +1365,7 @@ public:
     void UpdateWaterBuffer(std::shared_ptr<Buffer<float>> newWaterBuffer)
     {
         mWaterBuffer.copy_from(*newWaterBuffer);
+        mWaterRenderDirtyChunks.MarkAllDirty();
     }
 
     vec2f * GetWaterVelocityBufferAsVec2()
@@ -1391,6 +1575,24 @@ public:
         return mLightBuffer.data();
     }
 
+    /*
+     * To be invoked by whoever modifies the light buffer wholesale.
+     */
+    void MarkLightBufferAsDirty()
+    {
+        mLightRenderDirtyChunks.MarkAllDirty();
+    }
+
+    /*
+     * To be invoked by whoever modifies a range of the light buffer wholesale.
+     */
+    void MarkLightBufferAsDirty(
+        ElementIndex startPointIndex,
+        ElementCount pointCount)
+    {
+        mLightRenderDirtyChunks.MarkDirty(startPointIndex, pointCount);
+    }
+
     //
     // Wind dynamics
     //
@@ -1576,12 +1778,13 @@ public:
         float planeIdFloat)
     {
         mPlaneIdBuffer[pointElementIndex] = planeId;
-        mPlaneIdFloatBuffer[pointElementIndex] = planeIdFloat;
-    }
 
-    void MarkPlaneIdBufferNonEphemeralAsDirty()
-    {
-        mIsPlaneIdBufferNonEphemeralDirty = true;
+        // Plane IDs are re-assigned at each connectivity visit, but they mostly stay the same
+        if (planeIdFloat != mPlaneIdFloatBuffer[pointElementIndex])
+        {
+            mPlaneIdFloatBuffer[pointElementIndex] = planeIdFloat;
+            mPlaneIdRenderDirtyChunks.MarkDirty(pointElementIndex);
+        }
     }
 
     SequenceNumber GetCurrentConnectivityVisitSequenceNumber(ElementIndex pointElementIndex) const
@@ -1698,6 +1901,12 @@ public:
 
 private:
 
+    static inline ElementCount CalculateElementCount(ElementCount shipPointCount)
+    {
+        // Ship points are aligned, and followed by the ephemeral particles
+        return make_aligned_float_element_count(shipPointCount) + GameParameters::MaxEphemeralParticles;
+    }
+
     static inline float CalculateIntegrationFactorTimeCoefficient(
         float numMechanicalDynamicsIterations,
         float frozenCoefficient)
@@ -1745,11 +1954,37 @@ private:
         mCumulatedIntakenWater[pointElementIndex] = RandomizeCumulatedIntakenWater(mCurrentCumulatedIntakenWaterThresholdForAirBubbles);
     }
 
-    inline ElementIndex FindFreeEphemeralParticle(
+    /*
+     * Finds a free ephemeral particle - or, if forced, steals the oldest - and makes it
+     * an active particle of the specified type, starting now.
+     */
+    inline ElementIndex AllocateEphemeralParticle(
+        EphemeralType ephemeralType,
         float currentSimulationTime,
+        float maxSimulationLifetime,
         bool doForce);
 
     inline void ExpireEphemeralParticle(ElementIndex pointElementIndex)
+    {
+        // Remove from its lane, moving the last particle of the lane into its slot
+        assert(EphemeralType::None != mEphemeralParticleAttributes1Buffer[pointElementIndex].Type);
+        auto & lane = mEphemeralParticleLanes[static_cast<size_t>(mEphemeralParticleAttributes1Buffer[pointElementIndex].Type)];
+        ElementIndex const laneSlot = mEphemeralParticleLaneSlots[pointElementIndex - mAlignedShipPointCount];
+        assert(laneSlot < lane.size() && lane.PointIndices[laneSlot] == pointElementIndex);
+        size_t const lastLaneSlot = lane.size() - 1;
+        if (laneSlot != lastLaneSlot)
+        {
+            lane.move(lastLaneSlot, laneSlot);
+            mEphemeralParticleLaneSlots[lane.PointIndices[laneSlot] - mAlignedShipPointCount] = laneSlot;
+        }
+
+        lane.resize(lastLaneSlot);
+
+        ReleaseEphemeralParticle(pointElementIndex);
+    }
+
+    // Frees a particle that has already been removed from its lane
+    inline void ReleaseEphemeralParticle(ElementIndex pointElementIndex)
     {
         // Freeze the particle (just to prevent drifting)
         Freeze(pointElementIndex);
@@ -1759,8 +1994,89 @@ private:
         // - Being updated
         // ...and it will allow its slot to be chosen for a new ephemeral particle
         mEphemeralParticleAttributes1Buffer[pointElementIndex].Type = EphemeralType::None;
+
+        ElementIndex const ephemeralOrdinal = pointElementIndex - mAlignedShipPointCount;
+        mEphemeralParticleLaneSlots[ephemeralOrdinal] = NoneElementIndex;
+        mEphemeralParticleStartTimes.remove_if_in(ephemeralOrdinal);
+
+        // Make it available again
+        mFreeEphemeralParticles.push_back(pointElementIndex);
+    }
+
+    /*
+     * Releases the particles of the lane that have expired, and compacts the survivors -
+     * together with the attributes calculated at this update - at the front of the lane;
+     * returns the number of expired particles.
+     */
+    template<bool HasOceanSurfaceDepths, typename TIsExpired>
+    inline size_t CompactEphemeralParticleLane(
+        EphemeralParticleLane & lane,
+        TIsExpired isExpired)
+    {
+        size_t const count = lane.size();
+        assert(lane.LifetimeProgresses.size() == count);
+        assert(!HasOceanSurfaceDepths || lane.OceanSurfaceDepths.size() == count);
+
+        size_t survivorCount = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (isExpired(i))
+            {
+                ReleaseEphemeralParticle(lane.PointIndices[i]);
+            }
+            else
+            {
+                if (survivorCount != i)
+                {
+                    lane.move(i, survivorCount);
+                    lane.ElapsedSimulationLifetimes[survivorCount] = lane.ElapsedSimulationLifetimes[i];
+                    lane.LifetimeProgresses[survivorCount] = lane.LifetimeProgresses[i];
+                    if constexpr (HasOceanSurfaceDepths)
+                        lane.OceanSurfaceDepths[survivorCount] = lane.OceanSurfaceDepths[i];
+
+                    mEphemeralParticleLaneSlots[lane.PointIndices[survivorCount] - mAlignedShipPointCount] = static_cast<ElementIndex>(survivorCount);
+                }
+
+                ++survivorCount;
+            }
+        }
+
+        lane.resize(survivorCount);
+        lane.ElapsedSimulationLifetimes.resize(survivorCount);
+        lane.LifetimeProgresses.resize(survivorCount);
+        if constexpr (HasOceanSurfaceDepths)
+            lane.OceanSurfaceDepths.resize(survivorCount);
+
+        return count - survivorCount;
     }
 
+    /*
+     * Calculates the elapsed lifetimes and the lifetime progresses of all the
+     * particles in the lane.
+     */
+    static void CalculateEphemeralParticleLifetimes(
+        EphemeralParticleLane & lane,
+        float currentSimulationTime);
+
+    /*
+     * Calculates the depths under the ocean surface of all the particles in the lane.
+     */
+    void CalculateEphemeralParticleOceanSurfaceDepths(EphemeralParticleLane & lane) const;
+
+    void UpdateEphemeralParticlesAirBubble(
+        float currentSimulationTime,
+        GameParameters const & gameParameters);
+
+    void UpdateEphemeralParticlesDebris(float currentSimulationTime);
+
+    void UpdateEphemeralParticlesSmoke(
+        float currentSimulationTime,
+        GameParameters const & gameParameters);
+
+    void UpdateEphemeralParticlesSparkle(float currentSimulationTime);
+
+    void UpdateEphemeralParticlesWakeBubble(float currentSimulationTime);
+
 private:
 
     //////////////////////////////////////////////////////////
@@ -1788,7 +2104,7 @@ private:
     Buffer<float> mMassBuffer; // Augmented + Water
     Buffer<float> mMaterialBuoyancyVolumeFillBuffer;
     Buffer<float> mDecayBuffer; // 1.0 -> 0.0 (completely decayed)
-    bool mutable mIsDecayBufferDirty; // Only tracks non-ephemerals
+    DirtyChunkBitmap<RenderDirtyChunkSize> mutable mDecayRenderDirtyChunks; // Only tracks non-ephemerals
     Buffer<float> mFrozenCoefficientBuffer; // 1.0: not frozen; 0.0f: frozen
     Buffer<float> mIntegrationFactorTimeCoefficientBuffer; // dt^2 or zero when the point is frozen
     Buffer<BuoyancyCoefficients> mBuoyancyCoefficientsBuffer;
@@ -1808,6 +2124,7 @@ private:
     // Height of a 1m2 column of water which provides a pressure equivalent to the pressure at
     // this point. Quantity of water is max(water, 1.0)
     Buffer<float> mWaterBuffer;
+    DirtyChunkBitmap<RenderDirtyChunkSize> mutable mWaterRenderDirtyChunks; // Only tracks non-ephemerals
 
     // Total velocity of the water at this point
     Buffer<vec2f> mWaterVelocityBuffer;
@@ -1846,6 +2163,7 @@ private:
 
     // Total illumination, 0.0->1.0
     Buffer<float> mLightBuffer;
+    DirtyChunkBitmap<RenderDirtyChunkSize> mutable mLightRenderDirtyChunks; // Only tracks non-ephemerals
 
     //
     // Wind dynamics
@@ -1882,7 +2200,7 @@ private:
     Buffer<ConnectedComponentId> mConnectedComponentIdBuffer;
     Buffer<PlaneId> mPlaneIdBuffer;
     Buffer<float> mPlaneIdFloatBuffer;
-    bool mutable mIsPlaneIdBufferNonEphemeralDirty;
+    DirtyChunkBitmap<RenderDirtyChunkSize> mutable mPlaneIdRenderDirtyChunks; // Only tracks non-ephemerals
     bool mutable mIsPlaneIdBufferEphemeralDirty;
     Buffer<SequenceNumber> mCurrentConnectivityVisitSequenceNumberBuffer;
 
@@ -1915,6 +2233,27 @@ private:
     Buffer<vec2f> mTextureCoordinatesBuffer;
     bool mutable mIsTextureCoordinatesBufferDirty; // Whether or not is dirty since last render upload
 
+    //
+    // Render snapshots
+    //
+
+    struct PositionSnapshot
+    {
+        Buffer<vec2f> Positions; // All points, including ephemeral particles
+        std::chrono::steady_clock::time_point Timestamp;
+
+        explicit PositionSnapshot(size_t bufferElementCount)
+            : Positions(bufferElementCount, 0, vec2f::zero())
+            , Timestamp()
+        {}
+    };
+
+    // Handed over from the simulation thread to the main thread; owned via a pointer,
+    // as we're movable while the triple buffer is not
+    std::unique_ptr<SnapshotTripleBuffer<PositionSnapshot>> mPositionSnapshots;
+
+    Buffer<vec2f> mutable mRenderPositionBuffer; // Interpolated positions, staged for upload; main thread only
+
 
     //////////////////////////////////////////////////////////
     // Container
@@ -1950,10 +2289,15 @@ private:
     BufferAllocator<float> mFloatBufferAllocator;
     BufferAllocator<vec2f> mVec2fBufferAllocator;
 
-    // The list of candidates for burning and exploding during combustion;
-    // member only to save allocations at use time
-    BoundedVector<std::tuple<ElementIndex, float>> mCombustionIgnitionCandidates;
-    BoundedVector<std::tuple<ElementIndex, float>> mCombustionExplosionCandidates;
+    // The max number of points that may ignite and explode at each
+    // low-frequency combustion update
+    static size_t constexpr MaxCombustionIgnitionPoints = 9;
+    static size_t constexpr MaxCombustionExplosionPoints = 10;
+
+    // The top candidates for burning and exploding during combustion, by ignition
+    // temperature delta; member only to save allocations at use time
+    TopNSelector<float> mCombustionIgnitionCandidates;
+    TopNSelector<float> mCombustionExplosionCandidates;
 
     // The indices of the points that are currently burning
     std::vector<ElementIndex> mBurningPoints;
@@ -1962,9 +2306,19 @@ private:
     // member only to save allocations at use time
     std::vector<ElementIndex> mStoppedBurningPoints;
 
-    // The index at which to start searching for free ephemeral particles
-    // (just an optimization over restarting from zero each time)
-    ElementIndex mFreeEphemeralParticleSearchStartIndex;
+    // The ephemeral particles that are free, used as a stack
+    std::vector<ElementIndex> mFreeEphemeralParticles;
+
+    // The active ephemeral particles, by type
+    std::array<EphemeralParticleLane, static_cast<size_t>(EphemeralType::_Last) + 1> mEphemeralParticleLanes;
+
+    // The position of each active ephemeral particle in the lane of its type,
+    // indexed by ephemeral ordinal (i.e. point index minus aligned ship point count)
+    std::vector<ElementIndex> mEphemeralParticleLaneSlots;
+
+    // The active ephemeral particles - by ephemeral ordinal - keyed by their start time,
+    // so that we may find the oldest one when we need to steal a particle
+    TemporallyCoherentPriorityQueue<float> mEphemeralParticleStartTimes;
 
     // Flag remembering whether the set of ephemeral points is dirty
     // (i.e. whether there are more or less points than previously
@@ -20,11 +20,14 @@ RenderContext::RenderContext(
     std::function<void()> makeRenderContextCurrentFunction,
     std::function<void()> swapRenderBuffersFunction,
     PerfStats & perfStats,
+    std::shared_ptr<TaskThreadPool> taskThreadPool,
     ResourceLocator const & resourceLocator,
     ProgressCallback const & progressCallback)
     // Thread
     : mRenderThread()
+    , mTaskThreadPool(std::move(taskThreadPool))
     , mLastRenderUploadEndCompletionIndicator()
+    , mLastRenderUploadEndCompletionIndicatorLock()
     , mLastRenderDrawCompletionIndicator()
     // Child contextes
     , mGlobalRenderContext()
@@ -287,7 +290,8 @@ void RenderContext::AddShip(
                     *mShaderManager,
                     *mGlobalRenderContext,
                     mRenderParameters,
-                    mShipFlameSizeAdjustment));
+                    mShipFlameSizeAdjustment,
+                    *mTaskThreadPool));
         });
 }
 
@@ -335,14 +339,24 @@ RgbImageData RenderContext::TakeScreenshot()
 
 void RenderContext::UpdateStart()
 {
+    // Invoked on the simulation thread
+
+    TaskThread::TaskCompletionIndicator lastRenderUploadEndCompletionIndicator;
+
+    {
+        std::lock_guard<std::mutex> const lock{ mLastRenderUploadEndCompletionIndicatorLock };
+
+        lastRenderUploadEndCompletionIndicator = std::move(mLastRenderUploadEndCompletionIndicator);
+        mLastRenderUploadEndCompletionIndicator.reset();
+    }
+
     // If there's a pending RenderUploadEnd, wait for it so we
     // know that CPU buffers are safe to be used
-    if (!!mLastRenderUploadEndCompletionIndicator)
+    if (!!lastRenderUploadEndCompletionIndicator)
     {
         auto const waitStart = GameChronometer::now();
 
-        mLastRenderUploadEndCompletionIndicator->Wait();
-        mLastRenderUploadEndCompletionIndicator.reset();
+        lastRenderUploadEndCompletionIndicator->Wait();
 
         mPerfStats.TotalWaitForRenderUploadDuration.Update(GameChronometer::now() - waitStart);
     }
@@ -357,9 +371,7 @@ void RenderContext::UpdateEnd()
 
 void RenderContext::RenderStart()
 {
-    // Cleanup an eventual pending RenderUploadEnd - may be left behind if
-    // this cycle did not do an Update
-    mLastRenderUploadEndCompletionIndicator.reset();
+    // Nop
 }
 
 void RenderContext::UploadStart()
@@ -388,9 +400,13 @@ void RenderContext::UploadEnd()
     mNotificationRenderContext->UploadEnd();
 
     // Queue an indicator here, so we may wait for it
-    // when we want to touch CPU buffers again
-    assert(!mLastRenderUploadEndCompletionIndicator);
-    mLastRenderUploadEndCompletionIndicator = mRenderThread.QueueSynchronizationPoint();
+    // when we want to touch CPU buffers again; it replaces
+    // any indicator that no Update has waited for yet, as
+    // the render thread runs tasks in order
+    auto completionIndicator = mRenderThread.QueueSynchronizationPoint();
+
+    std::lock_guard<std::mutex> const lock{ mLastRenderUploadEndCompletionIndicatorLock };
+    mLastRenderUploadEndCompletionIndicator = std::move(completionIndicator);
 }
 
 void RenderContext::Draw()
@@ -449,7 +465,7 @@ void RenderContext::Draw()
 
                 for (auto const & ship : mShips)
                 {
-                    ship->RenderPrepare(renderParameters);
+                    ship->RenderPrepare(renderParameters, renderStats);
                 }
 
                 mWorldRenderContext->RenderPrepareOceanFloor(renderParameters);
@@ -464,6 +480,7 @@ void RenderContext::Draw()
 
                 // Update stats
                 mPerfStats.TotalUploadRenderDrawDuration.Update(GameChronometer::now() - startTime);
+                mPerfStats.TotalUploadedShipPointAttributeBytes.Update(renderStats.LastUploadedShipPointAttributeBytes);
             }
 
             //
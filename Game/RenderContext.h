@@ -33,11 +33,13 @@
 #include <GameCore/ProgressCallback.h>
 #include <GameCore/SysSpecifics.h>
 #include <GameCore/TaskThread.h>
+#include <GameCore/TaskThreadPool.h>
 #include <GameCore/Vectors.h>
 
 #include <array>
 #include <cassert>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
@@ -62,6 +64,7 @@ public:
         std::function<void()> makeRenderContextCurrentFunction,
         std::function<void()> swapRenderBuffersFunction,
         PerfStats & perfStats,
+        std::shared_ptr<TaskThreadPool> taskThreadPool,
         ResourceLocator const & resourceLocator,
         ProgressCallback const & progressCallback);
 
@@ -474,6 +477,17 @@ public:
         mRenderParameters.IsHeatOverlayTransparencyDirty = true;
     }
 
+    bool GetDoPackShipPointAttributes() const
+    {
+        return mRenderParameters.DoPackShipPointAttributes;
+    }
+
+    void SetDoPackShipPointAttributes(bool doPackShipPointAttributes)
+    {
+        mRenderParameters.DoPackShipPointAttributes = doPackShipPointAttributes;
+        mRenderParameters.IsDoPackShipPointAttributesDirty = true;
+    }
+
     VectorFieldRenderModeType GetVectorFieldRenderMode() const
     {
         return mVectorFieldRenderMode;
@@ -545,6 +559,8 @@ public:
 
 public:
 
+    // Invoked on the simulation thread, concurrently with the render
+    // cycle on the main thread
     void UpdateStart();
 
     void UpdateEnd();
@@ -771,18 +787,39 @@ public:
 
     inline void UploadShipPointMutableAttributes(
         ShipId shipId,
-        vec2f const * position,
+        vec2f const * position)
+    {
+        assert(shipId >= 0 && shipId < mShips.size());
+
+        mShips[shipId]->UploadPointMutableAttributes(position);
+    }
+
+    inline void UploadShipPointMutableAttributesLight(
+        ShipId shipId,
         float const * light,
-        float const * water,
-        size_t lightAndWaterCount)
+        size_t startDst,
+        size_t count)
     {
         assert(shipId >= 0 && shipId < mShips.size());
 
-        mShips[shipId]->UploadPointMutableAttributes(
-            position,
+        mShips[shipId]->UploadPointMutableAttributesLight(
             light,
+            startDst,
+            count);
+    }
+
+    inline void UploadShipPointMutableAttributesWater(
+        ShipId shipId,
+        float const * water,
+        size_t startDst,
+        size_t count)
+    {
+        assert(shipId >= 0 && shipId < mShips.size());
+
+        mShips[shipId]->UploadPointMutableAttributesWater(
             water,
-            lightAndWaterCount);
+            startDst,
+            count);
     }
 
     inline void UploadShipPointMutableAttributesPlaneId(
@@ -841,8 +878,6 @@ public:
             });
     }
 
-    // Upload is Asynchronous - buffer may not be used until the
-    // next UpdateStart
     inline void UploadShipPointTemperature(
         ShipId shipId,
         float const * temperature,
@@ -851,15 +886,10 @@ public:
     {
         assert(shipId >= 0 && shipId < mShips.size());
 
-        // Run upload asynchronously
-        mRenderThread.QueueTask(
-            [=]()
-            {
-                mShips[shipId]->UploadPointTemperature(
-                    temperature,
-                    startDst,
-                    count);
-            });
+        mShips[shipId]->UploadPointTemperature(
+            temperature,
+            startDst,
+            count);
     }
 
     inline void UploadShipElementsStart(ShipId shipId)
@@ -1287,9 +1317,15 @@ private:
     // The thread running all of our OpenGL calls
     TaskThread mRenderThread;
 
+    // The thread pool used by the render thread to parallelize CPU-side work;
+    // shared with the simulation
+    std::shared_ptr<TaskThreadPool> mTaskThreadPool;
+
     // The asynchronous rendering tasks from the previous iteration,
-    // which we have to wait for before proceeding further
+    // which we have to wait for before proceeding further; the upload
+    // one is set by the main thread and consumed by the simulation thread
     TaskThread::TaskCompletionIndicator mLastRenderUploadEndCompletionIndicator;
+    std::mutex mLastRenderUploadEndCompletionIndicatorLock;
     TaskThread::TaskCompletionIndicator mLastRenderDrawCompletionIndicator;
 
     //
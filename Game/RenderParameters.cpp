@@ -45,6 +45,8 @@ RenderParameters::RenderParameters(ImageSize const & initialCanvasSize)
 	, DrawHeatOverlay(false)
 	, HeatOverlayTransparency(0.1875f)
 	, IsHeatOverlayTransparencyDirty(true)
+	, DoPackShipPointAttributes(true)
+	, IsDoPackShipPointAttributesDirty(true)
 	, DebugShipRenderMode(DebugShipRenderModeType::None)	
 	, IsDebugShipRenderModeDirty(true)
 {
@@ -70,6 +72,7 @@ RenderParameters RenderParameters::TakeSnapshotAndClear()
 	IsShipWaterContrastDirty = false;
 	IsShipWaterLevelOfDetailDirty = false;
 	IsHeatOverlayTransparencyDirty = false;
+	IsDoPackShipPointAttributesDirty = false;
 	IsDebugShipRenderModeDirty = false;
 
 	return copy;
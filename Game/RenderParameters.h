@@ -82,6 +82,9 @@ struct RenderParameters
 
     float HeatOverlayTransparency;
     float IsHeatOverlayTransparencyDirty;
+
+    bool DoPackShipPointAttributes; // Whether light, water, decay, and temperature are uploaded as 16-bit normalized integers
+    bool IsDoPackShipPointAttributesDirty;
     
     DebugShipRenderModeType DebugShipRenderMode;
     bool IsDebugShipRenderModeDirty;
@@ -66,6 +66,7 @@ struct RenderStatistics
     std::uint64_t LastRenderedShipPlanes;
     std::uint64_t LastRenderedShipFlames;
     std::uint64_t LastRenderedShipGenericMipMappedTextures;
+    std::uint64_t LastUploadedShipPointAttributeBytes;
 
     RenderStatistics() noexcept
     {
@@ -81,6 +82,7 @@ struct RenderStatistics
         LastRenderedShipPlanes = 0;
         LastRenderedShipFlames = 0;
         LastRenderedShipGenericMipMappedTextures = 0;
+        LastUploadedShipPointAttributeBytes = 0;
     }
 };
 
@@ -399,8 +399,8 @@ VertexAttributeType StrToVertexAttributeType(std::string const & str)
         return VertexAttributeType::ShipPointAttributeGroup2;
     else if (Utils::CaseInsensitiveEquals(str, "ShipPointColor"))
         return VertexAttributeType::ShipPointColor;
-    else if (Utils::CaseInsensitiveEquals(str, "ShipPointTemperature"))
-        return VertexAttributeType::ShipPointTemperature;
+    else if (Utils::CaseInsensitiveEquals(str, "ShipPointPlaneId"))
+        return VertexAttributeType::ShipPointPlaneId;
     else if (Utils::CaseInsensitiveEquals(str, "Explosion1"))
         return VertexAttributeType::Explosion1;
     else if (Utils::CaseInsensitiveEquals(str, "Explosion2"))
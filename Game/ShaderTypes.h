@@ -157,9 +157,9 @@ enum class VertexAttributeType : GLuint
     //
 
     ShipPointAttributeGroup1 = 0,   // Position, TextureCoordinates
-    ShipPointAttributeGroup2 = 1,   // Light, Water, PlaneId, Decay
+    ShipPointAttributeGroup2 = 1,   // Light, Water, Decay, Temperature (normalized)
     ShipPointColor = 2,
-    ShipPointTemperature = 3,
+    ShipPointPlaneId = 3,
 
     Explosion1 = 0,
     Explosion2 = 1,
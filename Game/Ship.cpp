@@ -41,6 +41,99 @@ static constexpr int SpringDecayAndTemperaturePeriodStep = 34;
 static constexpr int CombustionStateMachineSlowPeriodStep3 = 41;
 static constexpr int CombustionStateMachineSlowPeriodStep4 = 48;
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Ocean floor collisions broadphase
+//
+// The number of contiguous points in each block whose bounding box we track at integration
+//
+
+static constexpr size_t PointBlockSize = 64;
+
+// Bounces the points that are outside of the world boundaries back into the world;
+// branch-free, so that the compiler may vectorize it
+static inline void TrimPointsForWorldBounds(
+    vec2f * restrict positions,
+    vec2f * restrict velocities,
+    size_t count,
+    float elasticity)
+{
+    float constexpr MaxWorldLeft = -GameParameters::HalfMaxWorldWidth;
+    float constexpr MaxWorldRight = GameParameters::HalfMaxWorldWidth;
+
+    float constexpr MaxWorldTop = GameParameters::HalfMaxWorldHeight;
+    float constexpr MaxWorldBottom = -GameParameters::HalfMaxWorldHeight;
+
+    // We clamp velocity to damp system instabilities at extreme events
+    static constexpr float MaxBounceVelocity = 150.0f; // Magic number
+
+    for (size_t p = 0; p < count; ++p)
+    {
+        vec2f const pos = positions[p];
+        vec2f const vel = velocities[p];
+
+        // Simulate bounce, bounded; bounce velocity, bounded
+
+        bool const isLeft = pos.x < MaxWorldLeft;
+        bool const isRight = pos.x > MaxWorldRight;
+
+        positions[p].x = isLeft
+            ? std::min(MaxWorldLeft + elasticity * (MaxWorldLeft - pos.x), 0.0f)
+            : (isRight ? std::max(MaxWorldRight - elasticity * (pos.x - MaxWorldRight), 0.0f) : pos.x);
+
+        velocities[p].x = isLeft
+            ? std::min(-vel.x, MaxBounceVelocity)
+            : (isRight ? std::max(-vel.x, -MaxBounceVelocity) : vel.x);
+
+        bool const isAbove = pos.y > MaxWorldTop;
+        bool const isBelow = pos.y < MaxWorldBottom;
+
+        positions[p].y = isAbove
+            ? std::max(MaxWorldTop - elasticity * (pos.y - MaxWorldTop), 0.0f)
+            : (isBelow ? std::min(MaxWorldBottom + elasticity * (MaxWorldBottom - pos.y), 0.0f) : pos.y);
+
+        velocities[p].y = isAbove
+            ? std::max(-vel.y, -MaxBounceVelocity)
+            : (isBelow ? std::min(-vel.y, MaxBounceVelocity) : vel.y);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Light diffusion tiling
+//
+// Light is diffused to tiles of contiguous points, each against the lamps whose light
+// may reach the tile. Points and lamps that have moved less than the tolerance since they
+// were last diffused are considered unchanged, and so are tiles made of unchanged points
+// and reached by unchanged lamps only, which are not diffused again.
+//
+
+static constexpr ElementCount LightDiffusionTileSize = 64;
+
+static constexpr float LightDiffusionPositionTolerance = 0.02f;
+
+// The area that may receive light from a lamp, enlarged to cover the tolerated
+// movements of both the lamp and the points
+static inline Geometry::AABB CalculateLampLightArea(
+    vec2f const & lampPosition,
+    float lampDistanceCoeff,
+    float lampSpreadMaxDistance)
+{
+    if (lampDistanceCoeff <= 0.0f)
+    {
+        // Lamp is off
+        return Geometry::AABB();
+    }
+
+    float const extent = lampSpreadMaxDistance + 2.0f * LightDiffusionPositionTolerance;
+
+    return Geometry::AABB(
+        lampPosition.x - extent,
+        lampPosition.x + extent,
+        lampPosition.y + extent,
+        lampPosition.y - extent);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -63,6 +156,7 @@ Ship::Ship(
     MaterialDatabase const & materialDatabase,
     std::shared_ptr<GameEventDispatcher> gameEventDispatcher,
     std::shared_ptr<TaskThreadPool> taskThreadPool,
+    std::unique_ptr<BufferArena> bufferArena,
     Points && points,
     Springs && springs,
     Triangles && triangles,
@@ -73,6 +167,7 @@ Ship::Ship(
     , mGameEventHandler(std::move(gameEventDispatcher))
     , mTaskThreadPool(std::move(taskThreadPool))
     , mSize(points.GetAABB().GetSize())
+    , mBufferArena(std::move(bufferArena))
     , mPoints(std::move(points))
     , mSprings(std::move(springs))
     , mTriangles(std::move(triangles))
@@ -100,6 +195,28 @@ Ship::Ship(
     , mIsSinking(false)
     , mWaterSplashedRunningAverage()
     , mLastLuminiscenceAdjustmentDiffused(-1.0f)
+    , mIsLightDiffusionStateValid(false)
+    , mLastDiffusedLampPositions()
+    , mLastDiffusedLampDistanceCoeffs()
+    , mLastDiffusedLampSpreadMaxDistances()
+    , mLastDiffusedLampPlaneIds()
+    , mIsLampChangedSinceLastDiffusion()
+    , mLampLightAreas()
+    , mLampLightAreaBoundingVolumeHierarchy()
+    , mLastDiffusedPointPositions()
+    , mLastDiffusedPointPlaneIds()
+    , mSpringBoundingVolumeHierarchy()
+    , mSpringBoundingBoxes()
+    , mIsSpringBoundingVolumeHierarchyStale(true)
+    , mSpringStructuralChangesSinceBoundingVolumeHierarchyBuild(0)
+    , mOceanSurfaceDisplacedVolumes()
+    , mOceanSurfaceDisplacedVolumeDeltas()
+    , mOceanSurfaceDisplacedVolumesFirstSample(0)
+    , mOceanSurfaceDisplacedVolumesEndSample(0)
+    , mOceanSurfaceDisplacedVolumeDeltasFirstSample(0)
+    , mOceanSurfaceDisplacedVolumeDeltasEndSample(0)
+    , mHasOceanSurfaceDisplacedVolumes(false)
+    , mPointBlockBoundingBoxes((mPoints.GetBufferElementCount() + PointBlockSize - 1) / PointBlockSize)
     // Render
     , mLastUploadedDebugShipRenderMode()
     , mPlaneTriangleIndicesToRender()
@@ -128,11 +245,32 @@ bool Ship::IsUnderwater(ElementIndex pointElementIndex) const
     return mParentWorld.IsUnderwater(mPoints.GetPosition(pointElementIndex));
 }
 
+void Ship::AccumulateSimulationStatistics(SimulationStatistics & simulationStatistics) const
+{
+    ++simulationStatistics.ShipCount;
+
+    simulationStatistics.PointCount += mPoints.GetRawShipPointCount();
+
+    simulationStatistics.EphemeralParticleCount += mPoints.GetActiveEphemeralPointCount();
+
+    for (auto springIndex : mSprings)
+    {
+        if (!mSprings.IsDeleted(springIndex))
+            ++simulationStatistics.SpringCount;
+    }
+
+    for (auto triangleIndex : mTriangles)
+    {
+        if (!mTriangles.IsDeleted(triangleIndex))
+            ++simulationStatistics.TriangleCount;
+    }
+}
+
 void Ship::Update(
     float currentSimulationTime,
     Storm::Parameters const & stormParameters,
     GameParameters const & gameParameters,
-    Render::RenderContext const & renderContext)
+    VectorFieldRenderModeType vectorFieldRenderMode)
 {
     std::vector<TaskThreadPool::Task> parallelTasks;
 
@@ -145,6 +283,9 @@ void Ship::Update(
     // Advance the current simulation sequence
     ++mCurrentSimulationSequenceNumber;
 
+    // Springs are about to move
+    mIsSpringBoundingVolumeHierarchyStale = true;
+
 #ifdef _DEBUG
     VerifyInvariants();
 #endif
@@ -182,6 +323,13 @@ void Ship::Update(
 
     UpdateStateMachines(currentSimulationTime, gameParameters);
 
+    ///////////////////////////////////////////////////////////////////
+    // Apply force fields queued since the last update
+    ///////////////////////////////////////////////////////////////////
+
+    // - Outputs: NonSpringForce, Temperature
+    ApplyQueuedForceFields(currentSimulationTime, gameParameters);
+
     /////////////////////////////////////////////////////////////////
     // Update mechanical dynamics
     /////////////////////////////////////////////////////////////////
@@ -223,10 +371,16 @@ void Ship::Update(
     int const numMechanicalDynamicsIterations = gameParameters.NumMechanicalDynamicsIterations<int>();
     for (int iter = 0; iter < numMechanicalDynamicsIterations; ++iter)
     {
+        bool const isLastIteration = (iter == numMechanicalDynamicsIterations - 1);
+
         // - SpringForces = 0
 
-        // Apply spring forces
-        ApplySpringsForces_BySprings(gameParameters);
+        // Apply spring forces and, at the last iteration,
+        // store spring lengths for the strain update
+        if (!isLastIteration)
+            ApplySpringsForces_BySprings<false>(gameParameters);
+        else
+            ApplySpringsForces_BySprings<true>(gameParameters);
 
         // - SpringForces = fs
 
@@ -236,9 +390,13 @@ void Ship::Update(
 
         // - SpringForces = 0
 
-        // Handle collisions with sea floor
+        // Handle collisions with sea floor and, at the last iteration,
+        // trim for world bounds
         //  - Changes position and velocity
-        HandleCollisionsWithSeaFloor(gameParameters);
+        if (!isLastIteration)
+            ApplyPostIntegrationConstraints<false>(gameParameters);
+        else
+            ApplyPostIntegrationConstraints<true>(gameParameters);
     }
 
     //
@@ -246,7 +404,7 @@ void Ship::Update(
     //
 
     // Check whether we need to save the non-spring force buffer before we zero it out
-    if (VectorFieldRenderModeType::PointForce == renderContext.GetVectorFieldRenderMode())
+    if (VectorFieldRenderModeType::PointForce == vectorFieldRenderMode)
     {
         mPoints.CopyNonSpringForceBufferToForceRenderBuffer();
     }
@@ -255,15 +413,6 @@ void Ship::Update(
     // - Outputs: NonSpringForce
     mPoints.ResetNonSpringForces();
 
-
-    //
-    // Trim for world bounds
-    //
-
-    // - Inputs: Position
-    // - Outputs: Position, Velocity
-    TrimForWorldBounds(gameParameters);
-
     /////////////////////////////////////////////////////////////////
     // Update bombs
     /////////////////////////////////////////////////////////////////
@@ -486,11 +635,22 @@ void Ship::Update(
 
     mPoints.UpdateHighlights(currentWallClockTimeFloat);
 
+    ///////////////////////////////////////////////////////////////////
+    // Publish positions for rendering
+    ///////////////////////////////////////////////////////////////////
+
+    mPoints.PublishPositionSnapshot();
+
 #ifdef _DEBUG
     VerifyInvariants();
 #endif
 }
 
+void Ship::PublishRenderSnapshots()
+{
+    mPoints.PublishPositionSnapshot();
+}
+
 void Ship::RenderUpload(
     GameParameters const & /*gameParameters*/,
     Render::RenderContext & renderContext)
@@ -661,6 +821,18 @@ void Ship::RenderUpload(
     mLastUploadedDebugShipRenderMode = renderContext.GetDebugShipRenderMode();
 }
 
+void Ship::RenderUploadPointPositions(
+    bool doInterpolate,
+    std::chrono::steady_clock::time_point now,
+    Render::RenderContext & renderContext) const
+{
+    mPoints.UploadPositions(
+        mId,
+        doInterpolate,
+        now,
+        renderContext);
+}
+
 ///////////////////////////////////////////////////////////////////////////////////
 // Private Helpers
 ///////////////////////////////////////////////////////////////////////////////////
@@ -812,6 +984,7 @@ void Ship::ApplyWorldForces(
     }
 }
 
+template<bool DoStoreLengths>
 void Ship::ApplySpringsForces_BySprings(GameParameters const & /*gameParameters*/)
 {
     vec2f const * restrict const pointPositionBuffer = mPoints.GetPositionBufferAsVec2();
@@ -821,6 +994,7 @@ void Ship::ApplySpringsForces_BySprings(GameParameters const & /*gameParameters*
     Springs::Endpoints const * restrict const endpointsBuffer = mSprings.GetEndpointsBuffer();
     float const * restrict const restLengthBuffer = mSprings.GetRestLengthBuffer();
     Springs::Coefficients const * restrict const coefficientsBuffer = mSprings.GetCoefficientsBuffer();
+    float * restrict const lengthBuffer = mSprings.GetLengthBuffer();
 
     ElementCount const springCount = mSprings.GetElementCount();
     for (ElementIndex springIndex = 0; springIndex < springCount; ++springIndex)
@@ -835,6 +1009,11 @@ void Ship::ApplySpringsForces_BySprings(GameParameters const & /*gameParameters*
         float const displacementLength = displacement.length();
         vec2f const springDir = displacement.normalise(displacementLength);
 
+        if constexpr (DoStoreLengths)
+        {
+            lengthBuffer[springIndex] = displacementLength;
+        }
+
         //
         // 1. Hooke's law
         //
@@ -1034,152 +1213,209 @@ void Ship::IntegrateAndResetSpringForces(GameParameters const & gameParameters)
     float const * const restrict integrationFactorBuffer = mPoints.GetIntegrationFactorBufferAsFloat();
 
     size_t const count = mPoints.GetBufferElementCount() * 2; // Two components per vector
-    for (size_t i = 0; i < count; ++i)
+    size_t const pointCount = mPoints.GetElementCount() * 2; // Two components per vector
+
+    // Integrate one block of points at a time, so that we may calculate
+    // the bounding box of the block while its positions are in cache
+    for (size_t b = 0, blockStart = 0; blockStart < count; ++b, blockStart += PointBlockSize * 2)
     {
-        //
-        // Verlet integration (fourth order, with velocity being first order)
-        //
+        size_t const blockEnd = std::min(blockStart + PointBlockSize * 2, count);
 
-        float const deltaPos =
-            velocityBuffer[i] * dt
-            + (springForceBuffer[i] + nonSpringForceBuffer[i]) * integrationFactorBuffer[i];
+        for (size_t i = blockStart; i < blockEnd; ++i)
+        {
+            //
+            // Verlet integration (fourth order, with velocity being first order)
+            //
 
-        positionBuffer[i] += deltaPos;
-        velocityBuffer[i] = deltaPos * velocityFactor;
+            float const deltaPos =
+                velocityBuffer[i] * dt
+                + (springForceBuffer[i] + nonSpringForceBuffer[i]) * integrationFactorBuffer[i];
 
-        // Zero out spring force now that we've integrated it
-        springForceBuffer[i] = 0.0f;
+            positionBuffer[i] += deltaPos;
+            velocityBuffer[i] = deltaPos * velocityFactor;
+
+            // Zero out spring force now that we've integrated it
+            springForceBuffer[i] = 0.0f;
+        }
+
+        // Calculate the bounding box of the block, excluding the
+        // padding points
+        float minX = std::numeric_limits<float>::max();
+        float maxX = std::numeric_limits<float>::lowest();
+        float minY = std::numeric_limits<float>::max();
+        float maxY = std::numeric_limits<float>::lowest();
+        for (size_t i = blockStart; i < std::min(blockEnd, pointCount); i += 2)
+        {
+            minX = std::min(minX, positionBuffer[i]);
+            maxX = std::max(maxX, positionBuffer[i]);
+            minY = std::min(minY, positionBuffer[i + 1]);
+            maxY = std::max(maxY, positionBuffer[i + 1]);
+        }
+
+        assert(b < mPointBlockBoundingBoxes.size());
+        mPointBlockBoundingBoxes[b] = Geometry::AABB(minX, maxX, maxY, minY);
     }
 }
 
-void Ship::HandleCollisionsWithSeaFloor(GameParameters const & gameParameters)
+template<bool DoTrimForWorldBounds>
+void Ship::ApplyPostIntegrationConstraints(GameParameters const & gameParameters)
 {
     float const dt = gameParameters.MechanicalSimulationStepTimeDuration<float>();
 
     float const elasticityFactor = -gameParameters.OceanFloorElasticity;
     float const inverseFriction = 1.0f - gameParameters.OceanFloorFriction;
 
-    for (auto pointIndex : mPoints)
-    {
-        auto const & position = mPoints.GetPosition(pointIndex);
+    ElementCount const pointCount = mPoints.GetElementCount();
+
+    // Blocks made exclusively of padding points have no box
+    size_t const blockCount = (pointCount + PointBlockSize - 1) / PointBlockSize;
+    assert(blockCount <= mPointBlockBoundingBoxes.size());
 
-        // Check if point is below the sea floor
+    std::array<float, PointBlockSize> clampedXs;
+    std::array<float, PointBlockSize> floorHeights;
+
+    for (size_t b = 0; b < blockCount; ++b)
+    {
+        //
+        // Skip the block if none of its points may be below the sea floor
+        // nor - when trimming - outside of the world
         //
-        // At this moment the point might be outside of world boundaries,
-        // so better clamp its x before sampling ocean floor height
-        float const clampedX = Clamp(position.x, -GameParameters::HalfMaxWorldWidth, GameParameters::HalfMaxWorldWidth);
-        float const floorHeight = mParentWorld.GetOceanFloorHeightAt(clampedX);
-        if (position.y <= floorHeight)
-        {
-            // Collision!
 
-            //
-            // Calculate post-bounce velocity
-            //
+        auto const & blockBoundingBox = mPointBlockBoundingBoxes[b];
+
+        bool const isBlockNearFloor =
+            blockBoundingBox.BottomLeft.y <= mParentWorld.GetOceanFloorMaxHeightIn(blockBoundingBox.BottomLeft.x, blockBoundingBox.TopRight.x);
 
-            vec2f const pointVelocity = mPoints.GetVelocity(pointIndex);
+        // The floor response may move points back to where they were in the previous
+        // iteration, i.e. outside of the block's box, hence we also trim blocks near the floor
+        bool const doTrimBlock =
+            DoTrimForWorldBounds
+            && (isBlockNearFloor
+                || blockBoundingBox.BottomLeft.x < -GameParameters::HalfMaxWorldWidth
+                || blockBoundingBox.TopRight.x > GameParameters::HalfMaxWorldWidth
+                || blockBoundingBox.BottomLeft.y < -GameParameters::HalfMaxWorldHeight
+                || blockBoundingBox.TopRight.y > GameParameters::HalfMaxWorldHeight);
 
-            // Calculate sea floor anti-normal
-            // (optimized) (positive points down)
-            ////////vec2f const seaFloorAntiNormal = -vec2f(
-            ////////    floorHeight - mParentWorld.GetOceanFloorHeightAt(clampedX + 0.01f),
-            ////////    0.01f).normalise(); // Points below
-            vec2f const seaFloorAntiNormal = vec2f(
-                mParentWorld.GetOceanFloorHeightAt(clampedX + 0.01f) - floorHeight,
-                -0.01f).normalise(); // Points below
+        if (!isBlockNearFloor && !doTrimBlock)
+            continue;
 
-            // Calculate the component of the point's velocity along the anti-normal,
-            // i.e. towards the interior of the floor...
-            float const pointVelocityAlongAntiNormal = pointVelocity.dot(seaFloorAntiNormal);
+        ElementIndex const blockStart = static_cast<ElementIndex>(b * PointBlockSize);
+        ElementCount const blockPointCount = std::min(static_cast<ElementCount>(PointBlockSize), pointCount - blockStart);
 
-            // ...if negative, it's already pointing outside the floor, hence we leave it as-is
-            if (pointVelocityAlongAntiNormal > 0.0f)
+        if (isBlockNearFloor)
+        {
+            //
+            // Sample the ocean floor under all points of the block in one batch
+            //
+
+            for (ElementIndex p = 0; p < blockPointCount; ++p)
             {
-                // Decompose point velocity into normal and tangential
-                vec2f const normalVelocity = seaFloorAntiNormal * pointVelocityAlongAntiNormal;
-                vec2f const tangentialVelocity = pointVelocity - normalVelocity;
+                // At this moment the point might be outside of world boundaries,
+                // so better clamp its x before sampling ocean floor height
+                clampedXs[p] = Clamp(mPoints.GetPosition(blockStart + p).x, -GameParameters::HalfMaxWorldWidth, GameParameters::HalfMaxWorldWidth);
+            }
 
-                // Calculate normal reponse: Vn' = -e*Vn (e = elasticity, [0.0 - 1.0])
-                vec2f const normalResponse =
-                    normalVelocity
-                    * elasticityFactor; // Already negative
+            mParentWorld.GetOceanFloorHeightsAt(
+                clampedXs.data(),
+                floorHeights.data(),
+                blockPointCount);
 
-                // Calculate tangential response: Vt' = a*Vt (a = (1.0-friction), [0.0 - 1.0])
-                vec2f const tangentialResponse =
-                    tangentialVelocity
-                    * inverseFriction;
+            //
+            // Bounce points below the sea floor
+            //
 
-                //
-                // Impart final position and velocity
-                //
+            for (ElementIndex p = 0; p < blockPointCount; ++p)
+            {
+                ElementIndex const pointIndex = blockStart + p;
 
-                // Move point back to where it was in the previous step,
-                // which is guaranteed to be more towards the outside
-                mPoints.GetPosition(pointIndex) -= pointVelocity * dt;
+                auto const & position = mPoints.GetPosition(pointIndex);
 
-                // Set velocity to resultant collision velocity
-                mPoints.GetVelocity(pointIndex) = normalResponse + tangentialResponse;
-            }
-        }
-    }
-}
+                // Check if point is below the sea floor
+                float const clampedX = clampedXs[p];
+                float const floorHeight = floorHeights[p];
+                if (position.y <= floorHeight)
+                {
+                    // Collision!
 
-void Ship::TrimForWorldBounds(GameParameters const & gameParameters)
-{
-    float constexpr MaxWorldLeft = -GameParameters::HalfMaxWorldWidth;
-    float constexpr MaxWorldRight = GameParameters::HalfMaxWorldWidth;
+                    //
+                    // Calculate post-bounce velocity
+                    //
 
-    float constexpr MaxWorldTop = GameParameters::HalfMaxWorldHeight;
-    float constexpr MaxWorldBottom = -GameParameters::HalfMaxWorldHeight;
+                    vec2f const pointVelocity = mPoints.GetVelocity(pointIndex);
 
-    // Elasticity of the bounce against world boundaries
-    //  - We use the ocean floor's elasticity for convenience
-    float const elasticity = gameParameters.OceanFloorElasticity;
+                    // Calculate sea floor anti-normal
+                    // (optimized) (positive points down)
+                    ////////vec2f const seaFloorAntiNormal = -vec2f(
+                    ////////    floorHeight - mParentWorld.GetOceanFloorHeightAt(clampedX + 0.01f),
+                    ////////    0.01f).normalise(); // Points below
+                    vec2f const seaFloorAntiNormal = vec2f(
+                        mParentWorld.GetOceanFloorHeightAt(clampedX + 0.01f) - floorHeight,
+                        -0.01f).normalise(); // Points below
 
-    // We clamp velocity to damp system instabilities at extreme events
-    static constexpr float MaxBounceVelocity = 150.0f; // Magic number
+                    // Calculate the component of the point's velocity along the anti-normal,
+                    // i.e. towards the interior of the floor...
+                    float const pointVelocityAlongAntiNormal = pointVelocity.dot(seaFloorAntiNormal);
 
-    // Visit all points
-    for (auto pointIndex : mPoints)
-    {
-        auto & pos = mPoints.GetPosition(pointIndex);
+                    // ...if negative, it's already pointing outside the floor, hence we leave it as-is
+                    if (pointVelocityAlongAntiNormal > 0.0f)
+                    {
+                        // Decompose point velocity into normal and tangential
+                        vec2f const normalVelocity = seaFloorAntiNormal * pointVelocityAlongAntiNormal;
+                        vec2f const tangentialVelocity = pointVelocity - normalVelocity;
 
-        if (pos.x < MaxWorldLeft)
-        {
-            // Simulate bounce, bounded
-            pos.x = std::min(MaxWorldLeft + elasticity * (MaxWorldLeft - pos.x), 0.0f);
+                        // Calculate normal reponse: Vn' = -e*Vn (e = elasticity, [0.0 - 1.0])
+                        vec2f const normalResponse =
+                            normalVelocity
+                            * elasticityFactor; // Already negative
 
-            // Bounce bounded
-            mPoints.GetVelocity(pointIndex).x = std::min(-mPoints.GetVelocity(pointIndex).x, MaxBounceVelocity);
-        }
-        else if (pos.x > MaxWorldRight)
-        {
-            // Simulate bounce, bounded
-            pos.x = std::max(MaxWorldRight - elasticity * (pos.x - MaxWorldRight), 0.0f);
+                        // Calculate tangential response: Vt' = a*Vt (a = (1.0-friction), [0.0 - 1.0])
+                        vec2f const tangentialResponse =
+                            tangentialVelocity
+                            * inverseFriction;
 
-            // Bounce bounded
-            mPoints.GetVelocity(pointIndex).x = std::max(-mPoints.GetVelocity(pointIndex).x, -MaxBounceVelocity);
-        }
+                        //
+                        // Impart final position and velocity
+                        //
 
-        if (pos.y > MaxWorldTop)
-        {
-            // Simulate bounce, bounded
-            pos.y = std::max(MaxWorldTop - elasticity * (pos.y - MaxWorldTop), 0.0f);
+                        // Move point back to where it was in the previous step,
+                        // which is guaranteed to be more towards the outside
+                        mPoints.GetPosition(pointIndex) -= pointVelocity * dt;
 
-            // Bounce bounded
-            mPoints.GetVelocity(pointIndex).y = std::max(-mPoints.GetVelocity(pointIndex).y, -MaxBounceVelocity);
+                        // Set velocity to resultant collision velocity
+                        mPoints.GetVelocity(pointIndex) = normalResponse + tangentialResponse;
+                    }
+                }
+            }
         }
-        else if (pos.y < MaxWorldBottom)
+
+        if (doTrimBlock)
         {
-            // Simulate bounce, bounded
-            pos.y = std::min(MaxWorldBottom + elasticity * (MaxWorldBottom - pos.y), 0.0f);
+            //
+            // Trim for world bounds, while the block's points are still in cache
+            //
 
-            // Bounce bounded
-            mPoints.GetVelocity(pointIndex).y = std::min(-mPoints.GetVelocity(pointIndex).y, MaxBounceVelocity);
+            // Elasticity of the bounce against world boundaries
+            //  - We use the ocean floor's elasticity for convenience
+            TrimPointsForWorldBounds(
+                mPoints.GetPositionBufferAsVec2() + blockStart,
+                mPoints.GetVelocityBufferAsVec2() + blockStart,
+                blockPointCount,
+                gameParameters.OceanFloorElasticity);
         }
     }
 }
 
+void Ship::TrimForWorldBounds(GameParameters const & gameParameters)
+{
+    // Elasticity of the bounce against world boundaries
+    //  - We use the ocean floor's elasticity for convenience
+    TrimPointsForWorldBounds(
+        mPoints.GetPositionBufferAsVec2(),
+        mPoints.GetVelocityBufferAsVec2(),
+        mPoints.GetElementCount(),
+        gameParameters.OceanFloorElasticity);
+}
+
 ///////////////////////////////////////////////////////////////////////////////////
 // Water Dynamics
 ///////////////////////////////////////////////////////////////////////////////////
@@ -1313,7 +1549,7 @@ void Ship::UpdateWaterInflow(
             }
 
             // Adjust water
-            mPoints.GetWater(pointIndex) += newWater;
+            mPoints.SetWater(pointIndex, mPoints.GetWater(pointIndex) + newWater);
 
             // Check if it's time to produce air bubbles
             mPoints.GetCumulatedIntakenWater(pointIndex) += newWater;
@@ -1540,6 +1776,12 @@ void Ship::UpdateWaterVelocities(
                 newPointWaterBufferData[pointIndex] -= springOutboundQuantityOfWater;
                 newPointWaterBufferData[cs.OtherEndpointIndex] += springOutboundQuantityOfWater;
 
+                if (springOutboundQuantityOfWater != 0.0f)
+                {
+                    mPoints.MarkWaterAsDirty(pointIndex);
+                    mPoints.MarkWaterAsDirty(cs.OtherEndpointIndex);
+                }
+
                 // Remove "old momentum" (old velocity) from point
                 newPointWaterMomentumBufferData[pointIndex] -=
                     oldPointWaterVelocityBufferData[pointIndex]
@@ -1679,6 +1921,184 @@ void Ship::UpdateSinking()
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////////
+// Ocean Surface Coupling
+///////////////////////////////////////////////////////////////////////////////////
+
+void Ship::UpdateOceanSurfaceDisplacement()
+{
+    // The depth below the ocean surface over which the displacement of a point fades away;
+    // water displaced deeper than this does not move the surface (m)
+    float constexpr DisplacementFadeDepth = 8.0f; // Magic number
+
+    if (!mOceanSurfaceDisplacedVolumes)
+    {
+        // One extra sample just to ease distributing over neighboring samples
+        mOceanSurfaceDisplacedVolumes.reset(new float[OceanSurface::SamplesCount + 1]);
+        std::fill_n(mOceanSurfaceDisplacedVolumes.get(), OceanSurface::SamplesCount + 1, 0.0f);
+
+        mOceanSurfaceDisplacedVolumeDeltas.reset(new float[OceanSurface::SamplesCount + 1]);
+    }
+
+    ElementCount const pointCount = mPoints.GetRawShipPointCount();
+
+    //
+    // 1. Calculate the (fractional) ocean surface sample of each point and the volume
+    //    it displaces, together with the range of samples spanned by the ship
+    //
+
+    auto sampleIndexBuffer = mPoints.AllocateWorkBufferFloat();
+    float * restrict const pointSampleIndices = sampleIndexBuffer->data();
+
+    auto displacedVolumeBuffer = mPoints.AllocateWorkBufferFloat();
+    float * restrict const pointDisplacedVolumes = displacedVolumeBuffer->data();
+
+    vec2f const * restrict const positions = mPoints.GetPositionBufferAsVec2();
+
+    // Query the ocean surface in one batch, starting with the
+    // x's in the sample buffer and the heights in the volume buffer
+
+    for (ElementIndex p = 0; p < pointCount; ++p)
+    {
+        pointSampleIndices[p] = Clamp(positions[p].x, -GameParameters::HalfMaxWorldWidth, GameParameters::HalfMaxWorldWidth);
+    }
+
+    mParentWorld.GetOceanSurfaceHeightsAt(
+        pointSampleIndices,
+        pointDisplacedVolumes,
+        pointCount);
+
+    float minSampleIndex = std::numeric_limits<float>::max();
+    float maxSampleIndex = std::numeric_limits<float>::lowest();
+
+    for (ElementIndex p = 0; p < pointCount; ++p)
+    {
+        // Leave room for the next sample
+        float const sampleIndex = Clamp(
+            (pointSampleIndices[p] + GameParameters::HalfMaxWorldWidth) / OceanSurface::Dx,
+            0.0f,
+            static_cast<float>(OceanSurface::SamplesCount - 1));
+
+        pointSampleIndices[p] = sampleIndex;
+        minSampleIndex = std::min(minSampleIndex, sampleIndex);
+        maxSampleIndex = std::max(maxSampleIndex, sampleIndex);
+
+        float const depth = pointDisplacedVolumes[p] - positions[p].y;
+        pointDisplacedVolumes[p] =
+            Clamp(depth, 0.0f, 1.0f) // How much of the point is underwater
+            * Clamp(1.0f - depth / DisplacementFadeDepth, 0.0f, 1.0f);
+    }
+
+    size_t const firstSample = (pointCount > 0)
+        ? static_cast<size_t>(FastTruncateToArchInt(minSampleIndex))
+        : 0;
+    size_t const endSample = (pointCount > 0)
+        ? static_cast<size_t>(FastTruncateToArchInt(maxSampleIndex)) + 2 // Next sample, and one past it
+        : 0;
+
+    assert(firstSample <= endSample && endSample <= OceanSurface::SamplesCount + 1);
+
+    //
+    // 2. Start the deltas from the previous volumes, clearing these as we go
+    //
+
+    float * restrict const displacedVolumes = mOceanSurfaceDisplacedVolumes.get();
+    float * restrict const displacedVolumeDeltas = mOceanSurfaceDisplacedVolumeDeltas.get();
+
+    size_t deltasFirstSample = firstSample;
+    size_t deltasEndSample = endSample;
+    if (mOceanSurfaceDisplacedVolumesFirstSample < mOceanSurfaceDisplacedVolumesEndSample)
+    {
+        if (deltasFirstSample < deltasEndSample)
+        {
+            deltasFirstSample = std::min(deltasFirstSample, mOceanSurfaceDisplacedVolumesFirstSample);
+            deltasEndSample = std::max(deltasEndSample, mOceanSurfaceDisplacedVolumesEndSample);
+        }
+        else
+        {
+            deltasFirstSample = mOceanSurfaceDisplacedVolumesFirstSample;
+            deltasEndSample = mOceanSurfaceDisplacedVolumesEndSample;
+        }
+    }
+
+    for (size_t s = deltasFirstSample; s < deltasEndSample; ++s)
+    {
+        displacedVolumeDeltas[s] = -displacedVolumes[s];
+        displacedVolumes[s] = 0.0f;
+    }
+
+    //
+    // 3. Scatter the volume of each point onto the two samples around it;
+    //    no locking, as the volumes are owned by this ship
+    //
+
+    for (ElementIndex p = 0; p < pointCount; ++p)
+    {
+        auto const sampleIndexI = FastTruncateToArchInt(pointSampleIndices[p]);
+        float const sampleIndexDx = pointSampleIndices[p] - sampleIndexI;
+
+        assert(sampleIndexI >= 0 && static_cast<size_t>(sampleIndexI) < OceanSurface::SamplesCount);
+
+        displacedVolumes[sampleIndexI] += (1.0f - sampleIndexDx) * pointDisplacedVolumes[p];
+        displacedVolumes[sampleIndexI + 1] += sampleIndexDx * pointDisplacedVolumes[p];
+    }
+
+    //
+    // 4. Complete the deltas with the new volumes
+    //
+
+    for (size_t s = firstSample; s < endSample; ++s)
+    {
+        displacedVolumeDeltas[s] += displacedVolumes[s];
+    }
+
+    mOceanSurfaceDisplacedVolumesFirstSample = firstSample;
+    mOceanSurfaceDisplacedVolumesEndSample = endSample;
+
+    if (mHasOceanSurfaceDisplacedVolumes)
+    {
+        mOceanSurfaceDisplacedVolumeDeltasFirstSample = deltasFirstSample;
+        mOceanSurfaceDisplacedVolumeDeltasEndSample = deltasEndSample;
+    }
+    else
+    {
+        // Nothing to compare with yet - e.g. the ship has just been loaded
+        mOceanSurfaceDisplacedVolumeDeltasFirstSample = 0;
+        mOceanSurfaceDisplacedVolumeDeltasEndSample = 0;
+
+        mHasOceanSurfaceDisplacedVolumes = true;
+    }
+}
+
+void Ship::ResetOceanSurfaceDisplacement()
+{
+    if (!mHasOceanSurfaceDisplacedVolumes)
+        return;
+
+    std::fill(
+        mOceanSurfaceDisplacedVolumes.get() + mOceanSurfaceDisplacedVolumesFirstSample,
+        mOceanSurfaceDisplacedVolumes.get() + mOceanSurfaceDisplacedVolumesEndSample,
+        0.0f);
+
+    mOceanSurfaceDisplacedVolumesFirstSample = 0;
+    mOceanSurfaceDisplacedVolumesEndSample = 0;
+    mOceanSurfaceDisplacedVolumeDeltasFirstSample = 0;
+    mOceanSurfaceDisplacedVolumeDeltasEndSample = 0;
+
+    mHasOceanSurfaceDisplacedVolumes = false;
+}
+
+void Ship::ApplyOceanSurfaceDisplacement(OceanSurface & oceanSurface) const
+{
+    if (mOceanSurfaceDisplacedVolumeDeltasFirstSample < mOceanSurfaceDisplacedVolumeDeltasEndSample)
+    {
+        oceanSurface.DisplaceByVolumeDeltas(
+            mOceanSurfaceDisplacedVolumeDeltas.get(),
+            mOceanSurfaceDisplacedVolumeDeltasFirstSample,
+            mOceanSurfaceDisplacedVolumeDeltasEndSample);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////////
 // Electrical Dynamics
 ///////////////////////////////////////////////////////////////////////////////////
@@ -1697,15 +2117,34 @@ void Ship::DiffuseLight(GameParameters const & gameParameters)
         return;
     }
 
+    auto const lampCount = mElectricalElements.GetLampCount();
+    ElementCount const pointCount = mPoints.GetAlignedShipPointCount(); // No real reason to skip ephemerals, other than they're not expected to have light
+    ElementCount const rawPointCount = mPoints.GetRawShipPointCount();
+
+    if (!mIsLightDiffusionStateValid)
+    {
+        mLastDiffusedLampPositions.resize(lampCount);
+        mLastDiffusedLampDistanceCoeffs.resize(lampCount);
+        mLastDiffusedLampSpreadMaxDistances.resize(lampCount);
+        mLastDiffusedLampPlaneIds.resize(lampCount);
+        mIsLampChangedSinceLastDiffusion.resize(lampCount);
+        mLampLightAreas.resize(lampCount);
+        mLastDiffusedPointPositions.resize(rawPointCount);
+        mLastDiffusedPointPlaneIds.resize(rawPointCount);
+    }
+
+    float constexpr SquarePositionTolerance = LightDiffusionPositionTolerance * LightDiffusionPositionTolerance;
+
     //
-    // 1. Prepare lamp data
+    // 1. Prepare lamp data, and detect the lamps that have changed since they were last diffused
     //
 
     auto & lampPositions = mElectricalElements.GetLampPositionWorkBuffer(); // Padded to vectorization float count
     auto & lampPlaneIds = mElectricalElements.GetLampPlaneIdWorkBuffer(); // Padded to vectorization float count
     auto & lampDistanceCoeffs = mElectricalElements.GetLampDistanceCoefficientWorkBuffer(); // Padded to vectorization float count
+    float const * const lampSpreadMaxDistances = mElectricalElements.GetLampLightSpreadMaxDistanceBufferAsFloat();
 
-    auto const lampCount = mElectricalElements.GetLampCount();
+    bool isAnyLampChanged = false;
     for (ElementIndex l = 0; l < lampCount; ++l)
     {
         auto const lampElectricalElementIndex = mElectricalElements.Lamps()[l];
@@ -1716,22 +2155,156 @@ void Ship::DiffuseLight(GameParameters const & gameParameters)
         lampDistanceCoeffs[l] =
             mElectricalElements.GetLampRawDistanceCoefficient(l)
             * mElectricalElements.GetAvailableLight(lampElectricalElementIndex);
+
+        bool const isChanged =
+            !mIsLightDiffusionStateValid
+            || (lampPositions[l] - mLastDiffusedLampPositions[l]).squareLength() > SquarePositionTolerance
+            || lampDistanceCoeffs[l] != mLastDiffusedLampDistanceCoeffs[l]
+            || lampSpreadMaxDistances[l] != mLastDiffusedLampSpreadMaxDistances[l]
+            || lampPlaneIds[l] != mLastDiffusedLampPlaneIds[l];
+
+        mIsLampChangedSinceLastDiffusion[l] = isChanged;
+
+        if (isChanged)
+        {
+            // The area of a changed lamp also covers its old area, so that
+            // the points it used to light are diffused again
+            mLampLightAreas[l] = mIsLightDiffusionStateValid
+                ? CalculateLampLightArea(mLastDiffusedLampPositions[l], mLastDiffusedLampDistanceCoeffs[l], mLastDiffusedLampSpreadMaxDistances[l])
+                : Geometry::AABB();
+
+            mLastDiffusedLampPositions[l] = lampPositions[l];
+            mLastDiffusedLampDistanceCoeffs[l] = lampDistanceCoeffs[l];
+            mLastDiffusedLampSpreadMaxDistances[l] = lampSpreadMaxDistances[l];
+            mLastDiffusedLampPlaneIds[l] = lampPlaneIds[l];
+
+            mLampLightAreas[l].ExtendTo(CalculateLampLightArea(lampPositions[l], lampDistanceCoeffs[l], lampSpreadMaxDistances[l]));
+
+            isAnyLampChanged = true;
+        }
+        else
+        {
+            mLampLightAreas[l] = CalculateLampLightArea(mLastDiffusedLampPositions[l], mLastDiffusedLampDistanceCoeffs[l], mLastDiffusedLampSpreadMaxDistances[l]);
+        }
+    }
+
+    // When no lamp has changed the index is still valid, as the areas of the lamps
+    // that changed when it was built cover their current areas
+    if (isAnyLampChanged)
+    {
+        mLampLightAreaBoundingVolumeHierarchy.Build(mLampLightAreas);
     }
 
     //
-    // 2. Diffuse light
+    // 2. Diffuse light to each tile of points that has changed, or that is reached
+    //    by lamps that have changed, against the lamps that may reach it
     //
 
-    Algorithms::DiffuseLight(
-        mPoints.GetPositionBufferAsVec2(),
-        mPoints.GetPlaneIdBufferAsPlaneId(),
-        mPoints.GetAlignedShipPointCount(), // No real reason to skip ephemerals, other than they're not expected to have light
-        lampPositions.data(),
-        lampPlaneIds.data(),
-        lampDistanceCoeffs.data(),
-        mElectricalElements.GetLampLightSpreadMaxDistanceBufferAsFloat(),
-        mElectricalElements.GetBufferLampCount(),
-        mPoints.GetLightBufferAsFloat());
+    vec2f const * const pointPositions = mPoints.GetPositionBufferAsVec2();
+    PlaneId const * const pointPlaneIds = mPoints.GetPlaneIdBufferAsPlaneId();
+    float * const pointLights = mPoints.GetLightBufferAsFloat();
+
+    vec2f * const tileLampPositions = mElectricalElements.GetTileLampPositionWorkBuffer().data();
+    PlaneId * const tileLampPlaneIds = mElectricalElements.GetTileLampPlaneIdWorkBuffer().data();
+    float * const tileLampDistanceCoeffs = mElectricalElements.GetTileLampDistanceCoefficientWorkBuffer().data();
+    float * const tileLampSpreadMaxDistances = mElectricalElements.GetTileLampLightSpreadMaxDistanceWorkBuffer().data();
+
+    for (ElementIndex tileStart = 0; tileStart < pointCount; tileStart += LightDiffusionTileSize)
+    {
+        ElementIndex const tileEnd = std::min(tileStart + LightDiffusionTileSize, pointCount);
+        ElementIndex const rawTileEnd = std::min(tileEnd, rawPointCount);
+
+        // Calculate the tile's bounding box, and detect whether any of its points has changed
+
+        float minX = std::numeric_limits<float>::max();
+        float maxX = std::numeric_limits<float>::lowest();
+        float minY = std::numeric_limits<float>::max();
+        float maxY = std::numeric_limits<float>::lowest();
+        bool isTileChanged = !mIsLightDiffusionStateValid;
+        for (ElementIndex p = tileStart; p < rawTileEnd; ++p)
+        {
+            vec2f const pointPosition = pointPositions[p];
+            minX = std::min(minX, pointPosition.x);
+            maxX = std::max(maxX, pointPosition.x);
+            minY = std::min(minY, pointPosition.y);
+            maxY = std::max(maxY, pointPosition.y);
+
+            isTileChanged |=
+                ((pointPosition - mLastDiffusedPointPositions[p]).squareLength() > SquarePositionTolerance)
+                | (pointPlaneIds[p] != mLastDiffusedPointPlaneIds[p]);
+        }
+
+        // Gather the lamps that may reach the tile
+
+        ElementCount tileLampCount = 0;
+        bool isAnyTileLampChanged = false;
+        mLampLightAreaBoundingVolumeHierarchy.VisitOverlapping(
+            Geometry::AABB(minX, maxX, maxY, minY),
+            [&](ElementIndex l)
+            {
+                tileLampPositions[tileLampCount] = lampPositions[l];
+                tileLampPlaneIds[tileLampCount] = lampPlaneIds[l];
+                tileLampDistanceCoeffs[tileLampCount] = lampDistanceCoeffs[l];
+                tileLampSpreadMaxDistances[tileLampCount] = lampSpreadMaxDistances[l];
+                isAnyTileLampChanged |= mIsLampChangedSinceLastDiffusion[l];
+                ++tileLampCount;
+            });
+
+        if (!isTileChanged && !isAnyTileLampChanged)
+        {
+            // Tile keeps its light
+            continue;
+        }
+
+        if (tileLampCount == 0)
+        {
+            std::fill(
+                pointLights + tileStart,
+                pointLights + tileEnd,
+                0.0f);
+        }
+        else
+        {
+            // Pad with lamps that emit no light
+            while (!is_aligned_to_float_element_count(tileLampCount))
+            {
+                tileLampPositions[tileLampCount] = vec2f::zero();
+                tileLampPlaneIds[tileLampCount] = 0;
+                tileLampDistanceCoeffs[tileLampCount] = 0.0f;
+                tileLampSpreadMaxDistances[tileLampCount] = 0.0f;
+                ++tileLampCount;
+            }
+
+            assert(tileLampCount <= mElectricalElements.GetBufferLampCount());
+
+            Algorithms::DiffuseLight(
+                pointPositions + tileStart,
+                pointPlaneIds + tileStart,
+                tileEnd - tileStart,
+                tileLampPositions,
+                tileLampPlaneIds,
+                tileLampDistanceCoeffs,
+                tileLampSpreadMaxDistances,
+                tileLampCount,
+                pointLights + tileStart);
+        }
+
+        // Remember the points as diffused
+
+        std::copy(
+            pointPositions + tileStart,
+            pointPositions + rawTileEnd,
+            mLastDiffusedPointPositions.begin() + tileStart);
+
+        std::copy(
+            pointPlaneIds + tileStart,
+            pointPlaneIds + rawTileEnd,
+            mLastDiffusedPointPlaneIds.begin() + tileStart);
+
+        mPoints.MarkLightBufferAsDirty(tileStart, tileEnd - tileStart);
+    }
+
+    mIsLightDiffusionStateValid = true;
 
     // Remember that we've diffused light with this luminiscence adjustment
     mLastLuminiscenceAdjustmentDiffused = gameParameters.LuminiscenceAdjustment;
@@ -1967,9 +2540,6 @@ void Ship::RotPoints(
         // Decay
         mPoints.SetDecay(p, mPoints.GetDecay(p) * alpha);
     }
-
-    // Remember that the decay buffer is dirty
-    mPoints.MarkDecayBufferAsDirty();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////
@@ -2118,9 +2688,6 @@ void Ship::RunConnectivityVisit()
     mPoints.MarkColorBufferAsDirty();
 #endif
 
-    // Remember non-ephemeral portion of plane IDs is dirty
-    mPoints.MarkPlaneIdBufferNonEphemeralAsDirty();
-
     //
     // Re-order burning points, as their plane IDs might have changed
     //
@@ -2367,6 +2934,50 @@ void Ship::GenerateSparklesForLightning(
     }
 }
 
+void Ship::UpdateSpringBoundingVolumeHierarchy() const
+{
+    // Rebuild when more than this fraction of the springs has been broken or restored
+    ElementCount constexpr RebuildStructuralChangesFraction = 8;
+
+    if (!mIsSpringBoundingVolumeHierarchyStale)
+        return;
+
+    //
+    // Calculate spring boxes; broken springs get empty boxes
+    //
+
+    mSpringBoundingBoxes.resize(mSprings.GetElementCount());
+
+    for (auto springIndex : mSprings)
+    {
+        Geometry::AABB box;
+        if (!mSprings.IsDeleted(springIndex))
+        {
+            box.ExtendTo(mSprings.GetEndpointAPosition(springIndex, mPoints));
+            box.ExtendTo(mSprings.GetEndpointBPosition(springIndex, mPoints));
+        }
+
+        mSpringBoundingBoxes[springIndex] = box;
+    }
+
+    //
+    // Refit or rebuild
+    //
+
+    if (mSpringBoundingVolumeHierarchy.GetElementCount() != mSpringBoundingBoxes.size()
+        || mSpringStructuralChangesSinceBoundingVolumeHierarchyBuild > mSpringBoundingBoxes.size() / RebuildStructuralChangesFraction)
+    {
+        mSpringBoundingVolumeHierarchy.Build(mSpringBoundingBoxes);
+        mSpringStructuralChangesSinceBoundingVolumeHierarchyBuild = 0;
+    }
+    else
+    {
+        mSpringBoundingVolumeHierarchy.Refit(mSpringBoundingBoxes);
+    }
+
+    mIsSpringBoundingVolumeHierarchyStale = false;
+}
+
 /////////////////////////////////////////////////////////////////////////
 // IShipPhysicsHandler
 /////////////////////////////////////////////////////////////////////////
@@ -2599,6 +3210,9 @@ void Ship::HandleSpringDestroy(
 
     // Update count of broken springs
     ++mBrokenSpringsCount;
+
+    // The spring hierarchy skips broken springs, but it degrades as the pieces drift apart
+    ++mSpringStructuralChangesSinceBoundingVolumeHierarchyBuild;
 }
 
 void Ship::HandleSpringRestore(
@@ -2669,6 +3283,10 @@ void Ship::HandleSpringRestore(
     assert(mBrokenSpringsCount > 0);
     --mBrokenSpringsCount;
 
+    // The spring hierarchy needs the box of this spring now
+    mIsSpringBoundingVolumeHierarchyStale = true;
+    ++mSpringStructuralChangesSinceBoundingVolumeHierarchyBuild;
+
     // Notify if we've just completely restored the ship
     if (mDamagedPointsCount == 0 && mBrokenSpringsCount == 0 && mBrokenTrianglesCount == 0)
     {
@@ -2835,8 +3453,8 @@ void Ship::DoAntiMatterBombPreimplosion(
         130000.0f // Magic number
         * (gameParameters.IsUltraViolentMode ? 5.0f : 1.0f);
 
-    // Apply the force field
-    ApplyRadialSpaceWarpForceField(
+    // Queue the force field
+    QueueRadialSpaceWarpForceField(
         centerPosition,
         radius,
         10.0f, // Thickness of radius, magic number
@@ -2854,8 +3472,8 @@ void Ship::DoAntiMatterBombImplosion(
         * 10000.0f
         * (gameParameters.IsUltraViolentMode ? 50.0f : 1.0f);
 
-    // Apply the force field
-    ApplyImplosionForceField(
+    // Queue the force field
+    QueueImplosionForceField(
         centerPosition,
         strength);
 }
@@ -2875,8 +3493,8 @@ void Ship::DoAntiMatterBombExplosion(
             30000.0f
             * (gameParameters.IsUltraViolentMode ? 50.0f : 1.0f);
 
-        // Apply the force field
-        ApplyRadialExplosionForceField(
+        // Queue the force field
+        QueueRadialExplosionForceField(
             centerPosition,
             strength);
     }
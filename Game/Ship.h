@@ -8,15 +8,20 @@
 #include "GameEventDispatcher.h"
 #include "GameParameters.h"
 #include "MaterialDatabase.h"
+#include "PerfStats.h"
 #include "Physics.h"
 #include "RenderContext.h"
 #include "ShipDefinition.h"
 
+#include <GameCore/AABB.h>
+#include <GameCore/BoundingVolumeHierarchy.h>
+#include <GameCore/BufferArena.h>
 #include <GameCore/GameTypes.h>
 #include <GameCore/RunningAverage.h>
 #include <GameCore/TaskThreadPool.h>
 #include <GameCore/Vectors.h>
 
+#include <chrono>
 #include <list>
 #include <memory>
 #include <optional>
@@ -35,6 +40,7 @@ public:
         MaterialDatabase const & materialDatabase,
         std::shared_ptr<GameEventDispatcher> gameEventDispatcher,
         std::shared_ptr<TaskThreadPool> taskThreadPool,
+        std::unique_ptr<BufferArena> bufferArena,
         Points && points,
         Springs && springs,
         Triangles && triangles,
@@ -54,18 +60,53 @@ public:
     inline auto const & GetPoints() const { return mPoints; }
     inline auto & GetPoints() { return mPoints; }
 
+    inline BufferArena const & GetBufferArena() const { return *mBufferArena; }
+
     bool IsUnderwater(ElementIndex pointElementIndex) const;
 
+    void AccumulateSimulationStatistics(SimulationStatistics & simulationStatistics) const;
+
     void Update(
         float currentSimulationTime,
 		Storm::Parameters const & stormParameters,
         GameParameters const & gameParameters,
-        Render::RenderContext const & renderContext);
+        VectorFieldRenderModeType vectorFieldRenderMode);
+
+    // Publishes the current state for rendering, when it has changed
+    // outside of simulation updates
+    void PublishRenderSnapshots();
 
+    // Uploads everything but point positions
     void RenderUpload(
         GameParameters const & gameParameters,
         Render::RenderContext & renderContext);
 
+    // Uploads point positions from the published snapshots; may run
+    // concurrently with Update()
+    void RenderUploadPointPositions(
+        bool doInterpolate,
+        std::chrono::steady_clock::time_point now,
+        Render::RenderContext & renderContext) const;
+
+    /*
+     * Bins the volume of water displaced by the ship into the samples of the ocean surface,
+     * and calculates how much it has changed since the previous invocation.
+     *
+     * Only touches state owned by this ship, hence it may run concurrently for different ships.
+     */
+    void UpdateOceanSurfaceDisplacement();
+
+    /*
+     * Forgets the displacement calculated so far, so that the next update does not
+     * see any change.
+     */
+    void ResetOceanSurfaceDisplacement();
+
+    /*
+     * Displaces the ocean surface by the last change of the volume of water displaced by the ship.
+     */
+    void ApplyOceanSurfaceDisplacement(OceanSurface & oceanSurface) const;
+
 public:
 
     void Finalize();
@@ -240,11 +281,16 @@ private:
 
     void ApplySpringsForces_ByPoints(GameParameters const & gameParameters);
 
+    // Optionally stores the springs' lengths, for the strain update
+    template<bool DoStoreLengths>
     void ApplySpringsForces_BySprings(GameParameters const & gameParameters);
 
     void IntegrateAndResetSpringForces(GameParameters const & gameParameters);
 
-    void HandleCollisionsWithSeaFloor(GameParameters const & gameParameters);
+    // Handles collisions with the sea floor and, optionally, trims for world bounds,
+    // in a single pass over the points
+    template<bool DoTrimForWorldBounds>
+    void ApplyPostIntegrationConstraints(GameParameters const & gameParameters);
 
     void TrimForWorldBounds(GameParameters const & gameParameters);
 
@@ -292,36 +338,129 @@ private:
     // Force Fields
     /////////////////////////////////////////////////////////////////////////
 
-    void ApplyDrawForceField(
+    //
+    // Force fields are queued as they are requested, and applied all together
+    // at the next update, in a single pass over blocks of points; fields with
+    // a limited radius skip the blocks that lie outside of their radius.
+    //
+
+    enum class ForceFieldType
+    {
+        Draw,
+        Swirl,
+        Blast,
+        RadialSpaceWarp,
+        Implosion,
+        RadialExplosion
+    };
+
+    struct ForceField
+    {
+        ForceFieldType Type;
+        vec2f CenterPosition;
+        float Strength;
+        float Radius; // Blast and RadialSpaceWarp only
+        float RadiusThickness; // RadialSpaceWarp only
+        float BlastHeat; // Blast only; J
+        bool DoDetachPoint; // Blast only
+
+        ForceField(
+            ForceFieldType type,
+            vec2f const & centerPosition,
+            float strength,
+            float radius = 0.0f,
+            float radiusThickness = 0.0f,
+            float blastHeat = 0.0f,
+            bool doDetachPoint = false)
+            : Type(type)
+            , CenterPosition(centerPosition)
+            , Strength(strength)
+            , Radius(radius)
+            , RadiusThickness(radiusThickness)
+            , BlastHeat(blastHeat)
+            , DoDetachPoint(doDetachPoint)
+        {}
+    };
+
+    void QueueDrawForceField(
         vec2f const & centerPosition,
         float strength);
 
-    void ApplySwirlForceField(
+    void QueueSwirlForceField(
         vec2f const & centerPosition,
         float strength);
 
-    void ApplyBlastForceField(
+    void QueueBlastForceField(
         vec2f const & centerPosition,
         float blastRadius,
         float strength,
-        bool doDetachPoint,
-        float currentSimulationTime,
-        GameParameters const & gameParameters);
+        float blastHeat,
+        bool doDetachPoint);
 
-    void ApplyRadialSpaceWarpForceField(
+    void QueueRadialSpaceWarpForceField(
         vec2f const & centerPosition,
         float radius,
         float radiusThickness,
         float strength);
 
-    void ApplyImplosionForceField(
+    void QueueImplosionForceField(
         vec2f const & centerPosition,
         float strength);
 
-    void ApplyRadialExplosionForceField(
+    void QueueRadialExplosionForceField(
         vec2f const & centerPosition,
         float strength);
 
+    void ApplyQueuedForceFields(
+        float currentSimulationTime,
+        GameParameters const & gameParameters);
+
+    // The following apply a force field to the points in [startPointIndex, endPointIndex)
+
+    inline void ApplyDrawForceField(
+        vec2f const & centerPosition,
+        float strength,
+        ElementIndex startPointIndex,
+        ElementIndex endPointIndex);
+
+    inline void ApplySwirlForceField(
+        vec2f const & centerPosition,
+        float strength,
+        ElementIndex startPointIndex,
+        ElementIndex endPointIndex);
+
+    inline void ApplyBlastForceField(
+        vec2f const & centerPosition,
+        float blastRadius,
+        float strength,
+        float blastHeat,
+        ElementIndex startPointIndex,
+        ElementIndex endPointIndex,
+        float & closestPointSquareDistance,
+        ElementIndex & closestPointIndex);
+
+    inline void ApplyRadialSpaceWarpForceField(
+        vec2f const & centerPosition,
+        float radius,
+        float radiusThickness,
+        float strength,
+        ElementIndex startPointIndex,
+        ElementIndex endPointIndex);
+
+    inline void ApplyImplosionForceField(
+        vec2f const & centerPosition,
+        float strength,
+        ElementIndex startPointIndex,
+        ElementIndex endPointIndex);
+
+    inline void ApplyRadialExplosionForceField(
+        vec2f const & centerPosition,
+        float strength,
+        ElementIndex startPointIndex,
+        ElementIndex endPointIndex);
+
+    std::vector<ForceField> mQueuedForceFields;
+
 private:
 
     void RunConnectivityVisit();
@@ -362,6 +501,9 @@ private:
 		float currentSimulationTime,
 		GameParameters const & gameParameters);
 
+    // Brings the spring hierarchy up-to-date with the current positions of the springs
+    void UpdateSpringBoundingVolumeHierarchy() const;
+
     inline size_t GetPointConnectedComponentSize(ElementIndex pointIndex) const noexcept
     {
         auto const connCompId = mPoints.GetConnectedComponentId(pointIndex);
@@ -493,6 +635,9 @@ private:
     // The (initial) world size of  the ship
     vec2f const mSize;
 
+    // The memory of all the element buffers; must outlive the elements
+    std::unique_ptr<BufferArena> mBufferArena;
+
     // All the ship elements - never removed, the repositories maintain their own size forever
     Points mPoints;
     Springs mSprings;
@@ -543,6 +688,46 @@ private:
     // already ran once with zero (so to zero out buffer)
     float mLastLuminiscenceAdjustmentDiffused;
 
+    // State of the incremental light diffusion: the lamps and the ship points as of
+    // the last time they have been diffused, and a spatial index of the areas that
+    // each lamp may light. Tiles of points that have not moved, and whose lamps have
+    // not changed, since they were last diffused keep their light
+    bool mIsLightDiffusionStateValid;
+    std::vector<vec2f> mLastDiffusedLampPositions;
+    std::vector<float> mLastDiffusedLampDistanceCoeffs;
+    std::vector<float> mLastDiffusedLampSpreadMaxDistances;
+    std::vector<PlaneId> mLastDiffusedLampPlaneIds;
+    std::vector<bool> mIsLampChangedSinceLastDiffusion;
+    std::vector<Geometry::AABB> mLampLightAreas;
+    Geometry::BoundingVolumeHierarchy mLampLightAreaBoundingVolumeHierarchy;
+    std::vector<vec2f> mLastDiffusedPointPositions;
+    std::vector<PlaneId> mLastDiffusedPointPlaneIds;
+
+    // Spatial index of the springs, for the queries of the interactions; refitted
+    // lazily at the first query after the springs have moved, and rebuilt after
+    // enough springs have been broken or restored since it was last built.
+    // Broken springs are skipped by the queries, so they do not require a refit
+    Geometry::BoundingVolumeHierarchy mutable mSpringBoundingVolumeHierarchy;
+    std::vector<Geometry::AABB> mutable mSpringBoundingBoxes;
+    bool mutable mIsSpringBoundingVolumeHierarchyStale;
+    ElementCount mutable mSpringStructuralChangesSinceBoundingVolumeHierarchyBuild;
+
+    // Coupling with the ocean surface: the volume of water displaced by the ship at each
+    // ocean surface sample, and its change since the previous update, together with the
+    // ranges of samples they span; the volumes are zero outside of their range.
+    // Allocated lazily, as the coupling might never be enabled
+    std::unique_ptr<float[]> mOceanSurfaceDisplacedVolumes;
+    std::unique_ptr<float[]> mOceanSurfaceDisplacedVolumeDeltas;
+    size_t mOceanSurfaceDisplacedVolumesFirstSample;
+    size_t mOceanSurfaceDisplacedVolumesEndSample;
+    size_t mOceanSurfaceDisplacedVolumeDeltasFirstSample;
+    size_t mOceanSurfaceDisplacedVolumeDeltasEndSample;
+    bool mHasOceanSurfaceDisplacedVolumes; // False until the first update after a reset
+
+    // The bounding box of each block of contiguous points, as of the last integration;
+    // used to skip the collision test with the ocean floor for blocks far above it
+    std::vector<Geometry::AABB> mPointBlockBoundingBoxes;
+
     //
     // Render members
     //
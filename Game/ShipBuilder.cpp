@@ -9,9 +9,11 @@
 
 #include <GameCore/ImageTools.h>
 #include <GameCore/Log.h>
+#include <GameCore/SpaceFillingCurves.h>
 
 #include <algorithm>
 #include <cassert>
+#include <exception>
 #include <limits>
 #include <map>
 #include <sstream>
@@ -62,71 +64,178 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData> ShipBuilder::Create(
         pointIndexMatrix[c] = std::unique_ptr<std::optional<ElementIndex>[]>(new std::optional<ElementIndex>[structureHeight + 2]);
     }
 
-    // Visit all columns
-    for (int x = 0; x < structureWidth; ++x)
+    // Visit all columns, in bands of adjacent columns processed in parallel;
+    // each band creates its own points, which we then concatenate in band order
+    // so to obtain the same order we'd obtain by visiting all columns serially
+
+    struct RopeEndpoint
     {
-        // From bottom to top
-        for (int y = 0; y < structureHeight; ++y)
-        {
-            MaterialDatabase::ColorKey const colorKey = shipDefinition.StructuralLayerImage.Data[x + y * structureWidth];
-            StructuralMaterial const * structuralMaterial = materialDatabase.FindStructuralMaterial(colorKey);
-            if (nullptr != structuralMaterial)
+        MaterialDatabase::ColorKey ColorKey;
+        ElementIndex BandPointIndex;
+        IntegralPoint Coordinates;
+
+        RopeEndpoint(
+            MaterialDatabase::ColorKey const & colorKey,
+            ElementIndex bandPointIndex,
+            IntegralPoint const & coordinates)
+            : ColorKey(colorKey)
+            , BandPointIndex(bandPointIndex)
+            , Coordinates(coordinates)
+        {}
+    };
+
+    struct PointBand
+    {
+        std::vector<ShipBuildPoint> PointInfos;
+        std::vector<RopeEndpoint> RopeEndpoints;
+        ElementIndex FirstPointIndex;
+    };
+
+    auto const columnBands = MakeBands(structureWidth, *taskThreadPool);
+    std::vector<PointBand> pointBands(columnBands.size());
+
+    std::vector<TaskThreadPool::Task> tasks;
+    for (size_t b = 0; b < columnBands.size(); ++b)
+    {
+        tasks.emplace_back(
+            [&, b]()
             {
-                float water = 0.0f;
+                PointBand & band = pointBands[b];
 
-                //
-                // Transform water point to air point+water
-                //
+                // Runs of identical colors are common, hence we remember the last lookup
+                MaterialDatabase::ColorKey lastColorKey = { 0xff, 0xff, 0xff };
+                StructuralMaterial const * lastStructuralMaterial = materialDatabase.FindStructuralMaterial(lastColorKey);
 
-                if (structuralMaterial->IsUniqueType(StructuralMaterial::MaterialUniqueType::Water))
+                for (int x = columnBands[b].first; x < columnBands[b].second; ++x)
                 {
-                    structuralMaterial = &materialDatabase.GetUniqueStructuralMaterial(StructuralMaterial::MaterialUniqueType::Air);
-                    water = 1.0f;
-                }
+                    // From bottom to top
+                    for (int y = 0; y < structureHeight; ++y)
+                    {
+                        MaterialDatabase::ColorKey const colorKey = shipDefinition.StructuralLayerImage.Data[x + y * structureWidth];
+                        if (colorKey != lastColorKey)
+                        {
+                            lastColorKey = colorKey;
+                            lastStructuralMaterial = materialDatabase.FindStructuralMaterial(colorKey);
+                        }
 
-                //
-                // Make a point
-                //
+                        StructuralMaterial const * structuralMaterial = lastStructuralMaterial;
+                        if (nullptr != structuralMaterial)
+                        {
+                            float water = 0.0f;
 
-                ElementIndex const pointIndex = static_cast<ElementIndex>(pointInfos.size());
+                            //
+                            // Transform water point to air point+water
+                            //
 
-                pointIndexMatrix[x + 1][y + 1] = static_cast<ElementIndex>(pointIndex);
+                            if (structuralMaterial->IsUniqueType(StructuralMaterial::MaterialUniqueType::Water))
+                            {
+                                structuralMaterial = &materialDatabase.GetUniqueStructuralMaterial(StructuralMaterial::MaterialUniqueType::Air);
+                                water = 1.0f;
+                            }
 
-                pointInfos.emplace_back(
-                    IntegralPoint::FromFlippedY(x, y, structureHeight),
-                    vec2f(
-                        static_cast<float>(x) - halfWidth,
-                        static_cast<float>(y)) + shipDefinition.Metadata.Offset,
-                    MakeTextureCoordinates(x, y, shipDefinition.StructuralLayerImage.Size),
-                    structuralMaterial->RenderColor,
-                    *structuralMaterial,
-                    structuralMaterial->IsUniqueType(StructuralMaterial::MaterialUniqueType::Rope),
-                    water);
+                            //
+                            // Make a point
+                            //
 
-                //
-                // Check if it's a (custom) rope endpoint
-                //
+                            // Index is relative to band, for now
+                            ElementIndex const bandPointIndex = static_cast<ElementIndex>(band.PointInfos.size());
 
-                if (structuralMaterial->IsUniqueType(StructuralMaterial::MaterialUniqueType::Rope)
-                    && !materialDatabase.IsUniqueStructuralMaterialColorKey(StructuralMaterial::MaterialUniqueType::Rope, colorKey))
-                {
-                    // Store in RopeSegments, using the color key as the color of the rope
-                    RopeSegment & ropeSegment = ropeSegments[colorKey];
-                    if (!ropeSegment.SetEndpoint(pointIndex, colorKey))
-                    {
-                        throw GameException(
-                            "More than two \"" + Utils::RgbColor2Hex(colorKey) + "\" rope endpoints found at "
-                            + IntegralPoint::FromFlippedY(x, y, structureHeight).ToString());
+                            pointIndexMatrix[x + 1][y + 1] = bandPointIndex;
+
+                            band.PointInfos.emplace_back(
+                                IntegralPoint::FromFlippedY(x, y, structureHeight),
+                                vec2f(
+                                    static_cast<float>(x) - halfWidth,
+                                    static_cast<float>(y)) + shipDefinition.Metadata.Offset,
+                                MakeTextureCoordinates(x, y, shipDefinition.StructuralLayerImage.Size),
+                                structuralMaterial->RenderColor,
+                                *structuralMaterial,
+                                structuralMaterial->IsUniqueType(StructuralMaterial::MaterialUniqueType::Rope),
+                                water);
+
+                            //
+                            // Check if it's a (custom) rope endpoint
+                            //
+
+                            if (structuralMaterial->IsUniqueType(StructuralMaterial::MaterialUniqueType::Rope)
+                                && !materialDatabase.IsUniqueStructuralMaterialColorKey(StructuralMaterial::MaterialUniqueType::Rope, colorKey))
+                            {
+                                // Remember it, we'll process it later
+                                band.RopeEndpoints.emplace_back(
+                                    colorKey,
+                                    bandPointIndex,
+                                    IntegralPoint::FromFlippedY(x, y, structureHeight));
+                            }
+                        }
+                        else
+                        {
+                            // Just ignore this pixel
+                        }
                     }
                 }
-            }
-            else
+            });
+    }
+
+    RunAndClear(tasks, *taskThreadPool);
+
+    // Concatenate bands' points and process rope endpoints, in band order
+
+    size_t totalPointCount = 0;
+    for (auto const & band : pointBands)
+    {
+        totalPointCount += band.PointInfos.size();
+    }
+
+    pointInfos.reserve(totalPointCount);
+
+    for (auto & band : pointBands)
+    {
+        band.FirstPointIndex = static_cast<ElementIndex>(pointInfos.size());
+
+        for (auto & pointInfo : band.PointInfos)
+        {
+            pointInfos.emplace_back(std::move(pointInfo));
+        }
+
+        for (auto const & ropeEndpoint : band.RopeEndpoints)
+        {
+            // Store in RopeSegments, using the color key as the color of the rope
+            RopeSegment & ropeSegment = ropeSegments[ropeEndpoint.ColorKey];
+            if (!ropeSegment.SetEndpoint(band.FirstPointIndex + ropeEndpoint.BandPointIndex, ropeEndpoint.ColorKey))
             {
-                // Just ignore this pixel
+                throw GameException(
+                    "More than two \"" + Utils::RgbColor2Hex(ropeEndpoint.ColorKey) + "\" rope endpoints found at "
+                    + ropeEndpoint.Coordinates.ToString());
             }
         }
     }
 
+    // Make point matrix indices absolute
+
+    for (size_t b = 0; b < columnBands.size(); ++b)
+    {
+        tasks.emplace_back(
+            [&, b]()
+            {
+                ElementIndex const firstPointIndex = pointBands[b].FirstPointIndex;
+
+                for (int x = columnBands[b].first; x < columnBands[b].second; ++x)
+                {
+                    for (int y = 0; y < structureHeight; ++y)
+                    {
+                        if (pointIndexMatrix[x + 1][y + 1].has_value())
+                        {
+                            *(pointIndexMatrix[x + 1][y + 1]) += firstPointIndex;
+                        }
+                    }
+                }
+            });
+    }
+
+    RunAndClear(tasks, *taskThreadPool);
+
+    pointBands.clear();
+
     if (pointInfos.empty())
     {
         throw GameException("The ship structure contains no pixels that may be recognized as structural material");
@@ -172,7 +281,8 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData> ShipBuilder::Create(
             pointInfos,
             true, // isDedicatedElectricalLayer
             pointIndexMatrix,
-            materialDatabase);
+            materialDatabase,
+            *taskThreadPool);
     }
     else
     {
@@ -182,7 +292,8 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData> ShipBuilder::Create(
             pointInfos,
             false, // isDedicatedElectricalLayer
             pointIndexMatrix,
-            materialDatabase);
+            materialDatabase,
+            *taskThreadPool);
     }
 
     //
@@ -214,26 +325,82 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData> ShipBuilder::Create(
         pointInfos,
         springInfos,
         triangleInfos,
-        leakingPointsCount);
+        leakingPointsCount,
+        *taskThreadPool);
 
 
     //
     // Optimize order of ShipBuildPoint's and ShipBuildSpring's to minimize cache misses
     //
 
-    float originalSpringACMR = CalculateACMR(springInfos);
+    // Note: we calculate the ACMR and the cache misses of the original order while we reorder
 
-    // Tiling algorithm
-    //auto [pointInfos2, pointIndexRemap2, springInfos2] = ReorderPointsAndSpringsOptimally_Tiling<2>(
-    auto [pointInfos2, pointIndexRemap2, springInfos2] = ReorderPointsAndSpringsOptimally_Stripes<4>(
-        pointInfos,
-        springInfos,
-        pointIndexMatrix,
-        shipDefinition.StructuralLayerImage.Size);
+    ShipPointsReorderingModeType const pointsReorderingMode = shipDefinition.PointsReorderingMode.value_or(DefaultPointsReorderingMode);
 
-    float optimizedSpringACMR = CalculateACMR(springInfos2);
+    float originalSpringACMR;
+    std::tuple<float, float> originalSpringMissRatios;
+    ReorderingResults reorderingResults;
 
-    LogMessage("Spring ACMR: original=", originalSpringACMR, ", optimized=", optimizedSpringACMR);
+    tasks.emplace_back(
+        [&]()
+        {
+            switch (pointsReorderingMode)
+            {
+                case ShipPointsReorderingModeType::Stripes:
+                {
+                    // Tiling algorithm
+                    //reorderingResults = ReorderPointsAndSpringsOptimally_Tiling<2>(
+                    reorderingResults = ReorderPointsAndSpringsOptimally_Stripes<4>(
+                        pointInfos,
+                        springInfos,
+                        pointIndexMatrix,
+                        shipDefinition.StructuralLayerImage.Size);
+
+                    break;
+                }
+
+                case ShipPointsReorderingModeType::MortonCurve:
+                case ShipPointsReorderingModeType::HilbertCurve:
+                {
+                    reorderingResults = ReorderPointsAndSpringsOptimally_SpaceFillingCurve(
+                        pointInfos,
+                        springInfos,
+                        pointsReorderingMode);
+
+                    break;
+                }
+            }
+        });
+
+    tasks.emplace_back(
+        [&]()
+        {
+            originalSpringACMR = CalculateACMR(springInfos);
+
+            std::vector<ElementIndex> identityRemap(pointInfos.size());
+            for (ElementIndex p = 0; p < identityRemap.size(); ++p)
+            {
+                identityRemap[p] = p;
+            }
+
+            originalSpringMissRatios = CalculateSpringGatherMissRatios(springInfos, identityRemap);
+        });
+
+    RunAndClear(tasks, *taskThreadPool);
+
+    std::vector<ShipBuildPoint> const & pointInfos2 = std::get<0>(reorderingResults);
+    std::vector<ElementIndex> const & pointIndexRemap2 = std::get<1>(reorderingResults);
+    std::vector<ShipBuildSpring> & springInfos2 = std::get<2>(reorderingResults);
+
+
+    //
+    // Create the arena for all of the ship's element buffers, sized up-front;
+    // triangles are filtered later, hence their count here is an upper bound
+    //
+
+    auto bufferArena = std::make_unique<BufferArena>(
+        CalculateBufferArenaByteSize(pointInfos2, springInfos2.size(), triangleInfos.size()),
+        DoUseHugePagesForBufferArena);
 
 
     //
@@ -260,14 +427,44 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData> ShipBuilder::Create(
     // Visit all ShipBuildPoint's and create Points, i.e. the entire set of points
     //
 
+    // Note: we calculate the ACMR and the cache misses of the optimized order while we create points;
+    // points are created on the main thread, as they use the random engine
+
     std::vector<ElectricalElementInstanceIndex> electricalElementInstanceIndices;
-    Physics::Points points = CreatePoints(
-        pointInfos2,
-        parentWorld,
-        materialDatabase,
-        gameEventDispatcher,
-        gameParameters,
-        electricalElementInstanceIndices);
+    std::optional<Physics::Points> createdPoints;
+    float optimizedSpringACMR;
+    std::tuple<float, float> optimizedSpringMissRatios;
+
+    tasks.emplace_back(
+        [&]()
+        {
+            createdPoints.emplace(
+                CreatePoints(
+                    pointInfos2,
+                    parentWorld,
+                    materialDatabase,
+                    gameEventDispatcher,
+                    gameParameters,
+                    *bufferArena,
+                    electricalElementInstanceIndices));
+        });
+
+    tasks.emplace_back(
+        [&]()
+        {
+            optimizedSpringACMR = CalculateACMR(springInfos2);
+            optimizedSpringMissRatios = CalculateSpringGatherMissRatios(springInfos2, pointIndexRemap2);
+        });
+
+    RunAndClear(tasks, *taskThreadPool);
+
+    LogMessage("Spring ACMR: original=", originalSpringACMR, ", optimized=", optimizedSpringACMR);
+    LogMessage("Spring gather misses (", ToString(pointsReorderingMode), "): original L1=", std::get<0>(originalSpringMissRatios),
+        " L2=", std::get<1>(originalSpringMissRatios), ", optimized L1=", std::get<0>(optimizedSpringMissRatios),
+        " L2=", std::get<1>(optimizedSpringMissRatios));
+
+    assert(createdPoints.has_value());
+    Physics::Points points = std::move(*createdPoints);
 
 
     //
@@ -278,7 +475,8 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData> ShipBuilder::Create(
         triangleInfos,
         points,
         pointIndexRemap2,
-        springInfos2);
+        springInfos2,
+        *taskThreadPool);
 
 
     //
@@ -300,7 +498,8 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData> ShipBuilder::Create(
         pointIndexRemap2,
         parentWorld,
         gameEventDispatcher,
-        gameParameters);
+        gameParameters,
+        *bufferArena);
 
 
     //
@@ -310,7 +509,8 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData> ShipBuilder::Create(
     Triangles triangles = CreateTriangles(
         triangleInfos2,
         points,
-        pointIndexRemap2);
+        pointIndexRemap2,
+        *bufferArena);
 
 
     //
@@ -325,7 +525,8 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData> ShipBuilder::Create(
         shipId,
         parentWorld,
         gameEventDispatcher,
-        gameParameters);
+        gameParameters,
+        *bufferArena);
 
     //
     // Create texture, if needed
@@ -337,7 +538,8 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData> ShipBuilder::Create(
             shipDefinition.AutoTexturizationSettings,
             shipDefinition.StructuralLayerImage.Size,
             pointIndexMatrix,
-            pointInfos); // Auto-texturize
+            pointInfos,
+            *taskThreadPool); // Auto-texturize
 
     //
     // We're done!
@@ -348,12 +550,20 @@ std::tuple<std::unique_ptr<Physics::Ship>, RgbaImageData> ShipBuilder::Create(
         springs.GetElementCount(), " springs, ", triangles.GetElementCount(), " triangles, ",
         electricalElements.GetElementCount(), " electrical elements.");
 
+    LogMessage("Ship buffer arena: ", bufferArena->GetAllocatedByteSize(), "/", bufferArena->GetCapacityByteSize(), " bytes in ",
+        bufferArena->GetBlockCount(), " block(s)", bufferArena->IsHugePageBacked() ? ", huge pages" : "");
+
+    // Verify that the arena was sized for all the buffers that were actually allocated
+    assert(bufferArena->GetAllocatedByteSize() == CalculateBufferArenaByteSize(pointInfos2, springs.GetElementCount(), triangles.GetElementCount()));
+    assert(bufferArena->GetBlockCount() == 1);
+
     auto ship = std::make_unique<Ship>(
         shipId,
         parentWorld,
         materialDatabase,
         std::move(gameEventDispatcher),
         std::move(taskThreadPool),
+        std::move(bufferArena),
         std::move(points),
         std::move(springs),
         std::move(triangles),
@@ -451,76 +661,101 @@ void ShipBuilder::DecoratePointsWithElectricalMaterials(
     std::vector<ShipBuildPoint> & pointInfos1,
     bool isDedicatedElectricalLayer,
     ShipBuildPointIndexMatrix const & pointIndexMatrix,
-    MaterialDatabase const & materialDatabase)
+    MaterialDatabase const & materialDatabase,
+    TaskThreadPool & taskThreadPool)
 {
     int const width = layerImage.Size.Width;
     int const height = layerImage.Size.Height;
 
     constexpr MaterialDatabase::ColorKey BackgroundColorKey = { 0xff, 0xff, 0xff };
 
-    for (int x = 0; x < width; ++x)
-    {
-        // From bottom to top
-        for (int y = 0; y < height; ++y)
-        {
-            // Get color
-            MaterialDatabase::ColorKey const & colorKey = layerImage.Data[x + y * width];
+    // Visit all columns, in bands of adjacent columns processed in parallel;
+    // each pixel decorates its own point, hence bands never touch the same points
 
-            // Check if it's an electrical material
-            ElectricalMaterial const * const electricalMaterial = materialDatabase.FindElectricalMaterial(colorKey);
-            if (nullptr == electricalMaterial)
-            {
-                //
-                // Not an electrical material
-                //
+    auto const columnBands = MakeBands(width, taskThreadPool);
 
-                if (isDedicatedElectricalLayer
-                    && colorKey != BackgroundColorKey)
-                {
-                    throw GameException(
-                        "Cannot find electrical material for color key \"" + Utils::RgbColor2Hex(colorKey)
-                        + "\" of pixel found at " + IntegralPoint::FromFlippedY(x, y, height).ToString()
-                        + " in the " + (isDedicatedElectricalLayer ? "electrical" : "structural")
-                        + " layer image");
-                }
-                else
-                {
-                    // Just ignore
-                }
-            }
-            else
+    std::vector<TaskThreadPool::Task> tasks;
+    for (auto const & columnBand : columnBands)
+    {
+        tasks.emplace_back(
+            [&, startX = columnBand.first, endX = columnBand.second]()
             {
-                //
-                // Electrical material found on this particle
-                //
+                // Runs of identical colors are common, hence we remember the last lookup
+                MaterialDatabase::ColorKey lastColorKey = BackgroundColorKey;
+                ElectricalMaterial const * lastElectricalMaterial = materialDatabase.FindElectricalMaterial(lastColorKey);
 
-                // Make sure we have a structural point here
-                if (!pointIndexMatrix[x + 1][y + 1])
+                for (int x = startX; x < endX; ++x)
                 {
-                    throw GameException(
-                        "The electrical layer image specifies an electrical material at "
-                        + IntegralPoint::FromFlippedY(x, y, height).ToString()
-                        + ", but no pixel may be found at those coordinates in the structural layer image");
-                }
+                    // From bottom to top
+                    for (int y = 0; y < height; ++y)
+                    {
+                        // Get color
+                        MaterialDatabase::ColorKey const & colorKey = layerImage.Data[x + y * width];
+                        if (colorKey != lastColorKey)
+                        {
+                            lastColorKey = colorKey;
+                            lastElectricalMaterial = materialDatabase.FindElectricalMaterial(colorKey);
+                        }
 
-                // Store electrical material
-                auto const pointIndex = *(pointIndexMatrix[x + 1][y + 1]);
-                assert(nullptr == pointInfos1[pointIndex].ElectricalMtl);
-                pointInfos1[pointIndex].ElectricalMtl = electricalMaterial;
+                        // Check if it's an electrical material
+                        ElectricalMaterial const * const electricalMaterial = lastElectricalMaterial;
+                        if (nullptr == electricalMaterial)
+                        {
+                            //
+                            // Not an electrical material
+                            //
 
-                // Store instance index, if material requires one
-                if (electricalMaterial->IsInstanced)
-                {
-                    pointInfos1[pointIndex].ElectricalElementInstanceIndex = MaterialDatabase::GetElectricalElementInstanceIndex(colorKey);
-                }
-                else
-                {
-                    assert(pointInfos1[pointIndex].ElectricalElementInstanceIndex == NoneElectricalElementInstanceIndex);
+                            if (isDedicatedElectricalLayer
+                                && colorKey != BackgroundColorKey)
+                            {
+                                throw GameException(
+                                    "Cannot find electrical material for color key \"" + Utils::RgbColor2Hex(colorKey)
+                                    + "\" of pixel found at " + IntegralPoint::FromFlippedY(x, y, height).ToString()
+                                    + " in the " + (isDedicatedElectricalLayer ? "electrical" : "structural")
+                                    + " layer image");
+                            }
+                            else
+                            {
+                                // Just ignore
+                            }
+                        }
+                        else
+                        {
+                            //
+                            // Electrical material found on this particle
+                            //
+
+                            // Make sure we have a structural point here
+                            if (!pointIndexMatrix[x + 1][y + 1])
+                            {
+                                throw GameException(
+                                    "The electrical layer image specifies an electrical material at "
+                                    + IntegralPoint::FromFlippedY(x, y, height).ToString()
+                                    + ", but no pixel may be found at those coordinates in the structural layer image");
+                            }
+
+                            // Store electrical material
+                            auto const pointIndex = *(pointIndexMatrix[x + 1][y + 1]);
+                            assert(nullptr == pointInfos1[pointIndex].ElectricalMtl);
+                            pointInfos1[pointIndex].ElectricalMtl = electricalMaterial;
+
+                            // Store instance index, if material requires one
+                            if (electricalMaterial->IsInstanced)
+                            {
+                                pointInfos1[pointIndex].ElectricalElementInstanceIndex = MaterialDatabase::GetElectricalElementInstanceIndex(colorKey);
+                            }
+                            else
+                            {
+                                assert(pointInfos1[pointIndex].ElectricalElementInstanceIndex == NoneElectricalElementInstanceIndex);
+                            }
+                        }
+                    }
                 }
-            }
-        }
+            });
     }
 
+    RunAndClear(tasks, taskThreadPool);
+
     //
     // Check for duplicate electrical element instance indices
     //
@@ -757,7 +992,8 @@ void ShipBuilder::CreateShipElementInfos(
     std::vector<ShipBuildPoint> & pointInfos1,
     std::vector<ShipBuildSpring> & springInfos1,
     std::vector<ShipBuildTriangle> & triangleInfos1,
-    size_t & leakingPointsCount)
+    size_t & leakingPointsCount,
+    TaskThreadPool & taskThreadPool)
 {
     //
     // Visit point matrix and:
@@ -765,9 +1001,10 @@ void ShipBuilder::CreateShipElementInfos(
     //  - Detect springs and create ShipBuildSpring's for them (additional to ropes)
     //  - Do tessellation and create ShipBuildTriangle's
     //
-
-    // Initialize count of leaking points
-    leakingPointsCount = 0;
+    // We visit bands of adjacent rows in parallel; each band creates its own springs
+    // and triangles, which we then concatenate in band order so to obtain the same
+    // order we'd obtain by visiting all rows serially
+    //
 
     // This is our local circular order
     static const int Directions[8][2] = {
@@ -781,141 +1018,192 @@ void ShipBuilder::CreateShipElementInfos(
         {  1,  1 }   // 7: NE
     };
 
-    // From bottom to top - excluding extras at boundaries
-    for (int y = 1; y <= structureImageSize.Height; ++y)
+    struct ElementBand
     {
-        // We're starting a new row, so we're not in a ship now
-        bool isInShip = false;
+        std::vector<ShipBuildSpring> SpringInfos;
+        std::vector<ShipBuildTriangle> TriangleInfos;
+        size_t LeakingPointsCount;
+    };
 
-        // From left to right - excluding extras at boundaries
-        for (int x = 1; x <= structureImageSize.Width; ++x)
-        {
-            if (!!pointIndexMatrix[x][y])
+    auto const rowBands = MakeBands(structureImageSize.Height, taskThreadPool);
+    std::vector<ElementBand> elementBands(rowBands.size());
+
+    std::vector<TaskThreadPool::Task> tasks;
+    for (size_t b = 0; b < rowBands.size(); ++b)
+    {
+        tasks.emplace_back(
+            [&, b]()
             {
-                //
-                // A point exists at these coordinates
-                //
+                ElementBand & band = elementBands[b];
 
-                ElementIndex pointIndex = *pointIndexMatrix[x][y];
+                // Initialize count of leaking points
+                band.LeakingPointsCount = 0;
 
-                // If a non-hull node has empty space on one of its four sides, it is leaking.
-                // Check if a is leaking; a is leaking if:
-                // - a is not hull, AND
-                // - there is at least a hole at E, S, W, N
-                if (!pointInfos1[pointIndex].StructuralMtl.IsHull)
+                // From bottom to top - excluding extras at boundaries
+                for (int y = rowBands[b].first + 1; y <= rowBands[b].second; ++y)
                 {
-                    if (!pointIndexMatrix[x + 1][y]
-                        || !pointIndexMatrix[x][y + 1]
-                        || !pointIndexMatrix[x - 1][y]
-                        || !pointIndexMatrix[x][y - 1])
-                    {
-                        pointInfos1[pointIndex].IsLeaking = true;
-                        ++leakingPointsCount;
-                    }
-                }
+                    // We're starting a new row, so we're not in a ship now
+                    bool isInShip = false;
 
+                    // From left to right - excluding extras at boundaries
+                    for (int x = 1; x <= structureImageSize.Width; ++x)
+                    {
+                        if (!!pointIndexMatrix[x][y])
+                        {
+                            //
+                            // A point exists at these coordinates
+                            //
 
-                //
-                // Check if a spring exists
-                //
-
-                // First four directions out of 8: from 0 deg (+x) through to 225 deg (-x -y),
-                // i.e. E, SE, S, SW - this covers each pair of points in each direction
-                for (int i = 0; i < 4; ++i)
-                {
-                    int adjx1 = x + Directions[i][0];
-                    int adjy1 = y + Directions[i][1];
+                            ElementIndex pointIndex = *pointIndexMatrix[x][y];
 
-                    if (!!pointIndexMatrix[adjx1][adjy1])
-                    {
-                        // This point is adjacent to the first point at one of E, SE, S, SW
+                            // If a non-hull node has empty space on one of its four sides, it is leaking.
+                            // Check if a is leaking; a is leaking if:
+                            // - a is not hull, AND
+                            // - there is at least a hole at E, S, W, N
+                            //
+                            // Note: each point is only visited by the band that contains its row
+                            if (!pointInfos1[pointIndex].StructuralMtl.IsHull)
+                            {
+                                if (!pointIndexMatrix[x + 1][y]
+                                    || !pointIndexMatrix[x][y + 1]
+                                    || !pointIndexMatrix[x - 1][y]
+                                    || !pointIndexMatrix[x][y - 1])
+                                {
+                                    pointInfos1[pointIndex].IsLeaking = true;
+                                    ++(band.LeakingPointsCount);
+                                }
+                            }
 
-                        //
-                        // Create ShipBuildSpring
-                        //
 
-                        ElementIndex const otherEndpointIndex = *pointIndexMatrix[adjx1][adjy1];
+                            //
+                            // Check if a spring exists
+                            //
 
-                        ElementIndex const springIndex = static_cast<ElementIndex>(springInfos1.size());
+                            // First four directions out of 8: from 0 deg (+x) through to 225 deg (-x -y),
+                            // i.e. E, SE, S, SW - this covers each pair of points in each direction
+                            for (int i = 0; i < 4; ++i)
+                            {
+                                int adjx1 = x + Directions[i][0];
+                                int adjy1 = y + Directions[i][1];
 
-                        springInfos1.emplace_back(
-                            pointIndex,
-                            i,
-                            otherEndpointIndex,
-                            (i + 4) % 8);
+                                if (!!pointIndexMatrix[adjx1][adjy1])
+                                {
+                                    // This point is adjacent to the first point at one of E, SE, S, SW
 
-                        // Add the spring to its endpoints
-                        pointInfos1[pointIndex].AddConnectedSpring(springIndex);
-                        pointInfos1[otherEndpointIndex].AddConnectedSpring(springIndex);
+                                    //
+                                    // Create ShipBuildSpring
+                                    //
+                                    // Note: we connect springs to their endpoints later, as the other
+                                    // endpoint might belong to a different band
+                                    //
 
+                                    ElementIndex const otherEndpointIndex = *pointIndexMatrix[adjx1][adjy1];
 
-                        //
-                        // Check if a triangle exists
-                        // - If this is the first point that is in a ship, we check all the way up to W;
-                        // - Else, we check up to S, so to avoid covering areas already covered by the triangulation
-                        //   at the previous point
-                        //
+                                    band.SpringInfos.emplace_back(
+                                        pointIndex,
+                                        i,
+                                        otherEndpointIndex,
+                                        (i + 4) % 8);
 
-                        // Check adjacent point in next CW direction
-                        int adjx2 = x + Directions[i + 1][0];
-                        int adjy2 = y + Directions[i + 1][1];
-                        if ((!isInShip || i < 2)
-                            && !!pointIndexMatrix[adjx2][adjy2])
-                        {
-                            // This point is adjacent to the first point at one of SE, S, SW, W
 
-                            //
-                            // Create ShipBuildTriangle
-                            //
+                                    //
+                                    // Check if a triangle exists
+                                    // - If this is the first point that is in a ship, we check all the way up to W;
+                                    // - Else, we check up to S, so to avoid covering areas already covered by the triangulation
+                                    //   at the previous point
+                                    //
 
-                            triangleInfos1.emplace_back(
-                                std::array<ElementIndex, 3>(
+                                    // Check adjacent point in next CW direction
+                                    int adjx2 = x + Directions[i + 1][0];
+                                    int adjy2 = y + Directions[i + 1][1];
+                                    if ((!isInShip || i < 2)
+                                        && !!pointIndexMatrix[adjx2][adjy2])
                                     {
-                                        pointIndex,
-                                        otherEndpointIndex,
-                                        *pointIndexMatrix[adjx2][adjy2]
-                                    }));
-                        }
+                                        // This point is adjacent to the first point at one of SE, S, SW, W
+
+                                        //
+                                        // Create ShipBuildTriangle
+                                        //
+
+                                        band.TriangleInfos.emplace_back(
+                                            std::array<ElementIndex, 3>(
+                                                {
+                                                    pointIndex,
+                                                    otherEndpointIndex,
+                                                    *pointIndexMatrix[adjx2][adjy2]
+                                                }));
+                                    }
+
+                                    // Now, we also want to check whether the single "irregular" triangle from this point exists,
+                                    // i.e. the triangle between this point, the point at its E, and the point at its
+                                    // S, in case there is no point at SE.
+                                    // We do this so that we can forget the entire W side for inner points and yet ensure
+                                    // full coverage of the area
+                                    if (i == 0
+                                        && !pointIndexMatrix[x + Directions[1][0]][y + Directions[1][1]]
+                                        && !!pointIndexMatrix[x + Directions[2][0]][y + Directions[2][1]])
+                                    {
+                                        // If we're here, the point at E exists
+                                        assert(!!pointIndexMatrix[x + Directions[0][0]][y + Directions[0][1]]);
+
+                                        //
+                                        // Create ShipBuildTriangle
+                                        //
+
+                                        band.TriangleInfos.emplace_back(
+                                            std::array<ElementIndex, 3>(
+                                                {
+                                                    pointIndex,
+                                                    *pointIndexMatrix[x + Directions[0][0]][y + Directions[0][1]],
+                                                    *pointIndexMatrix[x + Directions[2][0]][y + Directions[2][1]]
+                                                }));
+                                    }
+                                }
+                            }
 
-                        // Now, we also want to check whether the single "irregular" triangle from this point exists,
-                        // i.e. the triangle between this point, the point at its E, and the point at its
-                        // S, in case there is no point at SE.
-                        // We do this so that we can forget the entire W side for inner points and yet ensure
-                        // full coverage of the area
-                        if (i == 0
-                            && !pointIndexMatrix[x + Directions[1][0]][y + Directions[1][1]]
-                            && !!pointIndexMatrix[x + Directions[2][0]][y + Directions[2][1]])
+                            // Remember now that we're in a ship
+                            isInShip = true;
+                        }
+                        else
                         {
-                            // If we're here, the point at E exists
-                            assert(!!pointIndexMatrix[x + Directions[0][0]][y + Directions[0][1]]);
-
                             //
-                            // Create ShipBuildTriangle
+                            // No point exists at these coordinates
                             //
 
-                            triangleInfos1.emplace_back(
-                                std::array<ElementIndex, 3>(
-                                    {
-                                        pointIndex,
-                                        *pointIndexMatrix[x + Directions[0][0]][y + Directions[0][1]],
-                                        *pointIndexMatrix[x + Directions[2][0]][y + Directions[2][1]]
-                                    }));
+                            // From now on we're not in a ship anymore
+                            isInShip = false;
                         }
                     }
                 }
+            });
+    }
 
-                // Remember now that we're in a ship
-                isInShip = true;
-            }
-            else
-            {
-                //
-                // No point exists at these coordinates
-                //
+    RunAndClear(tasks, taskThreadPool);
 
-                // From now on we're not in a ship anymore
-                isInShip = false;
-            }
+    //
+    // Concatenate bands, in band order, and connect springs to their endpoints
+    //
+
+    leakingPointsCount = 0;
+
+    for (auto & band : elementBands)
+    {
+        leakingPointsCount += band.LeakingPointsCount;
+
+        for (auto & springInfo : band.SpringInfos)
+        {
+            ElementIndex const springIndex = static_cast<ElementIndex>(springInfos1.size());
+
+            // Add the spring to its endpoints
+            pointInfos1[springInfo.PointAIndex1].AddConnectedSpring(springIndex);
+            pointInfos1[springInfo.PointBIndex1].AddConnectedSpring(springIndex);
+
+            springInfos1.emplace_back(std::move(springInfo));
+        }
+
+        for (auto & triangleInfo : band.TriangleInfos)
+        {
+            triangleInfos1.emplace_back(std::move(triangleInfo));
         }
     }
 }
@@ -926,6 +1214,7 @@ Physics::Points ShipBuilder::CreatePoints(
     MaterialDatabase const & materialDatabase,
     std::shared_ptr<GameEventDispatcher> gameEventDispatcher,
     GameParameters const & gameParameters,
+    BufferArena & bufferArena,
     std::vector<ElectricalElementInstanceIndex> & electricalElementInstanceIndices)
 {
     Physics::Points points(
@@ -933,7 +1222,8 @@ Physics::Points ShipBuilder::CreatePoints(
         parentWorld,
         materialDatabase,
         std::move(gameEventDispatcher),
-        gameParameters);
+        gameParameters,
+        bufferArena);
 
     electricalElementInstanceIndices.reserve(pointInfos2.size());
 
@@ -980,10 +1270,12 @@ std::vector<ShipBuilder::ShipBuildTriangle> ShipBuilder::FilterOutRedundantTrian
     std::vector<ShipBuildTriangle> const & triangleInfos,
     Physics::Points const & points,
     std::vector<ElementIndex> const & pointIndexRemap,
-    std::vector<ShipBuildSpring> const & springInfos)
+    std::vector<ShipBuildSpring> const & springInfos,
+    TaskThreadPool & taskThreadPool)
 {
     //
-    // First pass: collect indices of those that need to stay
+    // First pass: collect indices of those that need to stay, in parallel
+    // over bands of triangles
     //
     // Remove:
     //  - Those whose vertices are all rope points, of which at least one is connected exclusively
@@ -991,39 +1283,55 @@ std::vector<ShipBuilder::ShipBuildTriangle> ShipBuilder::FilterOutRedundantTrian
     //      - This happens when two or more rope endpoints - from the structural layer - are next to each other
     //
 
-    std::vector<ElementIndex> triangleIndices;
-    triangleIndices.reserve(triangleInfos.size());
+    auto const triangleBands = MakeBands(static_cast<int>(triangleInfos.size()), taskThreadPool);
+    std::vector<std::vector<ElementIndex>> bandTriangleIndices(triangleBands.size());
 
-    for (ElementIndex t = 0; t < triangleInfos.size(); ++t)
+    std::vector<TaskThreadPool::Task> tasks;
+    for (size_t b = 0; b < triangleBands.size(); ++b)
     {
-        if (points.IsRope(pointIndexRemap[triangleInfos[t].PointIndices1[0]])
-            && points.IsRope(pointIndexRemap[triangleInfos[t].PointIndices1[1]])
-            && points.IsRope(pointIndexRemap[triangleInfos[t].PointIndices1[2]]))
-        {
-            // Do not add triangle if at least one vertex is connected to rope points only
-            if (!IsConnectedToNonRopePoints(pointIndexRemap[triangleInfos[t].PointIndices1[0]], points, pointIndexRemap, springInfos)
-                || !IsConnectedToNonRopePoints(pointIndexRemap[triangleInfos[t].PointIndices1[1]], points, pointIndexRemap, springInfos)
-                || !IsConnectedToNonRopePoints(pointIndexRemap[triangleInfos[t].PointIndices1[2]], points, pointIndexRemap, springInfos))
+        tasks.emplace_back(
+            [&, b]()
             {
-                continue;
-            }
-        }
+                std::vector<ElementIndex> & triangleIndices = bandTriangleIndices[b];
+                triangleIndices.reserve(triangleBands[b].second - triangleBands[b].first);
 
-        // Remember to create this triangle
-        triangleIndices.push_back(t);
+                for (ElementIndex t = triangleBands[b].first; t < static_cast<ElementIndex>(triangleBands[b].second); ++t)
+                {
+                    if (points.IsRope(pointIndexRemap[triangleInfos[t].PointIndices1[0]])
+                        && points.IsRope(pointIndexRemap[triangleInfos[t].PointIndices1[1]])
+                        && points.IsRope(pointIndexRemap[triangleInfos[t].PointIndices1[2]]))
+                    {
+                        // Do not add triangle if at least one vertex is connected to rope points only
+                        if (!IsConnectedToNonRopePoints(pointIndexRemap[triangleInfos[t].PointIndices1[0]], points, pointIndexRemap, springInfos)
+                            || !IsConnectedToNonRopePoints(pointIndexRemap[triangleInfos[t].PointIndices1[1]], points, pointIndexRemap, springInfos)
+                            || !IsConnectedToNonRopePoints(pointIndexRemap[triangleInfos[t].PointIndices1[2]], points, pointIndexRemap, springInfos))
+                        {
+                            continue;
+                        }
+                    }
+
+                    // Remember to create this triangle
+                    triangleIndices.push_back(t);
+                }
+            });
     }
 
+    RunAndClear(tasks, taskThreadPool);
+
     //
-    // Second pass: create new list of triangle info's
+    // Second pass: create new list of triangle info's, in band order
     //
 
     std::vector<ShipBuildTriangle> newTriangleInfos;
-    newTriangleInfos.reserve(triangleIndices.size());
+    newTriangleInfos.reserve(triangleInfos.size());
 
-    for (ElementIndex t = 0; t < triangleIndices.size(); ++t)
+    for (auto const & triangleIndices : bandTriangleIndices)
     {
-        newTriangleInfos.push_back(
-            triangleInfos[triangleIndices[t]]);
+        for (ElementIndex t : triangleIndices)
+        {
+            newTriangleInfos.push_back(
+                triangleInfos[t]);
+        }
     }
 
     return newTriangleInfos;
@@ -1166,13 +1474,15 @@ Physics::Springs ShipBuilder::CreateSprings(
     std::vector<ElementIndex> const & pointIndexRemap,
     World & parentWorld,
     std::shared_ptr<GameEventDispatcher> gameEventDispatcher,
-    GameParameters const & gameParameters)
+    GameParameters const & gameParameters,
+    BufferArena & bufferArena)
 {
     Physics::Springs springs(
         static_cast<ElementIndex>(springInfos2.size()),
         parentWorld,
         std::move(gameEventDispatcher),
-        gameParameters);
+        gameParameters,
+        bufferArena);
 
     for (ElementIndex s = 0; s < springInfos2.size(); ++s)
     {
@@ -1202,9 +1512,12 @@ Physics::Springs ShipBuilder::CreateSprings(
 Physics::Triangles ShipBuilder::CreateTriangles(
     std::vector<ShipBuildTriangle> const & triangleInfos2,
     Physics::Points & points,
-    std::vector<ElementIndex> const & pointIndexRemap)
+    std::vector<ElementIndex> const & pointIndexRemap,
+    BufferArena & bufferArena)
 {
-    Physics::Triangles triangles(static_cast<ElementIndex>(triangleInfos2.size()));
+    Physics::Triangles triangles(
+        static_cast<ElementIndex>(triangleInfos2.size()),
+        bufferArena);
 
     for (ElementIndex t = 0; t < triangleInfos2.size(); ++t)
     {
@@ -1232,7 +1545,8 @@ ElectricalElements ShipBuilder::CreateElectricalElements(
     ShipId shipId,
     Physics::World & parentWorld,
     std::shared_ptr<GameEventDispatcher> gameEventDispatcher,
-    GameParameters const & gameParameters)
+    GameParameters const & gameParameters,
+    BufferArena & bufferArena)
 {
     //
     // Verify all panel metadata indices are valid instance IDs
@@ -1311,7 +1625,8 @@ ElectricalElements ShipBuilder::CreateElectricalElements(
         shipId,
         parentWorld,
         gameEventDispatcher,
-        gameParameters);
+        gameParameters,
+        bufferArena);
 
     for (auto const & elementInfo : electricalElementInfos)
     {
@@ -1358,6 +1673,92 @@ ElectricalElements ShipBuilder::CreateElectricalElements(
     return electricalElements;
 }
 
+size_t ShipBuilder::CalculateBufferArenaByteSize(
+    std::vector<ShipBuildPoint> const & pointInfos2,
+    size_t springCount,
+    size_t triangleCount)
+{
+    ElementCount electricalElementCount = 0;
+    ElementCount lampElementCount = 0;
+    for (auto const & pointInfo : pointInfos2)
+    {
+        if (nullptr != pointInfo.ElectricalMtl)
+        {
+            ++electricalElementCount;
+
+            if (ElectricalMaterial::ElectricalElementType::Lamp == pointInfo.ElectricalMtl->ElectricalType)
+                ++lampElementCount;
+        }
+    }
+
+    return Points::CalculateBufferArenaByteSize(static_cast<ElementCount>(pointInfos2.size()))
+        + Springs::CalculateBufferArenaByteSize(static_cast<ElementCount>(springCount))
+        + Triangles::CalculateBufferArenaByteSize(static_cast<ElementCount>(triangleCount))
+        + ElectricalElements::CalculateBufferArenaByteSize(electricalElementCount, lampElementCount);
+}
+
+std::vector<std::pair<int, int>> ShipBuilder::MakeBands(
+    int elementCount,
+    TaskThreadPool const & taskThreadPool)
+{
+    std::vector<std::pair<int, int>> bands;
+
+    int const bandCount = std::min(elementCount, static_cast<int>(taskThreadPool.GetParallelism()));
+    if (bandCount > 0)
+    {
+        int const bandSize = (elementCount + bandCount - 1) / bandCount;
+        for (int start = 0; start < elementCount; start += bandSize)
+        {
+            bands.emplace_back(start, std::min(start + bandSize, elementCount));
+        }
+    }
+
+    return bands;
+}
+
+void ShipBuilder::RunAndClear(
+    std::vector<TaskThreadPool::Task> & tasks,
+    TaskThreadPool & taskThreadPool)
+{
+    //
+    // The thread pool swallows exceptions, hence we catch them ourselves
+    // and re-throw here the one of the earliest task - which is also the one
+    // that we would have thrown had we run all the tasks serially
+    //
+
+    std::vector<std::exception_ptr> taskExceptions(tasks.size());
+
+    std::vector<TaskThreadPool::Task> wrappedTasks;
+    wrappedTasks.reserve(tasks.size());
+    for (size_t t = 0; t < tasks.size(); ++t)
+    {
+        wrappedTasks.emplace_back(
+            [&task = tasks[t], &taskException = taskExceptions[t]]()
+            {
+                try
+                {
+                    task();
+                }
+                catch (...)
+                {
+                    taskException = std::current_exception();
+                }
+            });
+    }
+
+    taskThreadPool.Run(wrappedTasks);
+
+    tasks.clear();
+
+    for (auto const & taskException : taskExceptions)
+    {
+        if (taskException)
+        {
+            std::rethrow_exception(taskException);
+        }
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////
 // Reordering
 //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1877,6 +2278,117 @@ ShipBuilder::ReorderingResults ShipBuilder::ReorderPointsAndSpringsOptimally_Til
     return std::make_tuple(pointInfos2, pointIndexRemap, springInfos2);
 }
 
+ShipBuilder::ReorderingResults ShipBuilder::ReorderPointsAndSpringsOptimally_SpaceFillingCurve(
+    std::vector<ShipBuildPoint> const & pointInfos1,
+    std::vector<ShipBuildSpring> const & springInfos1,
+    ShipPointsReorderingModeType curve)
+{
+    assert(curve == ShipPointsReorderingModeType::MortonCurve || curve == ShipPointsReorderingModeType::HilbertCurve);
+
+    //
+    // 1. Calculate curve keys of all points, using their positions in the
+    //    structure - including rope points, which are positioned along their rope
+    //
+
+    vec2f minPosition(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+    vec2f maxPosition(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest());
+    for (auto const & pointInfo : pointInfos1)
+    {
+        minPosition.x = std::min(minPosition.x, pointInfo.Position.x);
+        minPosition.y = std::min(minPosition.y, pointInfo.Position.y);
+        maxPosition.x = std::max(maxPosition.x, pointInfo.Position.x);
+        maxPosition.y = std::max(maxPosition.y, pointInfo.Position.y);
+    }
+
+    int const hilbertOrder = pointInfos1.empty()
+        ? 0
+        : SpaceFillingCurves::HilbertOrder(
+            static_cast<std::uint32_t>(std::max(maxPosition.x - minPosition.x, maxPosition.y - minPosition.y)) + 1);
+
+    std::vector<std::uint32_t> pointKeys(pointInfos1.size());
+    for (size_t p = 0; p < pointInfos1.size(); ++p)
+    {
+        auto const x = static_cast<std::uint32_t>(pointInfos1[p].Position.x - minPosition.x);
+        auto const y = static_cast<std::uint32_t>(pointInfos1[p].Position.y - minPosition.y);
+
+        pointKeys[p] = (curve == ShipPointsReorderingModeType::MortonCurve)
+            ? SpaceFillingCurves::MortonKey(static_cast<std::uint16_t>(x), static_cast<std::uint16_t>(y))
+            : SpaceFillingCurves::HilbertKey(x, y, hilbertOrder);
+    }
+
+    //
+    // 2. Sort points by key; points with the same key (e.g. rope points) retain their original order
+    //
+
+    std::vector<ElementIndex> sortedPointIndices1(pointInfos1.size());
+    for (ElementIndex p = 0; p < sortedPointIndices1.size(); ++p)
+    {
+        sortedPointIndices1[p] = p;
+    }
+
+    std::stable_sort(
+        sortedPointIndices1.begin(),
+        sortedPointIndices1.end(),
+        [&pointKeys](ElementIndex p1, ElementIndex p2)
+        {
+            return pointKeys[p1] < pointKeys[p2];
+        });
+
+    std::vector<ShipBuildPoint> pointInfos2;
+    pointInfos2.reserve(pointInfos1.size());
+
+    std::vector<ElementIndex> pointIndexRemap(pointInfos1.size(), NoneElementIndex);
+
+    for (ElementIndex pointIndex1 : sortedPointIndices1)
+    {
+        pointIndexRemap[pointIndex1] = static_cast<ElementIndex>(pointInfos2.size());
+        pointInfos2.push_back(pointInfos1[pointIndex1]);
+    }
+
+    //
+    // 3. Sort springs by their lowest new endpoint index, and then by their highest one,
+    //    so that the spring loops visit the point buffers (almost) sequentially
+    //
+
+    std::vector<ElementIndex> sortedSpringIndices1(springInfos1.size());
+    for (ElementIndex s = 0; s < sortedSpringIndices1.size(); ++s)
+    {
+        sortedSpringIndices1[s] = s;
+    }
+
+    auto const makeSpringKey = [&](ElementIndex s)
+    {
+        ElementIndex const pointAIndex2 = pointIndexRemap[springInfos1[s].PointAIndex1];
+        ElementIndex const pointBIndex2 = pointIndexRemap[springInfos1[s].PointBIndex1];
+        return std::make_tuple(std::min(pointAIndex2, pointBIndex2), std::max(pointAIndex2, pointBIndex2));
+    };
+
+    std::stable_sort(
+        sortedSpringIndices1.begin(),
+        sortedSpringIndices1.end(),
+        [&makeSpringKey](ElementIndex s1, ElementIndex s2)
+        {
+            return makeSpringKey(s1) < makeSpringKey(s2);
+        });
+
+    std::vector<ShipBuildSpring> springInfos2;
+    springInfos2.reserve(springInfos1.size());
+
+    for (ElementIndex springIndex1 : sortedSpringIndices1)
+    {
+        springInfos2.push_back(springInfos1[springIndex1]);
+    }
+
+    //
+    // 4. Return results
+    //
+
+    assert(pointInfos2.size() == pointInfos1.size());
+    assert(springInfos2.size() == springInfos1.size());
+
+    return std::make_tuple(pointInfos2, pointIndexRemap, springInfos2);
+}
+
 std::vector<ShipBuilder::ShipBuildSpring> ShipBuilder::ReorderSpringsOptimally_TomForsyth(
     std::vector<ShipBuildSpring> const & springInfos1,
     size_t pointCount)
@@ -2075,6 +2587,66 @@ float ShipBuilder::CalculateACMR(std::vector<ShipBuildSpring> const & springInfo
     return cacheMisses / static_cast<float>(springInfos.size());
 }
 
+std::tuple<float, float> ShipBuilder::CalculateSpringGatherMissRatios(
+    std::vector<ShipBuildSpring> const & springInfos,
+    std::vector<ElementIndex> const & pointIndexRemap)
+{
+    if (springInfos.empty())
+    {
+        return { 0.0f, 0.0f };
+    }
+
+    TestSetAssociativeCache<L1CacheSets, CacheWays> l1Cache;
+    TestSetAssociativeCache<L2CacheSets, CacheWays> l2Cache;
+
+    float l1Misses = 0.0f;
+    float l2Misses = 0.0f;
+
+    auto const usePoint = [&](ElementIndex pointIndex1)
+    {
+        size_t const address = static_cast<size_t>(pointIndexRemap[pointIndex1]) * sizeof(vec2f);
+
+        if (!l1Cache.UseAddress(address))
+        {
+            l1Misses += 1.0f;
+
+            // L2 is only accessed on L1 misses
+            if (!l2Cache.UseAddress(address))
+            {
+                l2Misses += 1.0f;
+            }
+        }
+    };
+
+    for (auto const & springInfo : springInfos)
+    {
+        usePoint(springInfo.PointAIndex1);
+        usePoint(springInfo.PointBIndex1);
+    }
+
+    return {
+        l1Misses / static_cast<float>(springInfos.size()),
+        l2Misses / static_cast<float>(springInfos.size()) };
+}
+
+std::string ShipBuilder::ToString(ShipPointsReorderingModeType mode)
+{
+    switch (mode)
+    {
+        case ShipPointsReorderingModeType::Stripes:
+            return "Stripes";
+
+        case ShipPointsReorderingModeType::MortonCurve:
+            return "Morton";
+
+        case ShipPointsReorderingModeType::HilbertCurve:
+            return "Hilbert";
+    }
+
+    assert(false);
+    return "";
+}
+
 float ShipBuilder::CalculateACMR(std::vector<ShipBuildTriangle> const & triangleInfos)
 {
     //
@@ -2408,4 +2980,42 @@ std::optional<size_t> ShipBuilder::TestLRUVertexCache<Size>::GetCachePosition(si
 
     // Not found
     return std::nullopt;
-}
\ No newline at end of file
+}
+
+template<size_t Sets, size_t Ways>
+ShipBuilder::TestSetAssociativeCache<Sets, Ways>::TestSetAssociativeCache()
+{
+    for (auto & set : mTags)
+    {
+        set.fill(std::numeric_limits<size_t>::max());
+    }
+}
+
+template<size_t Sets, size_t Ways>
+bool ShipBuilder::TestSetAssociativeCache<Sets, Ways>::UseAddress(size_t address)
+{
+    size_t const line = address / CacheLineSize;
+    auto & set = mTags[line % Sets];
+
+    // Find line in set, or else evict least recently used one
+    size_t w = 0;
+    for (; w < Ways - 1; ++w)
+    {
+        if (set[w] == line)
+        {
+            break;
+        }
+    }
+
+    bool const isHit = (set[w] == line);
+
+    // Move to front
+    for (; w > 0; --w)
+    {
+        set[w] = set[w - 1];
+    }
+
+    set[0] = line;
+
+    return isHit;
+}
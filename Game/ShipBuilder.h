@@ -17,11 +17,15 @@
 #include <GameCore/TaskThreadPool.h>
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
 #include <list>
 #include <map>
 #include <memory>
 #include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 /*
@@ -198,7 +202,8 @@ private:
         std::vector<ShipBuildPoint> & pointInfos1,
         bool isDedicatedElectricalLayer,
         ShipBuildPointIndexMatrix const & pointIndexMatrix,
-        MaterialDatabase const & materialDatabase);
+        MaterialDatabase const & materialDatabase,
+        TaskThreadPool & taskThreadPool);
 
     static void AppendRopes(
         std::map<MaterialDatabase::ColorKey, RopeSegment> const & ropeSegments,
@@ -213,7 +218,8 @@ private:
         std::vector<ShipBuildPoint> & pointInfos1,
         std::vector<ShipBuildSpring> & springInfos1,
         std::vector<ShipBuildTriangle> & triangleInfos1,
-        size_t & leakingPointsCount);
+        size_t & leakingPointsCount,
+        TaskThreadPool & taskThreadPool);
 
     static Physics::Points CreatePoints(
         std::vector<ShipBuildPoint> const & pointInfos2,
@@ -221,13 +227,15 @@ private:
         MaterialDatabase const & materialDatabase,
         std::shared_ptr<GameEventDispatcher> gameEventDispatcher,
         GameParameters const & gameParameters,
+        BufferArena & bufferArena,
         std::vector<ElectricalElementInstanceIndex> & electricalElementInstanceIndices);
 
     static std::vector<ShipBuildTriangle> FilterOutRedundantTriangles(
         std::vector<ShipBuildTriangle> const & triangleInfos2,
         Physics::Points const & points,
         std::vector<ElementIndex> const & pointIndexRemap,
-        std::vector<ShipBuildSpring> const & springInfos2);
+        std::vector<ShipBuildSpring> const & springInfos2,
+        TaskThreadPool & taskThreadPool);
 
     static void ConnectSpringsAndTriangles(
         std::vector<ShipBuildSpring> & springInfos2,
@@ -239,12 +247,14 @@ private:
         std::vector<ElementIndex> const & pointIndexRemap,
         Physics::World & parentWorld,
         std::shared_ptr<GameEventDispatcher> gameEventDispatcher,
-        GameParameters const & gameParameters);
+        GameParameters const & gameParameters,
+        BufferArena & bufferArena);
 
     static Physics::Triangles CreateTriangles(
         std::vector<ShipBuildTriangle> const & triangleInfos2,
         Physics::Points & points,
-        std::vector<ElementIndex> const & pointIndexRemap);
+        std::vector<ElementIndex> const & pointIndexRemap,
+        BufferArena & bufferArena);
 
     static Physics::ElectricalElements CreateElectricalElements(
         Physics::Points const & points,
@@ -254,16 +264,46 @@ private:
         ShipId shipId,
         Physics::World & parentWorld,
         std::shared_ptr<GameEventDispatcher> gameEventDispatcher,
-        GameParameters const & gameParameters);
+        GameParameters const & gameParameters,
+        BufferArena & bufferArena);
+
+    static size_t CalculateBufferArenaByteSize(
+        std::vector<ShipBuildPoint> const & pointInfos2,
+        size_t springCount,
+        size_t triangleCount);
+
+    //
+    // Parallelism
+    //
+
+    // Splits [0, elementCount) into contiguous [start, end) bands, one per thread
+    static std::vector<std::pair<int, int>> MakeBands(
+        int elementCount,
+        TaskThreadPool const & taskThreadPool);
+
+    // Runs the tasks and re-throws the exception thrown by the earliest task, if any
+    static void RunAndClear(
+        std::vector<TaskThreadPool::Task> & tasks,
+        TaskThreadPool & taskThreadPool);
 
 private:
 
+    //
+    // Buffer arena
+    //
+
+    static bool constexpr DoUseHugePagesForBufferArena = true;
+
     using ReorderingResults = std::tuple<std::vector<ShipBuildPoint>, std::vector<ElementIndex>, std::vector<ShipBuildSpring>>;
 
     //
     // Reordering
     //
 
+    // The reordering mode used for ships that don't specify one; chosen on the basis
+    // of the PointReordering benchmarks, in which stripes still beat both curves
+    static ShipPointsReorderingModeType constexpr DefaultPointsReorderingMode = ShipPointsReorderingModeType::Stripes;
+
     template <int StripeLength>
     static ReorderingResults ReorderPointsAndSpringsOptimally_Stripes(
         std::vector<ShipBuildPoint> const & pointInfos1,
@@ -311,6 +351,13 @@ private:
         ShipBuildPointIndexMatrix const & pointIndexMatrix,
         ImageSize const & structureImageSize);
 
+    // Sorts points along a space-filling curve over their positions, and springs
+    // by their lowest (reordered) endpoint
+    static ReorderingResults ReorderPointsAndSpringsOptimally_SpaceFillingCurve(
+        std::vector<ShipBuildPoint> const & pointInfos1,
+        std::vector<ShipBuildSpring> const & springInfos1,
+        ShipPointsReorderingModeType curve);
+
     static std::vector<ShipBuildSpring> ReorderSpringsOptimally_TomForsyth(
         std::vector<ShipBuildSpring> const & springInfos1,
         size_t pointCount);
@@ -329,6 +376,14 @@ private:
 
     static float CalculateVertexMissRatio(std::vector<ShipBuildTriangle> const & triangleInfos);
 
+    // Simulates the cache lines touched by the springs while gathering their endpoints'
+    // positions, and returns the L1 and L2 misses per spring
+    static std::tuple<float, float> CalculateSpringGatherMissRatios(
+        std::vector<ShipBuildSpring> const & springInfos,
+        std::vector<ElementIndex> const & pointIndexRemap);
+
+    static std::string ToString(ShipPointsReorderingModeType mode);
+
 private:
 
     /////////////////////////////////////////////////////////////////
@@ -394,4 +449,30 @@ private:
 
         std::list<size_t> mEntries;
     };
+
+    /////////////////////////////////////////////////////////////////
+    // Memory cache simulation
+    /////////////////////////////////////////////////////////////////
+
+    // We only simulate the point positions buffer, while the spring loops gather
+    // at least three point buffers; hence we give it a fraction of each cache
+    static constexpr size_t CacheLineSize = 64;
+    static constexpr size_t L1CacheSets = 16; // 8KB
+    static constexpr size_t L2CacheSets = 128; // 64KB
+    static constexpr size_t CacheWays = 8;
+
+    template <size_t Sets, size_t Ways>
+    class TestSetAssociativeCache
+    {
+    public:
+
+        TestSetAssociativeCache();
+
+        bool UseAddress(size_t address);
+
+    private:
+
+        // Line tags, for each set from most recently used to least recently used
+        std::array<std::array<size_t, Ways>, Sets> mTags;
+    };
 };
@@ -29,6 +29,8 @@ public:
 
     std::optional<ShipAutoTexturizationSettings> const AutoTexturizationSettings;
 
+    std::optional<ShipPointsReorderingModeType> const PointsReorderingMode;
+
     ShipMetadata const Metadata;
 
     static ShipDefinition Load(std::filesystem::path const & filepath);
@@ -41,12 +43,14 @@ private:
         std::optional<RgbImageData> electricalLayerImage,
         std::optional<RgbaImageData> textureLayerImage,
         std::optional<ShipAutoTexturizationSettings> autoTexturizationSettings,
+        std::optional<ShipPointsReorderingModeType> pointsReorderingMode,
         ShipMetadata const metadata)
         : StructuralLayerImage(std::move(structuralLayerImage))
         , RopesLayerImage(std::move(ropesLayerImage))
         , ElectricalLayerImage(std::move(electricalLayerImage))
         , TextureLayerImage(std::move(textureLayerImage))
         , AutoTexturizationSettings(std::move(autoTexturizationSettings))
+        , PointsReorderingMode(pointsReorderingMode)
         , Metadata(std::move(metadata))
     {
     }
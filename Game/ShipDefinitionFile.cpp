@@ -60,6 +60,13 @@ ShipDefinitionFile ShipDefinitionFile::Load(std::filesystem::path definitionFile
             autoTexturizationSettings = ShipAutoTexturizationSettings::FromJSON(memberIt->second.get<picojson::object>());
         }
 
+        std::optional<ShipPointsReorderingModeType> pointsReorderingMode;
+        if (std::optional<std::string> const pointsReorderingModeStr = Utils::GetOptionalJsonMember<std::string>(definitionJson, "points_reordering");
+            pointsReorderingModeStr.has_value())
+        {
+            pointsReorderingMode = StrToShipPointsReorderingModeType(*pointsReorderingModeStr);
+        }
+
         bool const doHideElectricalsInPreview = Utils::GetOptionalJsonMember<bool>(
             definitionJson,
             "do_hide_electricals_in_preview",
@@ -141,6 +148,7 @@ ShipDefinitionFile ShipDefinitionFile::Load(std::filesystem::path definitionFile
                 ? basePath / std::filesystem::path(*textureLayerImageFilePathStr)
                 : std::optional<std::filesystem::path>(std::nullopt),
             autoTexturizationSettings,
+            pointsReorderingMode,
             doHideElectricalsInPreview,
             doHideHDInPreview,
             ShipMetadata(
@@ -163,6 +171,7 @@ ShipDefinitionFile ShipDefinitionFile::Load(std::filesystem::path definitionFile
             std::nullopt, // Electrical
             std::nullopt, // Texture
             std::nullopt, // AutoTexturizationSettings
+            std::nullopt, // PointsReorderingMode
             false, // HideElectricalsInPreview
             false, // HideHDInPreview
             ShipMetadata(definitionFilePath.stem().string()));
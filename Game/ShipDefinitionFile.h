@@ -35,6 +35,8 @@ public:
 
     std::optional<ShipAutoTexturizationSettings> const AutoTexturizationSettings;
 
+    std::optional<ShipPointsReorderingModeType> const PointsReorderingMode;
+
     bool const DoHideElectricalsInPreview;
     bool const DoHideHDInPreview;
 
@@ -58,6 +60,7 @@ private:
         std::optional<std::filesystem::path> const & electricalLayerImageFilePath,
         std::optional<std::filesystem::path> const & textureLayerImageFilePath,
         std::optional<ShipAutoTexturizationSettings> const & autoTexturizationSettings,
+        std::optional<ShipPointsReorderingModeType> pointsReorderingMode,
         bool doHideElectricalsInPreview,
         bool doHideHDInPreview,
         ShipMetadata && shipMetadata)
@@ -66,6 +69,7 @@ private:
         , ElectricalLayerImageFilePath(electricalLayerImageFilePath)
         , TextureLayerImageFilePath(textureLayerImageFilePath)
         , AutoTexturizationSettings(autoTexturizationSettings)
+        , PointsReorderingMode(pointsReorderingMode)
         , DoHideElectricalsInPreview(doHideElectricalsInPreview)
         , DoHideHDInPreview(doHideHDInPreview)
         , Metadata(std::move(shipMetadata))
@@ -7,6 +7,7 @@
 
 #include "GameParameters.h"
 
+#include <GameCore/Algorithms.h>
 #include <GameCore/GameException.h>
 #include <GameCore/GameMath.h>
 #include <GameCore/GameWallClock.h>
@@ -25,7 +26,8 @@ ShipRenderContext::ShipRenderContext(
     ShaderManager<ShaderManagerTraits> & shaderManager,
     GlobalRenderContext const & globalRenderContext,
     RenderParameters const & renderParameters,
-    float shipFlameSizeAdjustment)
+    float shipFlameSizeAdjustment,
+    TaskThreadPool & taskThreadPool)
     : mShipId(shipId)
     , mPointCount(pointCount)
     , mShipCount(shipCount)
@@ -35,9 +37,15 @@ ShipRenderContext::ShipRenderContext(
     , mPointAttributeGroup1Buffer()
     , mPointAttributeGroup1VBO()
     , mPointAttributeGroup2Buffer()
+    , mPointAttributeGroup2PackedBuffer()
     , mPointAttributeGroup2VBO()
+    , mPointAttributeGroup2DirtyChunks(pointCount)
+    , mIsPointAttributeGroup2Packed(false)
     , mPointColorVBO()
-    , mPointTemperatureVBO()
+    , mPointPlaneIdBuffer()
+    , mPointPlaneIdVBO()
+    , mPointPlaneIdDirtyChunks(pointCount)
+    , mPointAttributeUploadedBytes(0)
     //
     , mStressedSpringElementBuffer()
     , mStressedSpringElementVBO()
@@ -52,17 +60,17 @@ ShipRenderContext::ShipRenderContext(
     , mFlameWindSpeedMagnitudeAverage(0.0f)
     , mIsFlameWindSpeedMagnitudeAverageDirty(true)
     //
-    , mExplosionPlaneVertexBuffers()
+    , mExplosionPlaneQuadBuffers()
     , mExplosionTotalVertexCount(0u)
     , mExplosionVBO()
     , mExplosionVBOAllocatedVertexSize(0u)
     //
-    , mSparkleVertexBuffer()
+    , mSparkleQuadBuffer()
     , mSparkleVBO()
     , mSparkleVBOAllocatedVertexSize(0u)
     //
-    , mGenericMipMappedTextureAirBubbleVertexBuffer()
-    , mGenericMipMappedTexturePlaneVertexBuffers()
+    , mGenericMipMappedTextureAirBubbleQuadBuffer()
+    , mGenericMipMappedTexturePlaneQuadBuffers()
     , mGenericMipMappedTextureTotalVertexCount(0u)
     , mGenericMipMappedTextureVBO()
     , mGenericMipMappedTextureVBOAllocatedVertexSize(0u)
@@ -105,6 +113,9 @@ ShipRenderContext::ShipRenderContext(
     , mGenericMipMappedTextureAtlasMetadata(globalRenderContext.GetGenericMipMappedTextureAtlasMetadata())
     // Managers
     , mShaderManager(shaderManager)
+    , mTaskThreadPool(taskThreadPool)
+    , mQuadBufferStartIndices()
+    , mVertexGenerationTasks()
     // Non-render parameters
     , mHalfFlameQuadWidth(0.0f) // Will be calculated
     , mFlameQuadHeight(0.0f) // Will be calculated
@@ -130,18 +141,21 @@ ShipRenderContext::ShipRenderContext(
     std::memset(mPointAttributeGroup1Buffer.get(), 0, pointCount * sizeof(vec4f));
 
     mPointAttributeGroup2VBO = vbos[1];
-    glBindBuffer(GL_ARRAY_BUFFER, *mPointAttributeGroup2VBO);
-    glBufferData(GL_ARRAY_BUFFER, pointCount * sizeof(vec4f), nullptr, GL_STREAM_DRAW);
+    // Note: VBO is allocated by ApplyDoPackShipPointAttributesChanges(), depending on the format
     mPointAttributeGroup2Buffer.reset(new vec4f[pointCount]);
     std::memset(mPointAttributeGroup2Buffer.get(), 0, pointCount * sizeof(vec4f));
+    mPointAttributeGroup2PackedBuffer.reset(new std::uint16_t[pointCount * 4]);
 
     mPointColorVBO = vbos[2];
     glBindBuffer(GL_ARRAY_BUFFER, *mPointColorVBO);
     glBufferData(GL_ARRAY_BUFFER, pointCount * sizeof(vec4f), nullptr, GL_STATIC_DRAW);
 
-    mPointTemperatureVBO = vbos[3];
-    glBindBuffer(GL_ARRAY_BUFFER, *mPointTemperatureVBO);
+    mPointPlaneIdVBO = vbos[3];
+    glBindBuffer(GL_ARRAY_BUFFER, *mPointPlaneIdVBO);
     glBufferData(GL_ARRAY_BUFFER, pointCount * sizeof(float), nullptr, GL_STREAM_DRAW);
+    mPointPlaneIdBuffer.reset(new float[pointCount]);
+    std::memset(mPointPlaneIdBuffer.get(), 0, pointCount * sizeof(float));
+    mPointPlaneIdDirtyChunks.MarkAllDirty();
 
     mStressedSpringElementVBO = vbos[4];
     mStressedSpringElementBuffer.reserve(1024); // Arbitrary
@@ -151,7 +165,7 @@ ShipRenderContext::ShipRenderContext(
     mExplosionVBO = vbos[6];
 
     mSparkleVBO = vbos[7];
-    mSparkleVertexBuffer.reserve(256); // Arbitrary
+    mSparkleQuadBuffer.reserve(64); // Arbitrary
 
     mGenericMipMappedTextureVBO = vbos[8];
 
@@ -196,9 +210,8 @@ ShipRenderContext::ShipRenderContext(
         glVertexAttribPointer(static_cast<GLuint>(VertexAttributeType::ShipPointAttributeGroup1), 4, GL_FLOAT, GL_FALSE, sizeof(vec4f), (void*)(0));
         CheckOpenGLError();
 
-        glBindBuffer(GL_ARRAY_BUFFER, *mPointAttributeGroup2VBO);
+        // Note: AttributeGroup2 is described by ApplyDoPackShipPointAttributesChanges(), depending on the format
         glEnableVertexAttribArray(static_cast<GLuint>(VertexAttributeType::ShipPointAttributeGroup2));
-        glVertexAttribPointer(static_cast<GLuint>(VertexAttributeType::ShipPointAttributeGroup2), 4, GL_FLOAT, GL_FALSE, sizeof(vec4f), (void*)(0));
         CheckOpenGLError();
 
         glBindBuffer(GL_ARRAY_BUFFER, *mPointColorVBO);
@@ -206,9 +219,9 @@ ShipRenderContext::ShipRenderContext(
         glVertexAttribPointer(static_cast<GLuint>(VertexAttributeType::ShipPointColor), 4, GL_FLOAT, GL_FALSE, sizeof(vec4f), (void*)(0));
         CheckOpenGLError();
 
-        glBindBuffer(GL_ARRAY_BUFFER, *mPointTemperatureVBO);
-        glEnableVertexAttribArray(static_cast<GLuint>(VertexAttributeType::ShipPointTemperature));
-        glVertexAttribPointer(static_cast<GLuint>(VertexAttributeType::ShipPointTemperature), 1, GL_FLOAT, GL_FALSE, sizeof(float), (void*)(0));
+        glBindBuffer(GL_ARRAY_BUFFER, *mPointPlaneIdVBO);
+        glEnableVertexAttribArray(static_cast<GLuint>(VertexAttributeType::ShipPointPlaneId));
+        glVertexAttribPointer(static_cast<GLuint>(VertexAttributeType::ShipPointPlaneId), 1, GL_FLOAT, GL_FALSE, sizeof(float), (void*)(0));
         CheckOpenGLError();
 
         glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -463,6 +476,7 @@ ShipRenderContext::ShipRenderContext(
     ApplyWaterContrastChanges(renderParameters);
     ApplyWaterLevelOfDetailChanges(renderParameters);
     ApplyHeatOverlayTransparencyChanges(renderParameters);
+    ApplyDoPackShipPointAttributesChanges(renderParameters);
 }
 
 ShipRenderContext::~ShipRenderContext()
@@ -481,35 +495,35 @@ void ShipRenderContext::UploadStart(PlaneId maxMaxPlaneId)
 
     {
         size_t const newSize = static_cast<size_t>(maxMaxPlaneId) + 1u;
-        assert(mExplosionPlaneVertexBuffers.size() <= newSize);
+        assert(mExplosionPlaneQuadBuffers.size() <= newSize);
 
-        size_t const clearCount = mExplosionPlaneVertexBuffers.size();
+        size_t const clearCount = mExplosionPlaneQuadBuffers.size();
         for (size_t i = 0; i < clearCount; ++i)
         {
-            mExplosionPlaneVertexBuffers[i].vertexBuffer.clear();
+            mExplosionPlaneQuadBuffers[i].quadBuffer.clear();
         }
 
-        if (newSize != mExplosionPlaneVertexBuffers.size())
-            mExplosionPlaneVertexBuffers.resize(newSize);
+        if (newSize != mExplosionPlaneQuadBuffers.size())
+            mExplosionPlaneQuadBuffers.resize(newSize);
     }
 
 
-    mSparkleVertexBuffer.clear();
+    mSparkleQuadBuffer.clear();
 
     {
-        mGenericMipMappedTextureAirBubbleVertexBuffer.clear();
+        mGenericMipMappedTextureAirBubbleQuadBuffer.clear();
 
         size_t const newSize = static_cast<size_t>(maxMaxPlaneId) + 1u;
-        assert(mGenericMipMappedTexturePlaneVertexBuffers.size() <= newSize);
+        assert(mGenericMipMappedTexturePlaneQuadBuffers.size() <= newSize);
 
-        size_t const clearCount = mGenericMipMappedTexturePlaneVertexBuffers.size();
+        size_t const clearCount = mGenericMipMappedTexturePlaneQuadBuffers.size();
         for (size_t i = 0; i < clearCount; ++i)
         {
-            mGenericMipMappedTexturePlaneVertexBuffers[i].vertexBuffer.clear();
+            mGenericMipMappedTexturePlaneQuadBuffers[i].quadBuffer.clear();
         }
 
-        if (newSize != mGenericMipMappedTexturePlaneVertexBuffers.size())
-            mGenericMipMappedTexturePlaneVertexBuffers.resize(newSize);
+        if (newSize != mGenericMipMappedTexturePlaneQuadBuffers.size())
+            mGenericMipMappedTexturePlaneQuadBuffers.resize(newSize);
     }
 
     for (size_t i = 0; i <= static_cast<size_t>(HighlightModeType::_Last); ++i)
@@ -551,32 +565,52 @@ void ShipRenderContext::UploadPointMutableAttributesStart()
     // Nop
 }
 
-void ShipRenderContext::UploadPointMutableAttributes(
-    vec2f const * position,
-    float const * light,
-    float const * water,
-    size_t lightAndWaterCount)
+void ShipRenderContext::UploadPointMutableAttributes(vec2f const * position)
 {
     // Uploaded at each cycle
 
     // Interleave positions into AttributeGroup1 buffer
-    vec4f * restrict pDst1 = mPointAttributeGroup1Buffer.get();
+    vec4f * restrict pDst = mPointAttributeGroup1Buffer.get();
     vec2f const * restrict pSrc = position;
     for (size_t i = 0; i < mPointCount; ++i)
     {
-        pDst1[i].x = pSrc[i].x;
-        pDst1[i].y = pSrc[i].y;
+        pDst[i].x = pSrc[i].x;
+        pDst[i].y = pSrc[i].y;
     }
+}
 
-    // Interleave light and water into AttributeGroup2 buffer
-    vec4f * restrict pDst2 = mPointAttributeGroup2Buffer.get();
-    float const * restrict pSrc1 = light;
-    float const * restrict pSrc2 = water;
-    for (size_t i = 0; i < lightAndWaterCount; ++i)
-    {
-        pDst2[i].x = pSrc1[i];
-        pDst2[i].y = pSrc2[i];
-    }
+void ShipRenderContext::UploadPointMutableAttributesLight(
+    float const * light,
+    size_t startDst,
+    size_t count)
+{
+    // Uploaded for the ranges that have changed
+
+    // Interleave light into AttributeGroup2 buffer
+    assert(startDst + count <= mPointCount);
+    vec4f * restrict pDst = &(mPointAttributeGroup2Buffer.get()[startDst]);
+    float const * restrict pSrc = light;
+    for (size_t i = 0; i < count; ++i)
+        pDst[i].x = pSrc[i];
+
+    mPointAttributeGroup2DirtyChunks.MarkDirty(startDst, count);
+}
+
+void ShipRenderContext::UploadPointMutableAttributesWater(
+    float const * water,
+    size_t startDst,
+    size_t count)
+{
+    // Uploaded for the ranges that have changed
+
+    // Interleave water into AttributeGroup2 buffer, normalized
+    assert(startDst + count <= mPointCount);
+    vec4f * restrict pDst = &(mPointAttributeGroup2Buffer.get()[startDst]);
+    float const * restrict pSrc = water;
+    for (size_t i = 0; i < count; ++i)
+        pDst[i].y = pSrc[i] / PointWaterRange;
+
+    mPointAttributeGroup2DirtyChunks.MarkDirty(startDst, count);
 }
 
 void ShipRenderContext::UploadPointMutableAttributesPlaneId(
@@ -587,12 +621,11 @@ void ShipRenderContext::UploadPointMutableAttributesPlaneId(
     // Uploaded sparingly, but we treat them as if they could
     // be uploaded at any time
 
-    // Interleave plane ID into AttributeGroup2 buffer
+    // Copy plane ID into its own buffer, as it doesn't fit 16 bits
     assert(startDst + count <= mPointCount);
-    vec4f * restrict pDst = &(mPointAttributeGroup2Buffer.get()[startDst]);
-    float const * restrict pSrc = planeId;
-    for (size_t i = 0; i < count; ++i)
-        pDst[i].z = pSrc[i];
+    std::memcpy(&(mPointPlaneIdBuffer.get()[startDst]), planeId, count * sizeof(float));
+
+    mPointPlaneIdDirtyChunks.MarkDirty(startDst, count);
 }
 
 void ShipRenderContext::UploadPointMutableAttributesDecay(
@@ -608,7 +641,9 @@ void ShipRenderContext::UploadPointMutableAttributesDecay(
     vec4f * restrict pDst = &(mPointAttributeGroup2Buffer.get()[startDst]);
     float const * restrict pSrc = decay;
     for (size_t i = 0; i < count; ++i)
-        pDst[i].w = pSrc[i];
+        pDst[i].z = pSrc[i];
+
+    mPointAttributeGroup2DirtyChunks.MarkDirty(startDst, count);
 }
 
 void ShipRenderContext::UploadPointMutableAttributesEnd()
@@ -636,6 +671,8 @@ void ShipRenderContext::UploadPointColors(
     glBufferSubData(GL_ARRAY_BUFFER, startDst * sizeof(vec4f), count * sizeof(vec4f), color);
     CheckOpenGLError();
 
+    mPointAttributeUploadedBytes += count * sizeof(vec4f);
+
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
@@ -644,22 +681,16 @@ void ShipRenderContext::UploadPointTemperature(
     size_t startDst,
     size_t count)
 {
-    // Uploaded sparingly
-
-    // We've been invoked on the render thread
-
-    //
-    // Upload temperature range
-    //
+    // Uploaded only when the heat overlay is on
 
+    // Interleave temperature into AttributeGroup2 buffer, normalized
     assert(startDst + count <= mPointCount);
+    vec4f * restrict pDst = &(mPointAttributeGroup2Buffer.get()[startDst]);
+    float const * restrict pSrc = temperature;
+    for (size_t i = 0; i < count; ++i)
+        pDst[i].w = pSrc[i] / PointTemperatureRange;
 
-    glBindBuffer(GL_ARRAY_BUFFER, *mPointTemperatureVBO);
-
-    glBufferSubData(GL_ARRAY_BUFFER, startDst * sizeof(float), count * sizeof(float), temperature);
-    CheckOpenGLError();
-
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    mPointAttributeGroup2DirtyChunks.MarkDirty(startDst, count);
 }
 
 void ShipRenderContext::UploadElementsStart()
@@ -850,9 +881,16 @@ void ShipRenderContext::ProcessParameterChanges(RenderParameters const & renderP
     {
         ApplyHeatOverlayTransparencyChanges(renderParameters);
     }
+
+    if (renderParameters.IsDoPackShipPointAttributesDirty)
+    {
+        ApplyDoPackShipPointAttributesChanges(renderParameters);
+    }
 }
 
-void ShipRenderContext::RenderPrepare(RenderParameters const & renderParameters)
+void ShipRenderContext::RenderPrepare(
+    RenderParameters const & renderParameters,
+    RenderStatistics & renderStats)
 {
     // We've been invoked on the render thread
 
@@ -865,17 +903,75 @@ void ShipRenderContext::RenderPrepare(RenderParameters const & renderParameters)
     glBufferSubData(GL_ARRAY_BUFFER, 0, mPointCount * sizeof(vec4f), mPointAttributeGroup1Buffer.get());
     CheckOpenGLError();
 
+    mPointAttributeUploadedBytes += mPointCount * sizeof(vec4f);
+
     //
-    // Upload Point AttributeGroup2 buffer
+    // Upload Point AttributeGroup2 buffer - only the chunks that have changed
     //
 
-    glBindBuffer(GL_ARRAY_BUFFER, *mPointAttributeGroup2VBO);
+    if (mPointAttributeGroup2DirtyChunks.IsAnyDirty())
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, *mPointAttributeGroup2VBO);
 
-    glBufferSubData(GL_ARRAY_BUFFER, 0, mPointCount * sizeof(vec4f), mPointAttributeGroup2Buffer.get());
-    CheckOpenGLError();
+        if (mIsPointAttributeGroup2Packed)
+        {
+            mPointAttributeGroup2DirtyChunks.VisitDirtyRanges(
+                [this](size_t start, size_t count)
+                {
+                    // Quantize range
+                    std::uint16_t * const pPacked = &(mPointAttributeGroup2PackedBuffer.get()[start * 4]);
+                    Algorithms::QuantizeToUNorm16(
+                        &(mPointAttributeGroup2Buffer.get()[start].x),
+                        count * 4,
+                        pPacked);
+
+                    glBufferSubData(GL_ARRAY_BUFFER, start * 4 * sizeof(std::uint16_t), count * 4 * sizeof(std::uint16_t), pPacked);
+                    CheckOpenGLError();
+
+                    mPointAttributeUploadedBytes += count * 4 * sizeof(std::uint16_t);
+                });
+        }
+        else
+        {
+            mPointAttributeGroup2DirtyChunks.VisitDirtyRanges(
+                [this](size_t start, size_t count)
+                {
+                    glBufferSubData(GL_ARRAY_BUFFER, start * sizeof(vec4f), count * sizeof(vec4f), &(mPointAttributeGroup2Buffer.get()[start]));
+                    CheckOpenGLError();
+
+                    mPointAttributeUploadedBytes += count * sizeof(vec4f);
+                });
+        }
+
+        mPointAttributeGroup2DirtyChunks.Clear();
+    }
+
+    //
+    // Upload Point PlaneId buffer - only the chunks that have changed
+    //
+
+    if (mPointPlaneIdDirtyChunks.IsAnyDirty())
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, *mPointPlaneIdVBO);
+
+        mPointPlaneIdDirtyChunks.VisitDirtyRanges(
+            [this](size_t start, size_t count)
+            {
+                glBufferSubData(GL_ARRAY_BUFFER, start * sizeof(float), count * sizeof(float), &(mPointPlaneIdBuffer.get()[start]));
+                CheckOpenGLError();
+
+                mPointAttributeUploadedBytes += count * sizeof(float);
+            });
+
+        mPointPlaneIdDirtyChunks.Clear();
+    }
 
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 
+    // Update stats
+    renderStats.LastUploadedShipPointAttributeBytes += mPointAttributeUploadedBytes;
+    mPointAttributeUploadedBytes = 0;
+
     //
     // Upload element buffers, if needed
     //
@@ -1467,34 +1563,315 @@ void ShipRenderContext::RenderDrawFlames(
     }
 }
 
-void ShipRenderContext::RenderPrepareSparkles(RenderParameters const & /*renderParameters*/)
+template<typename TVertex, typename TGetQuadBuffer, typename TGenerateQuadVertices>
+void ShipRenderContext::GenerateQuadVertices(
+    size_t quadBufferCount,
+    TGetQuadBuffer const & getQuadBuffer,
+    size_t totalQuadCount,
+    TVertex * restrict vertices,
+    TGenerateQuadVertices const & generateQuadVertices)
 {
-    if (!mSparkleVertexBuffer.empty())
+    //
+    // The quad buffers are laid out in the vertex buffer one after the other,
+    // six vertices per quad; we split the whole quad range among tasks, each
+    // generating its vertices directly at their final place
+    //
+
+    // Calculate the index of the first quad of each buffer
+    mQuadBufferStartIndices.clear();
+    size_t quadBufferStartIndex = 0;
+    for (size_t b = 0; b < quadBufferCount; ++b)
     {
-        glBindBuffer(GL_ARRAY_BUFFER, *mSparkleVBO);
+        mQuadBufferStartIndices.push_back(quadBufferStartIndex);
+        quadBufferStartIndex += getQuadBuffer(b).size();
+    }
+
+    assert(quadBufferStartIndex == totalQuadCount);
 
-        if (mSparkleVertexBuffer.size() > mSparkleVBOAllocatedVertexSize)
+    auto const generateQuadRange =
+        [&](size_t startQuadIndex, size_t endQuadIndex)
         {
-            // Re-allocate VBO buffer and upload
-            glBufferData(GL_ARRAY_BUFFER, mSparkleVertexBuffer.size() * sizeof(SparkleVertex), mSparkleVertexBuffer.data(), GL_DYNAMIC_DRAW);
-            CheckOpenGLError();
+            // Find the last buffer starting at or before the start quad
+            size_t b = static_cast<size_t>(
+                std::upper_bound(mQuadBufferStartIndices.cbegin(), mQuadBufferStartIndices.cend(), startQuadIndex)
+                - mQuadBufferStartIndices.cbegin()) - 1;
+
+            for (size_t q = startQuadIndex; q < endQuadIndex; ++b)
+            {
+                assert(b < quadBufferCount);
+
+                auto const & quadBuffer = getQuadBuffer(b);
+                size_t const bufferStartQuadIndex = mQuadBufferStartIndices[b];
+                size_t const bufferEndQuadIndex = std::min(bufferStartQuadIndex + quadBuffer.size(), endQuadIndex);
+                for (; q < bufferEndQuadIndex; ++q)
+                {
+                    generateQuadVertices(quadBuffer[q - bufferStartQuadIndex], &(vertices[q * 6]));
+                }
+            }
+        };
+
+    size_t const taskCount = std::min(
+        mTaskThreadPool.GetParallelism(),
+        std::max(size_t(1), totalQuadCount / MinQuadsPerVertexGenerationTask));
 
-            mSparkleVBOAllocatedVertexSize = mSparkleVertexBuffer.size();
+    if (taskCount == 1)
+    {
+        generateQuadRange(0, totalQuadCount);
+    }
+    else
+    {
+        size_t const quadsPerTask = (totalQuadCount + taskCount - 1) / taskCount;
+
+        assert(mVertexGenerationTasks.empty());
+        for (size_t startQuadIndex = 0; startQuadIndex < totalQuadCount; startQuadIndex += quadsPerTask)
+        {
+            size_t const endQuadIndex = std::min(startQuadIndex + quadsPerTask, totalQuadCount);
+
+            mVertexGenerationTasks.emplace_back(
+                [&generateQuadRange, startQuadIndex, endQuadIndex]()
+                {
+                    generateQuadRange(startQuadIndex, endQuadIndex);
+                });
         }
-        else
+
+        mTaskThreadPool.RunAndClear(mVertexGenerationTasks);
+    }
+}
+
+inline void ShipRenderContext::GenerateExplosionQuadVertices(
+    ExplosionQuad const & quad,
+    ExplosionVertex * restrict vertices) const
+{
+    // Resolution of atlas, for dead center calculations
+    float const dTextureX = 1.0f / (2.0f * static_cast<float>(mExplosionTextureAtlasMetadata.GetSize().Width));
+    float const dTextureY = 1.0f / (2.0f * static_cast<float>(mExplosionTextureAtlasMetadata.GetSize().Height));
+
+    float const halfQuadSize = quad.halfQuadSize;
+
+    // Triangle 1
+
+    // Top-left
+    vertices[0] = ExplosionVertex(
+        quad.centerPosition,
+        vec2f(-halfQuadSize, halfQuadSize),
+        vec2f(0.0f + dTextureX, 1.0f - dTextureY),
+        quad.planeId,
+        quad.angle,
+        quad.explosionIndex,
+        quad.progress);
+
+    // Top-Right
+    vertices[1] = ExplosionVertex(
+        quad.centerPosition,
+        vec2f(halfQuadSize, halfQuadSize),
+        vec2f(1.0f - dTextureX, 1.0f - dTextureY),
+        quad.planeId,
+        quad.angle,
+        quad.explosionIndex,
+        quad.progress);
+
+    // Bottom-left
+    vertices[2] = ExplosionVertex(
+        quad.centerPosition,
+        vec2f(-halfQuadSize, -halfQuadSize),
+        vec2f(0.0f + dTextureX, 0.0f + dTextureY),
+        quad.planeId,
+        quad.angle,
+        quad.explosionIndex,
+        quad.progress);
+
+    // Triangle 2
+
+    // Top-Right
+    vertices[3] = vertices[1];
+
+    // Bottom-left
+    vertices[4] = vertices[2];
+
+    // Bottom-right
+    vertices[5] = ExplosionVertex(
+        quad.centerPosition,
+        vec2f(halfQuadSize, -halfQuadSize),
+        vec2f(1.0f - dTextureX, 0.0f + dTextureY),
+        quad.planeId,
+        quad.angle,
+        quad.explosionIndex,
+        quad.progress);
+}
+
+inline void ShipRenderContext::GenerateSparkleQuadVertices(
+    SparkleQuad const & quad,
+    SparkleVertex * restrict vertices) const
+{
+    //
+    // Calculate sparkle quad
+    //
+
+    float const halfQuadSide =
+        1.5f
+        * (1.0f - SmoothStep(0.5f, 0.75f, quad.progress)); // Shrinks as time goes
+
+    // Calculate quad coordinates
+    float const leftX = quad.position.x - halfQuadSide;
+    float const rightX = quad.position.x + halfQuadSide;
+    float const topY = quad.position.y - halfQuadSide;
+    float const bottomY = quad.position.y + halfQuadSide;
+
+    // Triangle 1
+
+    // Top-left
+    vertices[0] = SparkleVertex(
+        vec2f(leftX, topY),
+        quad.planeId,
+        quad.progress,
+        quad.velocityVector,
+        vec2f(-1.0f, -1.0f));
+
+    // Top-right
+    vertices[1] = SparkleVertex(
+        vec2f(rightX, topY),
+        quad.planeId,
+        quad.progress,
+        quad.velocityVector,
+        vec2f(1.0f, -1.0f));
+
+    // Bottom-left
+    vertices[2] = SparkleVertex(
+        vec2f(leftX, bottomY),
+        quad.planeId,
+        quad.progress,
+        quad.velocityVector,
+        vec2f(-1.0f, 1.0f));
+
+    // Triangle 2
+
+    // Top-right
+    vertices[3] = vertices[1];
+
+    // Bottom-left
+    vertices[4] = vertices[2];
+
+    // Bottom-right
+    vertices[5] = SparkleVertex(
+        vec2f(rightX, bottomY),
+        quad.planeId,
+        quad.progress,
+        quad.velocityVector,
+        vec2f(1.0f, 1.0f));
+}
+
+inline void ShipRenderContext::GenerateGenericMipMappedTextureQuadVertices(
+    GenericTextureQuad const & quad,
+    GenericTextureVertex * restrict vertices) const
+{
+    TextureAtlasFrameMetadata<GenericMipMappedTextureGroups> const & frame =
+        mGenericMipMappedTextureAtlasMetadata.GetFrameMetadata(quad.textureFrameId);
+
+    float const leftX = -frame.FrameMetadata.AnchorWorldX;
+    float const rightX = frame.FrameMetadata.WorldWidth - frame.FrameMetadata.AnchorWorldX;
+    float const topY = frame.FrameMetadata.WorldHeight - frame.FrameMetadata.AnchorWorldY;
+    float const bottomY = -frame.FrameMetadata.AnchorWorldY;
+
+    float const lightSensitivity =
+        frame.FrameMetadata.HasOwnAmbientLight ? 0.0f : 1.0f;
+
+    // Triangle 1
+
+    // Top-left
+    vertices[0] = GenericTextureVertex(
+        quad.position,
+        vec2f(leftX, topY),
+        vec2f(frame.TextureCoordinatesBottomLeft.x, frame.TextureCoordinatesTopRight.y),
+        quad.planeId,
+        quad.scale,
+        -quad.angleCw,
+        quad.alpha,
+        lightSensitivity);
+
+    // Top-Right
+    vertices[1] = GenericTextureVertex(
+        quad.position,
+        vec2f(rightX, topY),
+        frame.TextureCoordinatesTopRight,
+        quad.planeId,
+        quad.scale,
+        -quad.angleCw,
+        quad.alpha,
+        lightSensitivity);
+
+    // Bottom-left
+    vertices[2] = GenericTextureVertex(
+        quad.position,
+        vec2f(leftX, bottomY),
+        frame.TextureCoordinatesBottomLeft,
+        quad.planeId,
+        quad.scale,
+        -quad.angleCw,
+        quad.alpha,
+        lightSensitivity);
+
+    // Triangle 2
+
+    // Top-Right
+    vertices[3] = vertices[1];
+
+    // Bottom-left
+    vertices[4] = vertices[2];
+
+    // Bottom-right
+    vertices[5] = GenericTextureVertex(
+        quad.position,
+        vec2f(rightX, bottomY),
+        vec2f(frame.TextureCoordinatesTopRight.x, frame.TextureCoordinatesBottomLeft.y),
+        quad.planeId,
+        quad.scale,
+        -quad.angleCw,
+        quad.alpha,
+        lightSensitivity);
+}
+
+void ShipRenderContext::RenderPrepareSparkles(RenderParameters const & /*renderParameters*/)
+{
+    if (!mSparkleQuadBuffer.empty())
+    {
+        size_t const sparkleVertexCount = mSparkleQuadBuffer.size() * 6;
+
+        glBindBuffer(GL_ARRAY_BUFFER, *mSparkleVBO);
+
+        if (sparkleVertexCount > mSparkleVBOAllocatedVertexSize)
         {
-            // No size change, just upload VBO buffer
-            glBufferSubData(GL_ARRAY_BUFFER, 0, mSparkleVertexBuffer.size() * sizeof(SparkleVertex), mSparkleVertexBuffer.data());
+            // Re-allocate VBO buffer
+            glBufferData(GL_ARRAY_BUFFER, sparkleVertexCount * sizeof(SparkleVertex), nullptr, GL_DYNAMIC_DRAW);
             CheckOpenGLError();
+
+            mSparkleVBOAllocatedVertexSize = sparkleVertexCount;
         }
 
+        // Map vertex buffer
+        auto mappedBuffer = reinterpret_cast<SparkleVertex *>(glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY));
+        CheckOpenGLError();
+
+        // Generate vertices
+        GenerateQuadVertices(
+            1,
+            [this](size_t) -> auto const & { return mSparkleQuadBuffer; },
+            mSparkleQuadBuffer.size(),
+            mappedBuffer,
+            [this](SparkleQuad const & quad, SparkleVertex * restrict vertices)
+            {
+                GenerateSparkleQuadVertices(quad, vertices);
+            });
+
+        // Unmap vertex buffer
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+
         glBindBuffer(GL_ARRAY_BUFFER, 0);
     }
 }
 
 void ShipRenderContext::RenderDrawSparkles(RenderParameters const & renderParameters)
 {
-    if (!mSparkleVertexBuffer.empty())
+    if (!mSparkleQuadBuffer.empty())
     {
         glBindVertexArray(*mSparkleVAO);
 
@@ -1503,8 +1880,7 @@ void ShipRenderContext::RenderDrawSparkles(RenderParameters const & renderParame
         if (renderParameters.DebugShipRenderMode == DebugShipRenderModeType::Wireframe)
             glLineWidth(0.1f);
 
-        assert(0 == (mSparkleVertexBuffer.size() % 6));
-        glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(mSparkleVertexBuffer.size()));
+        glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(mSparkleQuadBuffer.size() * 6));
 
         glBindVertexArray(0);
     }
@@ -1512,16 +1888,18 @@ void ShipRenderContext::RenderDrawSparkles(RenderParameters const & renderParame
 
 void ShipRenderContext::RenderPrepareGenericMipMappedTextures(RenderParameters const & /*renderParameters*/)
 {
-    size_t const nonAirBubblesTotalVertexCount = std::accumulate(
-        mGenericMipMappedTexturePlaneVertexBuffers.cbegin(),
-        mGenericMipMappedTexturePlaneVertexBuffers.cend(),
+    size_t const nonAirBubblesTotalQuadCount = std::accumulate(
+        mGenericMipMappedTexturePlaneQuadBuffers.cbegin(),
+        mGenericMipMappedTexturePlaneQuadBuffers.cend(),
         size_t(0),
-        [](size_t const total, auto const & vec)
+        [](size_t const total, auto const & plane)
         {
-            return total + vec.vertexBuffer.size();
+            return total + plane.quadBuffer.size();
         });
 
-    mGenericMipMappedTextureTotalVertexCount = mGenericMipMappedTextureAirBubbleVertexBuffer.size() + nonAirBubblesTotalVertexCount;
+    size_t const totalQuadCount = mGenericMipMappedTextureAirBubbleQuadBuffer.size() + nonAirBubblesTotalQuadCount;
+
+    mGenericMipMappedTextureTotalVertexCount = totalQuadCount * 6;
 
     if (mGenericMipMappedTextureTotalVertexCount > 0)
     {
@@ -1537,27 +1915,24 @@ void ShipRenderContext::RenderPrepareGenericMipMappedTextures(RenderParameters c
         }
 
         // Map vertex buffer
-        auto mappedBuffer = reinterpret_cast<uint8_t *>(glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY));
+        auto mappedBuffer = reinterpret_cast<GenericTextureVertex *>(glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY));
         CheckOpenGLError();
 
-        // Upload air bubbles
-        if (!mGenericMipMappedTextureAirBubbleVertexBuffer.empty())
-        {
-            size_t const byteCopySize = mGenericMipMappedTextureAirBubbleVertexBuffer.size() * sizeof(GenericTextureVertex);
-            std::memcpy(mappedBuffer, mGenericMipMappedTextureAirBubbleVertexBuffer.data(), byteCopySize);
-            mappedBuffer += byteCopySize;
-        }
-
-        // Upload all planes of other textures
-        for (auto const & plane : mGenericMipMappedTexturePlaneVertexBuffers)
-        {
-            if (!plane.vertexBuffer.empty())
+        // Generate vertices: air bubbles first, then all planes of other textures
+        GenerateQuadVertices(
+            1 + mGenericMipMappedTexturePlaneQuadBuffers.size(),
+            [this](size_t quadBufferIndex) -> auto const &
             {
-                size_t const byteCopySize = plane.vertexBuffer.size() * sizeof(GenericTextureVertex);
-                std::memcpy(mappedBuffer, plane.vertexBuffer.data(), byteCopySize);
-                mappedBuffer += byteCopySize;
-            }
-        }
+                return (quadBufferIndex == 0)
+                    ? mGenericMipMappedTextureAirBubbleQuadBuffer
+                    : mGenericMipMappedTexturePlaneQuadBuffers[quadBufferIndex - 1].quadBuffer;
+            },
+            totalQuadCount,
+            mappedBuffer,
+            [this](GenericTextureQuad const & quad, GenericTextureVertex * restrict vertices)
+            {
+                GenerateGenericMipMappedTextureQuadVertices(quad, vertices);
+            });
 
         // Unmap vertex buffer
         glUnmapBuffer(GL_ARRAY_BUFFER);
@@ -1591,15 +1966,17 @@ void ShipRenderContext::RenderDrawGenericMipMappedTextures(
 
 void ShipRenderContext::RenderPrepareExplosions(RenderParameters const & /*renderParameters*/)
 {
-    mExplosionTotalVertexCount = std::accumulate(
-        mExplosionPlaneVertexBuffers.cbegin(),
-        mExplosionPlaneVertexBuffers.cend(),
+    size_t const totalQuadCount = std::accumulate(
+        mExplosionPlaneQuadBuffers.cbegin(),
+        mExplosionPlaneQuadBuffers.cend(),
         size_t(0),
-        [](size_t const total, auto const & vec)
+        [](size_t const total, auto const & plane)
         {
-            return total + vec.vertexBuffer.size();
+            return total + plane.quadBuffer.size();
         });
 
+    mExplosionTotalVertexCount = totalQuadCount * 6;
+
     if (mExplosionTotalVertexCount > 0)
     {
         glBindBuffer(GL_ARRAY_BUFFER, *mExplosionVBO);
@@ -1614,19 +1991,19 @@ void ShipRenderContext::RenderPrepareExplosions(RenderParameters const & /*rende
         }
 
         // Map vertex buffer
-        auto mappedBuffer = reinterpret_cast<uint8_t *>(glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY));
+        auto mappedBuffer = reinterpret_cast<ExplosionVertex *>(glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY));
         CheckOpenGLError();
 
-        // Upload all planes
-        for (auto const & plane : mExplosionPlaneVertexBuffers)
-        {
-            if (!plane.vertexBuffer.empty())
+        // Generate vertices of all planes
+        GenerateQuadVertices(
+            mExplosionPlaneQuadBuffers.size(),
+            [this](size_t quadBufferIndex) -> auto const & { return mExplosionPlaneQuadBuffers[quadBufferIndex].quadBuffer; },
+            totalQuadCount,
+            mappedBuffer,
+            [this](ExplosionQuad const & quad, ExplosionVertex * restrict vertices)
             {
-                size_t const byteCopySize = plane.vertexBuffer.size() * sizeof(ExplosionVertex);
-                std::memcpy(mappedBuffer, plane.vertexBuffer.data(), byteCopySize);
-                mappedBuffer += byteCopySize;
-            }
-        }
+                GenerateExplosionQuadVertices(quad, vertices);
+            });
 
         // Unmap vertex buffer
         glUnmapBuffer(GL_ARRAY_BUFFER);
@@ -2404,4 +2781,41 @@ void ShipRenderContext::ApplyHeatOverlayTransparencyChanges(RenderParameters con
         renderParameters.HeatOverlayTransparency);
 }
 
+void ShipRenderContext::ApplyDoPackShipPointAttributesChanges(RenderParameters const & renderParameters)
+{
+    //
+    // (Re-)allocate the AttributeGroup2 VBO in the new format, and describe it
+    //
+
+    mIsPointAttributeGroup2Packed = renderParameters.DoPackShipPointAttributes;
+
+    glBindVertexArray(*mShipVAO);
+
+    glBindBuffer(GL_ARRAY_BUFFER, *mPointAttributeGroup2VBO);
+
+    if (mIsPointAttributeGroup2Packed)
+    {
+        glBufferData(GL_ARRAY_BUFFER, mPointCount * 4 * sizeof(std::uint16_t), nullptr, GL_STREAM_DRAW);
+        CheckOpenGLError();
+
+        glVertexAttribPointer(static_cast<GLuint>(VertexAttributeType::ShipPointAttributeGroup2), 4, GL_UNSIGNED_SHORT, GL_TRUE, 4 * sizeof(std::uint16_t), (void*)(0));
+        CheckOpenGLError();
+    }
+    else
+    {
+        glBufferData(GL_ARRAY_BUFFER, mPointCount * sizeof(vec4f), nullptr, GL_STREAM_DRAW);
+        CheckOpenGLError();
+
+        glVertexAttribPointer(static_cast<GLuint>(VertexAttributeType::ShipPointAttributeGroup2), 4, GL_FLOAT, GL_FALSE, sizeof(vec4f), (void*)(0));
+        CheckOpenGLError();
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glBindVertexArray(0);
+
+    // The VBO's content is now undefined, re-upload it all at next RenderPrepare
+    mPointAttributeGroup2DirtyChunks.MarkAllDirty();
+}
+
 }
\ No newline at end of file
@@ -18,10 +18,12 @@
 #include <GameOpenGL/ShaderManager.h>
 
 #include <GameCore/BoundedVector.h>
+#include <GameCore/DirtyChunkBitmap.h>
 #include <GameCore/GameTypes.h>
 #include <GameCore/ImageData.h>
 #include <GameCore/RunningAverage.h>
 #include <GameCore/SysSpecifics.h>
+#include <GameCore/TaskThreadPool.h>
 #include <GameCore/Vectors.h>
 
 #include <algorithm>
@@ -43,6 +45,17 @@ private:
     static float constexpr BasisHalfFlameQuadWidth = 10.5f * 2.0f;
     static float constexpr BasisFlameQuadHeight = 7.5f * 2.0f;
 
+    // Granularity (in points) at which we track changes to point attributes
+    static size_t constexpr PointAttributeUploadChunkSize = 256;
+
+    // Ranges of the point attributes that are normalized into AttributeGroup2;
+    // must match the SHIP_POINT_*_RANGE static shader parameters
+    static float constexpr PointWaterRange = 2.0f; // Shaders don't care about more water than this
+    static float constexpr PointTemperatureRange = 2048.0f; // Heat overlay saturates below this
+
+    // Minimum number of quads whose vertices are worth generating in a separate task
+    static size_t constexpr MinQuadsPerVertexGenerationTask = 256;
+
 public:
 
     ShipRenderContext(
@@ -53,7 +66,8 @@ public:
         ShaderManager<ShaderManagerTraits> & shaderManager,
         GlobalRenderContext const & globalRenderContext,
         RenderParameters const & renderParameters,
-        float shipFlameSizeAdjustment);
+        float shipFlameSizeAdjustment,
+        TaskThreadPool & taskThreadPool);
 
     ~ShipRenderContext();
 
@@ -84,11 +98,17 @@ public:
 
     void UploadPointMutableAttributesStart();
 
-    void UploadPointMutableAttributes(
-        vec2f const * position,
+    void UploadPointMutableAttributes(vec2f const * position);
+
+    void UploadPointMutableAttributesLight(
         float const * light,
+        size_t startDst,
+        size_t count);
+
+    void UploadPointMutableAttributesWater(
         float const * water,
-        size_t lightAndWaterCount);
+        size_t startDst,
+        size_t count);
 
     void UploadPointMutableAttributesPlaneId(
         float const * planeId,
@@ -340,18 +360,7 @@ public:
         size_t const planeIndex = static_cast<size_t>(planeId);
 
         // Pre-sized
-        assert(planeIndex < mExplosionPlaneVertexBuffers.size());
-
-        // Get this plane's vertex buffer
-        auto & vertexBuffer = mExplosionPlaneVertexBuffers[planeIndex].vertexBuffer;
-
-        //
-        // Populate the texture quad
-        //
-
-        // Resolution of atlas, for dead center calculations
-        float const dTextureX = 1.0f / (2.0f * static_cast<float>(mExplosionTextureAtlasMetadata.GetSize().Width));
-        float const dTextureY = 1.0f / (2.0f * static_cast<float>(mExplosionTextureAtlasMetadata.GetSize().Height));
+        assert(planeIndex < mExplosionPlaneQuadBuffers.size());
 
         // Calculate render half quad size - magic offset to account for
         // empty outskirts of frames
@@ -374,67 +383,10 @@ public:
         // Calculate rotation based off personality seed
         float const angleCcw = personalitySeed * 2.0f * Pi<float>;
 
-        // Append vertices - two triangles
-
-        // Triangle 1
-
-        // Top-left
-        vertexBuffer.emplace_back(
-            centerPosition,
-            vec2f(-renderHalfQuadSize, renderHalfQuadSize),
-            vec2f(0.0f + dTextureX, 1.0f - dTextureY),
-            static_cast<float>(planeId),
-            angleCcw,
-            explosionIndex,
-            progress);
-
-        // Top-Right
-        vertexBuffer.emplace_back(
-            centerPosition,
-            vec2f(renderHalfQuadSize, renderHalfQuadSize),
-            vec2f(1.0f - dTextureX, 1.0f - dTextureY),
-            static_cast<float>(planeId),
-            angleCcw,
-            explosionIndex,
-            progress);
-
-        // Bottom-left
-        vertexBuffer.emplace_back(
+        // Store quad - vertices are generated at RenderPrepare
+        mExplosionPlaneQuadBuffers[planeIndex].quadBuffer.emplace_back(
             centerPosition,
-            vec2f(-renderHalfQuadSize, -renderHalfQuadSize),
-            vec2f(0.0f + dTextureX, 0.0f + dTextureY),
-            static_cast<float>(planeId),
-            angleCcw,
-            explosionIndex,
-            progress);
-
-        // Triangle 2
-
-        // Top-Right
-        vertexBuffer.emplace_back(
-            centerPosition,
-            vec2f(renderHalfQuadSize, renderHalfQuadSize),
-            vec2f(1.0f - dTextureX, 1.0f - dTextureY),
-            static_cast<float>(planeId),
-            angleCcw,
-            explosionIndex,
-            progress);
-
-        // Bottom-left
-        vertexBuffer.emplace_back(
-            centerPosition,
-            vec2f(-renderHalfQuadSize, -renderHalfQuadSize),
-            vec2f(0.0f + dTextureX, 0.0f + dTextureY),
-            static_cast<float>(planeId),
-            angleCcw,
-            explosionIndex,
-            progress);
-
-        // Bottom-right
-        vertexBuffer.emplace_back(
-            centerPosition,
-            vec2f(renderHalfQuadSize, -renderHalfQuadSize),
-            vec2f(1.0f - dTextureX, 0.0f + dTextureY),
+            renderHalfQuadSize,
             static_cast<float>(planeId),
             angleCcw,
             explosionIndex,
@@ -451,76 +403,12 @@ public:
         vec2f const & velocityVector,
         float progress)
     {
-        //
-        // Calculate sparkle quad
-        //
-
-        float const halfQuadSide =
-            1.5f
-            * (1.0f - SmoothStep(0.5f, 0.75f, progress)); // Shrinks as time goes
-
-        // Calculate quad coordinates
-        float const leftX = position.x - halfQuadSide;
-        float const rightX = position.x + halfQuadSide;
-        float const topY = position.y - halfQuadSide;
-        float const bottomY = position.y + halfQuadSide;
-
-
-        //
-        // Store vertices
-        //
-
-        // Triangle 1
-
-        // Top-left
-        mSparkleVertexBuffer.emplace_back(
-            vec2f(leftX, topY),
-            static_cast<float>(planeId),
-            progress,
-            velocityVector,
-            vec2f(-1.0f, -1.0f));
-
-        // Top-right
-        mSparkleVertexBuffer.emplace_back(
-            vec2f(rightX, topY),
-            static_cast<float>(planeId),
-            progress,
-            velocityVector,
-            vec2f(1.0f, -1.0f));
-
-        // Bottom-left
-        mSparkleVertexBuffer.emplace_back(
-            vec2f(leftX, bottomY),
-            static_cast<float>(planeId),
-            progress,
-            velocityVector,
-            vec2f(-1.0f, 1.0f));
-
-        // Triangle 2
-
-        // Top-right
-        mSparkleVertexBuffer.emplace_back(
-            vec2f(rightX, topY),
-            static_cast<float>(planeId),
-            progress,
+        // Store quad - vertices are generated at RenderPrepare
+        mSparkleQuadBuffer.emplace_back(
+            position,
             velocityVector,
-            vec2f(1.0f, -1.0f));
-
-        // Bottom-left
-        mSparkleVertexBuffer.emplace_back(
-            vec2f(leftX, bottomY),
             static_cast<float>(planeId),
-            progress,
-            velocityVector,
-            vec2f(-1.0f, 1.0f));
-
-        // Bottom-right
-        mSparkleVertexBuffer.emplace_back(
-            vec2f(rightX, bottomY),
-            static_cast<float>(planeId),
-            progress,
-            velocityVector,
-            vec2f(1.0f, 1.0f));
+            progress);
     }
 
     //
@@ -536,14 +424,14 @@ public:
         float scale,
         float alpha)
     {
-        StoreGenericMipMappedTextureRenderSpecification(
-            planeId,
-            TextureFrameId<GenericMipMappedTextureGroups>(GenericMipMappedTextureGroups::AirBubble, 0),
+        // Store quad - vertices are generated at RenderPrepare
+        mGenericMipMappedTextureAirBubbleQuadBuffer.emplace_back(
             position,
+            TextureFrameId<GenericMipMappedTextureGroups>(GenericMipMappedTextureGroups::AirBubble, 0),
+            static_cast<float>(planeId),
             scale,
             0.0f, // angle
-            alpha,
-            mGenericMipMappedTextureAirBubbleVertexBuffer);
+            alpha);
     }
 
     inline void UploadGenericMipMappedTextureRenderSpecification(
@@ -616,20 +504,16 @@ public:
         size_t const planeIndex = static_cast<size_t>(planeId);
 
         // Pre-sized
-        assert(planeIndex < mGenericMipMappedTexturePlaneVertexBuffers.size());
+        assert(planeIndex < mGenericMipMappedTexturePlaneQuadBuffers.size());
 
-        // Get this plane's vertex buffer
-        auto & vertexBuffer = mGenericMipMappedTexturePlaneVertexBuffers[planeIndex].vertexBuffer;
-
-        // Populate the texture quad
-        StoreGenericMipMappedTextureRenderSpecification(
-            planeId,
-            textureFrameId,
+        // Store quad - vertices are generated at RenderPrepare
+        mGenericMipMappedTexturePlaneQuadBuffers[planeIndex].quadBuffer.emplace_back(
             position,
+            textureFrameId,
+            static_cast<float>(planeId),
             scale,
             angleCw,
-            alpha,
-            vertexBuffer);
+            alpha);
     }
 
     //
@@ -742,7 +626,9 @@ public:
 
     void ProcessParameterChanges(RenderParameters const & renderParameters);
 
-    void RenderPrepare(RenderParameters const & renderParameters);
+    void RenderPrepare(
+        RenderParameters const & renderParameters,
+        RenderStatistics & renderStats);
 
     void RenderDraw(
         RenderParameters const & renderParameters,
@@ -750,103 +636,17 @@ public:
 
 private:
 
-    template<typename TVertexBuffer>
-    inline void StoreGenericMipMappedTextureRenderSpecification(
-        PlaneId planeId,
-        TextureFrameId<GenericMipMappedTextureGroups> const & textureFrameId,
-        vec2f const & position,
-        float scale,
-        float angleCw,
-        float alpha,
-        TVertexBuffer & vertexBuffer)
-    {
-        //
-        // Populate the texture quad
-        //
-
-        TextureAtlasFrameMetadata<GenericMipMappedTextureGroups> const & frame =
-            mGenericMipMappedTextureAtlasMetadata.GetFrameMetadata(textureFrameId);
-
-        float const leftX = -frame.FrameMetadata.AnchorWorldX;
-        float const rightX = frame.FrameMetadata.WorldWidth - frame.FrameMetadata.AnchorWorldX;
-        float const topY = frame.FrameMetadata.WorldHeight - frame.FrameMetadata.AnchorWorldY;
-        float const bottomY = -frame.FrameMetadata.AnchorWorldY;
-
-        float const lightSensitivity =
-            frame.FrameMetadata.HasOwnAmbientLight ? 0.0f : 1.0f;
-
-        // Append vertices - two triangles
-
-        // Triangle 1
-
-        // Top-left
-        vertexBuffer.emplace_back(
-            position,
-            vec2f(leftX, topY),
-            vec2f(frame.TextureCoordinatesBottomLeft.x, frame.TextureCoordinatesTopRight.y),
-            static_cast<float>(planeId),
-            scale,
-            -angleCw,
-            alpha,
-            lightSensitivity);
-
-        // Top-Right
-        vertexBuffer.emplace_back(
-            position,
-            vec2f(rightX, topY),
-            frame.TextureCoordinatesTopRight,
-            static_cast<float>(planeId),
-            scale,
-            -angleCw,
-            alpha,
-            lightSensitivity);
-
-        // Bottom-left
-        vertexBuffer.emplace_back(
-            position,
-            vec2f(leftX, bottomY),
-            frame.TextureCoordinatesBottomLeft,
-            static_cast<float>(planeId),
-            scale,
-            -angleCw,
-            alpha,
-            lightSensitivity);
-
-        // Triangle 2
-
-        // Top-Right
-        vertexBuffer.emplace_back(
-            position,
-            vec2f(rightX, topY),
-            frame.TextureCoordinatesTopRight,
-            static_cast<float>(planeId),
-            scale,
-            -angleCw,
-            alpha,
-            lightSensitivity);
+    //
+    // Quad vertex generation
+    //
 
-        // Bottom-left
-        vertexBuffer.emplace_back(
-            position,
-            vec2f(leftX, bottomY),
-            frame.TextureCoordinatesBottomLeft,
-            static_cast<float>(planeId),
-            scale,
-            -angleCw,
-            alpha,
-            lightSensitivity);
-
-        // Bottom-right
-        vertexBuffer.emplace_back(
-            position,
-            vec2f(rightX, bottomY),
-            vec2f(frame.TextureCoordinatesTopRight.x, frame.TextureCoordinatesBottomLeft.y),
-            static_cast<float>(planeId),
-            scale,
-            -angleCw,
-            alpha,
-            lightSensitivity);
-    }
+    template<typename TVertex, typename TGetQuadBuffer, typename TGenerateQuadVertices>
+    void GenerateQuadVertices(
+        size_t quadBufferCount,
+        TGetQuadBuffer const & getQuadBuffer,
+        size_t totalQuadCount,
+        TVertex * restrict vertices,
+        TGenerateQuadVertices const & generateQuadVertices);
 
 private:
 
@@ -881,6 +681,7 @@ private:
     void ApplyWaterContrastChanges(RenderParameters const & renderParameters);
     void ApplyWaterLevelOfDetailChanges(RenderParameters const & renderParameters);
     void ApplyHeatOverlayTransparencyChanges(RenderParameters const & renderParameters);
+    void ApplyDoPackShipPointAttributesChanges(RenderParameters const & renderParameters);
 
 private:
 
@@ -1054,16 +855,102 @@ private:
 
 #pragma pack(pop)
 
+    //
+    // Quads, as specified at upload time; their vertices are
+    // generated at RenderPrepare time, directly into the VBOs
+    //
+
+    struct ExplosionQuad
+    {
+        vec2f centerPosition;
+        float halfQuadSize;
+        float planeId;
+        float angle;
+        float explosionIndex;
+        float progress;
+
+        ExplosionQuad(
+            vec2f _centerPosition,
+            float _halfQuadSize,
+            float _planeId,
+            float _angle,
+            float _explosionIndex,
+            float _progress)
+            : centerPosition(_centerPosition)
+            , halfQuadSize(_halfQuadSize)
+            , planeId(_planeId)
+            , angle(_angle)
+            , explosionIndex(_explosionIndex)
+            , progress(_progress)
+        {}
+    };
+
+    struct SparkleQuad
+    {
+        vec2f position;
+        vec2f velocityVector;
+        float planeId;
+        float progress;
+
+        SparkleQuad(
+            vec2f _position,
+            vec2f _velocityVector,
+            float _planeId,
+            float _progress)
+            : position(_position)
+            , velocityVector(_velocityVector)
+            , planeId(_planeId)
+            , progress(_progress)
+        {}
+    };
+
+    struct GenericTextureQuad
+    {
+        vec2f position;
+        TextureFrameId<GenericMipMappedTextureGroups> textureFrameId;
+        float planeId;
+        float scale;
+        float angleCw;
+        float alpha;
+
+        GenericTextureQuad(
+            vec2f _position,
+            TextureFrameId<GenericMipMappedTextureGroups> _textureFrameId,
+            float _planeId,
+            float _scale,
+            float _angleCw,
+            float _alpha)
+            : position(_position)
+            , textureFrameId(_textureFrameId)
+            , planeId(_planeId)
+            , scale(_scale)
+            , angleCw(_angleCw)
+            , alpha(_alpha)
+        {}
+    };
+
     struct ExplosionPlaneData
     {
-        std::vector<ExplosionVertex> vertexBuffer;
+        std::vector<ExplosionQuad> quadBuffer;
     };
 
     struct GenericTexturePlaneData
     {
-        std::vector<GenericTextureVertex> vertexBuffer;
+        std::vector<GenericTextureQuad> quadBuffer;
     };
 
+    inline void GenerateExplosionQuadVertices(
+        ExplosionQuad const & quad,
+        ExplosionVertex * restrict vertices) const;
+
+    inline void GenerateSparkleQuadVertices(
+        SparkleQuad const & quad,
+        SparkleVertex * restrict vertices) const;
+
+    inline void GenerateGenericMipMappedTextureQuadVertices(
+        GenericTextureQuad const & quad,
+        GenericTextureVertex * restrict vertices) const;
+
     //
     // Buffers
     //
@@ -1071,12 +958,19 @@ private:
     std::unique_ptr<vec4f> mPointAttributeGroup1Buffer; // Position, TextureCoordinates
     GameOpenGLVBO mPointAttributeGroup1VBO;
 
-    std::unique_ptr<vec4f> mPointAttributeGroup2Buffer; // Light, Water, PlaneId, Decay
+    std::unique_ptr<vec4f> mPointAttributeGroup2Buffer; // Light, Water, Decay, Temperature - normalized
+    std::unique_ptr<std::uint16_t[]> mPointAttributeGroup2PackedBuffer; // AttributeGroup2 quantized to 16-bit normalized integers
     GameOpenGLVBO mPointAttributeGroup2VBO;
+    DirtyChunkBitmap<PointAttributeUploadChunkSize> mPointAttributeGroup2DirtyChunks; // Chunks changed since last RenderPrepare
+    bool mIsPointAttributeGroup2Packed; // The format of the VBO
 
     GameOpenGLVBO mPointColorVBO;
 
-    GameOpenGLVBO mPointTemperatureVBO;
+    std::unique_ptr<float[]> mPointPlaneIdBuffer;
+    GameOpenGLVBO mPointPlaneIdVBO;
+    DirtyChunkBitmap<PointAttributeUploadChunkSize> mPointPlaneIdDirtyChunks; // Chunks changed since last RenderPrepare
+
+    size_t mPointAttributeUploadedBytes; // Since last RenderPrepare; for stats
 
     std::vector<LineElement> mStressedSpringElementBuffer;
     GameOpenGLVBO mStressedSpringElementVBO;
@@ -1091,17 +985,17 @@ private:
     float mFlameWindSpeedMagnitudeAverage;
     bool mIsFlameWindSpeedMagnitudeAverageDirty;
 
-    std::vector<ExplosionPlaneData> mExplosionPlaneVertexBuffers;
+    std::vector<ExplosionPlaneData> mExplosionPlaneQuadBuffers;
     size_t mExplosionTotalVertexCount; // Calculated at RenderPrepare and cached for convenience
     GameOpenGLVBO mExplosionVBO;
     size_t mExplosionVBOAllocatedVertexSize;
 
-    std::vector<SparkleVertex> mSparkleVertexBuffer;
+    std::vector<SparkleQuad> mSparkleQuadBuffer;
     GameOpenGLVBO mSparkleVBO;
     size_t mSparkleVBOAllocatedVertexSize;
 
-    std::vector<GenericTextureVertex> mGenericMipMappedTextureAirBubbleVertexBuffer; // Specifically for air bubbles; mixed planes
-    std::vector<GenericTexturePlaneData> mGenericMipMappedTexturePlaneVertexBuffers; // For all other generic textures; separate buffers per-plane
+    std::vector<GenericTextureQuad> mGenericMipMappedTextureAirBubbleQuadBuffer; // Specifically for air bubbles; mixed planes
+    std::vector<GenericTexturePlaneData> mGenericMipMappedTexturePlaneQuadBuffers; // For all other generic textures; separate buffers per-plane
     size_t mGenericMipMappedTextureTotalVertexCount; // Calculated at RenderPrepare and cached for convenience
     GameOpenGLVBO mGenericMipMappedTextureVBO;
     size_t mGenericMipMappedTextureVBOAllocatedVertexSize;    
@@ -1172,6 +1066,11 @@ private:
     //
 
     ShaderManager<ShaderManagerTraits> & mShaderManager;
+    TaskThreadPool & mTaskThreadPool;
+
+    // Scratch buffers for quad vertex generation
+    std::vector<size_t> mQuadBufferStartIndices;
+    std::vector<TaskThreadPool::Task> mVertexGenerationTasks;
 
     //
     // Externally-controlled parameters that only affect Upload (i.e. that do
@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <unordered_set>
 
 size_t constexpr MaterialTextureCacheSizeHighWatermark = 40;
 size_t constexpr MaterialTextureCacheSizeLowWatermark = 25;
@@ -26,6 +27,67 @@ namespace /*anonymous*/ {
             ? x1 * 2.0f * x2                        // Damper: x1 * [0.0, 1.0]
             : x1 + (x2 - x1) * 2.0f * (x2 - 0.5f);  // Amplifier:x1 + (x2 - x1) * [0.0, 1.0]
     }
+
+#if defined(FS_ARCHITECTURE_X86_32) || defined(FS_ARCHITECTURE_X86_64)
+
+    inline __m128 LoadVec3f_SSE(vec3f const & v)
+    {
+        return _mm_setr_ps(v.x, v.y, v.z, 0.0f);
+    }
+
+    inline __m128 Mix_SSE(__m128 val1, __m128 val2, __m128 x)
+    {
+        // val1 * (1.0f - x) + val2 * x
+        return _mm_add_ps(
+            _mm_mul_ps(val1, _mm_sub_ps(_mm_set1_ps(1.0f), x)),
+            _mm_mul_ps(val2, x));
+    }
+
+    /*
+     * Blends all three channels at once, calculating both the damper and the amplifier
+     * and then selecting each channel's result according to its x2 value.
+     */
+    inline __m128 BidirMultiplyBlend_SSE(__m128 x1, __m128 x2)
+    {
+        __m128 const Half = _mm_set1_ps(0.5f);
+        __m128 const Two = _mm_set1_ps(2.0f);
+
+        __m128 const damper = _mm_mul_ps(_mm_mul_ps(x1, Two), x2);
+        __m128 const amplifier = _mm_add_ps(
+            x1,
+            _mm_mul_ps(
+                _mm_mul_ps(_mm_sub_ps(x2, x1), Two),
+                _mm_sub_ps(x2, Half)));
+
+        __m128 const isDamperMask = _mm_cmple_ps(x2, Half);
+
+        return _mm_or_ps(
+            _mm_and_ps(isDamperMask, damper),
+            _mm_andnot_ps(isDamperMask, amplifier));
+    }
+
+    /*
+     * Converts the three [0.0, 1.0] channels to bytes, and adds the specified alpha.
+     */
+    inline rgbaColor ToRgbaColor_SSE(__m128 c, rgbaColor::data_type alpha)
+    {
+        __m128i const ci = _mm_cvttps_epi32(
+            _mm_add_ps(
+                _mm_mul_ps(c, _mm_set1_ps(255.0f)),
+                _mm_set1_ps(0.5f)));
+
+        // Pack 32 -> 16 -> 8, with saturation
+        __m128i const packed = _mm_packus_epi16(_mm_packs_epi32(ci, ci), _mm_setzero_si128());
+        uint32_t const rgb = static_cast<uint32_t>(_mm_cvtsi128_si32(packed));
+
+        return rgbaColor(
+            static_cast<rgbaColor::data_type>(rgb),
+            static_cast<rgbaColor::data_type>(rgb >> 8),
+            static_cast<rgbaColor::data_type>(rgb >> 16),
+            alpha);
+    }
+
+#endif
 }
 
 ShipTexturizer::ShipTexturizer(ResourceLocator const & resourceLocator)
@@ -60,8 +122,16 @@ RgbaImageData ShipTexturizer::Texturize(
     std::optional<ShipAutoTexturizationSettings> const & shipDefinitionSettings,
     ImageSize const & structureSize,
     ShipBuildPointIndexMatrix const & pointMatrix, // One more point on each side, to avoid checking for boundaries
-    std::vector<ShipBuildPoint> const & points) const
+    std::vector<ShipBuildPoint> const & points,
+    TaskThreadPool & taskThreadPool) const
 {
+    // Make room in the cache, if needed; we only do this here, before
+    // starting our parallel tasks, as the tasks hold references to cached textures
+    if (mMaterialTextureCache.size() >= MaterialTextureCacheSizeHighWatermark)
+    {
+        PurgeMaterialTextureCache(MaterialTextureCacheSizeLowWatermark);
+    }
+
     // Zero-out cache usage counts
     ResetMaterialTextureCacheUseCounts();
 
@@ -75,7 +145,6 @@ RgbaImageData ShipTexturizer::Texturize(
     assert(maxDimension > 0);
 
     int const magnificationFactor = std::min(32, std::max(1, 4096 / maxDimension));
-    float const magnificationFactorInvF = 1.0f / static_cast<float>(magnificationFactor);
 
     ImageSize const textureSize = structureSize * magnificationFactor;
 
@@ -93,14 +162,113 @@ RgbaImageData ShipTexturizer::Texturize(
     float const materialTextureAlpha = 1.0f - settings.MaterialTextureTransparency;
 
     //
-    // Create texture
+    // Pre-load all the material textures we need, on this thread - so that
+    // loading errors are reported to our caller, and parallel tasks only
+    // find textures in the cache
+    //
+
+    if (settings.Mode == ShipAutoTexturizationModeType::MaterialTextures)
+    {
+        std::unordered_set<StructuralMaterial const *> seenMaterials;
+        for (auto const & point : points)
+        {
+            if (seenMaterials.insert(&(point.StructuralMtl)).second)
+            {
+                GetMaterialTexture(point.StructuralMtl.MaterialTextureName);
+            }
+        }
+    }
+
+    //
+    // Create texture, one band of rows per task
     //
 
     auto newImageData = std::make_unique<rgbaColor[]>(textureSize.GetPixelCount());
 
     auto const startTime = std::chrono::steady_clock::now();
 
-    for (int y = 1; y <= structureSize.Height; ++y)
+    int const parallelism = static_cast<int>(taskThreadPool.GetParallelism());
+    int const rowsPerTask = std::max(1, (structureSize.Height + parallelism - 1) / parallelism);
+
+    std::vector<TaskThreadPool::Task> tasks;
+    for (int y = 1; y <= structureSize.Height; y += rowsPerTask)
+    {
+        tasks.emplace_back(
+            [&, startY = y, endY = std::min(y + rowsPerTask, structureSize.Height + 1)]()
+            {
+                TexturizeRows(
+                    startY,
+                    endY,
+                    settings.Mode,
+                    structureSize,
+                    pointMatrix,
+                    points,
+                    magnificationFactor,
+                    materialTextureWorldToPixelConversionFactor,
+                    materialTextureAlpha,
+                    textureSize,
+                    newImageData.get());
+            });
+    }
+
+    taskThreadPool.Run(tasks);
+
+    LogMessage("ShipTexturizer: completed auto-texturization:",
+        " materialTextureMagnification=", settings.MaterialTextureMagnification,
+        " structureSize=", structureSize, " textureSize=", textureSize, " magFactor=", magnificationFactor,
+        " tasks=", tasks.size(),
+        " time=", std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count(), "us");
+
+    return RgbaImageData(textureSize, std::move(newImageData));
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+
+std::unordered_map<std::string, std::filesystem::path> ShipTexturizer::MakeMaterialTextureNameToTextureFilePathMap(std::filesystem::path const materialTexturesFolderPath)
+{
+    std::unordered_map<std::string, std::filesystem::path> materialTextureNameToTextureFilePath;
+
+    for (auto const & entryIt : std::filesystem::directory_iterator(materialTexturesFolderPath))
+    {
+        if (std::filesystem::is_regular_file(entryIt.path()))
+        {
+            std::string const textureName = entryIt.path().stem().string();
+
+            assert(materialTextureNameToTextureFilePath.count(textureName) == 0);
+            materialTextureNameToTextureFilePath[textureName] = entryIt.path();
+        }
+    }
+
+    return materialTextureNameToTextureFilePath;
+}
+
+float ShipTexturizer::MaterialTextureMagnificationToPixelConversionFactor(float magnification)
+{
+    // Magic number
+    return 1.0f / (0.08f * magnification);
+}
+
+void ShipTexturizer::TexturizeRows(
+    int startY,
+    int endY,
+    ShipAutoTexturizationModeType mode,
+    ImageSize const & structureSize,
+    ShipBuildPointIndexMatrix const & pointMatrix,
+    std::vector<ShipBuildPoint> const & points,
+    int magnificationFactor,
+    float materialTextureWorldToPixelConversionFactor,
+    float materialTextureAlpha,
+    ImageSize const & textureSize,
+    rgbaColor * restrict textureImageData) const
+{
+    float const magnificationFactorInvF = 1.0f / static_cast<float>(magnificationFactor);
+
+    // Runs of pixels with the same material are very common,
+    // so we remember the last texture we've looked up
+    StructuralMaterial const * lastMaterial = nullptr;
+    Vec3fImageData const * lastMaterialTexture = nullptr;
+
+    for (int y = startY; y < endY; ++y)
     {
         for (int x = 1; x <= structureSize.Width; ++x)
         {
@@ -109,7 +277,7 @@ RgbaImageData ShipTexturizer::Texturize(
                 ? rgbaColor(points[*pointMatrix[x][y]].StructuralMtl.RenderColor)
                 : rgbaColor::zero(); // Fully transparent
 
-            if (settings.Mode == ShipAutoTexturizationModeType::FlatStructure
+            if (mode == ShipAutoTexturizationModeType::FlatStructure
                 || !pointMatrix[x][y].has_value())
             {
                 //
@@ -125,7 +293,7 @@ RgbaImageData ShipTexturizer::Texturize(
 
                     for (int xx = 0; xx < magnificationFactor; ++xx)
                     {
-                        newImageData[quadOffset + xx] = structurePixelColor;
+                        textureImageData[quadOffset + xx] = structurePixelColor;
                     }
                 }
             }
@@ -135,13 +303,18 @@ RgbaImageData ShipTexturizer::Texturize(
                 // Material textures
                 //
 
-                assert(settings.Mode == ShipAutoTexturizationModeType::MaterialTextures);
-
-                vec3f const structurePixelColorF = structurePixelColor.toVec3f();
+                assert(mode == ShipAutoTexturizationModeType::MaterialTextures);
 
                 // Get bump map texture
                 assert(pointMatrix[x][y].has_value());
-                Vec3fImageData const & materialTexture = GetMaterialTexture(points[*pointMatrix[x][y]].StructuralMtl.MaterialTextureName);
+                StructuralMaterial const & structuralMaterial = points[*pointMatrix[x][y]].StructuralMtl;
+                if (&structuralMaterial != lastMaterial)
+                {
+                    lastMaterialTexture = &GetMaterialTexture(structuralMaterial.MaterialTextureName);
+                    lastMaterial = &structuralMaterial;
+                }
+
+                Vec3fImageData const & materialTexture = *lastMaterialTexture;
 
                 //
                 // Fill quad with color multiply-blended with "bump map" texture
@@ -149,6 +322,13 @@ RgbaImageData ShipTexturizer::Texturize(
 
                 int const baseTargetQuadOffset = ((x - 1) + (y - 1) * textureSize.Width) * magnificationFactor;
 
+#if defined(FS_ARCHITECTURE_X86_32) || defined(FS_ARCHITECTURE_X86_64)
+                __m128 const structurePixelColor_SSE = LoadVec3f_SSE(structurePixelColor.toVec3f());
+                __m128 const materialTextureAlpha_SSE = _mm_set1_ps(materialTextureAlpha);
+#else
+                vec3f const structurePixelColorF = structurePixelColor.toVec3f();
+#endif
+
                 float worldY = static_cast<float>(y - 1);
                 for (int yy = 0; yy < magnificationFactor; ++yy, worldY += magnificationFactorInvF)
                 {
@@ -157,6 +337,24 @@ RgbaImageData ShipTexturizer::Texturize(
                     float worldX = static_cast<float>(x - 1);
                     for (int xx = 0; xx < magnificationFactor; ++xx, worldX += magnificationFactorInvF)
                     {
+#if defined(FS_ARCHITECTURE_X86_32) || defined(FS_ARCHITECTURE_X86_64)
+                        __m128 const bumpMapSample = SampleTexture_SSE(
+                            materialTexture,
+                            worldX * materialTextureWorldToPixelConversionFactor,
+                            worldY * materialTextureWorldToPixelConversionFactor);
+
+                        // Bi-directional multiply blending
+                        __m128 const resultantColor = BidirMultiplyBlend_SSE(structurePixelColor_SSE, bumpMapSample);
+
+                        // Store resultant color, using structure's alpha channel value,
+                        // and blended with transparency
+                        textureImageData[targetQuadOffset + xx] = ToRgbaColor_SSE(
+                            Mix_SSE(
+                                structurePixelColor_SSE,
+                                resultantColor,
+                                materialTextureAlpha_SSE),
+                            structurePixelColor.a);
+#else
                         vec3f const bumpMapSample = SampleTexture(
                             materialTexture,
                             worldX * materialTextureWorldToPixelConversionFactor,
@@ -176,55 +374,25 @@ RgbaImageData ShipTexturizer::Texturize(
 
                         // Store resultant color, using structure's alpha channel value,
                         // and blended with transparency
-                        newImageData[targetQuadOffset + xx] = rgbaColor(
+                        textureImageData[targetQuadOffset + xx] = rgbaColor(
                             Mix(structurePixelColorF,
                                 resultantColorF,
                                 materialTextureAlpha),
                             structurePixelColor.a);
+#endif
                     }
                 }
             }
         }
     }
-
-    LogMessage("ShipTexturizer: completed auto-texturization:",
-        " materialTextureMagnification=", settings.MaterialTextureMagnification,
-        " structureSize=", structureSize, " textureSize=", textureSize, " magFactor=", magnificationFactor,
-        " time=", std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count(), "us");
-
-    return RgbaImageData(textureSize, std::move(newImageData));
-}
-
-///////////////////////////////////////////////////////////////////////////////////
-
-std::unordered_map<std::string, std::filesystem::path> ShipTexturizer::MakeMaterialTextureNameToTextureFilePathMap(std::filesystem::path const materialTexturesFolderPath)
-{
-    std::unordered_map<std::string, std::filesystem::path> materialTextureNameToTextureFilePath;
-
-    for (auto const & entryIt : std::filesystem::directory_iterator(materialTexturesFolderPath))
-    {
-        if (std::filesystem::is_regular_file(entryIt.path()))
-        {
-            std::string const textureName = entryIt.path().stem().string();
-
-            assert(materialTextureNameToTextureFilePath.count(textureName) == 0);
-            materialTextureNameToTextureFilePath[textureName] = entryIt.path();
-        }
-    }
-
-    return materialTextureNameToTextureFilePath;
-}
-
-float ShipTexturizer::MaterialTextureMagnificationToPixelConversionFactor(float magnification)
-{
-    // Magic number
-    return 1.0f / (0.08f * magnification);
 }
 
 Vec3fImageData const & ShipTexturizer::GetMaterialTexture(std::optional<std::string> const & textureName) const
 {
     std::string const actualTextureName = textureName.value_or("none");
 
+    std::lock_guard<std::mutex> const lock(mMaterialTextureCacheMutex);
+
     auto const & it = mMaterialTextureCache.find(actualTextureName);
     if (it != mMaterialTextureCache.end())
     {
@@ -236,11 +404,9 @@ Vec3fImageData const & ShipTexturizer::GetMaterialTexture(std::optional<std::str
     {
         // Have to load texture
 
-        // Check whether need to make room in the cache, first
-        if (mMaterialTextureCache.size() + 1 >= MaterialTextureCacheSizeHighWatermark)
-        {
-            PurgeMaterialTextureCache(MaterialTextureCacheSizeLowWatermark);
-        }
+        // Note: we don't make room in the cache here, as other threads
+        // might be using cached textures; the cache is purged at
+        // the beginning of each Texturize() instead
 
         // Load and cache texture
         assert(mMaterialTextureNameToTextureFilePathMap.count(actualTextureName) > 0);
@@ -343,4 +509,54 @@ vec3f ShipTexturizer::SampleTexture(
         interpolatedXColorBottom,
         interpolatedXColorTop,
         pixelDy);
-}
\ No newline at end of file
+}
+
+#if defined(FS_ARCHITECTURE_X86_32) || defined(FS_ARCHITECTURE_X86_64)
+
+__m128 ShipTexturizer::SampleTexture_SSE(
+    Vec3fImageData const & texture,
+    float pixelX,
+    float pixelY) const
+{
+    // Integral part
+    auto pixelXI = FastTruncateToArchInt(pixelX);
+    auto pixelYI = FastTruncateToArchInt(pixelY);
+
+    // Fractional part between index and next index
+    __m128 const pixelDx = _mm_set1_ps(pixelX - pixelXI);
+    __m128 const pixelDy = _mm_set1_ps(pixelY - pixelYI);
+
+    // Wrap integral coordinates
+    pixelXI %= static_cast<decltype(pixelXI)>(texture.Size.Width);
+    pixelYI %= static_cast<decltype(pixelYI)>(texture.Size.Height);
+
+    assert(pixelXI >= 0 && pixelXI < texture.Size.Width);
+    assert(pixelYI >= 0 && pixelYI < texture.Size.Height);
+
+    //
+    // Bilinear, on all three channels at once
+    //
+
+    int const nextPixelXI = (pixelXI + 1) % static_cast<decltype(pixelXI)>(texture.Size.Width);
+    int const nextPixelYI = (pixelYI + 1) % static_cast<decltype(pixelYI)>(texture.Size.Height);
+
+    // Linear interpolation between x samples at bottom
+    __m128 const interpolatedXColorBottom = Mix_SSE(
+        LoadVec3f_SSE(texture.Data[pixelXI + pixelYI * texture.Size.Width]),
+        LoadVec3f_SSE(texture.Data[nextPixelXI + pixelYI * texture.Size.Width]),
+        pixelDx);
+
+    // Linear interpolation between x samples at top
+    __m128 const interpolatedXColorTop = Mix_SSE(
+        LoadVec3f_SSE(texture.Data[pixelXI + nextPixelYI * texture.Size.Width]),
+        LoadVec3f_SSE(texture.Data[nextPixelXI + nextPixelYI * texture.Size.Width]),
+        pixelDx);
+
+    // Linear interpolation between two vertical samples
+    return Mix_SSE(
+        interpolatedXColorBottom,
+        interpolatedXColorTop,
+        pixelDy);
+}
+
+#endif
@@ -11,10 +11,13 @@
 
 #include <GameCore/GameTypes.h>
 #include <GameCore/ImageData.h>
+#include <GameCore/SysSpecifics.h>
+#include <GameCore/TaskThreadPool.h>
 #include <GameCore/Vectors.h>
 
 #include <cassert>
 #include <filesystem>
+#include <mutex>
 #include <optional>
 #include <unordered_map>
 
@@ -30,7 +33,8 @@ public:
         std::optional<ShipAutoTexturizationSettings> const & shipDefinitionSettings,
         ImageSize const & structureSize,
         ShipBuildPointIndexMatrix const & pointMatrix, // One more point on each side, to avoid checking for boundaries
-        std::vector<ShipBuildPoint> const & points) const;
+        std::vector<ShipBuildPoint> const & points,
+        TaskThreadPool & taskThreadPool) const;
 
     //
     // Settings
@@ -67,7 +71,21 @@ private:
 
     static float MaterialTextureMagnificationToPixelConversionFactor(float magnification);
 
-    inline Vec3fImageData const & GetMaterialTexture(std::optional<std::string> const & textureName) const;
+    void TexturizeRows(
+        int startY,
+        int endY,
+        ShipAutoTexturizationModeType mode,
+        ImageSize const & structureSize,
+        ShipBuildPointIndexMatrix const & pointMatrix,
+        std::vector<ShipBuildPoint> const & points,
+        int magnificationFactor,
+        float materialTextureWorldToPixelConversionFactor,
+        float materialTextureAlpha,
+        ImageSize const & textureSize,
+        rgbaColor * restrict textureImageData) const;
+
+    // Thread-safe
+    Vec3fImageData const & GetMaterialTexture(std::optional<std::string> const & textureName) const;
 
     void ResetMaterialTextureCacheUseCounts() const;
 
@@ -78,6 +96,13 @@ private:
         float pixelX,
         float pixelY) const;
 
+#if defined(FS_ARCHITECTURE_X86_32) || defined(FS_ARCHITECTURE_X86_64)
+    inline __m128 SampleTexture_SSE(
+        Vec3fImageData const & texture,
+        float pixelX,
+        float pixelY) const;
+#endif
+
 private:
 
     //
@@ -107,4 +132,9 @@ private:
     };
 
     mutable std::unordered_map<std::string, CachedTexture> mMaterialTextureCache;
+
+    // Protects the cache while texturizing in parallel; the cache
+    // is only purged outside of parallel sections, hence references
+    // to cached textures are stable for the duration of a Texturize()
+    mutable std::mutex mMaterialTextureCacheMutex;
 };
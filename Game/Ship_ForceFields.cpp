@@ -5,44 +5,344 @@
 ***************************************************************************************/
 #include "Physics.h"
 
+#include <GameCore/AABB.h>
 #include <GameCore/GameMath.h>
+#include <GameCore/GameRandomEngine.h>
+#include <GameCore/SysSpecifics.h>
 
 #include <algorithm>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+// The number of contiguous points in each block that we visit at once
+// when applying force fields
+static constexpr ElementCount ForceFieldPointBlockSize = 64;
 
 namespace Physics {
 
-void Ship::ApplyDrawForceField(
+void Ship::QueueDrawForceField(
+    vec2f const & centerPosition,
+    float strength)
+{
+    mQueuedForceFields.emplace_back(
+        ForceFieldType::Draw,
+        centerPosition,
+        strength);
+}
+
+void Ship::QueueSwirlForceField(
+    vec2f const & centerPosition,
+    float strength)
+{
+    mQueuedForceFields.emplace_back(
+        ForceFieldType::Swirl,
+        centerPosition,
+        strength);
+}
+
+void Ship::QueueBlastForceField(
+    vec2f const & centerPosition,
+    float blastRadius,
+    float strength,
+    float blastHeat,
+    bool doDetachPoint)
+{
+    mQueuedForceFields.emplace_back(
+        ForceFieldType::Blast,
+        centerPosition,
+        strength,
+        blastRadius,
+        0.0f,
+        blastHeat,
+        doDetachPoint);
+}
+
+void Ship::QueueRadialSpaceWarpForceField(
     vec2f const & centerPosition,
+    float radius,
+    float radiusThickness,
     float strength)
+{
+    mQueuedForceFields.emplace_back(
+        ForceFieldType::RadialSpaceWarp,
+        centerPosition,
+        strength,
+        radius,
+        radiusThickness);
+}
+
+void Ship::QueueImplosionForceField(
+    vec2f const & centerPosition,
+    float strength)
+{
+    mQueuedForceFields.emplace_back(
+        ForceFieldType::Implosion,
+        centerPosition,
+        strength);
+}
+
+void Ship::QueueRadialExplosionForceField(
+    vec2f const & centerPosition,
+    float strength)
+{
+    mQueuedForceFields.emplace_back(
+        ForceFieldType::RadialExplosion,
+        centerPosition,
+        strength);
+}
+
+void Ship::ApplyQueuedForceFields(
+    float currentSimulationTime,
+    GameParameters const & gameParameters)
+{
+    if (mQueuedForceFields.empty())
+    {
+        // Nothing to do
+        return;
+    }
+
+    //
+    // Calculate the extent of each field; fields without a radius
+    // extend to all points
+    //
+
+    std::vector<std::optional<Geometry::AABB>> fieldBoundingBoxes;
+    fieldBoundingBoxes.reserve(mQueuedForceFields.size());
+
+    bool hasBoundedFields = false;
+
+    for (auto const & forceField : mQueuedForceFields)
+    {
+        std::optional<float> fieldRadius;
+        switch (forceField.Type)
+        {
+            case ForceFieldType::Blast:
+            {
+                // Heat is injected in a larger radius than the blast's
+                fieldRadius = forceField.Radius * 1.23f; // ~ sqrt(1.5), rounded up
+                break;
+            }
+
+            case ForceFieldType::RadialSpaceWarp:
+            {
+                fieldRadius = forceField.Radius + forceField.RadiusThickness;
+                break;
+            }
+
+            case ForceFieldType::Draw:
+            case ForceFieldType::Swirl:
+            case ForceFieldType::Implosion:
+            case ForceFieldType::RadialExplosion:
+            {
+                break;
+            }
+        }
+
+        if (fieldRadius.has_value())
+        {
+            fieldBoundingBoxes.emplace_back(
+                Geometry::AABB(
+                    forceField.CenterPosition.x - *fieldRadius,
+                    forceField.CenterPosition.x + *fieldRadius,
+                    forceField.CenterPosition.y + *fieldRadius,
+                    forceField.CenterPosition.y - *fieldRadius));
+
+            hasBoundedFields = true;
+        }
+        else
+        {
+            fieldBoundingBoxes.emplace_back(std::nullopt);
+        }
+    }
+
+    // The non-ephemeral point that is closest to the center of each blast;
+    // we'll eventually detach it
+    std::vector<std::pair<float, ElementIndex>> blastClosestPoints(
+        mQueuedForceFields.size(),
+        std::make_pair(std::numeric_limits<float>::max(), NoneElementIndex));
+
+    //
+    // Visit all blocks of points, applying all the fields that may affect each block
+    //
+
+    ElementCount const pointCount = mPoints.GetElementCount();
+    ElementCount const rawShipPointCount = mPoints.GetRawShipPointCount();
+
+    for (ElementIndex blockStart = 0; blockStart < pointCount; blockStart += ForceFieldPointBlockSize)
+    {
+        ElementIndex const blockEnd = std::min(blockStart + ForceFieldPointBlockSize, pointCount);
+
+        // Calculate the bounding box of the block, but only if we may cull with it
+        Geometry::AABB blockBoundingBox;
+        if (hasBoundedFields)
+        {
+            for (ElementIndex p = blockStart; p < blockEnd; ++p)
+            {
+                blockBoundingBox.ExtendTo(mPoints.GetPosition(p));
+            }
+        }
+
+        for (size_t f = 0; f < mQueuedForceFields.size(); ++f)
+        {
+            if (fieldBoundingBoxes[f].has_value()
+                && !fieldBoundingBoxes[f]->Overlaps(blockBoundingBox))
+            {
+                // The field cannot affect any point of this block
+                continue;
+            }
+
+            auto const & forceField = mQueuedForceFields[f];
+            switch (forceField.Type)
+            {
+                case ForceFieldType::Draw:
+                {
+                    ApplyDrawForceField(
+                        forceField.CenterPosition,
+                        forceField.Strength,
+                        blockStart,
+                        blockEnd);
+
+                    break;
+                }
+
+                case ForceFieldType::Swirl:
+                {
+                    ApplySwirlForceField(
+                        forceField.CenterPosition,
+                        forceField.Strength,
+                        blockStart,
+                        blockEnd);
+
+                    break;
+                }
+
+                case ForceFieldType::Blast:
+                {
+                    // Non-ephemeral points only (ephemerals would be blown immediately away otherwise)
+                    ApplyBlastForceField(
+                        forceField.CenterPosition,
+                        forceField.Radius,
+                        forceField.Strength,
+                        forceField.BlastHeat,
+                        blockStart,
+                        std::min(blockEnd, rawShipPointCount),
+                        blastClosestPoints[f].first,
+                        blastClosestPoints[f].second);
+
+                    break;
+                }
+
+                case ForceFieldType::RadialSpaceWarp:
+                {
+                    ApplyRadialSpaceWarpForceField(
+                        forceField.CenterPosition,
+                        forceField.Radius,
+                        forceField.RadiusThickness,
+                        forceField.Strength,
+                        blockStart,
+                        blockEnd);
+
+                    break;
+                }
+
+                case ForceFieldType::Implosion:
+                {
+                    ApplyImplosionForceField(
+                        forceField.CenterPosition,
+                        forceField.Strength,
+                        blockStart,
+                        blockEnd);
+
+                    break;
+                }
+
+                case ForceFieldType::RadialExplosion:
+                {
+                    ApplyRadialExplosionForceField(
+                        forceField.CenterPosition,
+                        forceField.Strength,
+                        blockStart,
+                        blockEnd);
+
+                    break;
+                }
+            }
+        }
+    }
+
+    //
+    // Eventually detach the closest point of each blast
+    //
+
+    for (size_t f = 0; f < mQueuedForceFields.size(); ++f)
+    {
+        if (mQueuedForceFields[f].Type == ForceFieldType::Blast
+            && mQueuedForceFields[f].DoDetachPoint
+            && NoneElementIndex != blastClosestPoints[f].second)
+        {
+            // Choose a detach velocity - using the same distribution as Debris
+            vec2f detachVelocity = GameRandomEngine::GetInstance().GenerateUniformRadialVector(
+                GameParameters::MinDebrisParticlesVelocity,
+                GameParameters::MaxDebrisParticlesVelocity);
+
+            // Detach point
+            mPoints.Detach(
+                blastClosestPoints[f].second,
+                detachVelocity,
+                Points::DetachOptions::GenerateDebris
+                | Points::DetachOptions::FireDestroyEvent,
+                currentSimulationTime,
+                gameParameters);
+        }
+    }
+
+    mQueuedForceFields.clear();
+}
+
+void Ship::ApplyDrawForceField(
+    vec2f const & centerPosition,
+    float strength,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex)
 {
     //
     // F = ForceStrength/sqrt(distance), along radius
     //
 
-    for (auto pointIndex : mPoints)
+    vec2f const * restrict const positionBuffer = mPoints.GetPositionBufferAsVec2();
+    vec2f * restrict const nonSpringForceBuffer = mPoints.GetNonSpringForceBufferAsVec2();
+
+    for (ElementIndex pointIndex = startPointIndex; pointIndex < endPointIndex; ++pointIndex)
     {
-        vec2f displacement = (centerPosition - mPoints.GetPosition(pointIndex));
+        vec2f displacement = (centerPosition - positionBuffer[pointIndex]);
         float forceMagnitude = strength / sqrtf(0.1f + displacement.length());
 
-        mPoints.GetNonSpringForce(pointIndex) += displacement.normalise() * forceMagnitude;
+        nonSpringForceBuffer[pointIndex] += displacement.normalise() * forceMagnitude;
     }
 }
 
 void Ship::ApplySwirlForceField(
     vec2f const & centerPosition,
-    float strength)
+    float strength,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex)
 {
     //
     // F = ForceStrength*radius/sqrt(distance), perpendicular to radius
     //
 
-    for (auto pointIndex : mPoints)
+    vec2f const * restrict const positionBuffer = mPoints.GetPositionBufferAsVec2();
+    vec2f * restrict const nonSpringForceBuffer = mPoints.GetNonSpringForceBufferAsVec2();
+
+    for (ElementIndex pointIndex = startPointIndex; pointIndex < endPointIndex; ++pointIndex)
     {
-        vec2f displacement = (centerPosition - mPoints.GetPosition(pointIndex));
+        vec2f displacement = (centerPosition - positionBuffer[pointIndex]);
         float const displacementLength = displacement.length();
         float forceMagnitude = strength / sqrtf(0.1f + displacementLength);
 
-        mPoints.GetNonSpringForce(pointIndex) += vec2f(-displacement.y, displacement.x) * forceMagnitude;
+        nonSpringForceBuffer[pointIndex] += vec2f(-displacement.y, displacement.x) * forceMagnitude;
     }
 }
 
@@ -50,25 +350,25 @@ void Ship::ApplyBlastForceField(
     vec2f const & centerPosition,
     float blastRadius,
     float strength,
-    bool doDetachPoint,
-    float currentSimulationTime,
-    GameParameters const & gameParameters)
+    float blastHeat,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex,
+    float & closestPointSquareDistance,
+    ElementIndex & closestPointIndex)
 {
     //
     // Go through all points and, for each point in radius:
     // - Keep non-ephemeral point that is closest to blast position; we'll Detach() it later
     //   (if this is the fist frame of the blast sequence)
     // - Flip over the point outside of the radius
+    // - Inject heat, in a larger radius, so to heat parts that are not swept by the blast and stay behind
     //
 
     float const squareBlastRadius = blastRadius * blastRadius;
+    float const blastHeatSquareRadius = squareBlastRadius * 1.5f;
     constexpr float DtSquared = GameParameters::SimulationStepTimeDuration<float> * GameParameters::SimulationStepTimeDuration<float>;
 
-    float closestPointSquareDistance = std::numeric_limits<float>::max();
-    ElementIndex closestPointIndex = NoneElementIndex;
-
-    // Visit all (non-ephemeral) points (ephemerals would be blown immediately away otherwise)
-    for (auto pointIndex : mPoints.RawShipPoints())
+    for (ElementIndex pointIndex = startPointIndex; pointIndex < endPointIndex; ++pointIndex)
     {
         vec2f pointRadius = mPoints.GetPosition(pointIndex) - centerPosition;
         float squarePointDistance = pointRadius.squareLength();
@@ -90,29 +390,20 @@ void Ship::ApplyBlastForceField(
                 * strength
                 * mPoints.GetMass(pointIndex);
         }
-    }
 
+        if (squarePointDistance < blastHeatSquareRadius)
+        {
+            // Calc temperature delta
+            // T = Q/HeatCapacity
+            float const deltaT =
+                blastHeat
+                * mPoints.GetMaterialHeatCapacityReciprocal(pointIndex);
 
-    //
-    // Eventually detach the closest point
-    //
-
-    if (doDetachPoint
-        && NoneElementIndex != closestPointIndex)
-    {
-        // Choose a detach velocity - using the same distribution as Debris
-        vec2f detachVelocity = GameRandomEngine::GetInstance().GenerateUniformRadialVector(
-            GameParameters::MinDebrisParticlesVelocity,
-            GameParameters::MaxDebrisParticlesVelocity);
-
-        // Detach point
-        mPoints.Detach(
-            closestPointIndex,
-            detachVelocity,
-            Points::DetachOptions::GenerateDebris
-            | Points::DetachOptions::FireDestroyEvent,
-            currentSimulationTime,
-            gameParameters);
+            // Increase temperature
+            mPoints.SetTemperature(
+                pointIndex,
+                mPoints.GetTemperature(pointIndex) + deltaT);
+        }
     }
 }
 
@@ -120,34 +411,42 @@ void Ship::ApplyRadialSpaceWarpForceField(
     vec2f const & centerPosition,
     float radius,
     float radiusThickness,
-    float strength)
+    float strength,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex)
 {
-    for (auto pointIndex : mPoints)
+    vec2f const * restrict const positionBuffer = mPoints.GetPositionBufferAsVec2();
+    vec2f * restrict const nonSpringForceBuffer = mPoints.GetNonSpringForceBufferAsVec2();
+
+    for (ElementIndex pointIndex = startPointIndex; pointIndex < endPointIndex; ++pointIndex)
     {
-        vec2f const pointRadius = mPoints.GetPosition(pointIndex) - centerPosition;
+        vec2f const pointRadius = positionBuffer[pointIndex] - centerPosition;
         float const pointDistanceFromRadius = pointRadius.length() - radius;
         float const absolutePointDistanceFromRadius = std::abs(pointDistanceFromRadius);
-        if (absolutePointDistanceFromRadius <= radiusThickness)
-        {
-            float const forceDirection = pointDistanceFromRadius >= 0.0f ? 1.0f : -1.0f;
 
-            float const forceStrength = strength * (1.0f - absolutePointDistanceFromRadius / radiusThickness);
+        // Zero outside of the thickness; branch-free, so that it may be vectorized
+        float const forceDirection = pointDistanceFromRadius >= 0.0f ? 1.0f : -1.0f;
+        float const forceStrength = strength * std::max(1.0f - absolutePointDistanceFromRadius / radiusThickness, 0.0f);
 
-            mPoints.GetNonSpringForce(pointIndex) +=
-                pointRadius.normalise()
-                * forceStrength
-                * forceDirection;
-        }
+        nonSpringForceBuffer[pointIndex] +=
+            pointRadius.normalise()
+            * forceStrength
+            * forceDirection;
     }
 }
 
 void Ship::ApplyImplosionForceField(
     vec2f const & centerPosition,
-    float strength)
+    float strength,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex)
 {
-    for (auto pointIndex : mPoints)
+    vec2f const * restrict const positionBuffer = mPoints.GetPositionBufferAsVec2();
+    vec2f * restrict const nonSpringForceBuffer = mPoints.GetNonSpringForceBufferAsVec2();
+
+    for (ElementIndex pointIndex = startPointIndex; pointIndex < endPointIndex; ++pointIndex)
     {
-        vec2f displacement = (centerPosition - mPoints.GetPosition(pointIndex));
+        vec2f displacement = (centerPosition - positionBuffer[pointIndex]);
         float const displacementLength = displacement.length();
         vec2f normalizedDisplacement = displacement.normalise(displacementLength);
 
@@ -155,14 +454,14 @@ void Ship::ApplyImplosionForceField(
         float const massNormalization = mPoints.GetMass(pointIndex) / 50.0f;
 
         // Angular (constant)
-        mPoints.GetNonSpringForce(pointIndex) +=
+        nonSpringForceBuffer[pointIndex] +=
             vec2f(-normalizedDisplacement.y, normalizedDisplacement.x)
             * strength
             * massNormalization
             / 10.0f; // Magic number
 
         // Radial (stronger when closer)
-        mPoints.GetNonSpringForce(pointIndex) +=
+        nonSpringForceBuffer[pointIndex] +=
             normalizedDisplacement
             * strength
             / (0.2f + sqrt(displacementLength))
@@ -173,18 +472,23 @@ void Ship::ApplyImplosionForceField(
 
 void Ship::ApplyRadialExplosionForceField(
     vec2f const & centerPosition,
-    float strength)
+    float strength,
+    ElementIndex startPointIndex,
+    ElementIndex endPointIndex)
 {
     //
     // F = ForceStrength/sqrt(distance), along radius
     //
 
-    for (auto pointIndex : mPoints)
+    vec2f const * restrict const positionBuffer = mPoints.GetPositionBufferAsVec2();
+    vec2f * restrict const nonSpringForceBuffer = mPoints.GetNonSpringForceBufferAsVec2();
+
+    for (ElementIndex pointIndex = startPointIndex; pointIndex < endPointIndex; ++pointIndex)
     {
-        vec2f displacement = (mPoints.GetPosition(pointIndex) - centerPosition);
+        vec2f displacement = (positionBuffer[pointIndex] - centerPosition);
         float forceMagnitude = strength / sqrtf(0.1f + displacement.length());
 
-        mPoints.GetNonSpringForce(pointIndex) += displacement.normalise() * forceMagnitude;
+        nonSpringForceBuffer[pointIndex] += displacement.normalise() * forceMagnitude;
     }
 }
 
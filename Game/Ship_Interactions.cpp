@@ -12,8 +12,10 @@
 #include <GameCore/GameRandomEngine.h>
 #include <GameCore/GameWallClock.h>
 #include <GameCore/Log.h>
+#include <GameCore/TopNSelector.h>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <limits>
@@ -47,22 +49,43 @@ std::optional<ElementIndex> Ship::PickPointToMove(
     float bestOrphanedSquareDistance = std::numeric_limits<float>::max();
     ElementIndex bestOrphanedPoint = NoneElementIndex;
 
-    for (auto p : mPoints.RawShipPoints())
-    {
-        float const squareDistance = (mPoints.GetPosition(p) - pickPosition).squareLength();
-        if (squareDistance < squareSearchRadius)
+    // Non-orphaned points are the endpoints of the springs that are not broken,
+    // hence we may find them via the spring hierarchy
+    UpdateSpringBoundingVolumeHierarchy();
+
+    mSpringBoundingVolumeHierarchy.VisitOverlapping(
+        Geometry::AABB(
+            pickPosition.x - gameParameters.ToolSearchRadius,
+            pickPosition.x + gameParameters.ToolSearchRadius,
+            pickPosition.y + gameParameters.ToolSearchRadius,
+            pickPosition.y - gameParameters.ToolSearchRadius),
+        [&](ElementIndex springIndex)
         {
-            if (!mPoints.GetConnectedSprings(p).ConnectedSprings.empty())
+            if (!mSprings.IsDeleted(springIndex))
             {
-                if (squareDistance < bestNonOrphanedSquareDistance)
+                for (auto const p : { mSprings.GetEndpointAIndex(springIndex), mSprings.GetEndpointBIndex(springIndex) })
                 {
-                    bestNonOrphanedSquareDistance = squareDistance;
-                    bestNonOrphanedPoint = p;
+                    float const squareDistance = (mPoints.GetPosition(p) - pickPosition).squareLength();
+                    if (squareDistance < squareSearchRadius
+                        && squareDistance < bestNonOrphanedSquareDistance)
+                    {
+                        bestNonOrphanedSquareDistance = squareDistance;
+                        bestNonOrphanedPoint = p;
+                    }
                 }
             }
-            else
+        });
+
+    if (bestNonOrphanedPoint == NoneElementIndex)
+    {
+        // Look for orphaned points
+        for (auto p : mPoints.RawShipPoints())
+        {
+            if (mPoints.GetConnectedSprings(p).ConnectedSprings.empty())
             {
-                if (squareDistance < bestOrphanedSquareDistance)
+                float const squareDistance = (mPoints.GetPosition(p) - pickPosition).squareLength();
+                if (squareDistance < squareSearchRadius
+                    && squareDistance < bestOrphanedSquareDistance)
                 {
                     bestOrphanedSquareDistance = squareDistance;
                     bestOrphanedPoint = p;
@@ -104,6 +127,8 @@ void Ship::MoveBy(
             }
         }
 
+        mIsSpringBoundingVolumeHierarchyStale = true;
+
         TrimForWorldBounds(gameParameters);
     }
 }
@@ -127,6 +152,8 @@ void Ship::MoveBy(
         velocityBuffer[p] = actualInertialVelocity;
     }
 
+    mIsSpringBoundingVolumeHierarchyStale = true;
+
     TrimForWorldBounds(gameParameters);
 }
 
@@ -166,6 +193,8 @@ void Ship::RotateBy(
             }
         }
 
+        mIsSpringBoundingVolumeHierarchyStale = true;
+
         TrimForWorldBounds(gameParameters);
     }
 }
@@ -199,6 +228,8 @@ void Ship::RotateBy(
         positionBuffer[p] = vec2f(centeredPos.dot(rotX), centeredPos.dot(rotY)) + center;
     }
 
+    mIsSpringBoundingVolumeHierarchyStale = true;
+
     TrimForWorldBounds(gameParameters);
 }
 
@@ -726,7 +757,7 @@ void Ship::RepairAt(
 
                         if (hasOtherEndpointPointBeenMoved)
                         {
-                            mPoints.GetWater(otherEndpointIndex) /= 2.0f;
+                            mPoints.SetWater(otherEndpointIndex, mPoints.GetWater(otherEndpointIndex) / 2.0f);
                         }
                     }
                 }
@@ -819,15 +850,19 @@ void Ship::SawThrough(
     unsigned int metalsSawed = 0;
     unsigned int nonMetalsSawed = 0;
 
-    for (auto springIndex : mSprings)
-    {
-        if (!mSprings.IsDeleted(springIndex))
+    UpdateSpringBoundingVolumeHierarchy();
+
+    mSpringBoundingVolumeHierarchy.VisitIntersectingSegment(
+        startPos,
+        endPos,
+        [&](ElementIndex springIndex)
         {
-            if (Segment::ProperIntersectionTest(
-                startPos,
-                endPos,
-                mSprings.GetEndpointAPosition(springIndex, mPoints),
-                mSprings.GetEndpointBPosition(springIndex, mPoints)))
+            if (!mSprings.IsDeleted(springIndex)
+                && Segment::ProperIntersectionTest(
+                    startPos,
+                    endPos,
+                    mSprings.GetEndpointAPosition(springIndex, mPoints),
+                    mSprings.GetEndpointBPosition(springIndex, mPoints)))
             {
                 // Destroy spring
                 mSprings.Destroy(
@@ -857,8 +892,7 @@ void Ship::SawThrough(
                 else
                     nonMetalsSawed++;
             }
-        }
-    }
+        });
 
     // Notify (including zero)
     mGameEventHandler->OnSawed(true, metalsSawed);
@@ -980,8 +1014,8 @@ void Ship::DrawTo(
         * strengthFraction
         * (gameParameters.IsUltraViolentMode ? 20.0f : 1.0f);
 
-    // Apply the force field
-    ApplyDrawForceField(
+    // Queue the force field
+    QueueDrawForceField(
         targetPos,
         strength);
 }
@@ -996,8 +1030,8 @@ void Ship::SwirlAt(
         * strengthFraction
         * (gameParameters.IsUltraViolentMode ? 20.0f : 1.0f);
 
-    // Apply the force field
-    ApplySwirlForceField(
+    // Queue the force field
+    QueueSwirlForceField(
         targetPos,
         strength);
 }
@@ -1060,9 +1094,9 @@ bool Ship::FloodAt(
             if (squareDistance < searchSquareRadius)
             {
                 if (quantityOfWater >= 0.0f)
-                    mPoints.GetWater(pointIndex) += quantityOfWater;
+                    mPoints.SetWater(pointIndex, mPoints.GetWater(pointIndex) + quantityOfWater);
                 else
-                    mPoints.GetWater(pointIndex) -= std::min(-quantityOfWater, mPoints.GetWater(pointIndex));
+                    mPoints.SetWater(pointIndex, mPoints.GetWater(pointIndex) - std::min(-quantityOfWater, mPoints.GetWater(pointIndex)));
 
                 anyHasFlooded = true;
             }
@@ -1172,12 +1206,6 @@ bool Ship::ScrubThrough(
         }
     }
 
-    if (hasScrubbed)
-    {
-        // Make sure the decay buffer gets uploaded again
-        mPoints.MarkDecayBufferAsDirty();
-    }
-
     return hasScrubbed;
 }
 
@@ -1212,7 +1240,6 @@ void Ship::ApplyThanosSnap(
     }
 
     // Visit all points (excluding ephemerals, there's nothing to detach there)
-    bool atLeastOneDetached = false;
     for (auto pointIndex : mPoints.RawShipPoints())
     {
         auto const x = mPoints.GetPosition(pointIndex).x;
@@ -1241,15 +1268,8 @@ void Ship::ApplyThanosSnap(
             // Set decay to min, so that debris gets darkened
             mPoints.SetDecay(pointIndex, 0.0f);
 
-            atLeastOneDetached = true;
         }
     }
-
-    if (atLeastOneDetached)
-    {
-        // We've changed the decay buffer, need to upload it next then!
-        mPoints.MarkDecayBufferAsDirty();
-    }
 }
 
 ElementIndex Ship::GetNearestPointAt(
@@ -1311,13 +1331,18 @@ bool Ship::QueryNearestPointAt(
 std::optional<vec2f> Ship::FindSuitableLightningTarget() const
 {
     //
-    // Find top N points
+    // Find top N points, spread out across the ship
     //
 
     constexpr size_t MaxCandidates = 4;
 
-    // Sorted by y, largest first
-    std::vector<vec2f> candidatePositions;
+    // Points closer than this to a higher candidate are not candidates themselves,
+    // so that the top of a single structure does not take all of the slots
+    constexpr float MinCandidateDistance = 5.0f;
+
+    // By y, largest first; we select more points than needed, to have enough
+    // left after removing those too close to each other
+    TopNSelector<float> candidates(MaxCandidates * 8);
 
     for (auto pointIndex : mPoints.RawShipPoints())
     {
@@ -1329,37 +1354,45 @@ std::optional<vec2f> Ship::FindSuitableLightningTarget() const
 
             if (!mParentWorld.IsUnderwater(pos))
             {
-                candidatePositions.insert(
-                    std::upper_bound(
-                        candidatePositions.begin(),
-                        candidatePositions.end(),
-                        pos,
-                        [](auto const & candidatePos, auto const & pos)
-                        {
-                            // Height of to-be-inserted point is augmented based on distance from the point
-                            float const distance = (candidatePos - pos).length();
-                            float const actualPosY = pos.y + std::max(std::floor(distance / 3.0f), 5.0f);
-                            return candidatePos.y > actualPosY;
-                        }),
-                    pos);
-
-                if (candidatePositions.size() > MaxCandidates)
-                {
-                    candidatePositions.pop_back();
-                    assert(candidatePositions.size() == MaxCandidates);
-                }
+                candidates.emplace(pointIndex, pos.y);
             }
         }
     }
 
-    if (candidatePositions.empty())
+    candidates.finalize();
+
+    if (candidates.empty())
         return std::nullopt;
 
+    std::array<vec2f, MaxCandidates> candidatePositions;
+    size_t candidatePositionsCount = 0;
+
+    for (size_t c = 0; c < candidates.size() && candidatePositionsCount < MaxCandidates; ++c)
+    {
+        auto const & pos = mPoints.GetPosition(candidates[c].Element);
+
+        bool const isTooClose = std::any_of(
+            candidatePositions.cbegin(),
+            candidatePositions.cbegin() + candidatePositionsCount,
+            [&pos](vec2f const & candidatePos)
+            {
+                return (candidatePos - pos).length() < MinCandidateDistance;
+            });
+
+        if (!isTooClose)
+        {
+            candidatePositions[candidatePositionsCount++] = pos;
+        }
+    }
+
+    // The highest point is always a candidate
+    assert(candidatePositionsCount > 0);
+
     //
     // Choose
     //
 
-    return candidatePositions[GameRandomEngine::GetInstance().Choose(candidatePositions.size())];
+    return candidatePositions[GameRandomEngine::GetInstance().Choose(candidatePositionsCount)];
 }
 
 void Ship::ApplyLightning(
@@ -16,7 +16,7 @@ namespace Physics {
 bool Ship::UpdateExplosionStateMachine(
     ExplosionStateMachine & explosionStateMachine,
     float currentSimulationTime,
-    GameParameters const & gameParameters)
+    GameParameters const & /*gameParameters*/)
 {
     //
     // Update progress
@@ -51,20 +51,7 @@ bool Ship::UpdateExplosionStateMachine(
             explosionStateMachine.BlastRadius * std::min(1.0f, blastProgress);
 
         //
-        // Blast force
-        //
-
-        // Apply the force field
-        ApplyBlastForceField(
-            centerPosition,
-            blastRadius,
-            explosionStateMachine.BlastStrength,
-            explosionStateMachine.IsFirstFrame,
-            currentSimulationTime,
-            gameParameters);
-
-        //
-        // Blast heat
+        // Blast force and heat
         //
 
         // Q = q*dt
@@ -72,32 +59,13 @@ bool Ship::UpdateExplosionStateMachine(
             explosionStateMachine.BlastHeat * 1000.0f // KJoule->Joule
             * GameParameters::SimulationStepTimeDuration<float>;
 
-        float const blastHeatSquareRadius =
-            blastRadius * blastRadius
-            * 1.5f; // Larger radius, so to heat parts that are not swept by the blast and stay behind
-
-        // Search all non-ephemeral points within the radius
-        for (auto pointIndex : mPoints.RawShipPoints())
-        {
-            float const pointSquareDistance = (mPoints.GetPosition(pointIndex) - centerPosition).squareLength();
-            if (pointSquareDistance < blastHeatSquareRadius)
-            {
-                //
-                // Inject heat at this point
-                //
-
-                // Calc temperature delta
-                // T = Q/HeatCapacity
-                float const deltaT =
-                    blastHeat
-                    * mPoints.GetMaterialHeatCapacityReciprocal(pointIndex);
-
-                // Increase temperature
-                mPoints.SetTemperature(
-                    pointIndex,
-                    mPoints.GetTemperature(pointIndex) + deltaT);
-            }
-        }
+        // Queue the force field; we're invoked right before force fields are applied
+        QueueBlastForceField(
+            centerPosition,
+            blastRadius,
+            explosionStateMachine.BlastStrength,
+            blastHeat,
+            explosionStateMachine.IsFirstFrame);
 
         if (blastProgress > 1.0f)
         {
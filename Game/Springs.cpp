@@ -74,8 +74,12 @@ void Springs::Add(
         / 2.0f;
     mMaterialMeltingTemperatureBuffer.emplace_back(meltingTemperature);
 
+    mLengthBuffer.emplace_back((points.GetPosition(pointAIndex) - points.GetPosition(pointBIndex)).length());
+
     mIsStressedBuffer.emplace_back(false);
 
+    mStrainCandidateBuffer.emplace_back(springIndex);
+
     mIsBombAttachedBuffer.emplace_back(false);
 
     // Calculate parameters for this spring
@@ -263,16 +267,54 @@ void Springs::UpdateForStrains(
     float constexpr StrainHighWatermark = 0.5f; // Greater than this multiplier to be stressed
     float constexpr StrainLowWatermark = 0.08f; // Less than this multiplier to become non-stressed
 
-    // Visit all springs
-    for (ElementIndex s : *this)
+    //
+    // 1. Collect the springs that might change state, i.e. the springs whose strain is above
+    //    the low watermark - which are the only ones that may break or become stressed - and
+    //    the springs that are currently stressed - which may become un-stressed.
+    //
+    //    Deleted springs and springs with attached bombs are skipped, as we want to avoid
+    //    orphanizing bombs.
+    //
+    //    This is a branch-less sequential pass over the springs, which we want to be vectorized
+    //
+
+    bool const * restrict const isDeletedBuffer = mIsDeletedBuffer.data();
+    bool const * restrict const isBombAttachedBuffer = mIsBombAttachedBuffer.data();
+    bool const * restrict const isStressedBuffer = mIsStressedBuffer.data();
+    float const * restrict const lengthBuffer = mLengthBuffer.data();
+    float const * restrict const restLengthBuffer = mRestLengthBuffer.data();
+    float const * restrict const breakingElongationBuffer = mBreakingElongationBuffer.data();
+    ElementIndex * restrict const strainCandidateBuffer = mStrainCandidateBuffer.data();
+
+    ElementCount strainCandidateCount = 0;
+    for (ElementIndex s = 0; s < mElementCount; ++s)
     {
-        // Avoid breaking deleted springs and springs with attached bombs
-        // (we want to avoid orphanizing bombs)
+        float const strain = std::abs(lengthBuffer[s] - restLengthBuffer[s]);
+
+        bool const isCandidate =
+            !isDeletedBuffer[s]
+            & !isBombAttachedBuffer[s]
+            & ((strain > StrainLowWatermark * breakingElongationBuffer[s]) | isStressedBuffer[s]);
+
+        // Always write, and only advance when it's a candidate
+        strainCandidateBuffer[strainCandidateCount] = s;
+        strainCandidateCount += isCandidate ? 1 : 0;
+    }
+
+    //
+    // 2. Visit the candidates and change their state
+    //
+
+    for (ElementCount c = 0; c < strainCandidateCount; ++c)
+    {
+        ElementIndex const s = mStrainCandidateBuffer[c];
+
+        // Check again, as destroying springs might have destroyed other springs
         if (!mIsDeletedBuffer[s]
             && !mIsBombAttachedBuffer[s])
         {
             // Calculate strain length
-            float const strain = fabs(GetLength(s, points) - mRestLengthBuffer[s]);
+            float const strain = std::abs(mLengthBuffer[s] - mRestLengthBuffer[s]);
 
             // Check against breaking elongation
             float const breakingElongation = mBreakingElongationBuffer[s];
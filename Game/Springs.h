@@ -100,37 +100,40 @@ public:
         ElementCount elementCount,
         World & parentWorld,
         std::shared_ptr<GameEventDispatcher> gameEventDispatcher,
-        GameParameters const & gameParameters)
+        GameParameters const & gameParameters,
+        BufferArena & bufferArena)
         : ElementContainer(elementCount)
         //////////////////////////////////
         // Buffers
         //////////////////////////////////
-        , mIsDeletedBuffer(mBufferElementCount, mElementCount, true)
+        , mIsDeletedBuffer(mBufferElementCount, mElementCount, true, bufferArena, "Springs.IsDeleted")
         // Endpoints
-        , mEndpointsBuffer(mBufferElementCount, mElementCount, Endpoints(NoneElementIndex, NoneElementIndex))
+        , mEndpointsBuffer(mBufferElementCount, mElementCount, Endpoints(NoneElementIndex, NoneElementIndex), bufferArena, "Springs.Endpoints")
         // Factory endpoint octants
-        , mFactoryEndpointOctantsBuffer(mBufferElementCount, mElementCount, EndpointOctants(0, 4))
+        , mFactoryEndpointOctantsBuffer(mBufferElementCount, mElementCount, EndpointOctants(0, 4), bufferArena, "Springs.FactoryEndpointOctants")
         // Super triangles
-        , mSuperTrianglesBuffer(mBufferElementCount, mElementCount, SuperTrianglesVector())
-        , mFactorySuperTrianglesBuffer(mBufferElementCount, mElementCount, SuperTrianglesVector())
+        , mSuperTrianglesBuffer(mBufferElementCount, mElementCount, SuperTrianglesVector(), bufferArena, "Springs.SuperTriangles")
+        , mFactorySuperTrianglesBuffer(mBufferElementCount, mElementCount, SuperTrianglesVector(), bufferArena, "Springs.FactorySuperTriangles")
         // Physical
-        , mMaterialStrengthBuffer(mBufferElementCount, mElementCount, 0.0f)
-        , mBreakingElongationBuffer(mBufferElementCount, mElementCount, 0.0f)
-        , mMaterialStiffnessBuffer(mBufferElementCount, mElementCount, 0.0f)
-        , mFactoryRestLengthBuffer(mBufferElementCount, mElementCount, 1.0f)
-        , mRestLengthBuffer(mBufferElementCount, mElementCount, 1.0f)
-        , mCoefficientsBuffer(mBufferElementCount, mElementCount, Coefficients(0.0f, 0.0f))
-        , mBaseStructuralMaterialBuffer(mBufferElementCount, mElementCount, nullptr)
-        , mIsRopeBuffer(mBufferElementCount, mElementCount, false)
+        , mMaterialStrengthBuffer(mBufferElementCount, mElementCount, 0.0f, bufferArena, "Springs.MaterialStrength")
+        , mBreakingElongationBuffer(mBufferElementCount, mElementCount, 0.0f, bufferArena, "Springs.BreakingElongation")
+        , mMaterialStiffnessBuffer(mBufferElementCount, mElementCount, 0.0f, bufferArena, "Springs.MaterialStiffness")
+        , mFactoryRestLengthBuffer(mBufferElementCount, mElementCount, 1.0f, bufferArena, "Springs.FactoryRestLength")
+        , mRestLengthBuffer(mBufferElementCount, mElementCount, 1.0f, bufferArena, "Springs.RestLength")
+        , mCoefficientsBuffer(mBufferElementCount, mElementCount, Coefficients(0.0f, 0.0f), bufferArena, "Springs.Coefficients")
+        , mBaseStructuralMaterialBuffer(mBufferElementCount, mElementCount, nullptr, bufferArena, "Springs.BaseStructuralMaterial")
+        , mIsRopeBuffer(mBufferElementCount, mElementCount, false, bufferArena, "Springs.IsRope")
         // Water
-        , mWaterPermeabilityBuffer(mBufferElementCount, mElementCount, 0.0f)
+        , mWaterPermeabilityBuffer(mBufferElementCount, mElementCount, 0.0f, bufferArena, "Springs.WaterPermeability")
         // Heat
-        , mMaterialThermalConductivityBuffer(mBufferElementCount, mElementCount, 0.0f)
-        , mMaterialMeltingTemperatureBuffer(mBufferElementCount, mElementCount, 0.0f)
+        , mMaterialThermalConductivityBuffer(mBufferElementCount, mElementCount, 0.0f, bufferArena, "Springs.MaterialThermalConductivity")
+        , mMaterialMeltingTemperatureBuffer(mBufferElementCount, mElementCount, 0.0f, bufferArena, "Springs.MaterialMeltingTemperature")
         // Stress
-        , mIsStressedBuffer(mBufferElementCount, mElementCount, false)
+        , mLengthBuffer(mBufferElementCount, mElementCount, 0.0f, bufferArena, "Springs.Length")
+        , mIsStressedBuffer(mBufferElementCount, mElementCount, false, bufferArena, "Springs.IsStressed")
+        , mStrainCandidateBuffer(mBufferElementCount, mElementCount, NoneElementIndex, bufferArena, "Springs.StrainCandidate")
         // Bombs
-        , mIsBombAttachedBuffer(mBufferElementCount, mElementCount, false)
+        , mIsBombAttachedBuffer(mBufferElementCount, mElementCount, false, bufferArena, "Springs.IsBombAttached")
         //////////////////////////////////
         // Container
         //////////////////////////////////
@@ -149,6 +152,36 @@ public:
 
     Springs(Springs && other) = default;
 
+    /*
+     * The number of bytes that the buffers of the specified number of springs take
+     * from the ship's buffer arena.
+     */
+    static size_t CalculateBufferArenaByteSize(ElementCount elementCount)
+    {
+        return CalculateArenaByteSize<
+            decltype(mIsDeletedBuffer),
+            decltype(mEndpointsBuffer),
+            decltype(mFactoryEndpointOctantsBuffer),
+            decltype(mSuperTrianglesBuffer),
+            decltype(mFactorySuperTrianglesBuffer),
+            decltype(mMaterialStrengthBuffer),
+            decltype(mBreakingElongationBuffer),
+            decltype(mMaterialStiffnessBuffer),
+            decltype(mFactoryRestLengthBuffer),
+            decltype(mRestLengthBuffer),
+            decltype(mCoefficientsBuffer),
+            decltype(mBaseStructuralMaterialBuffer),
+            decltype(mIsRopeBuffer),
+            decltype(mWaterPermeabilityBuffer),
+            decltype(mMaterialThermalConductivityBuffer),
+            decltype(mMaterialMeltingTemperatureBuffer),
+            decltype(mLengthBuffer),
+            decltype(mIsStressedBuffer),
+            decltype(mStrainCandidateBuffer),
+            decltype(mIsBombAttachedBuffer)
+        >(CalculateBufferElementCount(elementCount));
+    }
+
     void RegisterShipPhysicsHandler(IShipPhysicsHandler * shipPhysicsHandler)
     {
         mShipPhysicsHandler = shipPhysicsHandler;
@@ -214,6 +247,8 @@ public:
     /*
      * Calculates the current strain - due to tension or compression - and acts depending on it,
      * eventually breaking springs.
+     *
+     * Uses the lengths stored in the length buffer by the last spring force calculation.
      */
     void UpdateForStrains(
         GameParameters const & gameParameters,
@@ -448,6 +483,14 @@ public:
         return mRestLengthBuffer.data();
     }
 
+    /*
+     * The length of each spring, as populated by the spring force calculation.
+     */
+    float * GetLengthBuffer() noexcept
+    {
+        return mLengthBuffer.data();
+    }
+
     void SetRestLength(
         ElementIndex springElementIndex,
         float restLength)
@@ -687,9 +730,15 @@ private:
     // Stress
     //
 
+    // The current length of the spring, as of the last spring force calculation
+    Buffer<float> mLengthBuffer;
+
     // State variable that tracks when we enter and exit the stressed state
     Buffer<bool> mIsStressedBuffer;
 
+    // Scratch buffer with the indices of the springs that might change their stress state
+    Buffer<ElementIndex> mStrainCandidateBuffer;
+
     //
     // Bombs
     //
@@ -0,0 +1,233 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2020-11-21
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "TelemetryExporter.h"
+
+#include <GameCore/GameException.h>
+#include <GameCore/SysSpecifics.h>
+
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <locale>
+#include <sstream>
+#include <utility>
+
+#if defined(FS_OS_LINUX) || defined(FS_OS_MACOS)
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+static std::string const UnixSocketTargetPrefix = "unix:";
+
+TelemetryExporter::TelemetryExporter(std::shared_ptr<TaskThreadPool> taskThreadPool)
+    : mTaskThreadPool(std::move(taskThreadPool))
+    , mTarget()
+    , mFileStream()
+    , mSocket(-1)
+    , mSocketPath()
+    , mLastSampleTimestampReal(std::chrono::steady_clock::now())
+    , mLastTaskThreadPoolStatistics()
+{
+}
+
+TelemetryExporter::~TelemetryExporter()
+{
+    Close();
+}
+
+void TelemetryExporter::SetTarget(std::string const & target)
+{
+    Close();
+
+    if (target.empty())
+        return;
+
+    if (target.compare(0, UnixSocketTargetPrefix.size(), UnixSocketTargetPrefix) == 0)
+    {
+#if defined(FS_OS_LINUX) || defined(FS_OS_MACOS)
+        std::string const socketPath = target.substr(UnixSocketTargetPrefix.size());
+        if (socketPath.empty() || socketPath.size() >= sizeof(sockaddr_un::sun_path))
+        {
+            throw GameException("Invalid telemetry socket path \"" + socketPath + "\"");
+        }
+
+        mSocket = socket(AF_UNIX, SOCK_DGRAM, 0);
+        if (mSocket < 0)
+        {
+            throw GameException("Cannot create telemetry socket: " + std::string(std::strerror(errno)));
+        }
+
+        mSocketPath = socketPath;
+#else
+        throw GameException("Telemetry export to UNIX sockets is not supported on this platform");
+#endif
+    }
+    else
+    {
+        auto fileStream = std::make_unique<std::ofstream>(target, std::ios_base::out | std::ios_base::app);
+        if (!fileStream->is_open())
+        {
+            throw GameException("Cannot open telemetry file \"" + target + "\"");
+        }
+
+        mFileStream = std::move(fileStream);
+    }
+
+    mTarget = target;
+
+    mTaskThreadPool->SetStatisticsEnabled(true);
+
+    // Start a fresh interval
+    mLastSampleTimestampReal = std::chrono::steady_clock::now();
+    mLastTaskThreadPoolStatistics.reset();
+}
+
+void TelemetryExporter::Export(
+    std::chrono::duration<float> elapsedRealSeconds,
+    std::chrono::duration<float> elapsedGameSeconds,
+    bool isPaused,
+    float immediateFps,
+    float averageFps,
+    PerfStats const & lastDeltaPerfStats,
+    Render::RenderStatistics const & renderStats,
+    SimulationStatistics const & simulationStats)
+{
+    assert(IsEnabled());
+
+    auto const nowReal = std::chrono::steady_clock::now();
+    auto const elapsedReal = nowReal - mLastSampleTimestampReal;
+    mLastSampleTimestampReal = nowReal;
+
+    std::ostringstream ss;
+    ss.imbue(std::locale::classic());
+
+    ss << "{\"real_time\":" << elapsedRealSeconds.count()
+        << ",\"game_time\":" << elapsedGameSeconds.count()
+        << ",\"paused\":" << (isPaused ? "true" : "false")
+        << ",\"fps\":{\"last\":" << immediateFps << ",\"total\":" << averageFps << "}";
+
+    ss << ",\"perf_ms\":{"
+        << "\"update\":" << lastDeltaPerfStats.TotalUpdateDuration.ToRatio<std::chrono::milliseconds>()
+        << ",\"ocean_surface_update\":" << lastDeltaPerfStats.TotalOceanSurfaceUpdateDuration.ToRatio<std::chrono::milliseconds>()
+        << ",\"ships_update\":" << lastDeltaPerfStats.TotalShipsUpdateDuration.ToRatio<std::chrono::milliseconds>()
+        << ",\"wait_for_render_upload\":" << lastDeltaPerfStats.TotalWaitForRenderUploadDuration.ToRatio<std::chrono::milliseconds>()
+        << ",\"net_update\":" << lastDeltaPerfStats.TotalNetUpdateDuration.ToRatio<std::chrono::milliseconds>()
+        << ",\"wait_for_render_draw\":" << lastDeltaPerfStats.TotalWaitForRenderDrawDuration.ToRatio<std::chrono::milliseconds>()
+        << ",\"net_render_upload\":" << lastDeltaPerfStats.TotalNetRenderUploadDuration.ToRatio<std::chrono::milliseconds>()
+        << ",\"main_thread_render_draw\":" << lastDeltaPerfStats.TotalMainThreadRenderDrawDuration.ToRatio<std::chrono::milliseconds>()
+        << ",\"render_draw\":" << lastDeltaPerfStats.TotalRenderDrawDuration.ToRatio<std::chrono::milliseconds>()
+        << ",\"upload_render_draw\":" << lastDeltaPerfStats.TotalUploadRenderDrawDuration.ToRatio<std::chrono::milliseconds>()
+        << "}";
+
+    ss << ",\"uploaded_ship_point_attribute_bytes\":" << lastDeltaPerfStats.TotalUploadedShipPointAttributeBytes.ToAverage();
+
+    ss << ",\"rendered\":{"
+        << "\"ship_points\":" << renderStats.LastRenderedShipPoints
+        << ",\"ship_ropes\":" << renderStats.LastRenderedShipRopes
+        << ",\"ship_springs\":" << renderStats.LastRenderedShipSprings
+        << ",\"ship_triangles\":" << renderStats.LastRenderedShipTriangles
+        << ",\"ship_planes\":" << renderStats.LastRenderedShipPlanes
+        << ",\"ship_flames\":" << renderStats.LastRenderedShipFlames
+        << ",\"ship_generic_textures\":" << renderStats.LastRenderedShipGenericMipMappedTextures
+        << "}";
+
+    ss << ",\"simulation\":{"
+        << "\"ships\":" << simulationStats.ShipCount
+        << ",\"points\":" << simulationStats.PointCount
+        << ",\"springs\":" << simulationStats.SpringCount
+        << ",\"triangles\":" << simulationStats.TriangleCount
+        << ",\"ephemeral_particles\":" << simulationStats.EphemeralParticleCount
+        << "}";
+
+    ss << ",\"task_pool\":";
+    WriteTaskThreadPool(ss, elapsedReal);
+
+    ss << ",\"resident_memory_bytes\":";
+    if (auto const residentMemory = GetProcessResidentMemoryBytes(); residentMemory.has_value())
+        ss << *residentMemory;
+    else
+        ss << "null";
+
+    ss << "}\n";
+
+    Send(ss.str());
+}
+
+void TelemetryExporter::WriteTaskThreadPool(
+    std::ostream & os,
+    std::chrono::steady_clock::duration elapsedReal)
+{
+    auto const statistics = mTaskThreadPool->GetStatistics();
+
+    if (!mLastTaskThreadPoolStatistics.has_value())
+    {
+        // First sample since enabled; start counting from now
+        mLastTaskThreadPoolStatistics = statistics;
+    }
+
+    auto const deltaTaskCount = statistics.TaskCount - mLastTaskThreadPoolStatistics->TaskCount;
+    auto const deltaBusyDuration = statistics.TaskBusyDuration - mLastTaskThreadPoolStatistics->TaskBusyDuration;
+
+    // Fraction of the pool's total thread time spent running tasks
+    auto const availableDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsedReal) * mTaskThreadPool->GetParallelism();
+    float const utilization = availableDuration.count() > 0
+        ? static_cast<float>(deltaBusyDuration.count()) / static_cast<float>(availableDuration.count())
+        : 0.0f;
+
+    os << "{"
+        << "\"parallelism\":" << mTaskThreadPool->GetParallelism()
+        << ",\"tasks\":" << deltaTaskCount
+        << ",\"utilization\":" << utilization
+        << "}";
+
+    mLastTaskThreadPoolStatistics = statistics;
+}
+
+void TelemetryExporter::Send(std::string const & line)
+{
+    if (mFileStream)
+    {
+        *mFileStream << line;
+        mFileStream->flush();
+    }
+#if defined(FS_OS_LINUX) || defined(FS_OS_MACOS)
+    else if (mSocket >= 0)
+    {
+        sockaddr_un address;
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, mSocketPath.c_str(), sizeof(address.sun_path) - 1);
+
+        // Fire-and-forget: when there's no listener, or its queue is full, the sample is simply lost
+        sendto(
+            mSocket,
+            line.data(),
+            line.size(),
+            MSG_DONTWAIT,
+            reinterpret_cast<sockaddr const *>(&address),
+            sizeof(address));
+    }
+#endif
+}
+
+void TelemetryExporter::Close()
+{
+    mTaskThreadPool->SetStatisticsEnabled(false);
+
+    mFileStream.reset();
+
+#if defined(FS_OS_LINUX) || defined(FS_OS_MACOS)
+    if (mSocket >= 0)
+    {
+        close(mSocket);
+        mSocket = -1;
+    }
+#endif
+
+    mSocketPath.clear();
+    mTarget.clear();
+}
@@ -0,0 +1,89 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2020-11-21
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "PerfStats.h"
+#include "RenderTypes.h"
+
+#include <GameCore/TaskThreadPool.h>
+
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+
+/*
+ * Exports periodic samples of the simulation's statistics as newline-delimited JSON.
+ *
+ * The target is either a file path, to which samples are appended, or "unix:<path>",
+ * in which case each sample is sent as a datagram to a local UNIX socket; sends
+ * never block, and samples are dropped when nobody is listening.
+ *
+ * The exporter is disabled - and costs nothing - as long as it has no target; the
+ * statistics of the task thread pool are only collected while the exporter is enabled.
+ */
+class TelemetryExporter
+{
+public:
+
+    explicit TelemetryExporter(std::shared_ptr<TaskThreadPool> taskThreadPool);
+
+    ~TelemetryExporter();
+
+    bool IsEnabled() const
+    {
+        return !mTarget.empty();
+    }
+
+    std::string const & GetTarget() const
+    {
+        return mTarget;
+    }
+
+    /*
+     * Sets the target of the export; an empty target disables the exporter.
+     * Throws GameException if the target cannot be opened, in which case
+     * the exporter is left disabled.
+     */
+    void SetTarget(std::string const & target);
+
+    void Export(
+        std::chrono::duration<float> elapsedRealSeconds,
+        std::chrono::duration<float> elapsedGameSeconds,
+        bool isPaused,
+        float immediateFps,
+        float averageFps,
+        PerfStats const & lastDeltaPerfStats,
+        Render::RenderStatistics const & renderStats,
+        SimulationStatistics const & simulationStats);
+
+private:
+
+    void WriteTaskThreadPool(
+        std::ostream & os,
+        std::chrono::steady_clock::duration elapsedReal);
+
+    void Send(std::string const & line);
+
+    void Close();
+
+private:
+
+    std::shared_ptr<TaskThreadPool> const mTaskThreadPool;
+
+    std::string mTarget;
+
+    std::unique_ptr<std::ofstream> mFileStream;
+
+    int mSocket; // -1 when not using a socket
+    std::string mSocketPath;
+
+    // The pool's counters at the previous sample, so that we may
+    // calculate the pool's utilization over the last interval
+    std::chrono::steady_clock::time_point mLastSampleTimestampReal;
+    std::optional<TaskThreadPool::Statistics> mLastTaskThreadPoolStatistics;
+};
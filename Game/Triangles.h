@@ -46,17 +46,19 @@ private:
 
 public:
 
-    Triangles(ElementCount elementCount)
+    Triangles(
+        ElementCount elementCount,
+        BufferArena & bufferArena)
         : ElementContainer(elementCount)
         //////////////////////////////////
         // Buffers
         //////////////////////////////////
-        , mIsDeletedBuffer(mBufferElementCount, mElementCount, true)
+        , mIsDeletedBuffer(mBufferElementCount, mElementCount, true, bufferArena, "Triangles.IsDeleted")
         // Endpoints
-        , mEndpointsBuffer(mBufferElementCount, mElementCount, Endpoints(NoneElementIndex, NoneElementIndex, NoneElementIndex))
+        , mEndpointsBuffer(mBufferElementCount, mElementCount, Endpoints(NoneElementIndex, NoneElementIndex, NoneElementIndex), bufferArena, "Triangles.Endpoints")
         // Sub springs
-        , mSubSpringsBuffer(mBufferElementCount, mElementCount, SubSpringsVector())
-        , mFactorySubSpringsBuffer(mBufferElementCount, mElementCount, SubSpringsVector())
+        , mSubSpringsBuffer(mBufferElementCount, mElementCount, SubSpringsVector(), bufferArena, "Triangles.SubSprings")
+        , mFactorySubSpringsBuffer(mBufferElementCount, mElementCount, SubSpringsVector(), bufferArena, "Triangles.FactorySubSprings")
         //////////////////////////////////
         // Container
         //////////////////////////////////
@@ -66,6 +68,20 @@ public:
 
     Triangles(Triangles && other) = default;
 
+    /*
+     * The number of bytes that the buffers of the specified number of triangles take
+     * from the ship's buffer arena.
+     */
+    static size_t CalculateBufferArenaByteSize(ElementCount elementCount)
+    {
+        return CalculateArenaByteSize<
+            decltype(mIsDeletedBuffer),
+            decltype(mEndpointsBuffer),
+            decltype(mSubSpringsBuffer),
+            decltype(mFactorySubSpringsBuffer)
+        >(CalculateBufferElementCount(elementCount));
+    }
+
     void RegisterShipPhysicsHandler(IShipPhysicsHandler * shipPhysicsHandler)
     {
         mShipPhysicsHandler = shipPhysicsHandler;
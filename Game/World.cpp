@@ -11,6 +11,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 
 namespace Physics {
 
@@ -58,6 +59,9 @@ std::tuple<ShipId, RgbaImageData> World::AddShip(
         shipTexturizer,
         gameParameters);
 
+    // Publish its initial state, so that it may be rendered before its first update
+    ship->PublishRenderSnapshots();
+
     // Store ship
     mAllShips.push_back(std::move(ship));
 
@@ -93,6 +97,30 @@ vec2f World::GetShipSize(ShipId shipId) const
     return mAllShips[shipId]->GetSize();
 }
 
+SimulationStatistics World::GetSimulationStatistics() const
+{
+    SimulationStatistics simulationStatistics;
+
+    for (auto const & ship : mAllShips)
+    {
+        ship->AccumulateSimulationStatistics(simulationStatistics);
+    }
+
+    return simulationStatistics;
+}
+
+std::vector<ShipMemoryReport> World::GetShipMemoryReports() const
+{
+    std::vector<ShipMemoryReport> reports;
+
+    for (auto const & ship : mAllShips)
+    {
+        reports.emplace_back(ship->GetId(), ship->GetBufferArena());
+    }
+
+    return reports;
+}
+
 bool World::IsUnderwater(ElementId elementId) const
 {
     auto const shipId = elementId.GetShipId();
@@ -682,7 +710,8 @@ void World::SetSilence(float silenceAmount)
 
 void World::Update(
     GameParameters const & gameParameters,
-    Render::RenderContext & renderContext,
+    vec2f const & cameraWorldPosition,
+    VectorFieldRenderModeType vectorFieldRenderMode,
     PerfStats & /*perfStats*/)
 {
     // Update current time
@@ -696,6 +725,12 @@ void World::Update(
 
     mClouds.Update(mCurrentSimulationTime, mWind.GetBaseAndStormSpeedMagnitude(), mStorm.GetParameters(), gameParameters);
 
+    // Simulate the ocean surface at a higher resolution where the user is looking
+    mOceanSurface.SetRefinementFocus(
+        gameParameters.DoRefineOceanSurfaceAroundCamera
+        ? std::optional<float>(cameraWorldPosition.x)
+        : std::nullopt);
+
     mOceanSurface.Update(mCurrentSimulationTime, mWind, gameParameters);
 
     mOceanFloor.Update(gameParameters);
@@ -706,7 +741,50 @@ void World::Update(
             mCurrentSimulationTime,
             mStorm.GetParameters(),
             gameParameters,
-            renderContext);
+            vectorFieldRenderMode);
+    }
+
+    //
+    // Couple ships with the ocean surface
+    //
+
+    if (gameParameters.DoDisplaceOceanSurfaceWithShips)
+    {
+        // Bin displacements in parallel - each ship only touches its own bins...
+        std::vector<TaskThreadPool::Task> tasks;
+        tasks.reserve(mAllShips.size());
+        for (auto & ship : mAllShips)
+        {
+            Ship * const shipPtr = ship.get();
+            tasks.emplace_back(
+                [shipPtr]()
+                {
+                    shipPtr->UpdateOceanSurfaceDisplacement();
+                });
+        }
+
+        mTaskThreadPool->Run(tasks);
+
+        // ...and feed them into the ocean surface, which will then propagate them
+        for (auto const & ship : mAllShips)
+        {
+            ship->ApplyOceanSurfaceDisplacement(mOceanSurface);
+        }
+    }
+    else
+    {
+        for (auto & ship : mAllShips)
+        {
+            ship->ResetOceanSurfaceDisplacement();
+        }
+    }
+}
+
+void World::PublishRenderSnapshots()
+{
+    for (auto & ship : mAllShips)
+    {
+        ship->PublishRenderSnapshots();
     }
 }
 
@@ -740,4 +818,19 @@ void World::RenderUpload(
     }
 }
 
+void World::RenderUploadShipPointPositions(
+    bool doInterpolate,
+    Render::RenderContext & renderContext) const
+{
+    auto const now = std::chrono::steady_clock::now();
+
+    for (auto const & ship : mAllShips)
+    {
+        ship->RenderUploadPointPositions(
+            doInterpolate,
+            now,
+            renderContext);
+    }
+}
+
 }
\ No newline at end of file
@@ -57,11 +57,28 @@ public:
 
     vec2f GetShipSize(ShipId shipId) const;
 
+    SimulationStatistics GetSimulationStatistics() const;
+
+    std::vector<ShipMemoryReport> GetShipMemoryReports() const;
+
+    TaskThreadPool const & GetTaskThreadPool() const
+    {
+        return *mTaskThreadPool;
+    }
+
     inline float GetOceanSurfaceHeightAt(float x) const
     {
         return mOceanSurface.GetHeightAt(x);
     }
 
+    inline void GetOceanSurfaceHeightsAt(
+        float const * xs,
+        float * heights,
+        size_t count) const
+    {
+        mOceanSurface.GetHeightsAt(xs, heights, count);
+    }
+
     inline void DisplaceOceanSurfaceAt(
         float x,
         float yOffset)
@@ -81,6 +98,21 @@ public:
         return mOceanFloor.GetHeightAt(x);
     }
 
+    inline void GetOceanFloorHeightsAt(
+        float const * xs,
+        float * heights,
+        size_t count) const
+    {
+        mOceanFloor.GetHeightsAt(xs, heights, count);
+    }
+
+    inline float GetOceanFloorMaxHeightIn(
+        float leftX,
+        float rightX) const
+    {
+        return mOceanFloor.GetMaxHeightIn(leftX, rightX);
+    }
+
     inline void DisplaceOceanFloorAt(
         float x,
         float yOffset)
@@ -279,16 +311,29 @@ public:
 
 public:
 
+    // Runs on the simulation thread, hence it takes render state by value
     void Update(
         GameParameters const & gameParameters,
-        Render::RenderContext & renderContext,
+        vec2f const & cameraWorldPosition,
+        VectorFieldRenderModeType vectorFieldRenderMode,
         PerfStats & perfStats);
 
+    // Publishes the current state for rendering, after it has been changed
+    // outside of Update() - e.g. by tools while the simulation is not running
+    void PublishRenderSnapshots();
+
+    // Uploads everything but ship point positions
     void RenderUpload(
         GameParameters const & gameParameters,
         Render::RenderContext & renderContext,
         PerfStats & perfStats);
 
+    // Uploads ship point positions from the published snapshots; unlike all
+    // other methods, this one may run concurrently with Update()
+    void RenderUploadShipPointPositions(
+        bool doInterpolate,
+        Render::RenderContext & renderContext) const;
+
 private:
 
     // The current simulation time
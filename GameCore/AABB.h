@@ -85,6 +85,15 @@ public:
             && point.y >= BottomLeft.y
             && point.y <= TopRight.y;
     }
+
+    // Empty boxes never overlap anything
+    inline bool Overlaps(AABB const & other) const
+    {
+        return BottomLeft.x <= other.TopRight.x
+            && TopRight.x >= other.BottomLeft.x
+            && BottomLeft.y <= other.TopRight.y
+            && TopRight.y >= other.BottomLeft.y;
+    }
 };
 
 }
\ No newline at end of file
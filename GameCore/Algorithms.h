@@ -10,6 +10,8 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstdint>
 #include <iterator>
 
 namespace Algorithms {
@@ -463,6 +465,75 @@ inline void DiffuseLight_SSEVectorized(
 
 #endif
 
+/*
+ * Quantizes floats in the [0.0, 1.0] range into 16-bit unsigned normalized
+ * integers, as consumed by GL_UNSIGNED_SHORT normalized vertex attributes;
+ * values outside of the range are clamped.
+ */
+inline void QuantizeToUNorm16_Naive(
+    float const * restrict src,
+    size_t const count,
+    std::uint16_t * restrict dst)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        float const v = std::clamp(src[i], 0.0f, 1.0f);
+        dst[i] = static_cast<std::uint16_t>(std::lround(v * 65535.0f));
+    }
+}
+
+#if defined(FS_ARCHITECTURE_X86_32) || defined(FS_ARCHITECTURE_X86_64)
+
+inline void QuantizeToUNorm16_SSE(
+    float const * restrict src,
+    size_t const count,
+    std::uint16_t * restrict dst)
+{
+    __m128 const Zero = _mm_setzero_ps();
+    __m128 const One = _mm_set1_ps(1.0f);
+    __m128 const Scale = _mm_set1_ps(65535.0f);
+
+    // SSE2 only has a signed saturating pack, hence we bias values into
+    // the signed 16-bit range and flip the sign bit back afterwards
+    __m128i const Bias32 = _mm_set1_epi32(32768);
+    __m128i const Bias16 = _mm_set1_epi16(static_cast<short>(0x8000));
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128 v0 = _mm_loadu_ps(src + i);
+        __m128 v1 = _mm_loadu_ps(src + i + 4);
+
+        v0 = _mm_mul_ps(_mm_min_ps(_mm_max_ps(v0, Zero), One), Scale);
+        v1 = _mm_mul_ps(_mm_min_ps(_mm_max_ps(v1, Zero), One), Scale);
+
+        // Round to nearest
+        __m128i const i0 = _mm_sub_epi32(_mm_cvtps_epi32(v0), Bias32);
+        __m128i const i1 = _mm_sub_epi32(_mm_cvtps_epi32(v1), Bias32);
+
+        __m128i const packed = _mm_xor_si128(_mm_packs_epi32(i0, i1), Bias16);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), packed);
+    }
+
+    // Remainder
+    QuantizeToUNorm16_Naive(src + i, count - i, dst + i);
+}
+
+#endif
+
+inline void QuantizeToUNorm16(
+    float const * restrict src,
+    size_t const count,
+    std::uint16_t * restrict dst)
+{
+#if defined(FS_ARCHITECTURE_X86_32) || defined(FS_ARCHITECTURE_X86_64)
+    QuantizeToUNorm16_SSE(src, count, dst);
+#else
+    QuantizeToUNorm16_Naive(src, count, dst);
+#endif
+}
+
 /*
  * Diffuse light from each lamp to all points on the same or lower plane ID,
  * inverse-proportionally to the lamp-point distance
@@ -0,0 +1,136 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2020-11-24
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "BoundingVolumeHierarchy.h"
+
+namespace Geometry {
+
+static vec2f GetCenter(AABB const & box)
+{
+    // Empty boxes have no center; lump them all at the origin
+    if (box.BottomLeft.x > box.TopRight.x)
+        return vec2f::zero();
+
+    return (box.BottomLeft + box.TopRight) / 2.0f;
+}
+
+void BoundingVolumeHierarchy::Build(std::vector<AABB> const & elementBoxes)
+{
+    mNodes.clear();
+    mElementIndices.clear();
+    mElementBoxes.clear();
+
+    if (elementBoxes.empty())
+        return;
+
+    mElementIndices.reserve(elementBoxes.size());
+    for (ElementIndex e = 0; e < static_cast<ElementIndex>(elementBoxes.size()); ++e)
+    {
+        mElementIndices.push_back(e);
+    }
+
+    // A full binary tree with L leaves has 2L - 1 nodes
+    size_t const maxLeafCount = (elementBoxes.size() + MaxLeafElementCount - 1) / MaxLeafElementCount;
+    mNodes.reserve(2 * (maxLeafCount + 1));
+
+    mNodes.emplace_back();
+    BuildNode(0, 0, static_cast<std::uint32_t>(elementBoxes.size()), elementBoxes);
+
+    mElementBoxes.reserve(elementBoxes.size());
+    for (ElementIndex e : mElementIndices)
+    {
+        mElementBoxes.push_back(elementBoxes[e]);
+    }
+}
+
+void BoundingVolumeHierarchy::Refit(std::vector<AABB> const & elementBoxes)
+{
+    assert(elementBoxes.size() == mElementIndices.size());
+
+    // Visit bottom-up, as children always come after their parent
+    for (size_t n = mNodes.size(); n-- > 0; )
+    {
+        Node & node = mNodes[n];
+
+        AABB box;
+        if (node.ElementCount > 0)
+        {
+            for (std::uint32_t e = node.FirstChildOrElement; e < node.FirstChildOrElement + node.ElementCount; ++e)
+            {
+                mElementBoxes[e] = elementBoxes[mElementIndices[e]];
+                box.ExtendTo(mElementBoxes[e]);
+            }
+        }
+        else
+        {
+            box.ExtendTo(mNodes[node.FirstChildOrElement].Box);
+            box.ExtendTo(mNodes[node.FirstChildOrElement + 1].Box);
+        }
+
+        node.Box = box;
+    }
+}
+
+void BoundingVolumeHierarchy::BuildNode(
+    std::uint32_t nodeIndex,
+    std::uint32_t firstElement,
+    std::uint32_t elementCount,
+    std::vector<AABB> const & elementBoxes)
+{
+    //
+    // Calculate box of this node, and box of the element centers
+    //
+
+    AABB box;
+    AABB centersBox;
+    for (std::uint32_t e = firstElement; e < firstElement + elementCount; ++e)
+    {
+        box.ExtendTo(elementBoxes[mElementIndices[e]]);
+        centersBox.ExtendTo(GetCenter(elementBoxes[mElementIndices[e]]));
+    }
+
+    mNodes[nodeIndex].Box = box;
+
+    if (elementCount <= MaxLeafElementCount)
+    {
+        // Leaf
+        mNodes[nodeIndex].FirstChildOrElement = firstElement;
+        mNodes[nodeIndex].ElementCount = elementCount;
+        return;
+    }
+
+    //
+    // Split at the median along the longest axis of the centers, which
+    // keeps the tree balanced
+    //
+
+    bool const isXSplit = centersBox.GetWidth() >= centersBox.GetHeight();
+
+    std::uint32_t const leftElementCount = elementCount / 2;
+
+    std::nth_element(
+        mElementIndices.begin() + firstElement,
+        mElementIndices.begin() + firstElement + leftElementCount,
+        mElementIndices.begin() + firstElement + elementCount,
+        [&elementBoxes, isXSplit](ElementIndex e1, ElementIndex e2)
+        {
+            vec2f const c1 = GetCenter(elementBoxes[e1]);
+            vec2f const c2 = GetCenter(elementBoxes[e2]);
+            return isXSplit ? c1.x < c2.x : c1.y < c2.y;
+        });
+
+    // Allocate both children together
+    std::uint32_t const firstChildIndex = static_cast<std::uint32_t>(mNodes.size());
+    mNodes.emplace_back();
+    mNodes.emplace_back();
+
+    mNodes[nodeIndex].FirstChildOrElement = firstChildIndex;
+    mNodes[nodeIndex].ElementCount = 0;
+
+    BuildNode(firstChildIndex, firstElement, leftElementCount, elementBoxes);
+    BuildNode(firstChildIndex + 1, firstElement + leftElementCount, elementCount - leftElementCount, elementBoxes);
+}
+
+}
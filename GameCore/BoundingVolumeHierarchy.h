@@ -0,0 +1,256 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2020-11-24
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "AABB.h"
+#include "GameTypes.h"
+#include "Vectors.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Geometry {
+
+/*
+ * A binary hierarchy of axis-aligned bounding boxes over a set of elements,
+ * each of which is described by its own bounding box.
+ *
+ * The hierarchy is built once over a set of element boxes, and may then be
+ * refitted cheaply to new boxes for the same elements, keeping its topology;
+ * the quality of the hierarchy degrades as elements drift away from their
+ * original neighbors, at which point the caller should rebuild it.
+ *
+ * An element may have an empty box (i.e. a default-constructed AABB), in which
+ * case it is never visited by queries.
+ */
+class BoundingVolumeHierarchy
+{
+public:
+
+    static size_t constexpr MaxLeafElementCount = 4;
+
+public:
+
+    BoundingVolumeHierarchy()
+        : mNodes()
+        , mElementIndices()
+        , mElementBoxes()
+    {}
+
+    size_t GetElementCount() const
+    {
+        return mElementIndices.size();
+    }
+
+    size_t GetNodeCount() const
+    {
+        return mNodes.size();
+    }
+
+    /*
+     * Builds the hierarchy over all the elements, whose boxes are indexed by element index.
+     */
+    void Build(std::vector<AABB> const & elementBoxes);
+
+    /*
+     * Updates the boxes of the hierarchy for new boxes of the same elements.
+     */
+    void Refit(std::vector<AABB> const & elementBoxes);
+
+    /*
+     * Invokes the visitor with the index of each element whose box overlaps the specified box.
+     */
+    template<typename TVisitor>
+    inline void VisitOverlapping(
+        AABB const & box,
+        TVisitor && visitor) const
+    {
+        Visit(
+            [&box](AABB const & nodeBox)
+            {
+                return Overlaps(nodeBox, box);
+            },
+            std::forward<TVisitor>(visitor));
+    }
+
+    /*
+     * Invokes the visitor with the index of each element whose box is crossed by the specified segment.
+     */
+    template<typename TVisitor>
+    inline void VisitIntersectingSegment(
+        vec2f const & startPosition,
+        vec2f const & endPosition,
+        TVisitor && visitor) const
+    {
+        vec2f const direction = endPosition - startPosition;
+
+        Visit(
+            [&startPosition, &direction](AABB const & nodeBox)
+            {
+                return IntersectsRay(nodeBox, startPosition, direction, 1.0f);
+            },
+            std::forward<TVisitor>(visitor));
+    }
+
+    /*
+     * Invokes the visitor with the index of each element whose box is crossed by the specified ray.
+     */
+    template<typename TVisitor>
+    inline void VisitIntersectingRay(
+        vec2f const & origin,
+        vec2f const & direction,
+        TVisitor && visitor) const
+    {
+        Visit(
+            [&origin, &direction](AABB const & nodeBox)
+            {
+                return IntersectsRay(nodeBox, origin, direction, std::numeric_limits<float>::max());
+            },
+            std::forward<TVisitor>(visitor));
+    }
+
+private:
+
+    struct Node
+    {
+        AABB Box;
+
+        // For leaves: the first element in mElementIndices;
+        // for internal nodes: the first of the two (adjacent) children
+        std::uint32_t FirstChildOrElement;
+
+        // Zero for internal nodes
+        std::uint32_t ElementCount;
+
+        Node()
+            : Box()
+            , FirstChildOrElement(0)
+            , ElementCount(0)
+        {}
+    };
+
+    template<typename TBoxTest, typename TVisitor>
+    inline void Visit(
+        TBoxTest && boxTest,
+        TVisitor && visitor) const
+    {
+        if (mNodes.empty())
+            return;
+
+        // Balanced by construction, hence the depth is logarithmic in the element count
+        std::array<std::uint32_t, 64> stack;
+        size_t stackSize = 0;
+
+        stack[stackSize++] = 0;
+
+        while (stackSize > 0)
+        {
+            Node const & node = mNodes[stack[--stackSize]];
+
+            if (!boxTest(node.Box))
+                continue;
+
+            if (node.ElementCount > 0)
+            {
+                // Leaf
+                for (std::uint32_t e = node.FirstChildOrElement; e < node.FirstChildOrElement + node.ElementCount; ++e)
+                {
+                    if (boxTest(mElementBoxes[e]))
+                    {
+                        visitor(mElementIndices[e]);
+                    }
+                }
+            }
+            else
+            {
+                assert(stackSize + 2 <= stack.size());
+                stack[stackSize++] = node.FirstChildOrElement + 1;
+                stack[stackSize++] = node.FirstChildOrElement;
+            }
+        }
+    }
+
+    inline static bool Overlaps(
+        AABB const & a,
+        AABB const & b)
+    {
+        // Empty boxes never overlap anything
+        return a.BottomLeft.x <= b.TopRight.x
+            && a.TopRight.x >= b.BottomLeft.x
+            && a.BottomLeft.y <= b.TopRight.y
+            && a.TopRight.y >= b.BottomLeft.y;
+    }
+
+    // Slab test for the ray origin + t * direction, with t in [0, tMax]
+    inline static bool IntersectsRay(
+        AABB const & box,
+        vec2f const & origin,
+        vec2f const & direction,
+        float tMax)
+    {
+        // Empty boxes never intersect anything; the slabs of an inverted box
+        // would otherwise still clip the ray to a non-empty interval when
+        // the ray is not axis-aligned
+        if (box.BottomLeft.x > box.TopRight.x || box.BottomLeft.y > box.TopRight.y)
+            return false;
+
+        float tMin = 0.0f;
+
+        if (!ClipRayToSlab(origin.x, direction.x, box.BottomLeft.x, box.TopRight.x, tMin, tMax))
+            return false;
+
+        return ClipRayToSlab(origin.y, direction.y, box.BottomLeft.y, box.TopRight.y, tMin, tMax);
+    }
+
+    inline static bool ClipRayToSlab(
+        float origin,
+        float direction,
+        float slabMin,
+        float slabMax,
+        float & tMin,
+        float & tMax)
+    {
+        if (direction == 0.0f)
+        {
+            // Parallel to the slab: either always in or always out
+            return origin >= slabMin && origin <= slabMax;
+        }
+
+        float t1 = (slabMin - origin) / direction;
+        float t2 = (slabMax - origin) / direction;
+        if (t1 > t2)
+            std::swap(t1, t2);
+
+        tMin = std::max(tMin, t1);
+        tMax = std::min(tMax, t2);
+
+        return tMin <= tMax;
+    }
+
+    void BuildNode(
+        std::uint32_t nodeIndex,
+        std::uint32_t firstElement,
+        std::uint32_t elementCount,
+        std::vector<AABB> const & elementBoxes);
+
+private:
+
+    // Children always come after their parent
+    std::vector<Node> mNodes;
+
+    // The element indices, permuted so that each leaf owns a contiguous range
+    std::vector<ElementIndex> mElementIndices;
+
+    // The element boxes, in the same order as mElementIndices
+    std::vector<AABB> mElementBoxes;
+};
+
+}
@@ -5,6 +5,7 @@
 ***************************************************************************************/
 #pragma once
 
+#include "BufferArena.h"
 #include "GameMath.h"
 #include "SysSpecifics.h"
 
@@ -15,6 +16,7 @@
 #include <functional>
 #include <memory>
 #include <stdexcept>
+#include <string>
 
 /*
  * This class is the base of a hierarchy implementing a simple buffer of "things".
@@ -241,6 +243,51 @@ public:
 	{
 	}
 
+    //
+    // Buffers allocated from an arena, which must outlive the buffer
+    //
+
+    Buffer(
+        size_t size,
+        BufferArena & arena,
+        std::string const & name)
+        : BaseBuffer<TElement>(
+            reinterpret_cast<TElement *>(arena.Allocate(BaseBuffer<TElement>::CalculateByteSize(size), name)),
+            size)
+        , mAllocatedBuffer() // Owned by the arena
+    {
+    }
+
+    Buffer(
+        size_t size,
+        size_t fillStart,
+        TElement fillValue,
+        BufferArena & arena,
+        std::string const & name)
+        : BaseBuffer<TElement>(
+            reinterpret_cast<TElement *>(arena.Allocate(BaseBuffer<TElement>::CalculateByteSize(size), name)),
+            size,
+            fillStart,
+            fillValue)
+        , mAllocatedBuffer() // Owned by the arena
+    {
+    }
+
+    Buffer(
+        size_t size,
+        size_t fillStart,
+        std::function<TElement(size_t)> fillFunction,
+        BufferArena & arena,
+        std::string const & name)
+        : BaseBuffer<TElement>(
+            reinterpret_cast<TElement *>(arena.Allocate(BaseBuffer<TElement>::CalculateByteSize(size), name)),
+            size,
+            fillStart,
+            fillFunction)
+        , mAllocatedBuffer() // Owned by the arena
+    {
+    }
+
     Buffer(Buffer && other) noexcept
         : BaseBuffer<TElement>(std::move(other))
         , mAllocatedBuffer(std::move(other.mAllocatedBuffer))
@@ -293,10 +340,20 @@ private:
 	{
 	}
 
-    // The buffer owned by us
+    // The buffer owned by us; empty when the buffer comes from an arena
     unique_aligned_buffer<TElement> mAllocatedBuffer;
 };
 
+/*
+ * The number of bytes that buffers of the specified types, each with the specified
+ * size, take from the BufferArena they are allocated from.
+ */
+template <typename... TBuffers>
+constexpr size_t CalculateArenaByteSize(size_t size) noexcept
+{
+    return (0 + ... + BufferArena::CalculateAllocationByteSize(TBuffers::CalculateByteSize(size)));
+}
+
 /*
  * A buffer that sees a segment of another buffer, with external ownership.
  *
@@ -0,0 +1,158 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2020-11-22
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "BufferArena.h"
+
+#include "Log.h"
+#include "SysSpecifics.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+#if defined(FS_OS_LINUX)
+#include <sys/mman.h>
+#elif defined(FS_OS_WINDOWS)
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+static_assert(BufferArena::AllocationAlignment % vectorization_byte_count<size_t> == 0);
+
+#if defined(FS_OS_LINUX)
+// Size of transparent huge pages on the architectures we run on
+static size_t constexpr HugePageByteSize = 2 * 1024 * 1024;
+#endif
+
+static size_t AlignUp(
+    size_t value,
+    size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+BufferArena::BufferArena(
+    size_t capacityByteSize,
+    bool doUseHugePages)
+    : mCapacityByteSize(capacityByteSize)
+    , mDoUseHugePages(doUseHugePages)
+    , mBlocks()
+    , mAllocations()
+{
+    if (capacityByteSize > 0)
+    {
+        AllocateBlock(capacityByteSize);
+    }
+}
+
+BufferArena::~BufferArena()
+{
+    for (auto const & block : mBlocks)
+    {
+        FreeBlock(block);
+    }
+}
+
+void * BufferArena::Allocate(
+    size_t byteSize,
+    std::string const & name)
+{
+    size_t const alignedByteSize = CalculateAllocationByteSize(byteSize);
+
+    if (mBlocks.empty()
+        || mBlocks.back().ByteSize - mBlocks.back().AllocatedByteSize < alignedByteSize)
+    {
+        if (!mBlocks.empty())
+        {
+            LogMessage("BufferArena: capacity of ", GetCapacityByteSize(), " bytes exceeded while allocating ",
+                name, "; allocating new block");
+        }
+
+        AllocateBlock(std::max(alignedByteSize, mCapacityByteSize / 4));
+    }
+
+    Block & block = mBlocks.back();
+    assert(block.ByteSize - block.AllocatedByteSize >= alignedByteSize);
+
+    void * const ptr = block.Memory + block.AllocatedByteSize;
+    block.AllocatedByteSize += alignedByteSize;
+
+    mAllocations.emplace_back(name, byteSize);
+
+    return ptr;
+}
+
+void BufferArena::AllocateBlock(size_t minByteSize)
+{
+    size_t byteSize = AlignUp(minByteSize, AllocationAlignment);
+
+    if (mDoUseHugePages)
+    {
+#if defined(FS_OS_LINUX)
+        if (byteSize >= HugePageByteSize)
+        {
+            byteSize = AlignUp(byteSize, HugePageByteSize);
+
+            void * const memory = mmap(nullptr, byteSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (memory != MAP_FAILED)
+            {
+                // Just a hint - the kernel may or may not honor it
+                madvise(memory, byteSize, MADV_HUGEPAGE);
+
+                mBlocks.emplace_back(reinterpret_cast<std::uint8_t *>(memory), byteSize, true);
+                return;
+            }
+        }
+#elif defined(FS_OS_WINDOWS)
+        // Requires the "Lock pages in memory" privilege, which we'll most likely not have
+        size_t const largePageByteSize = GetLargePageMinimum();
+        if (largePageByteSize > 0 && byteSize >= largePageByteSize)
+        {
+            size_t const largeByteSize = AlignUp(byteSize, largePageByteSize);
+
+            void * const memory = VirtualAlloc(nullptr, largeByteSize, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+            if (memory != nullptr)
+            {
+                mBlocks.emplace_back(reinterpret_cast<std::uint8_t *>(memory), largeByteSize, true);
+                return;
+            }
+        }
+#endif
+    }
+
+    // Fall back to regular pages
+#ifdef _MSC_VER
+    void * const memory = _aligned_malloc(byteSize, AllocationAlignment);
+#else
+    void * const memory = aligned_alloc(AllocationAlignment, byteSize);
+#endif
+
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    mBlocks.emplace_back(reinterpret_cast<std::uint8_t *>(memory), byteSize, false);
+}
+
+void BufferArena::FreeBlock(Block const & block)
+{
+    if (block.IsHugePageBacked)
+    {
+#if defined(FS_OS_LINUX)
+        munmap(block.Memory, block.ByteSize);
+#elif defined(FS_OS_WINDOWS)
+        VirtualFree(block.Memory, 0, MEM_RELEASE);
+#endif
+    }
+    else
+    {
+#ifdef _MSC_VER
+        _aligned_free(block.Memory);
+#else
+        std::free(block.Memory);
+#endif
+    }
+}
@@ -0,0 +1,146 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2020-11-22
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*
+ * A region of memory from which a set of buffers with a common lifetime - e.g. all
+ * the element buffers of a ship - are carved out.
+ *
+ * The region is allocated up-front in one block with the specified capacity and is
+ * released as a whole when the arena is destroyed; individual allocations are never
+ * freed. Should the capacity turn out to be insufficient, further blocks are allocated.
+ *
+ * Allocations are aligned to cache lines, which are a multiple of the vectorization word.
+ *
+ * Large blocks may optionally be backed by huge pages, where the platform supports it.
+ *
+ * Not thread-safe.
+ */
+class BufferArena
+{
+public:
+
+    static size_t constexpr AllocationAlignment = 64;
+
+    struct AllocationInfo
+    {
+        std::string Name;
+        size_t ByteSize;
+
+        AllocationInfo(
+            std::string const & name,
+            size_t byteSize)
+            : Name(name)
+            , ByteSize(byteSize)
+        {}
+    };
+
+public:
+
+    BufferArena(
+        size_t capacityByteSize,
+        bool doUseHugePages);
+
+    ~BufferArena();
+
+    BufferArena(BufferArena const & other) = delete;
+    BufferArena & operator=(BufferArena const & other) = delete;
+
+    /*
+     * The number of bytes that an allocation of the specified size takes from the arena,
+     * including alignment padding.
+     */
+    static constexpr size_t CalculateAllocationByteSize(size_t byteSize) noexcept
+    {
+        return (std::max(byteSize, size_t(1)) + AllocationAlignment - 1) / AllocationAlignment * AllocationAlignment;
+    }
+
+    /*
+     * Returns uninitialized memory, which stays valid for the lifetime of the arena.
+     */
+    void * Allocate(
+        size_t byteSize,
+        std::string const & name);
+
+    /*
+     * The total number of bytes reserved from the system, across all blocks.
+     */
+    size_t GetCapacityByteSize() const
+    {
+        size_t capacity = 0;
+        for (auto const & block : mBlocks)
+            capacity += block.ByteSize;
+
+        return capacity;
+    }
+
+    /*
+     * The total number of bytes handed out, including alignment padding.
+     */
+    size_t GetAllocatedByteSize() const
+    {
+        size_t allocated = 0;
+        for (auto const & block : mBlocks)
+            allocated += block.AllocatedByteSize;
+
+        return allocated;
+    }
+
+    size_t GetBlockCount() const
+    {
+        return mBlocks.size();
+    }
+
+    bool IsHugePageBacked() const
+    {
+        return !mBlocks.empty() && mBlocks.front().IsHugePageBacked;
+    }
+
+    std::vector<AllocationInfo> const & GetAllocations() const
+    {
+        return mAllocations;
+    }
+
+private:
+
+    struct Block
+    {
+        std::uint8_t * Memory;
+        size_t ByteSize;
+        size_t AllocatedByteSize;
+        bool IsHugePageBacked;
+
+        Block(
+            std::uint8_t * memory,
+            size_t byteSize,
+            bool isHugePageBacked)
+            : Memory(memory)
+            , ByteSize(byteSize)
+            , AllocatedByteSize(0)
+            , IsHugePageBacked(isHugePageBacked)
+        {}
+    };
+
+    void AllocateBlock(size_t minByteSize);
+
+    static void FreeBlock(Block const & block);
+
+private:
+
+    size_t const mCapacityByteSize;
+    bool const mDoUseHugePages;
+
+    std::vector<Block> mBlocks;
+
+    std::vector<AllocationInfo> mAllocations;
+};
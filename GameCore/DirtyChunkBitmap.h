@@ -0,0 +1,146 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2020-11-14
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*
+ * Tracks which chunks of a buffer have been modified, with one bit per chunk
+ * of ChunkSize consecutive elements.
+ *
+ * Writers of the buffer mark the elements they modify, and the consumer of the
+ * buffer visits the (coalesced) ranges of dirty chunks and clears the bitmap.
+ */
+template<size_t ChunkSize>
+class DirtyChunkBitmap
+{
+public:
+
+    static_assert(ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0, "ChunkSize must be a power of two");
+
+    explicit DirtyChunkBitmap(size_t elementCount)
+        : mElementCount(elementCount)
+        , mChunkCount((elementCount + ChunkSize - 1) / ChunkSize)
+        , mWords((mChunkCount + WordBits - 1) / WordBits, 0)
+        , mIsAnyDirty(false)
+    {
+    }
+
+    DirtyChunkBitmap(DirtyChunkBitmap && other) = default;
+
+    size_t GetElementCount() const
+    {
+        return mElementCount;
+    }
+
+    size_t GetChunkCount() const
+    {
+        return mChunkCount;
+    }
+
+    bool IsAnyDirty() const
+    {
+        return mIsAnyDirty;
+    }
+
+    bool IsChunkDirty(size_t chunkIndex) const
+    {
+        assert(chunkIndex < mChunkCount);
+        return (mWords[chunkIndex / WordBits] & (std::uint64_t(1) << (chunkIndex % WordBits))) != 0;
+    }
+
+    inline void MarkDirty(size_t elementIndex)
+    {
+        assert(elementIndex < mElementCount);
+
+        size_t const chunkIndex = elementIndex / ChunkSize;
+        mWords[chunkIndex / WordBits] |= std::uint64_t(1) << (chunkIndex % WordBits);
+        mIsAnyDirty = true;
+    }
+
+    void MarkDirty(
+        size_t startElementIndex,
+        size_t elementCount)
+    {
+        if (elementCount == 0)
+            return;
+
+        assert(startElementIndex + elementCount <= mElementCount);
+
+        size_t const lastChunkIndex = (startElementIndex + elementCount - 1) / ChunkSize;
+        for (size_t c = startElementIndex / ChunkSize; c <= lastChunkIndex; ++c)
+        {
+            mWords[c / WordBits] |= std::uint64_t(1) << (c % WordBits);
+        }
+
+        mIsAnyDirty = true;
+    }
+
+    void MarkAllDirty()
+    {
+        MarkDirty(0, mElementCount);
+    }
+
+    void Clear()
+    {
+        if (mIsAnyDirty)
+        {
+            std::fill(mWords.begin(), mWords.end(), 0);
+            mIsAnyDirty = false;
+        }
+    }
+
+    /*
+     * Invokes the visitor with (startElementIndex, elementCount) for each maximal
+     * range of consecutive dirty chunks, in increasing order.
+     */
+    template<typename TVisitor>
+    void VisitDirtyRanges(TVisitor && visitor) const
+    {
+        if (!mIsAnyDirty)
+            return;
+
+        size_t c = 0;
+        while (c < mChunkCount)
+        {
+            // Skip clean words wholesale
+            if (mWords[c / WordBits] == 0)
+            {
+                c = (c / WordBits + 1) * WordBits;
+                continue;
+            }
+
+            if (!IsChunkDirty(c))
+            {
+                ++c;
+                continue;
+            }
+
+            size_t const startChunk = c;
+            while (c < mChunkCount && IsChunkDirty(c))
+            {
+                ++c;
+            }
+
+            size_t const startElementIndex = startChunk * ChunkSize;
+            size_t const endElementIndex = std::min(c * ChunkSize, mElementCount);
+            visitor(startElementIndex, endElementIndex - startElementIndex);
+        }
+    }
+
+private:
+
+    static size_t constexpr WordBits = 64;
+
+    size_t mElementCount;
+    size_t mChunkCount;
+    std::vector<std::uint64_t> mWords;
+    bool mIsAnyDirty;
+};
@@ -60,11 +60,16 @@ protected:
 
     ElementContainer(ElementCount elementCount)
         : mElementCount(elementCount)
+        , mBufferElementCount(CalculateBufferElementCount(elementCount))
+    {
+    }
+
+    static ElementCount CalculateBufferElementCount(ElementCount elementCount)
+    {
         // We round our number of buffer elements to the next multiple of the vectorized float count, so that
         // buffers of single floats are aligned on vectorized word boundaries.
         // Note that buffers of more than single floats would also automatically be aligned.
-        , mBufferElementCount(make_aligned_float_element_count(elementCount))
-    {
+        return make_aligned_float_element_count(elementCount);
     }
 
     // The actual number of elements in this container
@@ -18,6 +18,18 @@ DurationShortLongType StrToDurationShortLongType(std::string const & str)
         throw GameException("Unrecognized DurationShortLongType \"" + str + "\"");
 }
 
+ShipPointsReorderingModeType StrToShipPointsReorderingModeType(std::string const & str)
+{
+    if (Utils::CaseInsensitiveEquals(str, "Stripes"))
+        return ShipPointsReorderingModeType::Stripes;
+    else if (Utils::CaseInsensitiveEquals(str, "Morton"))
+        return ShipPointsReorderingModeType::MortonCurve;
+    else if (Utils::CaseInsensitiveEquals(str, "Hilbert"))
+        return ShipPointsReorderingModeType::HilbertCurve;
+    else
+        throw GameException("Unrecognized ShipPointsReorderingModeType \"" + str + "\"");
+}
+
 ShipAutoTexturizationSettings ShipAutoTexturizationSettings::FromJSON(picojson::object const & jsonObject)
 {
     auto const modeIt = jsonObject.find("mode");
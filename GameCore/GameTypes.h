@@ -265,12 +265,14 @@ private:
 /*
  * Types of bombs (duh).
  */
-enum class BombType
+enum class BombType : size_t
 {
-    AntiMatterBomb,
+    AntiMatterBomb = 0,
     ImpactBomb,
     RCBomb,
-    TimerBomb
+    TimerBomb,
+
+    _Last = TimerBomb
 };
 
 /*
@@ -329,10 +331,12 @@ inline std::basic_ostream<char> & operator<<(std::basic_ostream<char>& os, Elect
 /*
  * Generic duration enum - short and long.
  */
-enum class DurationShortLongType
+enum class DurationShortLongType : size_t
 {
-    Short,
-    Long
+    Short = 0,
+    Long,
+
+    _Last = Long
 };
 
 DurationShortLongType StrToDurationShortLongType(std::string const & str);
@@ -408,6 +412,18 @@ struct ShipAutoTexturizationSettings
     picojson::object ToJSON() const;
 };
 
+/*
+ * The different orders in which ship points - and springs - are laid out in memory.
+ */
+enum class ShipPointsReorderingModeType
+{
+    Stripes,        // Vertical stripes visited left-to-right, from top to bottom
+    MortonCurve,    // Z-order curve over the point positions
+    HilbertCurve    // Hilbert curve over the point positions
+};
+
+ShipPointsReorderingModeType StrToShipPointsReorderingModeType(std::string const & str);
+
 
 /*
  * The different visual ways in which we render highlights.
@@ -0,0 +1,1023 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2020-11-08
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#include "PngDecoder.h"
+
+#include "GameException.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace /* anonymous */ {
+
+std::uint8_t constexpr PngSignature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+
+inline std::uint32_t ReadUInt32BE(std::uint8_t const * data)
+{
+    return (static_cast<std::uint32_t>(data[0]) << 24)
+        | (static_cast<std::uint32_t>(data[1]) << 16)
+        | (static_cast<std::uint32_t>(data[2]) << 8)
+        | static_cast<std::uint32_t>(data[3]);
+}
+
+inline bool IsChunkType(
+    std::uint8_t const * chunkType,
+    char const * expectedType)
+{
+    return 0 == std::memcmp(chunkType, expectedType, 4);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Inflate
+//////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+ * Reads bits LSB-first out of a deflate stream.
+ */
+class BitReader
+{
+public:
+
+    BitReader(
+        std::uint8_t const * data,
+        size_t size)
+        : mData(data)
+        , mSize(size)
+        , mPosition(0)
+        , mBitBuffer(0)
+        , mBitCount(0)
+        , mOverrunBits(0)
+    {}
+
+    inline std::uint32_t PeekBits(int count)
+    {
+        assert(count <= 24);
+
+        while (mBitCount < count)
+        {
+            if (mPosition < mSize)
+            {
+                mBitBuffer |= static_cast<std::uint32_t>(mData[mPosition++]) << mBitCount;
+            }
+            else
+            {
+                // Pad with zeroes, and remember we did so
+                mOverrunBits += 8;
+            }
+
+            mBitCount += 8;
+        }
+
+        return mBitBuffer & ((std::uint32_t(1) << count) - 1);
+    }
+
+    inline void ConsumeBits(int count)
+    {
+        assert(count <= mBitCount);
+
+        mBitBuffer >>= count;
+        mBitCount -= count;
+
+        if (mOverrunBits > mBitCount)
+        {
+            throw GameException("Compressed image data is truncated");
+        }
+    }
+
+    inline std::uint32_t GetBits(int count)
+    {
+        std::uint32_t const bits = PeekBits(count);
+        ConsumeBits(count);
+        return bits;
+    }
+
+    // Discards the bits up to the next byte boundary, and returns a pointer to
+    // the next byte together with the number of bytes available from there
+    std::pair<std::uint8_t const *, size_t> AlignToByte()
+    {
+        ConsumeBits(mBitCount % 8);
+
+        // Give back the whole bytes still in the bit buffer, excluding padding
+        mPosition -= (mBitCount - mOverrunBits) / 8;
+        mBitBuffer = 0;
+        mBitCount = 0;
+        mOverrunBits = 0;
+
+        return { mData + mPosition, mSize - mPosition };
+    }
+
+    void SkipBytes(size_t count)
+    {
+        assert(mBitCount == 0);
+        assert(mPosition + count <= mSize);
+        mPosition += count;
+    }
+
+private:
+
+    std::uint8_t const * const mData;
+    size_t const mSize;
+    size_t mPosition;
+
+    std::uint32_t mBitBuffer;
+    int mBitCount;
+    int mOverrunBits;
+};
+
+/*
+ * Canonical Huffman decoding table; codes up to FastBits long are decoded
+ * with a single lookup.
+ */
+class HuffmanTable
+{
+public:
+
+    static int constexpr FastBits = 9;
+
+    void Build(
+        std::uint8_t const * codeLengths,
+        int symbolCount)
+    {
+        std::array<int, 17> lengthCounts;
+        lengthCounts.fill(0);
+        for (int s = 0; s < symbolCount; ++s)
+        {
+            ++lengthCounts[codeLengths[s]];
+        }
+
+        lengthCounts[0] = 0;
+
+        std::array<int, 16> nextCode;
+        int code = 0;
+        int symbolIndex = 0;
+        for (int l = 1; l < 16; ++l)
+        {
+            nextCode[l] = code;
+            mFirstCode[l] = static_cast<std::uint16_t>(code);
+            mFirstSymbol[l] = static_cast<std::uint16_t>(symbolIndex);
+            code += lengthCounts[l];
+            if (lengthCounts[l] != 0 && code - 1 >= (1 << l))
+            {
+                throw GameException("Compressed image data contains an invalid Huffman table");
+            }
+
+            mMaxCode[l] = code << (16 - l);
+            code <<= 1;
+            symbolIndex += lengthCounts[l];
+        }
+
+        mMaxCode[16] = 0x10000;
+
+        mFast.fill(0);
+        for (int s = 0; s < symbolCount; ++s)
+        {
+            int const length = codeLengths[s];
+            if (length != 0)
+            {
+                int const c = nextCode[length] - mFirstCode[length] + mFirstSymbol[length];
+                mSymbols[c] = static_cast<std::uint16_t>(s);
+
+                if (length <= FastBits)
+                {
+                    std::uint16_t const fastEntry = static_cast<std::uint16_t>((length << FastBits) | s);
+                    for (int j = ReverseBits(nextCode[length], length); j < (1 << FastBits); j += (1 << length))
+                    {
+                        mFast[j] = fastEntry;
+                    }
+                }
+
+                ++nextCode[length];
+            }
+        }
+    }
+
+    inline int Decode(BitReader & bitReader) const
+    {
+        std::uint32_t const bits = bitReader.PeekBits(16);
+
+        std::uint16_t const fastEntry = mFast[bits & ((1 << FastBits) - 1)];
+        if (fastEntry != 0)
+        {
+            bitReader.ConsumeBits(fastEntry >> FastBits);
+            return fastEntry & ((1 << FastBits) - 1);
+        }
+
+        // Slow path: codes are stored MSB-first
+        int const k = ReverseBits(bits, 16);
+        int length;
+        for (length = FastBits + 1; k >= mMaxCode[length]; ++length);
+
+        if (length >= 16)
+        {
+            throw GameException("Compressed image data contains an invalid Huffman code");
+        }
+
+        int const c = (k >> (16 - length)) - mFirstCode[length] + mFirstSymbol[length];
+        bitReader.ConsumeBits(length);
+        return mSymbols[c];
+    }
+
+private:
+
+    static inline int ReverseBits(
+        std::uint32_t value,
+        int bitCount)
+    {
+        std::uint32_t result = 0;
+        for (int b = 0; b < bitCount; ++b, value >>= 1)
+        {
+            result = (result << 1) | (value & 1);
+        }
+
+        return static_cast<int>(result);
+    }
+
+    std::array<std::uint16_t, 1 << FastBits> mFast;
+    std::array<std::uint16_t, 17> mFirstCode;
+    std::array<std::uint16_t, 17> mFirstSymbol;
+    std::array<int, 17> mMaxCode;
+    std::array<std::uint16_t, 288> mSymbols;
+};
+
+std::uint16_t constexpr LengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+std::uint8_t constexpr LengthExtraBits[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+std::uint16_t constexpr DistanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+std::uint8_t constexpr DistanceExtraBits[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+/*
+ * Inflates a zlib stream, handing out the inflated bytes to the sink
+ * as they are produced; only the last 32KB - the maximum distance of
+ * back-references - are retained.
+ */
+template<typename TSink>
+void Inflate(
+    std::uint8_t const * data,
+    size_t size,
+    TSink && sink)
+{
+    static size_t constexpr WindowSize = 32768;
+    static size_t constexpr FlushSize = 4 * WindowSize;
+
+    //
+    // Check zlib header
+    //
+
+    if (size < 2
+        || (data[0] & 0x0f) != 8 // Deflate
+        || ((static_cast<unsigned int>(data[0]) << 8) | data[1]) % 31 != 0
+        || (data[1] & 0x20) != 0) // Preset dictionary
+    {
+        throw GameException("Image data is not a valid zlib stream");
+    }
+
+    BitReader bitReader(data + 2, size - 2);
+
+    //
+    // Output window: [0, flushedEnd) has been handed out already, [flushedEnd, end) not yet
+    //
+
+    std::unique_ptr<std::uint8_t[]> window(new std::uint8_t[FlushSize + WindowSize + 258]);
+    size_t windowFlushedEnd = 0;
+    size_t windowEnd = 0;
+
+    auto const flushIfNeeded = [&]()
+    {
+        if (windowEnd >= FlushSize)
+        {
+            sink(window.get() + windowFlushedEnd, windowEnd - windowFlushedEnd);
+
+            // Retain the last window
+            std::memmove(window.get(), window.get() + windowEnd - WindowSize, WindowSize);
+            windowFlushedEnd = WindowSize;
+            windowEnd = WindowSize;
+        }
+    };
+
+    HuffmanTable literalLengthTable;
+    HuffmanTable distanceTable;
+
+    bool isFinalBlock;
+    do
+    {
+        isFinalBlock = (bitReader.GetBits(1) != 0);
+        std::uint32_t const blockType = bitReader.GetBits(2);
+
+        if (blockType == 0)
+        {
+            //
+            // Stored block
+            //
+
+            auto [storedData, storedAvailable] = bitReader.AlignToByte();
+            if (storedAvailable < 4)
+            {
+                throw GameException("Compressed image data is truncated");
+            }
+
+            size_t const length = storedData[0] | (storedData[1] << 8);
+            size_t const lengthComplement = storedData[2] | (storedData[3] << 8);
+            if (length != (~lengthComplement & 0xffff) || storedAvailable - 4 < length)
+            {
+                throw GameException("Compressed image data contains an invalid stored block");
+            }
+
+            for (size_t copied = 0; copied < length; )
+            {
+                size_t const chunk = std::min(length - copied, FlushSize + WindowSize - windowEnd);
+                std::memcpy(window.get() + windowEnd, storedData + 4 + copied, chunk);
+                windowEnd += chunk;
+                copied += chunk;
+
+                flushIfNeeded();
+            }
+
+            bitReader.SkipBytes(4 + length);
+        }
+        else if (blockType == 1 || blockType == 2)
+        {
+            //
+            // Huffman-compressed block
+            //
+
+            if (blockType == 1)
+            {
+                // Fixed codes
+                std::array<std::uint8_t, 288 + 32> codeLengths;
+                std::fill(codeLengths.begin(), codeLengths.begin() + 144, std::uint8_t(8));
+                std::fill(codeLengths.begin() + 144, codeLengths.begin() + 256, std::uint8_t(9));
+                std::fill(codeLengths.begin() + 256, codeLengths.begin() + 280, std::uint8_t(7));
+                std::fill(codeLengths.begin() + 280, codeLengths.begin() + 288, std::uint8_t(8));
+                std::fill(codeLengths.begin() + 288, codeLengths.end(), std::uint8_t(5));
+
+                literalLengthTable.Build(codeLengths.data(), 288);
+                distanceTable.Build(codeLengths.data() + 288, 32);
+            }
+            else
+            {
+                // Dynamic codes
+                int const literalLengthCount = static_cast<int>(bitReader.GetBits(5)) + 257;
+                int const distanceCount = static_cast<int>(bitReader.GetBits(5)) + 1;
+                int const codeLengthCount = static_cast<int>(bitReader.GetBits(4)) + 4;
+
+                static int constexpr CodeLengthOrder[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+                std::array<std::uint8_t, 19> codeLengthCodeLengths;
+                codeLengthCodeLengths.fill(0);
+                for (int i = 0; i < codeLengthCount; ++i)
+                {
+                    codeLengthCodeLengths[CodeLengthOrder[i]] = static_cast<std::uint8_t>(bitReader.GetBits(3));
+                }
+
+                HuffmanTable codeLengthTable;
+                codeLengthTable.Build(codeLengthCodeLengths.data(), 19);
+
+                std::array<std::uint8_t, 286 + 32> codeLengths;
+                int const totalCount = literalLengthCount + distanceCount;
+                for (int i = 0; i < totalCount; )
+                {
+                    int const symbol = codeLengthTable.Decode(bitReader);
+                    if (symbol < 16)
+                    {
+                        codeLengths[i++] = static_cast<std::uint8_t>(symbol);
+                    }
+                    else
+                    {
+                        std::uint8_t repeatedLength = 0;
+                        int repeatCount;
+                        if (symbol == 16)
+                        {
+                            if (i == 0)
+                            {
+                                throw GameException("Compressed image data contains an invalid code length repetition");
+                            }
+
+                            repeatedLength = codeLengths[i - 1];
+                            repeatCount = 3 + static_cast<int>(bitReader.GetBits(2));
+                        }
+                        else if (symbol == 17)
+                        {
+                            repeatCount = 3 + static_cast<int>(bitReader.GetBits(3));
+                        }
+                        else
+                        {
+                            repeatCount = 11 + static_cast<int>(bitReader.GetBits(7));
+                        }
+
+                        if (i + repeatCount > totalCount)
+                        {
+                            throw GameException("Compressed image data contains an invalid code length repetition");
+                        }
+
+                        std::fill(codeLengths.begin() + i, codeLengths.begin() + i + repeatCount, repeatedLength);
+                        i += repeatCount;
+                    }
+                }
+
+                literalLengthTable.Build(codeLengths.data(), literalLengthCount);
+                distanceTable.Build(codeLengths.data() + literalLengthCount, distanceCount);
+            }
+
+            for (;;)
+            {
+                int const symbol = literalLengthTable.Decode(bitReader);
+                if (symbol < 256)
+                {
+                    window[windowEnd++] = static_cast<std::uint8_t>(symbol);
+                }
+                else if (symbol == 256)
+                {
+                    // End of block
+                    break;
+                }
+                else
+                {
+                    int const lengthIndex = symbol - 257;
+                    if (lengthIndex >= 29)
+                    {
+                        throw GameException("Compressed image data contains an invalid length code");
+                    }
+
+                    size_t const length = LengthBase[lengthIndex] + bitReader.GetBits(LengthExtraBits[lengthIndex]);
+
+                    int const distanceIndex = distanceTable.Decode(bitReader);
+                    if (distanceIndex >= 30)
+                    {
+                        throw GameException("Compressed image data contains an invalid distance code");
+                    }
+
+                    size_t const distance = DistanceBase[distanceIndex] + bitReader.GetBits(DistanceExtraBits[distanceIndex]);
+                    if (distance > windowEnd)
+                    {
+                        throw GameException("Compressed image data contains an invalid distance");
+                    }
+
+                    // Byte-by-byte, as source and destination may overlap
+                    std::uint8_t * dst = window.get() + windowEnd;
+                    std::uint8_t const * src = dst - distance;
+                    for (size_t b = 0; b < length; ++b)
+                    {
+                        dst[b] = src[b];
+                    }
+
+                    windowEnd += length;
+                }
+
+                flushIfNeeded();
+            }
+        }
+        else
+        {
+            throw GameException("Compressed image data contains an invalid block type");
+        }
+    } while (!isFinalBlock);
+
+    // Flush remaining
+    if (windowEnd > windowFlushedEnd)
+    {
+        sink(window.get() + windowFlushedEnd, windowEnd - windowFlushedEnd);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// PNG
+//////////////////////////////////////////////////////////////////////////////////////////
+
+struct PngHeader
+{
+    int Width;
+    int Height;
+    int BitDepth;
+    int ColorType;
+    int InterlaceMethod;
+
+    int GetChannelCount() const
+    {
+        switch (ColorType)
+        {
+            case 0: return 1; // Grayscale
+            case 2: return 3; // RGB
+            case 3: return 1; // Palette
+            case 4: return 2; // Grayscale + alpha
+            case 6: return 4; // RGBA
+            default: return 0;
+        }
+    }
+
+    // As per the table of allowed bit depths for each color type
+    bool IsBitDepthValid() const
+    {
+        switch (ColorType)
+        {
+            case 0: return BitDepth == 1 || BitDepth == 2 || BitDepth == 4 || BitDepth == 8 || BitDepth == 16;
+            case 3: return BitDepth == 1 || BitDepth == 2 || BitDepth == 4 || BitDepth == 8;
+            case 2:
+            case 4:
+            case 6: return BitDepth == 8 || BitDepth == 16;
+            default: return false;
+        }
+    }
+
+    size_t GetScanlineSize() const
+    {
+        return (static_cast<size_t>(Width) * GetChannelCount() * BitDepth + 7) / 8;
+    }
+
+    // The distance between corresponding bytes of adjacent pixels, as per the filters' definition
+    size_t GetFilterBytesPerPixel() const
+    {
+        return std::max(static_cast<size_t>(GetChannelCount() * BitDepth / 8), size_t(1));
+    }
+};
+
+std::optional<PngHeader> TryReadHeader(
+    std::uint8_t const * data,
+    size_t size)
+{
+    if (size < PngDecoder::HeaderSize
+        || 0 != std::memcmp(data, PngSignature, sizeof(PngSignature))
+        || ReadUInt32BE(data + 8) != 13
+        || !IsChunkType(data + 12, "IHDR"))
+    {
+        return std::nullopt;
+    }
+
+    PngHeader header;
+    header.Width = static_cast<int>(ReadUInt32BE(data + 16));
+    header.Height = static_cast<int>(ReadUInt32BE(data + 20));
+    header.BitDepth = data[24];
+    header.ColorType = data[25];
+    header.InterlaceMethod = data[28];
+
+    return header;
+}
+
+PngHeader ReadHeader(
+    std::uint8_t const * data,
+    size_t size)
+{
+    auto const header = TryReadHeader(data, size);
+    if (!header)
+    {
+        throw GameException("Image data is not a PNG");
+    }
+
+    if (header->Width <= 0 || header->Height <= 0)
+    {
+        throw GameException("PNG image is empty");
+    }
+
+    if (header->GetChannelCount() == 0)
+    {
+        throw GameException("PNG image has an invalid color type");
+    }
+
+    if (!header->IsBitDepthValid())
+    {
+        throw GameException("PNG image has an invalid bit depth");
+    }
+
+    if (header->InterlaceMethod != 0)
+    {
+        throw GameException("Interlaced PNG images are not supported");
+    }
+
+    return *header;
+}
+
+/*
+ * Inflates and unfilters the image's scanlines, and converts them to RGBA;
+ * hands out each scanline - top to bottom - to the specified consumer.
+ */
+template<typename TScanlineConsumer>
+void DecodeScanlines(
+    std::uint8_t const * data,
+    size_t size,
+    PngHeader const & header,
+    TScanlineConsumer && scanlineConsumer)
+{
+    //
+    // Visit chunks, collecting the palette, the transparency, and the compressed data
+    //
+
+    std::array<rgbaColor, 256> palette;
+    palette.fill(rgbaColor(0, 0, 0, 0xff));
+
+    std::optional<std::array<std::uint16_t, 3>> transparentColor;
+
+    std::vector<std::uint8_t> compressedData;
+
+    for (size_t position = 8; ; )
+    {
+        if (position + 12 > size)
+        {
+            throw GameException("PNG image is truncated");
+        }
+
+        size_t const chunkLength = ReadUInt32BE(data + position);
+        std::uint8_t const * const chunkType = data + position + 4;
+        std::uint8_t const * const chunkData = data + position + 8;
+
+        if (chunkLength > size - position - 12)
+        {
+            throw GameException("PNG image is truncated");
+        }
+
+        if (IsChunkType(chunkType, "PLTE"))
+        {
+            for (size_t i = 0; i < std::min(chunkLength / 3, palette.size()); ++i)
+            {
+                palette[i] = rgbaColor(chunkData[i * 3], chunkData[i * 3 + 1], chunkData[i * 3 + 2], 0xff);
+            }
+        }
+        else if (IsChunkType(chunkType, "tRNS"))
+        {
+            if (header.ColorType == 3)
+            {
+                for (size_t i = 0; i < std::min(chunkLength, palette.size()); ++i)
+                {
+                    palette[i].a = chunkData[i];
+                }
+            }
+            else if (header.ColorType == 0 && chunkLength >= 2)
+            {
+                std::uint16_t const gray = static_cast<std::uint16_t>((chunkData[0] << 8) | chunkData[1]);
+                transparentColor = { gray, gray, gray };
+            }
+            else if (header.ColorType == 2 && chunkLength >= 6)
+            {
+                transparentColor = {
+                    static_cast<std::uint16_t>((chunkData[0] << 8) | chunkData[1]),
+                    static_cast<std::uint16_t>((chunkData[2] << 8) | chunkData[3]),
+                    static_cast<std::uint16_t>((chunkData[4] << 8) | chunkData[5]) };
+            }
+        }
+        else if (IsChunkType(chunkType, "IDAT"))
+        {
+            compressedData.insert(compressedData.end(), chunkData, chunkData + chunkLength);
+        }
+        else if (IsChunkType(chunkType, "IEND"))
+        {
+            break;
+        }
+
+        position += 12 + chunkLength;
+    }
+
+    //
+    // Inflate, assembling scanlines
+    //
+
+    size_t const scanlineSize = header.GetScanlineSize();
+    size_t const filterBpp = header.GetFilterBytesPerPixel();
+
+    // Current and previous scanlines; the previous one starts as all zeroes
+    std::vector<std::uint8_t> scanline(scanlineSize, 0);
+    std::vector<std::uint8_t> previousScanline(scanlineSize, 0);
+    std::vector<rgbaColor> rgbaScanline(header.Width);
+
+    int filterType = -1; // Not read yet
+    size_t scanlineFill = 0;
+    int y = 0;
+
+    auto const completeScanline = [&]()
+    {
+        std::uint8_t * const cur = scanline.data();
+        std::uint8_t const * const prev = previousScanline.data();
+
+        //
+        // Unfilter
+        //
+
+        switch (filterType)
+        {
+            case 0:
+            {
+                break;
+            }
+
+            case 1: // Sub
+            {
+                for (size_t i = filterBpp; i < scanlineSize; ++i)
+                    cur[i] = static_cast<std::uint8_t>(cur[i] + cur[i - filterBpp]);
+
+                break;
+            }
+
+            case 2: // Up
+            {
+                for (size_t i = 0; i < scanlineSize; ++i)
+                    cur[i] = static_cast<std::uint8_t>(cur[i] + prev[i]);
+
+                break;
+            }
+
+            case 3: // Average
+            {
+                for (size_t i = 0; i < filterBpp; ++i)
+                    cur[i] = static_cast<std::uint8_t>(cur[i] + (prev[i] >> 1));
+                for (size_t i = filterBpp; i < scanlineSize; ++i)
+                    cur[i] = static_cast<std::uint8_t>(cur[i] + ((cur[i - filterBpp] + prev[i]) >> 1));
+
+                break;
+            }
+
+            case 4: // Paeth
+            {
+                for (size_t i = 0; i < filterBpp; ++i)
+                    cur[i] = static_cast<std::uint8_t>(cur[i] + prev[i]);
+
+                for (size_t i = filterBpp; i < scanlineSize; ++i)
+                {
+                    int const a = cur[i - filterBpp];
+                    int const b = prev[i];
+                    int const c = prev[i - filterBpp];
+                    int const pa = std::abs(b - c);
+                    int const pb = std::abs(a - c);
+                    int const pc = std::abs(a + b - 2 * c);
+                    int const predictor = (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+                    cur[i] = static_cast<std::uint8_t>(cur[i] + predictor);
+                }
+
+                break;
+            }
+
+            default:
+            {
+                throw GameException("PNG image contains an invalid filter type");
+            }
+        }
+
+        //
+        // Convert to RGBA
+        //
+
+        int const bitDepth = header.BitDepth;
+
+        // Returns the 8-bit value of the sample at the specified index, together with its full-precision value
+        auto const getSample = [&](size_t sampleIndex) -> std::pair<std::uint8_t, std::uint16_t>
+        {
+            switch (bitDepth)
+            {
+                case 8:
+                {
+                    return { cur[sampleIndex], cur[sampleIndex] };
+                }
+
+                case 16:
+                {
+                    std::uint16_t const value = static_cast<std::uint16_t>((cur[sampleIndex * 2] << 8) | cur[sampleIndex * 2 + 1]);
+                    return { cur[sampleIndex * 2], value };
+                }
+
+                default:
+                {
+                    // 1, 2, or 4 bits, packed MSB-first
+                    size_t const bitIndex = sampleIndex * bitDepth;
+                    std::uint8_t const value = static_cast<std::uint8_t>(
+                        (cur[bitIndex / 8] >> (8 - bitDepth - (bitIndex % 8))) & ((1 << bitDepth) - 1));
+
+                    return { value, value };
+                }
+            }
+        };
+
+        // Scales a sub-byte grayscale value to 8 bits
+        auto const scaleGray = [bitDepth](std::uint8_t value) -> std::uint8_t
+        {
+            return bitDepth >= 8
+                ? value
+                : static_cast<std::uint8_t>(value * 255 / ((1 << bitDepth) - 1));
+        };
+
+        for (int x = 0; x < header.Width; ++x)
+        {
+            rgbaColor & dst = rgbaScanline[x];
+
+            switch (header.ColorType)
+            {
+                case 0:
+                {
+                    auto const [gray8, gray] = getSample(x);
+                    std::uint8_t const gray8Scaled = scaleGray(gray8);
+                    dst = rgbaColor(gray8Scaled, gray8Scaled, gray8Scaled, 0xff);
+                    if (transparentColor && (*transparentColor)[0] == gray)
+                        dst.a = 0;
+
+                    break;
+                }
+
+                case 2:
+                {
+                    auto const [r8, r] = getSample(x * 3);
+                    auto const [g8, g] = getSample(x * 3 + 1);
+                    auto const [b8, b] = getSample(x * 3 + 2);
+                    dst = rgbaColor(r8, g8, b8, 0xff);
+                    if (transparentColor && (*transparentColor)[0] == r && (*transparentColor)[1] == g && (*transparentColor)[2] == b)
+                        dst.a = 0;
+
+                    break;
+                }
+
+                case 3:
+                {
+                    dst = palette[getSample(x).first];
+                    break;
+                }
+
+                case 4:
+                {
+                    std::uint8_t const gray8 = getSample(x * 2).first;
+                    dst = rgbaColor(gray8, gray8, gray8, getSample(x * 2 + 1).first);
+                    break;
+                }
+
+                case 6:
+                {
+                    dst = rgbaColor(getSample(x * 4).first, getSample(x * 4 + 1).first, getSample(x * 4 + 2).first, getSample(x * 4 + 3).first);
+                    break;
+                }
+            }
+        }
+
+        scanlineConsumer(y, rgbaScanline.data());
+
+        std::swap(scanline, previousScanline);
+        ++y;
+    };
+
+    Inflate(
+        compressedData.data(),
+        compressedData.size(),
+        [&](std::uint8_t const * bytes, size_t count)
+        {
+            for (size_t i = 0; i < count && y < header.Height; )
+            {
+                if (filterType < 0)
+                {
+                    filterType = bytes[i++];
+                    continue;
+                }
+
+                size_t const chunk = std::min(count - i, scanlineSize - scanlineFill);
+                std::memcpy(scanline.data() + scanlineFill, bytes + i, chunk);
+                scanlineFill += chunk;
+                i += chunk;
+
+                if (scanlineFill == scanlineSize)
+                {
+                    completeScanline();
+
+                    filterType = -1;
+                    scanlineFill = 0;
+                }
+            }
+        });
+
+    if (y < header.Height)
+    {
+        throw GameException("PNG image data is truncated");
+    }
+}
+
+template<typename TColor>
+inline TColor FromRgba(rgbaColor const & c);
+
+template<>
+inline rgbaColor FromRgba<rgbaColor>(rgbaColor const & c)
+{
+    return c;
+}
+
+template<>
+inline rgbColor FromRgba<rgbColor>(rgbaColor const & c)
+{
+    return rgbColor(c.r, c.g, c.b);
+}
+
+}
+
+bool PngDecoder::CanDecode(
+    std::uint8_t const * data,
+    size_t size)
+{
+    auto const header = TryReadHeader(data, size);
+    return header.has_value()
+        && header->GetChannelCount() != 0
+        && header->IsBitDepthValid()
+        && header->InterlaceMethod == 0;
+}
+
+ImageSize PngDecoder::DecodeSize(
+    std::uint8_t const * data,
+    size_t size)
+{
+    auto const header = ReadHeader(data, size);
+    return ImageSize(header.Width, header.Height);
+}
+
+template<typename TColor>
+ImageData<TColor> PngDecoder::Decode(
+    std::uint8_t const * data,
+    size_t size)
+{
+    auto const header = ReadHeader(data, size);
+
+    auto imageData = std::make_unique<TColor[]>(static_cast<size_t>(header.Width) * static_cast<size_t>(header.Height));
+
+    DecodeScanlines(
+        data,
+        size,
+        header,
+        [&](int y, rgbaColor const * scanline)
+        {
+            // Flip to lower-left origin
+            TColor * const dst = imageData.get() + static_cast<size_t>(header.Height - 1 - y) * header.Width;
+            for (int x = 0; x < header.Width; ++x)
+            {
+                dst[x] = FromRgba<TColor>(scanline[x]);
+            }
+        });
+
+    return ImageData<TColor>(
+        header.Width,
+        header.Height,
+        std::move(imageData));
+}
+
+template<typename TColor>
+ImageData<TColor> PngDecoder::DecodeAndDownscale(
+    std::uint8_t const * data,
+    size_t size,
+    ImageSize const & targetSize)
+{
+    auto const header = ReadHeader(data, size);
+
+    if (targetSize.Width <= 0 || targetSize.Height <= 0
+        || targetSize.Width > header.Width || targetSize.Height > header.Height)
+    {
+        throw GameException("Cannot downscale a " + ImageSize(header.Width, header.Height).ToString() + " image to " + targetSize.ToString());
+    }
+
+    auto imageData = std::make_unique<TColor[]>(static_cast<size_t>(targetSize.Width) * static_cast<size_t>(targetSize.Height));
+
+    // Target column of each source column
+    std::vector<int> targetXs(header.Width);
+    for (int x = 0; x < header.Width; ++x)
+    {
+        targetXs[x] = static_cast<int>(static_cast<std::int64_t>(x) * targetSize.Width / header.Width);
+    }
+
+    // Accumulation of the current target row
+    std::vector<rgbaColorAccumulation> accumulationRow(targetSize.Width);
+    int currentTargetY = 0;
+
+    auto const emitTargetRow = [&]()
+    {
+        // Flip to lower-left origin
+        TColor * const dst = imageData.get() + static_cast<size_t>(targetSize.Height - 1 - currentTargetY) * targetSize.Width;
+        for (int x = 0; x < targetSize.Width; ++x)
+        {
+            dst[x] = FromRgba<TColor>(accumulationRow[x].toRgbaColor());
+            accumulationRow[x] = rgbaColorAccumulation();
+        }
+    };
+
+    DecodeScanlines(
+        data,
+        size,
+        header,
+        [&](int y, rgbaColor const * scanline)
+        {
+            int const targetY = static_cast<int>(static_cast<std::int64_t>(y) * targetSize.Height / header.Height);
+            if (targetY != currentTargetY)
+            {
+                emitTargetRow();
+                currentTargetY = targetY;
+            }
+
+            for (int x = 0; x < header.Width; ++x)
+            {
+                accumulationRow[targetXs[x]] += scanline[x];
+            }
+        });
+
+    emitTargetRow();
+
+    return ImageData<TColor>(
+        targetSize,
+        std::move(imageData));
+}
+
+template ImageData<rgbColor> PngDecoder::Decode<rgbColor>(std::uint8_t const * data, size_t size);
+template ImageData<rgbaColor> PngDecoder::Decode<rgbaColor>(std::uint8_t const * data, size_t size);
+template ImageData<rgbColor> PngDecoder::DecodeAndDownscale<rgbColor>(std::uint8_t const * data, size_t size, ImageSize const & targetSize);
+template ImageData<rgbaColor> PngDecoder::DecodeAndDownscale<rgbaColor>(std::uint8_t const * data, size_t size, ImageSize const & targetSize);
@@ -0,0 +1,55 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2020-11-08
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "ImageData.h"
+#include "ImageSize.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * A self-contained decoder for PNG images.
+ *
+ * The decoder holds no global state and may thus be used concurrently from
+ * multiple threads. Scanlines are inflated, unfiltered, and converted one
+ * at a time directly into the target image, whose origin is at lower-left
+ * as per our image standards.
+ *
+ * Supports all color types and bit depths, but not interlaced images.
+ */
+class PngDecoder
+{
+public:
+
+    // The number of bytes needed to decode the header
+    static size_t constexpr HeaderSize = 8 + 8 + 13;
+
+    // Checks whether the data is a PNG which we are able to decode;
+    // requires at least HeaderSize bytes
+    static bool CanDecode(
+        std::uint8_t const * data,
+        size_t size);
+
+    // Decodes the size of the image; requires at least HeaderSize bytes
+    static ImageSize DecodeSize(
+        std::uint8_t const * data,
+        size_t size);
+
+    template<typename TColor>
+    static ImageData<TColor> Decode(
+        std::uint8_t const * data,
+        size_t size);
+
+    // Decodes the image and downscales it to the specified size - which may not be larger
+    // than the image - by averaging the pixels of each target pixel's area; scanlines are
+    // accumulated as they are decoded, hence the full-size image is never materialized
+    template<typename TColor>
+    static ImageData<TColor> DecodeAndDownscale(
+        std::uint8_t const * data,
+        size_t size,
+        ImageSize const & targetSize);
+};
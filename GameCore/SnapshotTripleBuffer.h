@@ -0,0 +1,170 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2020-12-05
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <mutex>
+
+/*
+ * Hands snapshots over from one writer thread to one reader thread, without
+ * either thread ever waiting for the other to finish with a snapshot.
+ *
+ * Of the three slots, the writer owns one, while the other two hold the latest
+ * and the previous published snapshots; readers get both of them, so that they
+ * may interpolate between the two.
+ *
+ * A snapshot completed while the reader is still reading is published as soon
+ * as the reader is done - unless by then the writer has started overwriting it
+ * with a newer one; readers must thus not assume that the previous and the
+ * latest snapshots are consecutive.
+ *
+ * The lock only protects the slot indices, and is never held while snapshots
+ * are being written or read.
+ */
+template<typename TSnapshot>
+class SnapshotTripleBuffer
+{
+public:
+
+    struct ReadView
+    {
+        TSnapshot const * Previous; // Same as Latest when only one snapshot has been published
+        TSnapshot const * Latest; // nullptr when nothing has been published yet
+    };
+
+public:
+
+    template<typename... TArgs>
+    explicit SnapshotTripleBuffer(TArgs const & ... args)
+        : mSlots{ TSnapshot(args...), TSnapshot(args...), TSnapshot(args...) }
+        , mLock()
+        , mWriteIndex(0)
+        , mLatestIndex(NoSlot)
+        , mPreviousIndex(NoSlot)
+        , mIsWriting(false)
+        , mIsReading(false)
+        , mHasPendingWrite(false)
+    {}
+
+    SnapshotTripleBuffer(SnapshotTripleBuffer const &) = delete;
+    SnapshotTripleBuffer & operator=(SnapshotTripleBuffer const &) = delete;
+
+    /*
+     * Returns the slot to write the next snapshot into; the slot is guaranteed
+     * to not be read until EndWrite() is invoked.
+     */
+    TSnapshot & BeginWrite()
+    {
+        std::lock_guard<std::mutex> const lock{ mLock };
+
+        assert(!mIsWriting);
+        mIsWriting = true;
+
+        // If the last write has not made it yet, we're overwriting it
+        mHasPendingWrite = false;
+
+        return mSlots[mWriteIndex];
+    }
+
+    void EndWrite()
+    {
+        std::lock_guard<std::mutex> const lock{ mLock };
+
+        assert(mIsWriting);
+        mIsWriting = false;
+
+        if (!mIsReading)
+        {
+            Publish();
+        }
+        else
+        {
+            // Publish it when the reader is done
+            mHasPendingWrite = true;
+        }
+    }
+
+    /*
+     * Returns the latest two published snapshots; they are guaranteed to not be
+     * written until EndRead() is invoked.
+     */
+    ReadView BeginRead()
+    {
+        std::lock_guard<std::mutex> const lock{ mLock };
+
+        assert(!mIsReading);
+        mIsReading = true;
+
+        if (mLatestIndex == NoSlot)
+        {
+            return ReadView{ nullptr, nullptr };
+        }
+
+        assert(mPreviousIndex != NoSlot);
+
+        return ReadView{ &(mSlots[mPreviousIndex]), &(mSlots[mLatestIndex]) };
+    }
+
+    void EndRead()
+    {
+        std::lock_guard<std::mutex> const lock{ mLock };
+
+        assert(mIsReading);
+        mIsReading = false;
+
+        if (mHasPendingWrite)
+        {
+            assert(!mIsWriting);
+
+            Publish();
+
+            mHasPendingWrite = false;
+        }
+    }
+
+private:
+
+    void Publish()
+    {
+        if (mLatestIndex == NoSlot)
+        {
+            // First snapshot, it's both the latest and the previous one
+            mLatestIndex = mWriteIndex;
+            mPreviousIndex = mWriteIndex;
+            mWriteIndex = (mWriteIndex + 1) % 3;
+        }
+        else
+        {
+            size_t const freeIndex = (mPreviousIndex != mLatestIndex)
+                ? mPreviousIndex
+                : 3 - mLatestIndex - mWriteIndex;
+
+            mPreviousIndex = mLatestIndex;
+            mLatestIndex = mWriteIndex;
+            mWriteIndex = freeIndex;
+        }
+
+        assert(mWriteIndex != mLatestIndex && mWriteIndex != mPreviousIndex);
+    }
+
+private:
+
+    static size_t constexpr NoSlot = 3;
+
+    std::array<TSnapshot, 3> mSlots;
+
+    std::mutex mLock;
+
+    size_t mWriteIndex;
+    size_t mLatestIndex;
+    size_t mPreviousIndex;
+
+    bool mIsWriting;
+    bool mIsReading;
+    bool mHasPendingWrite; // A write has completed while reading, and is waiting to be published
+};
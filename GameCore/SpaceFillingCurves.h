@@ -0,0 +1,98 @@
+/***************************************************************************************
+* Original Author:		Gabriele Giuseppini
+* Created:				2020-11-07
+* Copyright:			Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+
+/*
+ * Keys of 2D integral coordinates along space-filling curves; sorting
+ * elements by these keys yields an order in which elements that are
+ * close in 2D space tend to also be close in the 1D order.
+ */
+namespace SpaceFillingCurves {
+
+/*
+ * Returns the Morton (Z-order) key of the specified coordinates, obtained
+ * by interleaving the bits of x (even bits) with the bits of y (odd bits).
+ */
+inline std::uint32_t MortonKey(
+    std::uint16_t x,
+    std::uint16_t y)
+{
+    auto const spread = [](std::uint32_t v) -> std::uint32_t
+    {
+        v = (v | (v << 8)) & 0x00ff00ffu;
+        v = (v | (v << 4)) & 0x0f0f0f0fu;
+        v = (v | (v << 2)) & 0x33333333u;
+        v = (v | (v << 1)) & 0x55555555u;
+        return v;
+    };
+
+    return spread(x) | (spread(y) << 1);
+}
+
+/*
+ * Returns the Hilbert key of the specified coordinates, on a curve
+ * filling a square of side 2^order.
+ *
+ * Unlike the Morton curve, consecutive keys along the Hilbert curve are
+ * always adjacent in 2D space, which gives better locality at the cost
+ * of a (slightly) more expensive key calculation.
+ */
+inline std::uint32_t HilbertKey(
+    std::uint32_t x,
+    std::uint32_t y,
+    int order)
+{
+    assert(order >= 0 && order <= 16);
+    assert(x < (std::uint32_t(1) << order) && y < (std::uint32_t(1) << order));
+
+    std::uint32_t key = 0;
+
+    for (std::uint32_t s = (std::uint32_t(1) << order) >> 1; s > 0; s >>= 1)
+    {
+        std::uint32_t const rx = (x & s) > 0 ? 1 : 0;
+        std::uint32_t const ry = (y & s) > 0 ? 1 : 0;
+
+        key += s * s * ((3 * rx) ^ ry);
+
+        // Rotate quadrant
+        if (ry == 0)
+        {
+            if (rx == 1)
+            {
+                x = s - 1 - (x & (s - 1));
+                y = s - 1 - (y & (s - 1));
+            }
+
+            std::uint32_t const t = x;
+            x = y;
+            y = t;
+        }
+
+        x &= (s - 1);
+        y &= (s - 1);
+    }
+
+    return key;
+}
+
+/*
+ * Returns the smallest order of a Hilbert curve covering the specified size.
+ */
+inline int HilbertOrder(std::uint32_t size)
+{
+    int order = 0;
+    while ((std::uint32_t(1) << order) < size)
+    {
+        ++order;
+    }
+
+    return order;
+}
+
+}
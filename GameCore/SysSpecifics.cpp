@@ -5,6 +5,18 @@
 ***************************************************************************************/
 #include "SysSpecifics.h"
 
+#if defined(FS_OS_LINUX)
+#include <fstream>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#elif defined(FS_OS_MACOS)
+#include <mach/mach.h>
+#elif defined(FS_OS_WINDOWS)
+#include <windows.h>
+#include <psapi.h>
+#endif
+
 #if defined(FS_ARCHITECTURE_ARM)
 #pragma message ("ARCHITECTURE:FS_ARCHITECTURE_ARM")
 #elif defined(FS_ARCHITECTURE_X86_32)
@@ -23,4 +35,76 @@
 #pragma message ("OS:FS_OS_WINDOWS")
 #else
 #pragma message ("OS:<UNKNOWN>")
-#endif
\ No newline at end of file
+#endif
+
+std::optional<size_t> GetProcessResidentMemoryBytes()
+{
+#if defined(FS_OS_LINUX)
+
+    // Second field of statm is the number of resident pages
+    std::ifstream statm("/proc/self/statm");
+    size_t totalPages;
+    size_t residentPages;
+    if (statm >> totalPages >> residentPages)
+    {
+        return residentPages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+
+    return std::nullopt;
+
+#elif defined(FS_OS_MACOS)
+
+    mach_task_basic_info_data_t info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (KERN_SUCCESS == task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count))
+    {
+        return static_cast<size_t>(info.resident_size);
+    }
+
+    return std::nullopt;
+
+#elif defined(FS_OS_WINDOWS)
+
+    PROCESS_MEMORY_COUNTERS counters;
+    if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return static_cast<size_t>(counters.WorkingSetSize);
+    }
+
+    return std::nullopt;
+
+#else
+
+    return std::nullopt;
+
+#endif
+}
+
+bool PinCurrentThreadToHardwareThread(size_t hardwareThreadIndex)
+{
+#if defined(FS_OS_LINUX)
+
+    if (hardwareThreadIndex >= CPU_SETSIZE)
+        return false;
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(hardwareThreadIndex, &cpuSet);
+
+    return 0 == pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+
+#elif defined(FS_OS_WINDOWS)
+
+    if (hardwareThreadIndex >= sizeof(DWORD_PTR) * 8)
+        return false;
+
+    return 0 != SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << hardwareThreadIndex);
+
+#else
+
+    // MacOS only supports affinity hints, which we don't bother with
+    (void)hardwareThreadIndex;
+    return false;
+
+#endif
+}
@@ -8,6 +8,7 @@
 #include <cassert>
 #include <cstdint>
 #include <memory>
+#include <optional>
 
 #ifdef _MSC_VER
 #include <malloc.h>
@@ -65,6 +66,18 @@
 
 #define restrict __restrict
 
+/*
+ * Returns the resident set size of this process, or none when not available
+ * on this platform.
+ */
+std::optional<size_t> GetProcessResidentMemoryBytes();
+
+/*
+ * Restricts the calling thread to run on the specified hardware thread only;
+ * returns false when not supported on this platform, or when failing.
+ */
+bool PinCurrentThreadToHardwareThread(size_t hardwareThreadIndex);
+
 template<typename T>
 inline constexpr T ceil_power_of_two(T value)
 {
@@ -7,111 +7,188 @@
 
 #include "FloatingPoint.h"
 #include "Log.h"
+#include "SysSpecifics.h"
 
 #include <algorithm>
 
 TaskThreadPool::TaskThreadPool()
-    : TaskThreadPool(
-        std::max(
-            size_t(1),
-            static_cast<size_t>(std::thread::hardware_concurrency())))
+    : TaskThreadPool(GetHardwareThreadCount())
 {
 }
 
 TaskThreadPool::TaskThreadPool(size_t hardwareThreads)
+    : TaskThreadPool(hardwareThreads, false)
+{
+}
+
+TaskThreadPool::TaskThreadPool(
+    size_t hardwareThreads,
+    bool doPinThreads)
     : mLock()
     , mThreads()
+    , mParallelism(1)
+    , mDoPinThreads(false)
     , mWorkerThreadSignal()
     , mMainThreadSignal()
-    , mRemainingTasks()
-    , mTasksToComplete(0)
+    , mQueuedTasks()
     , mIsStop(false)
+    , mReconfigureLock()
+    , mIsStatisticsEnabled(false)
+    , mTotalTaskCount(0)
+    , mTotalTaskBusyNanoseconds(0)
 {
     assert(hardwareThreads > 0);
 
-    LogMessage("Number of hardware threads: ", hardwareThreads);
-
-    // Start threads
-    for (size_t i = 0; i < hardwareThreads - 1; ++i)
-    {
-        mThreads.emplace_back(&TaskThreadPool::ThreadLoop, this);
-    }
+    StartThreads(hardwareThreads, doPinThreads);
 }
 
 TaskThreadPool::~TaskThreadPool()
 {
-    // Tell all threads to stop
-    {
-        std::unique_lock const lock{ mLock };
+    StopThreads();
+}
 
-        mIsStop = true;
+void TaskThreadPool::Reconfigure(
+    size_t hardwareThreads,
+    bool doPinThreads)
+{
+    if (hardwareThreads == 0)
+    {
+        hardwareThreads = GetHardwareThreadCount();
     }
 
-    // Signal threads
-    mWorkerThreadSignal.notify_all();
+    std::lock_guard const reconfigureLock{ mReconfigureLock };
 
-    // Wait for all threads to exit
-    for (auto & t : mThreads)
+    if (hardwareThreads == mParallelism && doPinThreads == mDoPinThreads)
     {
-        t.join();
+        // Nothing to do
+        return;
     }
+
+    StopThreads();
+    StartThreads(hardwareThreads, doPinThreads);
 }
 
 void TaskThreadPool::Run(std::vector<Task> const & tasks)
 {
-    assert(mRemainingTasks.empty());
-    assert(0 == mTasksToComplete);
+    if (tasks.empty())
+        return;
+
+    Batch batch(tasks.size() - 1);
 
     // Queue all the tasks except the first one,
     // which we're gonna run immediately now to guarantee
     // that the first task always runs on the main thread
+    if (batch.TasksToComplete > 0)
     {
-        std::unique_lock const lock{ mLock };
-
-        for (size_t t = 1; t < tasks.size(); ++t)
         {
-            mRemainingTasks.push_back(tasks[t]);
+            std::unique_lock const lock{ mLock };
+
+            for (size_t t = 1; t < tasks.size(); ++t)
+            {
+                mQueuedTasks.emplace_back(&(tasks[t]), &batch);
+            }
         }
 
-        mTasksToComplete = mRemainingTasks.size();
+        // Signal threads
+        mWorkerThreadSignal.notify_all();
     }
 
-    // Signal threads
-    mWorkerThreadSignal.notify_all();
-
     // Run the first task on the main thread
-    if (!tasks.empty())
-    {
-        RunTask(tasks.front());
-    }
-
-    // Run the remaining tasks on own thread, if needed
-    RunRemainingTasksLoop();
+    RunTask(tasks.front());
 
-    // Only returns when there are no more tasks
-    assert(mRemainingTasks.empty());
+    // Run the remaining tasks of this batch on own thread, if needed
+    RunQueuedTasksLoop(&batch);
 
     // Wait until all tasks are completed
     {
         std::unique_lock lock{ mLock };
 
-        if (0 != mTasksToComplete)
+        if (0 != batch.TasksToComplete)
         {
             // Wait for signal
             mMainThreadSignal.wait(
                 lock,
-                [this]
+                [&batch]
                 {
-                    return 0 == mTasksToComplete;
+                    return 0 == batch.TasksToComplete;
                 });
 
-            assert(0 == mTasksToComplete);
+            assert(0 == batch.TasksToComplete);
         }
     }
 }
 
-void TaskThreadPool::ThreadLoop()
+size_t TaskThreadPool::GetHardwareThreadCount()
+{
+    return std::max(
+        size_t(1),
+        static_cast<size_t>(std::thread::hardware_concurrency()));
+}
+
+void TaskThreadPool::StartThreads(
+    size_t hardwareThreads,
+    bool doPinThreads)
+{
+    assert(hardwareThreads > 0);
+    assert(mThreads.empty());
+
+    LogMessage("Number of hardware threads: ", hardwareThreads, (doPinThreads ? " (pinned)" : ""));
+
+    mDoPinThreads = doPinThreads;
+
+    // Start threads
+    for (size_t i = 0; i < hardwareThreads - 1; ++i)
+    {
+        mThreads.emplace_back(&TaskThreadPool::ThreadLoop, this, i);
+    }
+
+    mParallelism = hardwareThreads;
+}
+
+void TaskThreadPool::StopThreads()
+{
+    // Tell all threads to stop
+    {
+        std::unique_lock const lock{ mLock };
+
+        mIsStop = true;
+    }
+
+    // Signal threads
+    mWorkerThreadSignal.notify_all();
+
+    // Wait for all threads to exit; tasks they leave in the queue
+    // are run by the threads that queued them
+    for (auto & t : mThreads)
+    {
+        t.join();
+    }
+
+    mThreads.clear();
+
+    {
+        std::unique_lock const lock{ mLock };
+
+        mIsStop = false;
+    }
+}
+
+void TaskThreadPool::ThreadLoop(size_t threadIndex)
 {
+    //
+    // Pin thread, if requested; we leave the first hardware thread
+    // to the calling threads
+    //
+
+    if (mDoPinThreads)
+    {
+        size_t const hardwareThreadIndex = (threadIndex + 1) % GetHardwareThreadCount();
+        if (!PinCurrentThreadToHardwareThread(hardwareThreadIndex))
+        {
+            LogMessage("Cannot pin thread ", threadIndex, " to hardware thread ", hardwareThreadIndex);
+        }
+    }
+
     //
     // Initialize floating point handling
     //
@@ -124,7 +201,7 @@ void TaskThreadPool::ThreadLoop()
 #endif
 
     //
-    // Run thread loop until thread pool is destroyed
+    // Run thread loop until thread pool is stopped
     //
 
     while (true)
@@ -143,7 +220,7 @@ void TaskThreadPool::ThreadLoop()
                 lock,
                 [this]
                 {
-                    return mIsStop || !mRemainingTasks.empty();
+                    return mIsStop || !mQueuedTasks.empty();
                 });
 
             if (mIsStop)
@@ -155,17 +232,17 @@ void TaskThreadPool::ThreadLoop()
 
         // Tasks have been queued...
 
-        // ...run the remaining tasks
-        RunRemainingTasksLoop();
+        // ...run the queued tasks, of whichever batch
+        RunQueuedTasksLoop(nullptr);
     }
 
     LogMessage("Thread exiting");
 }
 
-void TaskThreadPool::RunRemainingTasksLoop()
+void TaskThreadPool::RunQueuedTasksLoop(Batch const * batch)
 {
     //
-    // Run tasks until queue is empty
+    // Run tasks until there are no more tasks for us
     //
 
     while (true)
@@ -174,18 +251,30 @@ void TaskThreadPool::RunRemainingTasksLoop()
         // De-queue a task
         //
 
-        Task task;
+        Task const * task = nullptr;
+        Batch * parentBatch = nullptr;
         {
             std::unique_lock const lock{ mLock };
 
-            if (!mRemainingTasks.empty())
+            auto const it = (batch == nullptr)
+                ? mQueuedTasks.begin()
+                : std::find_if(
+                    mQueuedTasks.begin(),
+                    mQueuedTasks.end(),
+                    [batch](QueuedTask const & qt)
+                    {
+                        return qt.ParentBatch == batch;
+                    });
+
+            if (it != mQueuedTasks.end())
             {
-                task = std::move(mRemainingTasks.front());
-                mRemainingTasks.pop_front();
+                task = it->TaskPtr;
+                parentBatch = it->ParentBatch;
+                mQueuedTasks.erase(it);
             }
         }
 
-        if (!task)
+        if (nullptr == task)
         {
             // No more tasks
             return;
@@ -195,7 +284,7 @@ void TaskThreadPool::RunRemainingTasksLoop()
         // Run the task
         //
 
-        RunTask(task);
+        RunTask(*task);
 
         //
         // Signal task completion
@@ -204,14 +293,14 @@ void TaskThreadPool::RunRemainingTasksLoop()
         {
             std::unique_lock const lock{ mLock };
 
-            assert(mTasksToComplete > 0);
+            assert(parentBatch->TasksToComplete > 0);
 
-            --mTasksToComplete;
-            if (0 == mTasksToComplete)
+            --(parentBatch->TasksToComplete);
+            if (0 == parentBatch->TasksToComplete)
             {
-                // All tasks completed...
+                // All tasks of the batch completed...
 
-                // ...signal main thread
+                // ...signal calling threads
                 mMainThreadSignal.notify_all();
             }
         }
@@ -219,6 +308,24 @@ void TaskThreadPool::RunRemainingTasksLoop()
 }
 
 void TaskThreadPool::RunTask(Task const & task)
+{
+    if (!mIsStatisticsEnabled.load(std::memory_order_relaxed))
+    {
+        RunTaskSafe(task);
+        return;
+    }
+
+    auto const startTimestamp = std::chrono::steady_clock::now();
+
+    RunTaskSafe(task);
+
+    mTotalTaskBusyNanoseconds.fetch_add(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTimestamp).count(),
+        std::memory_order_relaxed);
+    mTotalTaskCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TaskThreadPool::RunTaskSafe(Task const & task)
 {
     try
     {
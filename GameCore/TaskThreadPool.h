@@ -5,8 +5,11 @@
 ***************************************************************************************/
 #pragma once
 
+#include <atomic>
 #include <cassert>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <mutex>
 #include <deque>
@@ -16,6 +19,9 @@
 /*
  * This class implements a thread pool that executes batches of tasks.
  *
+ * Multiple threads may run batches concurrently on the same pool - e.g. the
+ * simulation thread and the render thread; worker threads pick up tasks from
+ * all batches, while each calling thread only helps with its own batch.
  */
 class TaskThreadPool
 {
@@ -23,14 +29,63 @@ public:
 
     using Task = std::function<void()>;
 
+    /*
+     * Cumulative counters of the tasks run while statistics were enabled.
+     */
+    struct Statistics
+    {
+        std::uint64_t TaskCount;
+        std::chrono::nanoseconds TaskBusyDuration; // Summed across all threads
+
+        Statistics(
+            std::uint64_t taskCount,
+            std::chrono::nanoseconds taskBusyDuration)
+            : TaskCount(taskCount)
+            , TaskBusyDuration(taskBusyDuration)
+        {}
+    };
+
 public:
 
+    /*
+     * Uses as many threads as hardware threads.
+     */
     TaskThreadPool();
 
     TaskThreadPool(size_t hardwareThreads);
 
+    /*
+     * When pinning threads, each worker thread is pinned to its own
+     * hardware thread, leaving the first one to the calling threads.
+     */
+    TaskThreadPool(
+        size_t hardwareThreads,
+        bool doPinThreads);
+
     ~TaskThreadPool();
 
+    /*
+     * The number of threads that may run tasks concurrently, including the main thread.
+     */
+    size_t GetParallelism() const
+    {
+        return mParallelism;
+    }
+
+    bool GetDoPinThreads() const
+    {
+        return mDoPinThreads;
+    }
+
+    /*
+     * Changes the number of threads and their pinning, re-creating the worker threads;
+     * batches in progress on other threads are completed by their calling threads.
+     * A hardware thread count of zero means as many threads as hardware threads.
+     */
+    void Reconfigure(
+        size_t hardwareThreads,
+        bool doPinThreads);
+
     /*
      * The first task is guaranteed to run on the main thread.
      */
@@ -45,14 +100,70 @@ public:
         tasks.clear();
     }
 
+    /*
+     * Statistics are disabled by default, so that tasks do not pay for
+     * sampling the clock and updating the shared counters.
+     */
+    bool IsStatisticsEnabled() const
+    {
+        return mIsStatisticsEnabled.load(std::memory_order_relaxed);
+    }
+
+    void SetStatisticsEnabled(bool value)
+    {
+        mIsStatisticsEnabled.store(value, std::memory_order_relaxed);
+    }
+
+    Statistics GetStatistics() const
+    {
+        return Statistics(
+            mTotalTaskCount.load(std::memory_order_relaxed),
+            std::chrono::nanoseconds(mTotalTaskBusyNanoseconds.load(std::memory_order_relaxed)));
+    }
+
+    static size_t GetHardwareThreadCount();
+
 private:
 
-    void ThreadLoop();
+    // The state of one invocation of Run()
+    struct Batch
+    {
+        // The number of queued tasks awaiting for completion
+        size_t TasksToComplete;
+
+        Batch(size_t tasksToComplete)
+            : TasksToComplete(tasksToComplete)
+        {}
+    };
+
+    struct QueuedTask
+    {
+        Task const * TaskPtr;
+        Batch * ParentBatch;
+
+        QueuedTask(
+            Task const * taskPtr,
+            Batch * parentBatch)
+            : TaskPtr(taskPtr)
+            , ParentBatch(parentBatch)
+        {}
+    };
+
+    void StartThreads(
+        size_t hardwareThreads,
+        bool doPinThreads);
+
+    void StopThreads();
 
-    void RunRemainingTasksLoop();
+    void ThreadLoop(size_t threadIndex);
+
+    // Runs all the queued tasks of the specified batch, or of any batch if none
+    void RunQueuedTasksLoop(Batch const * batch);
 
     void RunTask(Task const & task);
 
+    void RunTaskSafe(Task const & task);
+
 private:
 
     // Our thread lock
@@ -60,20 +171,26 @@ private:
 
     // Our threads
     std::vector<std::thread> mThreads;
+    std::atomic<size_t> mParallelism;
+    bool mDoPinThreads;
 
     // The condition variable to wake up threads
     std::condition_variable mWorkerThreadSignal;
 
-    // The condition variable to wake up the main thread
+    // The condition variable to wake up the calling threads
     std::condition_variable mMainThreadSignal;
 
-    // The tasks currently awaiting to be picked up;
-    // expected to be empty at each Run invocation
-    std::deque<Task> mRemainingTasks;
-
-    // The number of tasks awaiting for completion
-    size_t mTasksToComplete;
+    // The tasks currently awaiting to be picked up, from all batches
+    std::deque<QueuedTask> mQueuedTasks;
 
-    // Set to true when have to stop
+    // Set to true when threads have to stop
     bool mIsStop;
+
+    // Serializes reconfigurations
+    std::mutex mReconfigureLock;
+
+    // Statistics
+    std::atomic<bool> mIsStatisticsEnabled;
+    std::atomic<std::uint64_t> mTotalTaskCount;
+    std::atomic<std::int64_t> mTotalTaskBusyNanoseconds;
 };
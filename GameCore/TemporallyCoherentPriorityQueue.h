@@ -64,9 +64,16 @@ public:
         auto const e = mHeap[1].elementIndex;
         mHeapIndices[e] = HeapIndexNone;
 
+        if (mHeapSize == 1)
+        {
+            // Root was the last one
+            --mHeapSize;
+            return e;
+        }
+
         // Move smallest to root
         mHeap[1] = mHeap[mHeapSize];
-        mHeapIndices[mHeap[mHeapSize].elementIndex] = 1;
+        mHeapIndices[mHeap[1].elementIndex] = 1;
         --mHeapSize;
 
         fix_down(1);
@@ -132,10 +139,17 @@ public:
             // Remove element
             mHeapIndices[e] = HeapIndexNone;
 
+            if (i == mHeapSize)
+            {
+                // Element was at the bottom, nothing to move
+                --mHeapSize;
+                return;
+            }
+
             // Move bottom here
             auto oldP = mHeap[i].priority;
             mHeap[i] = mHeap[mHeapSize];
-            mHeapIndices[mHeap[mHeapSize].elementIndex] = i;
+            mHeapIndices[mHeap[i].elementIndex] = i;
             --mHeapSize;
 
             // Fix heap
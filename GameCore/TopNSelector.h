@@ -0,0 +1,208 @@
+/***************************************************************************************
+* Original Author:      Gabriele Giuseppini
+* Created:              2020-11-29
+* Copyright:            Gabriele Giuseppini  (https://github.com/GabrieleGiuseppini)
+***************************************************************************************/
+#pragma once
+
+#include "GameTypes.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <memory>
+
+/*
+ * This class selects, out of a stream of elements, the (at most) N elements
+ * with the highest priorities.
+ *
+ * Elements are filtered against the lowest priority of the current top N, and
+ * the survivors are staged in a buffer which is truncated to the top N - via a
+ * partial selection - whenever it fills up. The filter is branch-less, so that
+ * loops emplacing elements may be vectorized by the compiler.
+ *
+ * Selectors populated from disjoint sets of elements - e.g. by different threads
+ * over different ranges of elements - may be merged together.
+ *
+ * Priorities must be greater than negative infinity (or than the lowest value, for
+ * types without infinity); elements with equal priorities are selected arbitrarily.
+ */
+template <typename PriorityType, typename ElementType = ElementIndex>
+class TopNSelector
+{
+public:
+
+    struct Entry
+    {
+        ElementType Element;
+        PriorityType Priority;
+
+        Entry() = default;
+
+        Entry(
+            ElementType element,
+            PriorityType priority)
+            : Element(element)
+            , Priority(priority)
+        {}
+    };
+
+public:
+
+    explicit TopNSelector(size_t maxSize)
+        : mCapacity(CalculateCapacity(maxSize))
+        , mEntries(std::make_unique<Entry[]>(mCapacity))
+        , mAllocatedMaxSize(maxSize)
+    {
+        reset(maxSize);
+    }
+
+    TopNSelector(TopNSelector && other) = default;
+
+    inline bool empty() const noexcept
+    {
+        return mSize == 0;
+    }
+
+    /*
+     * The number of elements currently held, which is larger than N
+     * until the selector is finalized.
+     */
+    inline size_t size() const noexcept
+    {
+        return mSize;
+    }
+
+    inline size_t max_size() const noexcept
+    {
+        return mMaxSize;
+    }
+
+    inline Entry const & operator[](size_t index) const noexcept
+    {
+        assert(index < mSize);
+        return mEntries[index];
+    }
+
+    inline void emplace(
+        ElementType element,
+        PriorityType priority) noexcept
+    {
+        assert(mSize < mCapacity);
+
+        // Always store the element, and only keep it when it may make it to the top N
+        mEntries[mSize] = Entry(element, priority);
+        mSize += (priority > mThreshold) ? 1 : 0;
+
+        if (mSize == mCapacity)
+        {
+            Truncate();
+        }
+    }
+
+    /*
+     * Adds to this selector the elements held by the other selector.
+     */
+    void merge(TopNSelector const & other) noexcept
+    {
+        for (size_t i = 0; i < other.mSize; ++i)
+        {
+            emplace(other.mEntries[i].Element, other.mEntries[i].Priority);
+        }
+    }
+
+    /*
+     * Leaves the top N elements only, sorted by decreasing priority.
+     */
+    void finalize() noexcept
+    {
+        if (mSize > mMaxSize)
+        {
+            Truncate();
+        }
+
+        std::sort(
+            mEntries.get(),
+            mEntries.get() + mSize,
+            [](Entry const & e1, Entry const & e2)
+            {
+                return e1.Priority > e2.Priority;
+            });
+    }
+
+    inline void clear() noexcept
+    {
+        reset(mMaxSize);
+    }
+
+    inline void clear(size_t maxSize) noexcept
+    {
+        reset(maxSize);
+    }
+
+private:
+
+    static size_t CalculateCapacity(size_t maxSize)
+    {
+        // Truncations cost linear time in the capacity, hence we want
+        // them to happen at most once every (capacity - N) elements
+        return std::max(2 * maxSize, size_t(64));
+    }
+
+    static PriorityType LowestPriority()
+    {
+        if constexpr (std::numeric_limits<PriorityType>::has_infinity)
+            return -std::numeric_limits<PriorityType>::infinity();
+        else
+            return std::numeric_limits<PriorityType>::lowest();
+    }
+
+    static PriorityType HighestPriority()
+    {
+        if constexpr (std::numeric_limits<PriorityType>::has_infinity)
+            return std::numeric_limits<PriorityType>::infinity();
+        else
+            return std::numeric_limits<PriorityType>::max();
+    }
+
+    void Truncate() noexcept
+    {
+        assert(mSize > mMaxSize);
+        assert(mMaxSize > 0); // Nothing makes it through the filter otherwise
+
+        std::nth_element(
+            mEntries.get(),
+            mEntries.get() + (mMaxSize - 1),
+            mEntries.get() + mSize,
+            [](Entry const & e1, Entry const & e2)
+            {
+                return e1.Priority > e2.Priority;
+            });
+
+        mSize = mMaxSize;
+
+        // From now on, only elements better than the worst of the top N may make it
+        mThreshold = mEntries[mMaxSize - 1].Priority;
+    }
+
+    void reset(size_t maxSize) noexcept
+    {
+        assert(maxSize <= mAllocatedMaxSize);
+
+        mSize = 0;
+        mMaxSize = maxSize;
+        mThreshold = (maxSize > 0) ? LowestPriority() : HighestPriority();
+    }
+
+private:
+
+    size_t mCapacity;
+    std::unique_ptr<Entry[]> mEntries;
+    size_t mAllocatedMaxSize;
+
+    size_t mSize;
+    size_t mMaxSize;
+
+    // Elements with a priority not higher than this are discarded
+    PriorityType mThreshold;
+};
@@ -6,6 +6,8 @@
 #include <GameCore/GameTypes.h>
 
 #include <cmath>
+#include <cstdint>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -338,4 +340,66 @@ TEST(AlgorithmsTests, DiffuseLight_SSEVectorized_8Lamps)
     EXPECT_FLOAT_EQ(0.17639320225f, outLightBuffer[3]);
 }
 
-#endif
\ No newline at end of file
+#endif
+TEST(AlgorithmsTests, QuantizeToUNorm16_Naive_RoundTrip)
+{
+    size_t constexpr Count = 1001;
+
+    std::vector<float> src(Count);
+    for (size_t i = 0; i < Count; ++i)
+        src[i] = static_cast<float>(i) / static_cast<float>(Count - 1);
+
+    std::vector<std::uint16_t> dst(Count);
+    Algorithms::QuantizeToUNorm16_Naive(src.data(), Count, dst.data());
+
+    EXPECT_EQ(0u, dst.front());
+    EXPECT_EQ(65535u, dst.back());
+
+    for (size_t i = 0; i < Count; ++i)
+    {
+        float const roundTrip = static_cast<float>(dst[i]) / 65535.0f;
+        EXPECT_LE(std::abs(roundTrip - src[i]), 0.5f / 65535.0f + 1e-7f);
+    }
+}
+
+TEST(AlgorithmsTests, QuantizeToUNorm16_Naive_Clamps)
+{
+    float const src[4] = { -1.0f, -0.0001f, 1.0001f, 100.0f };
+    std::uint16_t dst[4];
+
+    Algorithms::QuantizeToUNorm16_Naive(src, 4, dst);
+
+    EXPECT_EQ(0u, dst[0]);
+    EXPECT_EQ(0u, dst[1]);
+    EXPECT_EQ(65535u, dst[2]);
+    EXPECT_EQ(65535u, dst[3]);
+}
+
+#if defined(FS_ARCHITECTURE_X86_32) || defined(FS_ARCHITECTURE_X86_64)
+
+TEST(AlgorithmsTests, QuantizeToUNorm16_SSE_MatchesNaive)
+{
+    // Not a multiple of the vectorization width, to exercise the remainder
+    size_t constexpr Count = 8 * 37 + 5;
+
+    std::vector<float> src(Count);
+    for (size_t i = 0; i < Count; ++i)
+        src[i] = -0.1f + 1.2f * static_cast<float>(i) / static_cast<float>(Count - 1);
+
+    std::vector<std::uint16_t> expected(Count);
+    Algorithms::QuantizeToUNorm16_Naive(src.data(), Count, expected.data());
+
+    std::vector<std::uint16_t> actual(Count, 0xdead);
+    Algorithms::QuantizeToUNorm16_SSE(src.data(), Count, actual.data());
+
+    for (size_t i = 0; i < Count; ++i)
+    {
+        // Ties may round differently
+        EXPECT_LE(std::abs(static_cast<int>(actual[i]) - static_cast<int>(expected[i])), 1) << "i=" << i;
+    }
+
+    EXPECT_EQ(0u, actual.front());
+    EXPECT_EQ(65535u, actual.back());
+}
+
+#endif
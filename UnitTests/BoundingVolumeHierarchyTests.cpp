@@ -0,0 +1,217 @@
+#include <GameCore/BoundingVolumeHierarchy.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace Geometry;
+
+namespace {
+
+std::vector<AABB> MakeRandomSegmentBoxes(
+    size_t count,
+    std::mt19937 & rng)
+{
+    std::uniform_real_distribution<float> positionDistribution(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> lengthDistribution(-2.0f, 2.0f);
+
+    std::vector<AABB> boxes;
+    for (size_t i = 0; i < count; ++i)
+    {
+        vec2f const a(positionDistribution(rng), positionDistribution(rng));
+        vec2f const b = a + vec2f(lengthDistribution(rng), lengthDistribution(rng));
+
+        AABB box;
+        box.ExtendTo(a);
+        box.ExtendTo(b);
+        boxes.push_back(box);
+    }
+
+    return boxes;
+}
+
+bool BruteForceOverlaps(
+    AABB const & a,
+    AABB const & b)
+{
+    return a.BottomLeft.x <= b.TopRight.x
+        && a.TopRight.x >= b.BottomLeft.x
+        && a.BottomLeft.y <= b.TopRight.y
+        && a.TopRight.y >= b.BottomLeft.y;
+}
+
+std::vector<ElementIndex> Sorted(std::vector<ElementIndex> v)
+{
+    std::sort(v.begin(), v.end());
+    return v;
+}
+
+}
+
+TEST(BoundingVolumeHierarchyTests, Empty)
+{
+    BoundingVolumeHierarchy bvh;
+    bvh.Build({});
+
+    EXPECT_EQ(0u, bvh.GetElementCount());
+    EXPECT_EQ(0u, bvh.GetNodeCount());
+
+    size_t visitCount = 0;
+    bvh.VisitOverlapping(
+        AABB(-1.0f, 1.0f, 1.0f, -1.0f),
+        [&](ElementIndex) { ++visitCount; });
+
+    EXPECT_EQ(0u, visitCount);
+}
+
+TEST(BoundingVolumeHierarchyTests, Overlapping_MatchesBruteForce)
+{
+    std::mt19937 rng(42);
+    auto const boxes = MakeRandomSegmentBoxes(1000, rng);
+
+    BoundingVolumeHierarchy bvh;
+    bvh.Build(boxes);
+
+    EXPECT_EQ(1000u, bvh.GetElementCount());
+
+    std::uniform_real_distribution<float> positionDistribution(-100.0f, 100.0f);
+    for (int q = 0; q < 50; ++q)
+    {
+        vec2f const center(positionDistribution(rng), positionDistribution(rng));
+        AABB const queryBox(center.x - 5.0f, center.x + 5.0f, center.y + 5.0f, center.y - 5.0f);
+
+        std::vector<ElementIndex> expected;
+        for (ElementIndex e = 0; e < boxes.size(); ++e)
+        {
+            if (BruteForceOverlaps(boxes[e], queryBox))
+                expected.push_back(e);
+        }
+
+        std::vector<ElementIndex> actual;
+        bvh.VisitOverlapping(queryBox, [&](ElementIndex e) { actual.push_back(e); });
+
+        EXPECT_EQ(expected, Sorted(actual));
+    }
+}
+
+TEST(BoundingVolumeHierarchyTests, Segment_FindsAllCrossedBoxes)
+{
+    std::mt19937 rng(7);
+    auto const boxes = MakeRandomSegmentBoxes(1000, rng);
+
+    BoundingVolumeHierarchy bvh;
+    bvh.Build(boxes);
+
+    // Horizontal, vertical, and diagonal segments
+    std::vector<std::pair<vec2f, vec2f>> const segments = {
+        { vec2f(-100.0f, 3.0f), vec2f(100.0f, 3.0f) },
+        { vec2f(-20.0f, -100.0f), vec2f(-20.0f, 100.0f) },
+        { vec2f(-50.0f, -50.0f), vec2f(60.0f, 40.0f) },
+        { vec2f(10.0f, 10.0f), vec2f(10.5f, 9.0f) }
+    };
+
+    for (auto const & segment : segments)
+    {
+        AABB segmentBox;
+        segmentBox.ExtendTo(segment.first);
+        segmentBox.ExtendTo(segment.second);
+
+        std::vector<ElementIndex> actual;
+        bvh.VisitIntersectingSegment(segment.first, segment.second, [&](ElementIndex e) { actual.push_back(e); });
+
+        // No duplicates
+        auto const sortedActual = Sorted(actual);
+        EXPECT_EQ(sortedActual.end(), std::adjacent_find(sortedActual.begin(), sortedActual.end()));
+
+        // Conservative: all boxes actually crossed by the segment are visited, and
+        // only boxes overlapping the segment's box are visited
+        for (ElementIndex e = 0; e < boxes.size(); ++e)
+        {
+            bool isCrossed = false;
+            for (int s = 0; s <= 1000; ++s)
+            {
+                vec2f const p = segment.first + (segment.second - segment.first) * (static_cast<float>(s) / 1000.0f);
+                if (boxes[e].Contains(p))
+                {
+                    isCrossed = true;
+                    break;
+                }
+            }
+
+            bool const isVisited = std::binary_search(sortedActual.begin(), sortedActual.end(), e);
+
+            if (isCrossed)
+            {
+                EXPECT_TRUE(isVisited);
+            }
+
+            if (isVisited)
+            {
+                EXPECT_TRUE(BruteForceOverlaps(boxes[e], segmentBox));
+            }
+        }
+    }
+}
+
+TEST(BoundingVolumeHierarchyTests, Ray_IsUnbounded)
+{
+    std::vector<AABB> const boxes = {
+        AABB(10.0f, 11.0f, 1.0f, -1.0f),
+        AABB(1000.0f, 1001.0f, 1.0f, -1.0f),
+        AABB(-11.0f, -10.0f, 1.0f, -1.0f)
+    };
+
+    BoundingVolumeHierarchy bvh;
+    bvh.Build(boxes);
+
+    std::vector<ElementIndex> actual;
+    bvh.VisitIntersectingRay(vec2f(0.0f, 0.0f), vec2f(1.0f, 0.0f), [&](ElementIndex e) { actual.push_back(e); });
+
+    EXPECT_EQ(std::vector<ElementIndex>({ 0, 1 }), Sorted(actual));
+}
+
+TEST(BoundingVolumeHierarchyTests, EmptyBoxesAreNeverVisited)
+{
+    std::vector<AABB> boxes(10, AABB(-1.0f, 1.0f, 1.0f, -1.0f));
+    boxes[3] = AABB();
+    boxes[7] = AABB();
+
+    BoundingVolumeHierarchy bvh;
+    bvh.Build(boxes);
+
+    std::vector<ElementIndex> actual;
+    bvh.VisitOverlapping(AABB(-10.0f, 10.0f, 10.0f, -10.0f), [&](ElementIndex e) { actual.push_back(e); });
+    bvh.VisitIntersectingSegment(vec2f(-5.0f, 0.0f), vec2f(5.0f, 0.0f), [&](ElementIndex e) { actual.push_back(e); });
+    bvh.VisitIntersectingSegment(vec2f(-5.0f, -5.0f), vec2f(5.0f, 5.0f), [&](ElementIndex e) { actual.push_back(e); });
+    bvh.VisitIntersectingRay(vec2f(-5.0f, 5.0f), vec2f(1.0f, -1.0f), [&](ElementIndex e) { actual.push_back(e); });
+
+    EXPECT_EQ(32u, actual.size());
+    EXPECT_EQ(actual.end(), std::find(actual.begin(), actual.end(), 3u));
+    EXPECT_EQ(actual.end(), std::find(actual.begin(), actual.end(), 7u));
+}
+
+TEST(BoundingVolumeHierarchyTests, Refit_FollowsMovedElements)
+{
+    std::mt19937 rng(3);
+    auto boxes = MakeRandomSegmentBoxes(500, rng);
+
+    BoundingVolumeHierarchy bvh;
+    bvh.Build(boxes);
+
+    // Move an element far away, and delete another
+    boxes[123] = AABB(500.0f, 501.0f, 501.0f, 500.0f);
+    boxes[42] = AABB();
+
+    bvh.Refit(boxes);
+
+    std::vector<ElementIndex> actual;
+    bvh.VisitOverlapping(AABB(499.0f, 502.0f, 502.0f, 499.0f), [&](ElementIndex e) { actual.push_back(e); });
+    EXPECT_EQ(std::vector<ElementIndex>({ 123 }), actual);
+
+    actual.clear();
+    bvh.VisitOverlapping(AABB(-1000.0f, 1000.0f, 1000.0f, -1000.0f), [&](ElementIndex e) { actual.push_back(e); });
+    EXPECT_EQ(499u, actual.size());
+    EXPECT_EQ(actual.end(), std::find(actual.begin(), actual.end(), 42u));
+}
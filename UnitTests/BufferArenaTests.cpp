@@ -0,0 +1,65 @@
+#include <GameCore/BufferArena.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+TEST(BufferArenaTests, Allocate_Aligned)
+{
+    BufferArena arena(1024, false);
+
+    void * p1 = arena.Allocate(10, "a");
+    void * p2 = arena.Allocate(100, "b");
+
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(p1) % BufferArena::AllocationAlignment);
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(p2) % BufferArena::AllocationAlignment);
+    EXPECT_EQ(64u, reinterpret_cast<std::uint8_t *>(p2) - reinterpret_cast<std::uint8_t *>(p1));
+
+    // Memory is usable
+    std::memset(p1, 0xaa, 10);
+    std::memset(p2, 0xbb, 100);
+
+    EXPECT_EQ(1u, arena.GetBlockCount());
+    EXPECT_EQ(1024u, arena.GetCapacityByteSize());
+    EXPECT_EQ(64u + 128u, arena.GetAllocatedByteSize());
+}
+
+TEST(BufferArenaTests, Allocate_TracksAllocations)
+{
+    BufferArena arena(1024, false);
+
+    arena.Allocate(10, "a");
+    arena.Allocate(100, "b");
+
+    ASSERT_EQ(2u, arena.GetAllocations().size());
+    EXPECT_EQ("a", arena.GetAllocations()[0].Name);
+    EXPECT_EQ(10u, arena.GetAllocations()[0].ByteSize);
+    EXPECT_EQ("b", arena.GetAllocations()[1].Name);
+    EXPECT_EQ(100u, arena.GetAllocations()[1].ByteSize);
+}
+
+TEST(BufferArenaTests, Allocate_GrowsWhenCapacityExceeded)
+{
+    BufferArena arena(128, false);
+
+    arena.Allocate(100, "a");
+    void * p2 = arena.Allocate(100, "b");
+
+    EXPECT_NE(nullptr, p2);
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(p2) % BufferArena::AllocationAlignment);
+    EXPECT_EQ(2u, arena.GetBlockCount());
+    EXPECT_EQ(256u, arena.GetAllocatedByteSize());
+}
+
+TEST(BufferArenaTests, Allocate_HugePages)
+{
+    size_t constexpr Capacity = 4 * 1024 * 1024;
+    BufferArena arena(Capacity, true);
+
+    void * p = arena.Allocate(Capacity, "a");
+    std::memset(p, 0xcc, Capacity);
+
+    EXPECT_EQ(1u, arena.GetBlockCount());
+    EXPECT_GE(arena.GetCapacityByteSize(), Capacity);
+}
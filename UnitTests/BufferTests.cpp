@@ -223,4 +223,39 @@ TEST(BufferTests, BufferSegment_TwoSegments)
     EXPECT_EQ(2u, buf2.GetCurrentPopulatedSize());
     EXPECT_EQ(vec2f(1.0f, 2.0f), buf2[0]);
     EXPECT_EQ(vec2f(10.0f, 20.0f), buf2[1]);
-}
\ No newline at end of file
+}
+TEST(BufferTests, Buffer_FromArena)
+{
+    BufferArena arena(1024, false);
+
+    Buffer<float> buf(10, 5, 2.0f, arena, "Test");
+
+    EXPECT_TRUE(is_aligned_to_vectorization_word(buf.data()));
+    EXPECT_EQ(2.0f, buf[5]);
+    EXPECT_EQ(2.0f, buf[9]);
+
+    ASSERT_EQ(1u, arena.GetAllocations().size());
+    EXPECT_EQ("Test", arena.GetAllocations()[0].Name);
+    EXPECT_EQ(10u * sizeof(float), arena.GetAllocations()[0].ByteSize);
+
+    // Moves do not take ownership of the arena's memory
+    Buffer<float> buf2(std::move(buf));
+    EXPECT_EQ(2.0f, buf2[9]);
+}
+
+TEST(BufferTests, CalculateArenaByteSize_MatchesArenaAllocations)
+{
+    BufferArena arena(4096, false);
+
+    Buffer<float> buf1(20, 0, 1.0f, arena, "Buf1");
+    Buffer<vec2f> buf2(20, 0, vec2f::zero(), arena, "Buf2");
+    Buffer<bool> const buf3(20, 0, false, arena, "Buf3");
+
+    size_t const expectedByteSize = CalculateArenaByteSize<
+        decltype(buf1),
+        decltype(buf2),
+        decltype(buf3)>(20);
+
+    EXPECT_EQ(arena.GetAllocatedByteSize(), expectedByteSize);
+    EXPECT_EQ(128u + 192u + 64u, expectedByteSize);
+}
@@ -0,0 +1,97 @@
+#include <GameCore/DirtyChunkBitmap.h>
+
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using Ranges = std::vector<std::pair<size_t, size_t>>;
+
+template<size_t ChunkSize>
+static Ranges GetDirtyRanges(DirtyChunkBitmap<ChunkSize> const & bitmap)
+{
+    Ranges ranges;
+    bitmap.VisitDirtyRanges(
+        [&ranges](size_t start, size_t count)
+        {
+            ranges.emplace_back(start, count);
+        });
+
+    return ranges;
+}
+
+TEST(DirtyChunkBitmapTests, StartsClean)
+{
+    DirtyChunkBitmap<4> bitmap(10);
+
+    EXPECT_EQ(3u, bitmap.GetChunkCount());
+    EXPECT_FALSE(bitmap.IsAnyDirty());
+    EXPECT_TRUE(GetDirtyRanges(bitmap).empty());
+}
+
+TEST(DirtyChunkBitmapTests, MarkDirty_Element)
+{
+    DirtyChunkBitmap<4> bitmap(16);
+
+    bitmap.MarkDirty(5);
+
+    EXPECT_TRUE(bitmap.IsAnyDirty());
+    EXPECT_FALSE(bitmap.IsChunkDirty(0));
+    EXPECT_TRUE(bitmap.IsChunkDirty(1));
+    EXPECT_FALSE(bitmap.IsChunkDirty(2));
+    EXPECT_EQ(Ranges({ { 4, 4 } }), GetDirtyRanges(bitmap));
+}
+
+TEST(DirtyChunkBitmapTests, MarkDirty_Range)
+{
+    DirtyChunkBitmap<4> bitmap(32);
+
+    bitmap.MarkDirty(3, 6); // Elements 3..8, chunks 0..2
+
+    EXPECT_EQ(Ranges({ { 0, 12 } }), GetDirtyRanges(bitmap));
+}
+
+TEST(DirtyChunkBitmapTests, VisitDirtyRanges_Coalesces)
+{
+    DirtyChunkBitmap<4> bitmap(32);
+
+    bitmap.MarkDirty(0);
+    bitmap.MarkDirty(5);
+    bitmap.MarkDirty(17);
+    bitmap.MarkDirty(31);
+
+    EXPECT_EQ(Ranges({ { 0, 8 }, { 16, 4 }, { 28, 4 } }), GetDirtyRanges(bitmap));
+}
+
+TEST(DirtyChunkBitmapTests, VisitDirtyRanges_ClampsLastChunk)
+{
+    DirtyChunkBitmap<4> bitmap(10);
+
+    bitmap.MarkDirty(9);
+
+    EXPECT_EQ(Ranges({ { 8, 2 } }), GetDirtyRanges(bitmap));
+}
+
+TEST(DirtyChunkBitmapTests, VisitDirtyRanges_AcrossWords)
+{
+    DirtyChunkBitmap<1> bitmap(200);
+
+    bitmap.MarkDirty(62, 4);
+    bitmap.MarkDirty(199);
+
+    EXPECT_EQ(Ranges({ { 62, 4 }, { 199, 1 } }), GetDirtyRanges(bitmap));
+}
+
+TEST(DirtyChunkBitmapTests, MarkAllDirty_And_Clear)
+{
+    DirtyChunkBitmap<4> bitmap(10);
+
+    bitmap.MarkAllDirty();
+
+    EXPECT_EQ(Ranges({ { 0, 10 } }), GetDirtyRanges(bitmap));
+
+    bitmap.Clear();
+
+    EXPECT_FALSE(bitmap.IsAnyDirty());
+    EXPECT_TRUE(GetDirtyRanges(bitmap).empty());
+}
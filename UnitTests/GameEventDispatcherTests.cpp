@@ -1,5 +1,8 @@
 #include <Game/GameEventDispatcher.h>
 
+#include <thread>
+#include <vector>
+
 #include "gmock/gmock.h"
 
 class _MockGameEventHandler
@@ -17,9 +20,11 @@ using namespace ::testing;
 
 using MockHandler = StrictMock<_MockGameEventHandler>;
 
-StructuralMaterial MakeStructuralMaterial(std::string name)
+StructuralMaterial MakeStructuralMaterial(
+    std::string name,
+    std::uint32_t ordinal = 0)
 {
-    return StructuralMaterial(
+    StructuralMaterial material(
         name,
         1.0f,
         1.0f,
@@ -48,6 +53,10 @@ StructuralMaterial MakeStructuralMaterial(std::string name)
         // Misc
         1.0f,
         false);
+
+    material.Ordinal = ordinal;
+
+    return material;
 }
 
 /////////////////////////////////////////////////////////////////
@@ -82,9 +91,9 @@ TEST(GameEventDispatcherTests, Aggregates_OnStress_MultipleKeys)
     GameEventDispatcher dispatcher;
     dispatcher.RegisterStructuralEventHandler(&handler);
 
-    StructuralMaterial sm1 = MakeStructuralMaterial("Foo1");
+    StructuralMaterial sm1 = MakeStructuralMaterial("Foo1", 0);
 
-    StructuralMaterial sm2 = MakeStructuralMaterial("Foo2");
+    StructuralMaterial sm2 = MakeStructuralMaterial("Foo2", 1);
 
     EXPECT_CALL(handler, OnStress(_, _, _)).Times(0);
 
@@ -107,6 +116,50 @@ TEST(GameEventDispatcherTests, Aggregates_OnStress_MultipleKeys)
     Mock::VerifyAndClear(&handler);
 }
 
+TEST(GameEventDispatcherTests, Aggregates_OnStress_MultipleThreads)
+{
+    MockHandler handler;
+
+    GameEventDispatcher dispatcher;
+    dispatcher.RegisterStructuralEventHandler(&handler);
+
+    StructuralMaterial sm1 = MakeStructuralMaterial("Foo1", 0);
+
+    StructuralMaterial sm2 = MakeStructuralMaterial("Foo2", 5);
+
+    EXPECT_CALL(handler, OnStress(_, _, _)).Times(0);
+
+    dispatcher.OnStress(sm1, false, 1);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            [&dispatcher, &sm1, &sm2]()
+            {
+                for (int i = 0; i < 1000; ++i)
+                {
+                    dispatcher.OnStress(sm1, false, 1);
+                    dispatcher.OnStress(sm2, true, 2);
+                }
+            });
+    }
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    Mock::VerifyAndClear(&handler);
+
+    EXPECT_CALL(handler, OnStress(Field(&StructuralMaterial::Name, "Foo1"), false, 4001)).Times(1);
+    EXPECT_CALL(handler, OnStress(Field(&StructuralMaterial::Name, "Foo2"), true, 8000)).Times(1);
+
+    dispatcher.Flush();
+
+    Mock::VerifyAndClear(&handler);
+}
+
 TEST(GameEventDispatcherTests, OnSinkingBegin)
 {
     MockHandler handler;
@@ -137,6 +190,44 @@ TEST(GameEventDispatcherTests, OnSinkingBegin_MultipleShips)
     Mock::VerifyAndClear(&handler);
 }
 
+TEST(GameEventDispatcherTests, OnSinkingBegin_FromOtherThread_DeferredToFlush)
+{
+    MockHandler handler;
+
+    GameEventDispatcher dispatcher;
+    dispatcher.RegisterLifecycleEventHandler(&handler);
+
+    EXPECT_CALL(handler, OnSinkingBegin(_)).Times(0);
+
+    std::thread thread(
+        [&dispatcher]()
+        {
+            dispatcher.OnSinkingBegin(7);
+            dispatcher.OnSinkingBegin(3);
+        });
+
+    thread.join();
+
+    Mock::VerifyAndClear(&handler);
+
+    {
+        InSequence s;
+
+        EXPECT_CALL(handler, OnSinkingBegin(7)).Times(1);
+        EXPECT_CALL(handler, OnSinkingBegin(3)).Times(1);
+    }
+
+    dispatcher.Flush();
+
+    Mock::VerifyAndClear(&handler);
+
+    EXPECT_CALL(handler, OnSinkingBegin(_)).Times(0);
+
+    dispatcher.Flush();
+
+    Mock::VerifyAndClear(&handler);
+}
+
 TEST(GameEventDispatcherTests, ClearsStateAtUpdate)
 {
     MockHandler handler;
@@ -0,0 +1,305 @@
+#include <GameCore/GameException.h>
+#include <GameCore/PngDecoder.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+//
+// Test images, encoded with zlib
+//
+
+static std::uint8_t const Rgb3x2[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x08, 0x02, 0x00, 0x00, 0x00, 0x12, 0x16, 0xf1,
+    0x4d, 0x00, 0x00, 0x00, 0x15, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0x63, 0xf8, 0xcf, 0xc0, 0xc0,
+    0x00, 0xc1, 0xff, 0xff, 0x83, 0xe8, 0x86, 0x86, 0x06, 0x00, 0x47, 0xcf, 0x07, 0x7b, 0x62, 0x21,
+    0x8f, 0x81, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+static std::uint8_t const Rgba5x5AllFilters[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x08, 0x06, 0x00, 0x00, 0x00, 0x8d, 0x6f, 0x26,
+    0xe5, 0x00, 0x00, 0x00, 0x54, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0x4d, 0xca, 0xab, 0x11, 0x80,
+    0x30, 0x10, 0x06, 0xe1, 0xe5, 0xa1, 0xa2, 0x31, 0x67, 0x62, 0x30, 0xd1, 0x57, 0x53, 0xea, 0xa0,
+    0x0c, 0x6a, 0xa2, 0x03, 0x34, 0x1a, 0x0d, 0x26, 0x33, 0x1c, 0xff, 0xa0, 0x10, 0x9f, 0xd9, 0x59,
+    0x80, 0x70, 0xb8, 0x2a, 0x9c, 0x2b, 0x1c, 0x1b, 0xec, 0x1d, 0xce, 0xe3, 0xa4, 0xfb, 0xaf, 0x57,
+    0x0c, 0x3c, 0xc9, 0x24, 0x59, 0x4a, 0x0c, 0x54, 0x16, 0xb3, 0xa9, 0x99, 0x99, 0x64, 0x99, 0xdb,
+    0xf8, 0x9d, 0xe8, 0x44, 0x27, 0x3a, 0x29, 0xf1, 0x02, 0x3e, 0x84, 0x1e, 0x7c, 0xc4, 0x0c, 0x3b,
+    0x52, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+static std::uint8_t const Palette2Bit4x1[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x84, 0x52, 0xe7,
+    0x5e, 0x00, 0x00, 0x00, 0x0c, 0x50, 0x4c, 0x54, 0x45, 0x0a, 0x14, 0x1e, 0x28, 0x32, 0x3c, 0x46,
+    0x50, 0x5a, 0x64, 0x6e, 0x78, 0xc6, 0x48, 0x77, 0xdf, 0x00, 0x00, 0x00, 0x03, 0x74, 0x52, 0x4e,
+    0x53, 0xff, 0x00, 0x80, 0xa9, 0x56, 0x73, 0x13, 0x00, 0x00, 0x00, 0x0a, 0x49, 0x44, 0x41, 0x54,
+    0x78, 0xda, 0x63, 0x90, 0x06, 0x00, 0x00, 0x1d, 0x00, 0x1c, 0x23, 0x7c, 0x8f, 0xac, 0x00, 0x00,
+    0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+static std::uint8_t const Gray16Bit2x1[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x81, 0xd9, 0xfc,
+    0x15, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0x63, 0x10, 0x32, 0x59, 0x7d,
+    0x16, 0x00, 0x03, 0x0c, 0x01, 0xbf, 0xb1, 0xe7, 0xd4, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45,
+    0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+static std::uint8_t const StoredRgb2x2[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x08, 0x02, 0x00, 0x00, 0x00, 0xfd, 0xd4, 0x9a,
+    0x73, 0x00, 0x00, 0x00, 0x19, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0x01, 0x0e, 0x00, 0xf1, 0xff,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x00, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x01, 0x8f,
+    0x00, 0x4f, 0x9e, 0x35, 0x89, 0x49, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42,
+    0x60, 0x82,
+};
+static std::uint8_t const Rgb32x32[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x08, 0x02, 0x00, 0x00, 0x00, 0xfc, 0x18, 0xed,
+    0xa3, 0x00, 0x00, 0x02, 0xef, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xbd, 0x55, 0x3d, 0x8f, 0xe2,
+    0x48, 0x14, 0x7c, 0x6e, 0x37, 0xd8, 0x80, 0x81, 0x07, 0x18, 0x30, 0x60, 0x3e, 0x82, 0xa7, 0x15,
+    0x01, 0x01, 0x01, 0xc1, 0xd3, 0x89, 0x80, 0x80, 0x80, 0xa0, 0x03, 0x02, 0x02, 0x02, 0x82, 0x17,
+    0x10, 0x10, 0x10, 0x10, 0x74, 0x40, 0xc0, 0x9f, 0xbd, 0xf8, 0xa2, 0xd3, 0xe9, 0x74, 0x37, 0x3b,
+    0xcb, 0xce, 0xb2, 0x46, 0x3b, 0xf2, 0xee, 0x69, 0xa4, 0xe5, 0x16, 0xc6, 0x6a, 0x95, 0x4b, 0xa5,
+    0x92, 0x5a, 0x56, 0xa9, 0x5c, 0x1a, 0x00, 0x34, 0x38, 0x8f, 0x3b, 0x0e, 0xe8, 0xcb, 0xeb, 0x45,
+    0x83, 0xfb, 0x20, 0x54, 0x97, 0x0b, 0x40, 0xbb, 0xa0, 0xcf, 0xa0, 0x5f, 0x1e, 0xc1, 0x5d, 0xf0,
+    0x95, 0x52, 0x2f, 0x4a, 0x41, 0x82, 0xfa, 0xee, 0x1c, 0x00, 0xb5, 0xc6, 0x8c, 0x8f, 0xd9, 0x00,
+    0x3d, 0x44, 0x08, 0xd1, 0x89, 0x50, 0xc5, 0xe8, 0x0e, 0x30, 0x20, 0x2c, 0x0e, 0xb1, 0x34, 0xc2,
+    0xf2, 0x18, 0xfd, 0x09, 0xe6, 0x18, 0xf3, 0x53, 0x2c, 0xcc, 0x30, 0x9c, 0x63, 0x7d, 0x81, 0x0d,
+    0x83, 0xcd, 0x25, 0xe2, 0x0a, 0x2b, 0x6b, 0xac, 0x6e, 0xb0, 0x26, 0x18, 0x6f, 0xb1, 0xbb, 0xc3,
+    0xde, 0x1e, 0xfb, 0x07, 0x8c, 0x2c, 0xb6, 0x8e, 0xd8, 0x3e, 0x61, 0x47, 0x7f, 0xfd, 0x1c, 0xb8,
+    0xdc, 0xa3, 0x12, 0xbc, 0x3f, 0x77, 0x20, 0xca, 0x26, 0x71, 0x9f, 0xff, 0x83, 0xc5, 0xbb, 0xe8,
+    0xd7, 0x90, 0x5f, 0x1e, 0x87, 0x2e, 0x54, 0x33, 0xea, 0xeb, 0xe3, 0x26, 0xc9, 0x5c, 0x78, 0x56,
+    0x29, 0x4f, 0xa9, 0x4b, 0xf4, 0x7f, 0x2a, 0xf5, 0x51, 0xa9, 0x67, 0xa5, 0x3e, 0x29, 0x75, 0x56,
+    0xea, 0xf3, 0xb7, 0xdc, 0x72, 0x37, 0xf9, 0x01, 0x28, 0xa7, 0xc9, 0xf7, 0xa9, 0x10, 0x50, 0x1e,
+    0xa9, 0x18, 0x52, 0x10, 0x51, 0x39, 0xa6, 0xd2, 0x80, 0x1c, 0x22, 0x18, 0x92, 0x3b, 0x22, 0x35,
+    0xa6, 0xcc, 0x84, 0x34, 0x93, 0x37, 0xa5, 0xec, 0x8c, 0x5a, 0x73, 0x8a, 0x16, 0xd4, 0x31, 0xd4,
+    0x5e, 0x52, 0x77, 0x45, 0xf1, 0x9a, 0xfa, 0x1b, 0xea, 0x09, 0x55, 0xb6, 0x84, 0x3b, 0xaa, 0xed,
+    0xa9, 0x7a, 0xa0, 0xba, 0xa5, 0xf0, 0x48, 0xcd, 0x13, 0x35, 0xae, 0x21, 0x5f, 0x2e, 0x3a, 0x27,
+    0xc9, 0xdc, 0x9f, 0x3b, 0x30, 0x2a, 0x24, 0xad, 0xbb, 0x1e, 0x2f, 0xc5, 0xff, 0x79, 0x43, 0x6f,
+    0xde, 0xe4, 0x7f, 0x6d, 0x72, 0x06, 0xb4, 0x07, 0xfa, 0x09, 0xf4, 0xf3, 0xf7, 0x6d, 0xfc, 0x55,
+    0xdd, 0x85, 0xd8, 0x4b, 0xd2, 0xb8, 0xf6, 0xf9, 0xf3, 0x4f, 0xf0, 0xd2, 0x4d, 0x7e, 0x00, 0x2e,
+    0x69, 0x2e, 0xfb, 0x1c, 0x04, 0x5c, 0x44, 0xce, 0x87, 0x5c, 0x88, 0xd8, 0x8f, 0x39, 0x37, 0xe0,
+    0x2c, 0xb1, 0x37, 0x64, 0x3d, 0xe2, 0xcc, 0x98, 0xd5, 0x84, 0x5d, 0x66, 0x98, 0xb2, 0x33, 0xe3,
+    0xde, 0x9c, 0xfb, 0x0b, 0x8e, 0x0d, 0x77, 0x97, 0xdc, 0x5e, 0x71, 0x67, 0xcd, 0xd1, 0x86, 0x5b,
+    0xc2, 0x8d, 0x2d, 0x37, 0x77, 0x1c, 0xee, 0xb9, 0x7e, 0xe0, 0xaa, 0xe5, 0xda, 0x91, 0xf1, 0xc4,
+    0x95, 0xd7, 0x26, 0x3f, 0x0a, 0x1d, 0x98, 0xe1, 0x8d, 0xbf, 0xf8, 0xdf, 0x6f, 0xf2, 0xbf, 0x43,
+    0x93, 0x3f, 0xe4, 0x93, 0x34, 0xce, 0x49, 0x4b, 0xdd, 0x9f, 0xe0, 0x7f, 0xdd, 0xe4, 0x07, 0x30,
+    0x35, 0x6d, 0xaa, 0xbe, 0xa9, 0x04, 0x06, 0xd1, 0x34, 0x43, 0xd3, 0x88, 0x4c, 0x3d, 0x36, 0xe1,
+    0xc0, 0x74, 0xc8, 0xb4, 0x87, 0xa6, 0x35, 0x32, 0xd1, 0xd8, 0xf4, 0x27, 0xa6, 0xc7, 0xa6, 0x3b,
+    0x35, 0xf1, 0xcc, 0xb8, 0x73, 0xa3, 0x16, 0xc6, 0x31, 0x06, 0x96, 0xc6, 0x5b, 0x99, 0xec, 0xda,
+    0x64, 0x36, 0x46, 0x8b, 0x29, 0x6c, 0x4d, 0x7e, 0x67, 0x72, 0x7b, 0xe3, 0x1f, 0x4c, 0xd9, 0x9a,
+    0xd2, 0xd1, 0x14, 0x4f, 0x26, 0x78, 0x6d, 0xf2, 0xb5, 0x7e, 0x4f, 0xdf, 0xc8, 0x6b, 0x1b, 0x7f,
+    0x55, 0x77, 0x60, 0x55, 0x4f, 0xad, 0xe8, 0x73, 0x8a, 0x17, 0xde, 0xd0, 0xff, 0xb8, 0xc9, 0xff,
+    0x0e, 0x9b, 0x3c, 0x0e, 0x52, 0x5b, 0x9a, 0x46, 0xff, 0x0d, 0xfd, 0xdf, 0x9b, 0xfc, 0x00, 0x12,
+    0x69, 0x69, 0xf9, 0xd2, 0x0e, 0xa4, 0x83, 0x12, 0x87, 0xd2, 0x8d, 0xa4, 0x17, 0x4b, 0x7f, 0x20,
+    0x48, 0x52, 0x19, 0x4a, 0x75, 0x24, 0xb5, 0xb1, 0x84, 0x13, 0xa9, 0xb3, 0x34, 0xa6, 0xd2, 0x9c,
+    0x89, 0x3f, 0x97, 0xdc, 0x42, 0xf2, 0x46, 0x0a, 0x4b, 0x09, 0x56, 0x52, 0x5c, 0x4b, 0x69, 0x23,
+    0x65, 0x11, 0xd8, 0x8a, 0xb3, 0x13, 0xb5, 0x17, 0xf7, 0x20, 0xda, 0x4a, 0xe6, 0x28, 0xd9, 0x93,
+    0x78, 0x3f, 0x6c, 0xb2, 0x7a, 0x63, 0x63, 0xff, 0xbf, 0xee, 0xc0, 0xae, 0x9d, 0x5a, 0xd1, 0x4c,
+    0x8a, 0xff, 0x7d, 0x17, 0xfd, 0x1d, 0x9a, 0xfc, 0x5b, 0x39, 0xb5, 0xb1, 0x4f, 0xa9, 0xed, 0x3d,
+    0xdf, 0x45, 0x07, 0xb0, 0x5d, 0x6d, 0x63, 0xdf, 0xf6, 0x03, 0xdb, 0x43, 0xdb, 0x0a, 0x6d, 0x14,
+    0xd9, 0x4e, 0x6c, 0xdb, 0x03, 0x5b, 0x27, 0x1b, 0x0e, 0x6d, 0x73, 0x64, 0x1b, 0x63, 0x5b, 0x99,
+    0x58, 0x64, 0x5b, 0x9b, 0xda, 0xea, 0xcc, 0x16, 0xe7, 0x36, 0x58, 0xd8, 0xb2, 0xb1, 0xa5, 0xa5,
+    0xcd, 0xad, 0xac, 0xbf, 0xb6, 0x85, 0x8d, 0xcd, 0x8b, 0xcd, 0x6c, 0xad, 0xde, 0x59, 0x6f, 0x6f,
+    0xb3, 0x07, 0xeb, 0x58, 0x0b, 0x47, 0xeb, 0x9e, 0xac, 0x7a, 0x87, 0x4d, 0x3e, 0xf5, 0x53, 0x5b,
+    0x7a, 0xff, 0xf3, 0x05, 0xe8, 0x40, 0xf0, 0x37, 0x58, 0x60, 0xac, 0xb3, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+static std::uint8_t const Rgba4x4[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x08, 0x06, 0x00, 0x00, 0x00, 0xa9, 0xf1, 0x9e,
+    0x7e, 0x00, 0x00, 0x00, 0x35, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0x63, 0x60, 0x60, 0x60, 0xf8,
+    0xcf, 0x05, 0xc4, 0x22, 0x40, 0x2c, 0x07, 0xc4, 0x0c, 0x1a, 0x40, 0xc2, 0x08, 0x88, 0x6d, 0x80,
+    0xd8, 0x0d, 0x24, 0x10, 0x00, 0x24, 0xa2, 0x80, 0x38, 0x05, 0x88, 0xf3, 0x40, 0x02, 0x15, 0x40,
+    0xa2, 0x09, 0x88, 0x7b, 0x80, 0x78, 0x1a, 0x10, 0x03, 0x00, 0x74, 0x82, 0x14, 0xa1, 0xaf, 0xd0,
+    0xe5, 0xae, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82,
+};
+static std::uint8_t const InterlacedRgb1x1[] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x08, 0x02, 0x00, 0x00, 0x01, 0xe7, 0x70, 0x63,
+    0x48, 0x00, 0x00, 0x00, 0x0c, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0x63, 0x60, 0x64, 0x62, 0x06,
+    0x00, 0x00, 0x0e, 0x00, 0x07, 0xe9, 0x92, 0x37, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e,
+    0x44, 0xae, 0x42, 0x60, 0x82,
+};
+
+TEST(PngDecoderTests, CanDecode)
+{
+    EXPECT_TRUE(PngDecoder::CanDecode(Rgb3x2, sizeof(Rgb3x2)));
+    EXPECT_TRUE(PngDecoder::CanDecode(Palette2Bit4x1, sizeof(Palette2Bit4x1)));
+
+    // Interlaced
+    EXPECT_FALSE(PngDecoder::CanDecode(InterlacedRgb1x1, sizeof(InterlacedRgb1x1)));
+
+    // Too short
+    EXPECT_FALSE(PngDecoder::CanDecode(Rgb3x2, PngDecoder::HeaderSize - 1));
+
+    // Not a PNG
+    std::uint8_t const NotAPng[PngDecoder::HeaderSize] = { 'B', 'M' };
+    EXPECT_FALSE(PngDecoder::CanDecode(NotAPng, sizeof(NotAPng)));
+}
+
+TEST(PngDecoderTests, DecodeSize_FromHeaderOnly)
+{
+    auto const size = PngDecoder::DecodeSize(Rgba5x5AllFilters, PngDecoder::HeaderSize);
+
+    EXPECT_EQ(ImageSize(5, 5), size);
+}
+
+TEST(PngDecoderTests, Decode_Rgb_FixedHuffman_LowerLeftOrigin)
+{
+    auto const image = PngDecoder::Decode<rgbColor>(Rgb3x2, sizeof(Rgb3x2));
+
+    ASSERT_EQ(ImageSize(3, 2), image.Size);
+
+    // Bottom row first
+    EXPECT_EQ(rgbColor(255, 255, 255), image.Data[0]);
+    EXPECT_EQ(rgbColor(0, 0, 0), image.Data[1]);
+    EXPECT_EQ(rgbColor(128, 128, 128), image.Data[2]);
+    EXPECT_EQ(rgbColor(255, 0, 0), image.Data[3]);
+    EXPECT_EQ(rgbColor(0, 255, 0), image.Data[4]);
+    EXPECT_EQ(rgbColor(0, 0, 255), image.Data[5]);
+}
+
+TEST(PngDecoderTests, Decode_Rgb_ToRgba)
+{
+    auto const image = PngDecoder::Decode<rgbaColor>(Rgb3x2, sizeof(Rgb3x2));
+
+    ASSERT_EQ(ImageSize(3, 2), image.Size);
+
+    EXPECT_EQ(rgbaColor(128, 128, 128, 255), image.Data[2]);
+    EXPECT_EQ(rgbaColor(255, 0, 0, 255), image.Data[3]);
+}
+
+TEST(PngDecoderTests, Decode_Rgba_AllFilters)
+{
+    auto const image = PngDecoder::Decode<rgbaColor>(Rgba5x5AllFilters, sizeof(Rgba5x5AllFilters));
+
+    ASSERT_EQ(ImageSize(5, 5), image.Size);
+
+    for (int y = 0; y < 5; ++y)
+    {
+        for (int x = 0; x < 5; ++x)
+        {
+            // Image was encoded top-down
+            int const pngY = 4 - y;
+            EXPECT_EQ(
+                rgbaColor(
+                    static_cast<std::uint8_t>(x * 50),
+                    static_cast<std::uint8_t>(pngY * 50),
+                    static_cast<std::uint8_t>(x * pngY * 10),
+                    static_cast<std::uint8_t>(255 - x * 10 - pngY)),
+                image.Data[y * 5 + x]);
+        }
+    }
+}
+
+TEST(PngDecoderTests, Decode_Palette_SubByte_WithTransparency)
+{
+    auto const image = PngDecoder::Decode<rgbaColor>(Palette2Bit4x1, sizeof(Palette2Bit4x1));
+
+    ASSERT_EQ(ImageSize(4, 1), image.Size);
+
+    EXPECT_EQ(rgbaColor(10, 20, 30, 255), image.Data[0]);
+    EXPECT_EQ(rgbaColor(40, 50, 60, 0), image.Data[1]);
+    EXPECT_EQ(rgbaColor(70, 80, 90, 128), image.Data[2]);
+    EXPECT_EQ(rgbaColor(100, 110, 120, 255), image.Data[3]);
+}
+
+TEST(PngDecoderTests, Decode_Gray_16Bit)
+{
+    auto const image = PngDecoder::Decode<rgbColor>(Gray16Bit2x1, sizeof(Gray16Bit2x1));
+
+    ASSERT_EQ(ImageSize(2, 1), image.Size);
+
+    EXPECT_EQ(rgbColor(0x12, 0x12, 0x12), image.Data[0]);
+    EXPECT_EQ(rgbColor(0xab, 0xab, 0xab), image.Data[1]);
+}
+
+TEST(PngDecoderTests, Decode_StoredBlock)
+{
+    auto const image = PngDecoder::Decode<rgbColor>(StoredRgb2x2, sizeof(StoredRgb2x2));
+
+    ASSERT_EQ(ImageSize(2, 2), image.Size);
+
+    EXPECT_EQ(rgbColor(7, 8, 9), image.Data[0]);
+    EXPECT_EQ(rgbColor(10, 11, 12), image.Data[1]);
+    EXPECT_EQ(rgbColor(1, 2, 3), image.Data[2]);
+    EXPECT_EQ(rgbColor(4, 5, 6), image.Data[3]);
+}
+
+TEST(PngDecoderTests, Decode_DynamicHuffman)
+{
+    auto const image = PngDecoder::Decode<rgbColor>(Rgb32x32, sizeof(Rgb32x32));
+
+    ASSERT_EQ(ImageSize(32, 32), image.Size);
+
+    for (int y = 0; y < 32; ++y)
+    {
+        for (int x = 0; x < 32; ++x)
+        {
+            int const pngY = 31 - y;
+            EXPECT_EQ(
+                rgbColor(
+                    static_cast<std::uint8_t>(x * 4),
+                    static_cast<std::uint8_t>(pngY * 4),
+                    static_cast<std::uint8_t>(x ^ pngY)),
+                image.Data[y * 32 + x]);
+        }
+    }
+}
+
+TEST(PngDecoderTests, DecodeAndDownscale)
+{
+    auto const image = PngDecoder::DecodeAndDownscale<rgbaColor>(Rgba4x4, sizeof(Rgba4x4), ImageSize(2, 2));
+
+    ASSERT_EQ(ImageSize(2, 2), image.Size);
+
+    // Each target pixel averages a 2x2 block; the top PNG rows end up at the top
+    EXPECT_EQ(rgbaColor((80 + 90 + 120 + 130) / 4, 0, 0, 255), image.Data[0]);
+    EXPECT_EQ(rgbaColor((100 + 110 + 140 + 150) / 4, 0, 0, 255), image.Data[1]);
+    EXPECT_EQ(rgbaColor((0 + 10 + 40 + 50) / 4, 0, 0, 255), image.Data[2]);
+    EXPECT_EQ(rgbaColor((20 + 30 + 60 + 70) / 4, 0, 0, 255), image.Data[3]);
+}
+
+TEST(PngDecoderTests, DecodeAndDownscale_RejectsUpscale)
+{
+    EXPECT_THROW(
+        PngDecoder::DecodeAndDownscale<rgbaColor>(Rgba4x4, sizeof(Rgba4x4), ImageSize(8, 4)),
+        GameException);
+}
+
+TEST(PngDecoderTests, Decode_Truncated)
+{
+    EXPECT_THROW(
+        PngDecoder::Decode<rgbColor>(Rgb32x32, sizeof(Rgb32x32) / 2),
+        GameException);
+}
+
+TEST(PngDecoderTests, Decode_InvalidBitDepth)
+{
+    // Each combination of color type and bit depth not allowed by the spec
+    struct { std::uint8_t ColorType; std::uint8_t BitDepth; } const Combinations[] = {
+        { 0, 0 }, { 0, 3 }, { 0, 32 },
+        { 2, 1 }, { 2, 4 },
+        { 3, 16 }, { 3, 0 },
+        { 4, 2 },
+        { 6, 32 }
+    };
+
+    for (auto const & combination : Combinations)
+    {
+        std::vector<std::uint8_t> png(Rgba4x4, Rgba4x4 + sizeof(Rgba4x4));
+        png[24] = combination.BitDepth;
+        png[25] = combination.ColorType;
+
+        EXPECT_FALSE(PngDecoder::CanDecode(png.data(), png.size()));
+
+        EXPECT_THROW(
+            PngDecoder::DecodeSize(png.data(), png.size()),
+            GameException);
+
+        EXPECT_THROW(
+            PngDecoder::Decode<rgbaColor>(png.data(), png.size()),
+            GameException);
+    }
+}
@@ -0,0 +1,208 @@
+#include <GameCore/SnapshotTripleBuffer.h>
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace /* anonymous */ {
+
+    void Write(
+        SnapshotTripleBuffer<int> & buffer,
+        int value)
+    {
+        buffer.BeginWrite() = value;
+        buffer.EndWrite();
+    }
+
+}
+
+TEST(SnapshotTripleBufferTests, NothingPublished)
+{
+    SnapshotTripleBuffer<int> buffer(0);
+
+    auto const view = buffer.BeginRead();
+
+    EXPECT_EQ(nullptr, view.Previous);
+    EXPECT_EQ(nullptr, view.Latest);
+
+    buffer.EndRead();
+}
+
+TEST(SnapshotTripleBufferTests, OnePublished_PreviousIsLatest)
+{
+    SnapshotTripleBuffer<int> buffer(0);
+
+    Write(buffer, 1);
+
+    auto const view = buffer.BeginRead();
+
+    ASSERT_NE(nullptr, view.Latest);
+    EXPECT_EQ(1, *view.Latest);
+    EXPECT_EQ(view.Latest, view.Previous);
+
+    buffer.EndRead();
+}
+
+TEST(SnapshotTripleBufferTests, ManyPublished_LatestTwo)
+{
+    SnapshotTripleBuffer<int> buffer(0);
+
+    for (int i = 1; i <= 5; ++i)
+    {
+        Write(buffer, i);
+
+        auto const view = buffer.BeginRead();
+
+        ASSERT_NE(nullptr, view.Latest);
+        ASSERT_NE(nullptr, view.Previous);
+        EXPECT_EQ(i, *view.Latest);
+        EXPECT_EQ(i > 1 ? i - 1 : 1, *view.Previous);
+
+        buffer.EndRead();
+    }
+}
+
+TEST(SnapshotTripleBufferTests, WriteWhileReading_PublishedAtEndRead)
+{
+    SnapshotTripleBuffer<int> buffer(0);
+
+    Write(buffer, 1);
+    Write(buffer, 2);
+
+    auto const view = buffer.BeginRead();
+
+    // The writer gets a slot the reader is not reading
+    int & slot = buffer.BeginWrite();
+    EXPECT_NE(view.Previous, &slot);
+    EXPECT_NE(view.Latest, &slot);
+    slot = 3;
+    buffer.EndWrite();
+
+    // Not published yet
+    EXPECT_EQ(1, *view.Previous);
+    EXPECT_EQ(2, *view.Latest);
+
+    buffer.EndRead();
+
+    auto const view2 = buffer.BeginRead();
+
+    EXPECT_EQ(2, *view2.Previous);
+    EXPECT_EQ(3, *view2.Latest);
+
+    buffer.EndRead();
+}
+
+TEST(SnapshotTripleBufferTests, WritesWhileReading_OnlyLastOnePublished)
+{
+    SnapshotTripleBuffer<int> buffer(0);
+
+    Write(buffer, 1);
+    Write(buffer, 2);
+
+    buffer.BeginRead();
+
+    Write(buffer, 3);
+    Write(buffer, 4);
+
+    buffer.EndRead();
+
+    auto const view = buffer.BeginRead();
+
+    EXPECT_EQ(2, *view.Previous);
+    EXPECT_EQ(4, *view.Latest);
+
+    buffer.EndRead();
+}
+
+TEST(SnapshotTripleBufferTests, ReadEndsWhileWriting_PendingWriteDropped)
+{
+    SnapshotTripleBuffer<int> buffer(0);
+
+    Write(buffer, 1);
+    Write(buffer, 2);
+
+    buffer.BeginRead();
+
+    Write(buffer, 3);
+
+    // Overwriting the pending snapshot
+    int & slot = buffer.BeginWrite();
+
+    buffer.EndRead();
+
+    auto const view = buffer.BeginRead();
+
+    // Still the same ones
+    EXPECT_EQ(1, *view.Previous);
+    EXPECT_EQ(2, *view.Latest);
+
+    EXPECT_NE(view.Previous, &slot);
+    EXPECT_NE(view.Latest, &slot);
+
+    slot = 4;
+    buffer.EndWrite();
+
+    buffer.EndRead();
+
+    auto const view2 = buffer.BeginRead();
+
+    EXPECT_EQ(2, *view2.Previous);
+    EXPECT_EQ(4, *view2.Latest);
+
+    buffer.EndRead();
+}
+
+TEST(SnapshotTripleBufferTests, ConcurrentWriterAndReader)
+{
+    // Each snapshot is a run of identical values, which a torn read would break
+    SnapshotTripleBuffer<std::vector<int>> buffer(size_t(1024), 0);
+
+    std::atomic<bool> isDone(false);
+
+    std::thread writer(
+        [&buffer, &isDone]()
+        {
+            for (int i = 1; i <= 20000; ++i)
+            {
+                auto & slot = buffer.BeginWrite();
+                std::fill(slot.begin(), slot.end(), i);
+                buffer.EndWrite();
+            }
+
+            isDone = true;
+        });
+
+    int lastLatest = 0;
+    bool isConsistent = true;
+    while (!isDone)
+    {
+        auto const view = buffer.BeginRead();
+
+        if (view.Latest != nullptr)
+        {
+            int const latest = view.Latest->front();
+            int const previous = view.Previous->front();
+
+            isConsistent = isConsistent
+                && std::all_of(view.Latest->cbegin(), view.Latest->cend(), [latest](int v) { return v == latest; })
+                && std::all_of(view.Previous->cbegin(), view.Previous->cend(), [previous](int v) { return v == previous; })
+                && previous <= latest
+                && latest >= lastLatest;
+
+            lastLatest = latest;
+        }
+
+        buffer.EndRead();
+    }
+
+    writer.join();
+
+    EXPECT_TRUE(isConsistent);
+
+    auto const view = buffer.BeginRead();
+    EXPECT_EQ(20000, view.Latest->front());
+    buffer.EndRead();
+}
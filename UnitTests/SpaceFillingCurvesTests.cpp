@@ -0,0 +1,63 @@
+#include <GameCore/SpaceFillingCurves.h>
+
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+TEST(SpaceFillingCurvesTests, MortonKey_Basic)
+{
+    EXPECT_EQ(0u, SpaceFillingCurves::MortonKey(0, 0));
+    EXPECT_EQ(1u, SpaceFillingCurves::MortonKey(1, 0));
+    EXPECT_EQ(2u, SpaceFillingCurves::MortonKey(0, 1));
+    EXPECT_EQ(3u, SpaceFillingCurves::MortonKey(1, 1));
+    EXPECT_EQ(4u, SpaceFillingCurves::MortonKey(2, 0));
+    EXPECT_EQ(0x55555555u, SpaceFillingCurves::MortonKey(0xffff, 0));
+    EXPECT_EQ(0xaaaaaaaau, SpaceFillingCurves::MortonKey(0, 0xffff));
+}
+
+TEST(SpaceFillingCurvesTests, HilbertKey_Order1)
+{
+    EXPECT_EQ(0u, SpaceFillingCurves::HilbertKey(0, 0, 1));
+    EXPECT_EQ(1u, SpaceFillingCurves::HilbertKey(0, 1, 1));
+    EXPECT_EQ(2u, SpaceFillingCurves::HilbertKey(1, 1, 1));
+    EXPECT_EQ(3u, SpaceFillingCurves::HilbertKey(1, 0, 1));
+}
+
+TEST(SpaceFillingCurvesTests, HilbertKey_IsBijectiveAndContinuous)
+{
+    int constexpr Order = 5;
+    std::uint32_t constexpr Size = 1u << Order;
+
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> keyToCoords(Size * Size, { Size, Size });
+
+    for (std::uint32_t x = 0; x < Size; ++x)
+    {
+        for (std::uint32_t y = 0; y < Size; ++y)
+        {
+            auto const key = SpaceFillingCurves::HilbertKey(x, y, Order);
+            ASSERT_LT(key, Size * Size);
+            EXPECT_EQ(Size, keyToCoords[key].first);
+            keyToCoords[key] = { x, y };
+        }
+    }
+
+    // Consecutive keys are adjacent
+    for (size_t k = 1; k < keyToCoords.size(); ++k)
+    {
+        int const dx = std::abs(static_cast<int>(keyToCoords[k].first) - static_cast<int>(keyToCoords[k - 1].first));
+        int const dy = std::abs(static_cast<int>(keyToCoords[k].second) - static_cast<int>(keyToCoords[k - 1].second));
+        EXPECT_EQ(1, dx + dy);
+    }
+}
+
+TEST(SpaceFillingCurvesTests, HilbertOrder)
+{
+    EXPECT_EQ(0, SpaceFillingCurves::HilbertOrder(0));
+    EXPECT_EQ(0, SpaceFillingCurves::HilbertOrder(1));
+    EXPECT_EQ(1, SpaceFillingCurves::HilbertOrder(2));
+    EXPECT_EQ(2, SpaceFillingCurves::HilbertOrder(3));
+    EXPECT_EQ(8, SpaceFillingCurves::HilbertOrder(256));
+    EXPECT_EQ(9, SpaceFillingCurves::HilbertOrder(257));
+}
@@ -1,5 +1,7 @@
 #include <GameCore/SysSpecifics.h>
 
+#include <thread>
+
 #include "gtest/gtest.h"
 
 TEST(SysSpecificsTests, CeilPowerOfTwo)
@@ -34,4 +36,33 @@ TEST(SysSpecificsTests, CeilSquarePowerOfTwo)
     EXPECT_EQ(ceil_square_power_of_two(63), 64);
     EXPECT_EQ(ceil_square_power_of_two(64), 64);
     EXPECT_EQ(ceil_square_power_of_two(65), 256);
-}
\ No newline at end of file
+}
+TEST(SysSpecificsTests, GetProcessResidentMemoryBytes)
+{
+    auto const residentMemory = GetProcessResidentMemoryBytes();
+
+#if defined(FS_OS_LINUX) || defined(FS_OS_MACOS) || defined(FS_OS_WINDOWS)
+    ASSERT_TRUE(residentMemory.has_value());
+    EXPECT_GT(*residentMemory, 0u);
+#else
+    EXPECT_FALSE(residentMemory.has_value());
+#endif
+}
+
+TEST(SysSpecificsTests, PinCurrentThreadToHardwareThread)
+{
+    bool result = false;
+    std::thread t(
+        [&result]()
+        {
+            result = PinCurrentThreadToHardwareThread(0);
+        });
+
+    t.join();
+
+#if defined(FS_OS_LINUX) || defined(FS_OS_WINDOWS)
+    EXPECT_TRUE(result);
+#else
+    EXPECT_FALSE(result);
+#endif
+}
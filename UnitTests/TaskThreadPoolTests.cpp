@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -90,4 +91,108 @@ TEST_P(TaskThreadPoolTests_FourRuns, Four_Runs)
     t.Run(tasks);
 
     ASSERT_TRUE(std::all_of(results.cbegin(), results.cend(), [](bool b) { return b; }));
-}
\ No newline at end of file
+}
+
+TEST(TaskThreadPoolTests, Parallelism)
+{
+    TaskThreadPool t1(1);
+    EXPECT_EQ(t1.GetParallelism(), 1u);
+
+    TaskThreadPool t4(4);
+    EXPECT_EQ(t4.GetParallelism(), 4u);
+}
+
+TEST(TaskThreadPoolTests, Statistics_DisabledByDefault)
+{
+    TaskThreadPool t(4);
+    EXPECT_FALSE(t.IsStatisticsEnabled());
+
+    std::vector<TaskThreadPool::Task> tasks(7, []() {});
+    t.Run(tasks);
+
+    EXPECT_EQ(t.GetStatistics().TaskCount, 0u);
+    EXPECT_EQ(t.GetStatistics().TaskBusyDuration.count(), 0);
+}
+
+TEST(TaskThreadPoolTests, Statistics_CountsTasks)
+{
+    TaskThreadPool t(4);
+    t.SetStatisticsEnabled(true);
+    EXPECT_EQ(t.GetStatistics().TaskCount, 0u);
+
+    std::vector<TaskThreadPool::Task> tasks(7, []() {});
+    t.Run(tasks);
+    t.Run(tasks);
+
+    auto const statistics = t.GetStatistics();
+    EXPECT_EQ(statistics.TaskCount, 14u);
+    EXPECT_GE(statistics.TaskBusyDuration.count(), 0);
+}
+
+TEST(TaskThreadPoolTests, Reconfigure)
+{
+    TaskThreadPool t(2);
+
+    t.Reconfigure(4, false);
+    EXPECT_EQ(t.GetParallelism(), 4u);
+
+    std::vector<int> results(10, 0);
+    std::vector<TaskThreadPool::Task> tasks;
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        tasks.emplace_back(
+            [&results, i]()
+            {
+                results[i] = 1;
+            });
+    }
+
+    t.Run(tasks);
+
+    EXPECT_TRUE(std::all_of(results.cbegin(), results.cend(), [](int r) { return r == 1; }));
+
+    t.Reconfigure(1, true);
+    EXPECT_EQ(t.GetParallelism(), 1u);
+    EXPECT_TRUE(t.GetDoPinThreads());
+
+    std::fill(results.begin(), results.end(), 0);
+    t.Run(tasks);
+
+    EXPECT_TRUE(std::all_of(results.cbegin(), results.cend(), [](int r) { return r == 1; }));
+}
+
+TEST(TaskThreadPoolTests, ConcurrentCallers)
+{
+    TaskThreadPool t(4);
+    t.SetStatisticsEnabled(true);
+
+    size_t constexpr TaskCount = 16;
+    size_t constexpr Iterations = 200;
+
+    auto const runBatches = [&t]()
+    {
+        for (size_t i = 0; i < Iterations; ++i)
+        {
+            std::vector<int> results(TaskCount, 0);
+            std::vector<TaskThreadPool::Task> tasks;
+            for (size_t j = 0; j < TaskCount; ++j)
+            {
+                tasks.emplace_back(
+                    [&results, j]()
+                    {
+                        results[j] = 1;
+                    });
+            }
+
+            t.Run(tasks);
+
+            ASSERT_TRUE(std::all_of(results.cbegin(), results.cend(), [](int r) { return r == 1; }));
+        }
+    };
+
+    std::thread otherCaller(runBatches);
+    runBatches();
+    otherCaller.join();
+
+    EXPECT_EQ(t.GetStatistics().TaskCount, 2 * Iterations * TaskCount);
+}
@@ -2,6 +2,9 @@
 
 #include "gtest/gtest.h"
 
+#include <random>
+#include <vector>
+
 TEST(TemporallyCoherentPriorityQueueTest, Empty)
 {
     TemporallyCoherentPriorityQueue<float> q(10);
@@ -414,6 +417,147 @@ TEST(TemporallyCoherentPriorityQueueTest, Remove_Largest)
     EXPECT_TRUE(q.verify_heap());
 }
 
+TEST(TemporallyCoherentPriorityQueueTest, Remove_Bottom)
+{
+    TemporallyCoherentPriorityQueue<float> q(10);
+
+    q.add_or_update(5, 1.0f);
+    q.add_or_update(8, 3.0f);
+    q.add_or_update(3, 6.0f);
+
+    ASSERT_EQ(3u, q.size());
+
+    // Largest one was inserted last, and sits at the bottom
+    q.remove_if_in(3);
+
+    EXPECT_EQ(2u, q.size());
+    EXPECT_TRUE(q.verify_heap());
+
+    // Re-add
+    q.add_or_update(3, 2.0f);
+
+    EXPECT_EQ(3u, q.size());
+    EXPECT_TRUE(q.verify_heap());
+
+    auto i = q.pop();
+    EXPECT_EQ(5u, i);
+
+    i = q.pop();
+    EXPECT_EQ(3u, i);
+
+    i = q.pop();
+    EXPECT_EQ(8u, i);
+
+    EXPECT_TRUE(q.empty());
+    EXPECT_TRUE(q.verify_heap());
+}
+
+TEST(TemporallyCoherentPriorityQueueTest, Remove_OneElement_AndReAdd)
+{
+    TemporallyCoherentPriorityQueue<float> q(10);
+
+    q.add_or_update(5, 6.0f);
+
+    q.remove_if_in(5);
+
+    EXPECT_EQ(0u, q.size());
+
+    q.add_or_update(5, 4.0f);
+
+    EXPECT_EQ(1u, q.size());
+    EXPECT_TRUE(q.verify_heap());
+
+    q.remove_if_in(5);
+
+    EXPECT_TRUE(q.empty());
+    EXPECT_TRUE(q.verify_heap());
+}
+
+TEST(TemporallyCoherentPriorityQueueTest, Pop_LastElement_AndReAdd)
+{
+    TemporallyCoherentPriorityQueue<float> q(10);
+
+    q.add_or_update(5, 6.0f);
+
+    auto i = q.pop();
+    EXPECT_EQ(5u, i);
+    EXPECT_TRUE(q.empty());
+
+    q.add_or_update(5, 4.0f);
+    q.add_or_update(7, 2.0f);
+
+    EXPECT_EQ(2u, q.size());
+    EXPECT_TRUE(q.verify_heap());
+
+    i = q.pop();
+    EXPECT_EQ(7u, i);
+
+    i = q.pop();
+    EXPECT_EQ(5u, i);
+
+    EXPECT_TRUE(q.empty());
+    EXPECT_TRUE(q.verify_heap());
+}
+
+TEST(TemporallyCoherentPriorityQueueTest, RemoveAndReAdd_Random)
+{
+    TemporallyCoherentPriorityQueue<float> q(50);
+    std::vector<bool> isIn(50, false);
+    size_t expectedSize = 0;
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<ElementIndex> elementDistribution(0, 49);
+    std::uniform_real_distribution<float> priorityDistribution(0.0f, 100.0f);
+
+    for (int step = 0; step < 5000; ++step)
+    {
+        ElementIndex const e = elementDistribution(rng);
+
+        switch (step % 3)
+        {
+            case 0:
+            {
+                q.add_or_update(e, priorityDistribution(rng));
+                if (!isIn[e])
+                {
+                    isIn[e] = true;
+                    ++expectedSize;
+                }
+
+                break;
+            }
+
+            case 1:
+            {
+                q.remove_if_in(e);
+                if (isIn[e])
+                {
+                    isIn[e] = false;
+                    --expectedSize;
+                }
+
+                break;
+            }
+
+            default:
+            {
+                if (!q.empty())
+                {
+                    auto const popped = q.pop();
+                    ASSERT_TRUE(isIn[popped]);
+                    isIn[popped] = false;
+                    --expectedSize;
+                }
+
+                break;
+            }
+        }
+
+        ASSERT_EQ(expectedSize, q.size());
+        ASSERT_TRUE(q.verify_heap());
+    }
+}
+
 TEST(TemporallyCoherentPriorityQueueTest, Populate_Asymmetrically)
 {
     TemporallyCoherentPriorityQueue<float> q(100);
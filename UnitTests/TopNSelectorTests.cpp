@@ -0,0 +1,177 @@
+#include <GameCore/TopNSelector.h>
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace /* anonymous */ {
+
+    template<typename T>
+    std::vector<ElementIndex> MakeElementVector(T const & selector)
+    {
+        std::vector<ElementIndex> r;
+        for (size_t i = 0; i < selector.size(); ++i)
+            r.push_back(selector[i].Element);
+
+        return r;
+    }
+
+}
+
+TEST(TopNSelectorTests, Empty)
+{
+    TopNSelector<float> s(10);
+
+    s.finalize();
+
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(0u, s.size());
+}
+
+TEST(TopNSelectorTests, LessThanMax_SortedByDecreasingPriority)
+{
+    TopNSelector<float> s(10);
+
+    s.emplace(5, 6.0f);
+    s.emplace(8, 3.0f);
+    s.emplace(2, 9.0f);
+
+    s.finalize();
+
+    ASSERT_EQ(3u, s.size());
+    EXPECT_EQ(std::vector<ElementIndex>({ 2, 5, 8 }), MakeElementVector(s));
+    EXPECT_EQ(9.0f, s[0].Priority);
+    EXPECT_EQ(6.0f, s[1].Priority);
+    EXPECT_EQ(3.0f, s[2].Priority);
+}
+
+TEST(TopNSelectorTests, MoreThanMax)
+{
+    TopNSelector<float> s(4);
+
+    s.emplace(1, 1.0f);
+    s.emplace(2, 7.0f);
+    s.emplace(3, 2.0f);
+    s.emplace(4, 8.0f);
+    s.emplace(5, -3.0f);
+    s.emplace(6, 5.0f);
+    s.emplace(7, 6.0f);
+
+    s.finalize();
+
+    EXPECT_EQ(std::vector<ElementIndex>({ 4, 2, 7, 6 }), MakeElementVector(s));
+}
+
+TEST(TopNSelectorTests, ZeroMaxSize)
+{
+    TopNSelector<float> s(0);
+
+    s.emplace(1, 1.0f);
+    s.emplace(2, 7.0f);
+
+    s.finalize();
+
+    EXPECT_TRUE(s.empty());
+}
+
+TEST(TopNSelectorTests, Clear_WithSmallerMaxSize)
+{
+    TopNSelector<float> s(10);
+
+    for (ElementIndex e = 0; e < 10; ++e)
+        s.emplace(e, static_cast<float>(e));
+
+    s.clear(2);
+
+    EXPECT_TRUE(s.empty());
+    EXPECT_EQ(2u, s.max_size());
+
+    s.emplace(20, 0.5f);
+    s.emplace(21, 1.5f);
+    s.emplace(22, 1.0f);
+
+    s.finalize();
+
+    EXPECT_EQ(std::vector<ElementIndex>({ 21, 22 }), MakeElementVector(s));
+}
+
+TEST(TopNSelectorTests, IntegralPriorities)
+{
+    TopNSelector<int> s(2);
+
+    s.emplace(1, std::numeric_limits<int>::lowest() + 1);
+    s.emplace(2, -5);
+    s.emplace(3, 10);
+
+    s.finalize();
+
+    EXPECT_EQ(std::vector<ElementIndex>({ 3, 2 }), MakeElementVector(s));
+}
+
+TEST(TopNSelectorTests, ManyElements_MatchesSort)
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> priorityDistribution(-1000.0f, 1000.0f);
+
+    std::vector<float> priorities;
+    for (size_t i = 0; i < 5000; ++i)
+        priorities.push_back(priorityDistribution(rng));
+
+    TopNSelector<float> s(10);
+    for (ElementIndex e = 0; e < priorities.size(); ++e)
+        s.emplace(e, priorities[e]);
+
+    s.finalize();
+
+    std::vector<ElementIndex> expected(priorities.size());
+    for (ElementIndex e = 0; e < expected.size(); ++e)
+        expected[e] = e;
+    std::sort(
+        expected.begin(),
+        expected.end(),
+        [&priorities](ElementIndex e1, ElementIndex e2)
+        {
+            return priorities[e1] > priorities[e2];
+        });
+    expected.resize(10);
+
+    EXPECT_EQ(expected, MakeElementVector(s));
+}
+
+TEST(TopNSelectorTests, Merge_MatchesSingleSelector)
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> priorityDistribution(0.0f, 1.0f);
+
+    std::vector<float> priorities;
+    for (size_t i = 0; i < 3000; ++i)
+        priorities.push_back(priorityDistribution(rng));
+
+    TopNSelector<float> single(8);
+    for (ElementIndex e = 0; e < priorities.size(); ++e)
+        single.emplace(e, priorities[e]);
+
+    single.finalize();
+
+    // Three disjoint ranges, one of which is finalized before merging
+    TopNSelector<float> s1(8);
+    TopNSelector<float> s2(8);
+    TopNSelector<float> s3(8);
+    for (ElementIndex e = 0; e < 1000; ++e)
+        s1.emplace(e, priorities[e]);
+    for (ElementIndex e = 1000; e < 1010; ++e)
+        s2.emplace(e, priorities[e]);
+    for (ElementIndex e = 1010; e < priorities.size(); ++e)
+        s3.emplace(e, priorities[e]);
+
+    s3.finalize();
+
+    s1.merge(s2);
+    s1.merge(s3);
+    s1.finalize();
+
+    EXPECT_EQ(MakeElementVector(single), MakeElementVector(s1));
+}